@@ -0,0 +1,101 @@
+// acpi_index.c - One-pass ACPI table walk with checksums and a signature hash
+
+#include <Uefi.h>
+#include <Library/BaseMemoryLib.h>
+#include <emmintrin.h>
+#include "acpi_index.h"
+
+// Tables larger than this are treated as corrupt rather than summed.
+#define ACPI_TABLE_MAX_LENGTH   (16 * 1024 * 1024)
+
+// psadbw against zero adds 8 bytes into each 64-bit lane, 16 bytes per
+// instruction; two accumulators keep both load ports busy. SSE2 is part of
+// the x64 UEFI baseline, AVX is not enabled by firmware.
+UINT8 AcpiIndex_Checksum(const VOID *Data, UINTN Length) {
+    const UINT8 *P = (const UINT8 *)Data;
+    __m128i Zero = _mm_setzero_si128(), A = Zero, B = Zero;
+    UINTN i = 0;
+    for (; i + 32 <= Length; i += 32) {
+        A = _mm_add_epi64(A, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(P + i)), Zero));
+        B = _mm_add_epi64(B, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(P + i + 16)), Zero));
+    }
+    if (i + 16 <= Length) {
+        A = _mm_add_epi64(A, _mm_sad_epu8(_mm_loadu_si128((const __m128i *)(P + i)), Zero));
+        i += 16;
+    }
+    A = _mm_add_epi64(A, B);
+    UINT64 Sum = (UINT64)_mm_cvtsi128_si64(A) + (UINT64)_mm_cvtsi128_si64(_mm_unpackhi_epi64(A, A));
+    for (; i < Length; ++i) Sum += P[i];
+    return (UINT8)Sum;
+}
+
+static UINTN SlotOf(UINT32 Signature) {
+    return (UINTN)((Signature * 0x9E3779B1u) >> 24) & (ACPI_INDEX_SLOTS - 1);
+}
+
+static VOID AddTable(ACPI_INDEX *Index, UINT64 Address) {
+    const ACPI_SDT_HEADER *Hdr = (const ACPI_SDT_HEADER *)(UINTN)Address;
+    if (Hdr == NULL || Index->Count == ACPI_INDEX_MAX_TABLES) return;
+
+    UINT16 Id = (UINT16)Index->Count++;
+    ACPI_TABLE_ENTRY *E = &Index->Table[Id];
+    E->Address = Address;
+    E->Signature = Hdr->Signature;
+    E->Length = Hdr->Length;
+    E->Next = ACPI_INDEX_NONE;
+    E->ChecksumOk = Hdr->Length >= sizeof(ACPI_SDT_HEADER) && Hdr->Length <= ACPI_TABLE_MAX_LENGTH &&
+                    AcpiIndex_Checksum(Hdr, Hdr->Length) == 0;
+    if (E->ChecksumOk) Index->ChecksumBytes += Hdr->Length;
+    else Index->BadChecksums++;
+
+    for (UINTN s = SlotOf(E->Signature); ; s = (s + 1) & (ACPI_INDEX_SLOTS - 1)) {
+        UINT16 Head = Index->Slot[s];
+        if (Head == ACPI_INDEX_NONE) { Index->Slot[s] = Id; return; }
+        if (Index->Table[Head].Signature != E->Signature) continue;
+        while (Index->Table[Head].Next != ACPI_INDEX_NONE) Head = Index->Table[Head].Next;
+        Index->Table[Head].Next = Id;
+        return;
+    }
+}
+
+EFI_STATUS AcpiIndex_Build(ACPI_INDEX *Index, const ACPI_SDT_HEADER *Root) {
+    ZeroMem(Index, OFFSET_OF(ACPI_INDEX, Table));
+    SetMem(Index->Slot, sizeof(Index->Slot), 0xFF);
+    if (Root == NULL) return EFI_NOT_FOUND;
+
+    UINTN EntrySize;
+    if (Root->Signature == SIGNATURE_32('X','S','D','T')) EntrySize = sizeof(UINT64);
+    else if (Root->Signature == SIGNATURE_32('R','S','D','T')) EntrySize = sizeof(UINT32);
+    else return EFI_VOLUME_CORRUPTED;
+    if (Root->Length < sizeof(ACPI_SDT_HEADER)) return EFI_VOLUME_CORRUPTED;
+
+    UINTN Count = (Root->Length - sizeof(ACPI_SDT_HEADER)) / EntrySize;
+    const UINT8 *Ptr = (const UINT8 *)Root + sizeof(ACPI_SDT_HEADER);
+    for (UINTN i = 0; i < Count; ++i) {
+        UINT64 Address = 0;
+        CopyMem(&Address, Ptr + i * EntrySize, EntrySize);     // XSDT entries are only 4-byte aligned
+        AddTable(Index, Address);
+    }
+
+    // The DSDT hangs off the FADT rather than the root table.
+    const ACPI_TABLE_ENTRY *Fadt = AcpiIndex_Find(Index, SIGNATURE_32('F','A','C','P'));
+    if (Fadt && Fadt->ChecksumOk) {
+        const ACPI_FADT *F = (const ACPI_FADT *)(UINTN)Fadt->Address;
+        UINT64 Dsdt = F->Dsdt;
+        if (Fadt->Length >= OFFSET_OF(ACPI_FADT, XDsdt) + sizeof(UINT64) && F->XDsdt) Dsdt = F->XDsdt;
+        AddTable(Index, Dsdt);
+    }
+    return EFI_SUCCESS;
+}
+
+const ACPI_TABLE_ENTRY *AcpiIndex_Find(const ACPI_INDEX *Index, UINT32 Signature) {
+    for (UINTN s = SlotOf(Signature); ; s = (s + 1) & (ACPI_INDEX_SLOTS - 1)) {
+        UINT16 Head = Index->Slot[s];
+        if (Head == ACPI_INDEX_NONE) return NULL;
+        if (Index->Table[Head].Signature == Signature) return &Index->Table[Head];
+    }
+}
+
+const ACPI_TABLE_ENTRY *AcpiIndex_Next(const ACPI_INDEX *Index, const ACPI_TABLE_ENTRY *Entry) {
+    return Entry->Next == ACPI_INDEX_NONE ? NULL : &Index->Table[Entry->Next];
+}
@@ -0,0 +1,70 @@
+// boot_arena.c - Bump allocator for the loader's temporary buffers
+
+#include <Uefi.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include "boot_arena.h"
+
+EFI_STATUS BootArena_Grow(BOOT_ARENA *A, UINTN MinSize) {
+    EFI_PHYSICAL_ADDRESS Base;
+    UINTN Pages = EFI_SIZE_TO_PAGES(MinSize);
+    if (Pages < BOOT_ARENA_CHUNK_PAGES) Pages = BOOT_ARENA_CHUNK_PAGES;
+    if (A->ChunkCount == BOOT_ARENA_MAX_CHUNKS) return EFI_OUT_OF_RESOURCES;
+    A->FirmwareCalls++;
+    EFI_STATUS Status = gBS->AllocatePages(AllocateAnyPages, EfiBootServicesData, Pages, &Base);
+    if (EFI_ERROR(Status)) return Status;
+    BOOT_ARENA_CHUNK *Ch = &A->Chunk[A->ChunkCount++];
+    Ch->Base = (UINT8*)(UINTN)Base;
+    Ch->Size = EFI_PAGES_TO_SIZE(Pages);
+    Ch->Used = 0;
+    return EFI_SUCCESS;
+}
+
+VOID *BootArena_Alloc(BOOT_ARENA *A, UINTN Size, UINTN Align) {
+    for (UINTN c = A->Current; ; ++c) {
+        if (c == A->ChunkCount && EFI_ERROR(BootArena_Grow(A, Size))) return NULL;
+        BOOT_ARENA_CHUNK *Ch = &A->Chunk[c];
+        UINTN Off = ALIGN_VALUE(Ch->Used, Align);
+        if (Off > Ch->Size || Size > Ch->Size - Off) continue;
+
+        A->Current = c;
+        A->LastUsed = Ch->Used;
+        A->Last = Ch->Base + Off;
+        Ch->Used = Off + Size;
+        A->Allocs++;
+
+        UINTN Live = 0;
+        for (UINTN i = 0; i <= c; ++i) Live += A->Chunk[i].Used;
+        if (Live > A->HighWater) A->HighWater = Live;
+        return A->Last;
+    }
+}
+
+VOID BootArena_Pop(BOOT_ARENA *A, VOID *Ptr) {
+    if (Ptr == NULL || Ptr != A->Last) return;
+    A->Chunk[A->Current].Used = A->LastUsed;
+    A->Last = NULL;
+}
+
+EFI_STATUS BootArena_AllocHandoff(BOOT_ARENA *A, EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType,
+                                  UINTN Pages, EFI_PHYSICAL_ADDRESS *Memory) {
+    if (A->HandoffCount == BOOT_ARENA_MAX_HANDOFF) return EFI_OUT_OF_RESOURCES;
+    A->FirmwareCalls++;
+    EFI_STATUS Status = gBS->AllocatePages(Type, MemoryType, Pages, Memory);
+    if (EFI_ERROR(Status)) return Status;
+    A->Handoff[A->HandoffCount] = *Memory;
+    A->HandoffPages[A->HandoffCount++] = Pages;
+    return EFI_SUCCESS;
+}
+
+VOID BootArena_Teardown(BOOT_ARENA *A, BOOLEAN FirmwareUp, BOOLEAN KeepHandoff) {
+    if (FirmwareUp) {
+        for (UINTN c = 0; c < A->ChunkCount; ++c)
+            gBS->FreePages((EFI_PHYSICAL_ADDRESS)(UINTN)A->Chunk[c].Base, EFI_SIZE_TO_PAGES(A->Chunk[c].Size));
+        for (UINTN h = 0; !KeepHandoff && h < A->HandoffCount; ++h)
+            gBS->FreePages(A->Handoff[h], A->HandoffPages[h]);
+    }
+    A->ChunkCount = 0;
+    A->Current = 0;
+    A->Last = NULL;
+    A->HandoffCount = 0;
+}
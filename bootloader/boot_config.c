@@ -0,0 +1,107 @@
+// boot_config.c - config.ini parser and the config.bin cache checks
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include "boot_config.h"
+
+static BOOLEAN IsBlank(CHAR8 C) { return C == ' ' || C == '\t'; }
+
+// Strips spaces and tabs from both ends of [Start, End) in place.
+static CHAR8 *Trim(CHAR8 *Start, CHAR8 *End) {
+    while (Start < End && IsBlank(*Start)) Start++;
+    while (End > Start && IsBlank(End[-1])) End--;
+    *End = 0;
+    return Start;
+}
+
+// Digits only, at most 255.
+static BOOLEAN ParseByte(const CHAR8 *Val, UINT8 *Out) {
+    UINTN N = 0;
+    if (*Val == 0) return FALSE;
+    for (const CHAR8 *P = Val; *P; ++P) {
+        if (*P < '0' || *P > '9') return FALSE;
+        N = N * 10 + (UINTN)(*P - '0');
+        if (N > 0xFF) return FALSE;
+    }
+    *Out = (UINT8)N;
+    return TRUE;
+}
+
+static VOID SetByte(UINT8 *Out, const CHAR8 *Val) { ParseByte(Val, Out); }
+
+static VOID SetFlag(BOOLEAN *Out, const CHAR8 *Val) {
+    UINT8 N;
+    if (ParseByte(Val, &N)) *Out = (BOOLEAN)(N != 0);
+}
+
+// The whole array is replaced so nothing past the terminator reaches
+// config.bin.
+static VOID SetPath(CHAR16 *Out, const CHAR8 *Val) {
+    CHAR16 Tmp[BOOT_CONFIG_PATH_MAX];
+    if (*Val == 0) return;
+    ZeroMem(Tmp, sizeof(Tmp));
+    if (RETURN_ERROR(AsciiStrToUnicodeStrS(Val, Tmp, BOOT_CONFIG_PATH_MAX))) return;
+    CopyMem(Out, Tmp, sizeof(Tmp));
+}
+
+VOID BootConfig_Parse(BOOT_CONFIG_SETTINGS *S, CHAR8 *Buf) {
+    CHAR8 *Line = Buf;
+    while (*Line) {
+        CHAR8 *End = Line;
+        while (*End && *End != '\n' && *End != '\r') End++;
+        CHAR8 *Next = End;
+        if (*Next == '\r') Next++;
+        if (*Next == '\n') Next++;
+
+        CHAR8 *Eq = Line;
+        while (Eq < End && *Eq != '=') Eq++;
+        CHAR8 *Key = Trim(Line, Eq < End ? Eq : End);
+        if (Eq < End && *Key != '#' && *Key != ';' && *Key != '[') {
+            CHAR8 *Val = Trim(Eq + 1, End);
+            if (!AsciiStriCmp(Key, "kernel_path")) SetPath(S->KernelPath, Val);
+            else if (!AsciiStriCmp(Key, "signature_path")) SetPath(S->SignaturePath, Val);
+            else if (!AsciiStriCmp(Key, "trust_threshold")) SetByte(&S->TrustThreshold, Val);
+            else if (!AsciiStriCmp(Key, "fallback_enabled")) SetFlag(&S->Config.FallbackEnabled, Val);
+            else if (!AsciiStriCmp(Key, "boot_delay")) SetByte(&S->Config.BootDelay, Val);
+            else if (!AsciiStriCmp(Key, "entropy_required")) SetFlag(&S->Config.EntropyRequired, Val);
+            else if (!AsciiStriCmp(Key, "quiet_boot")) SetFlag(&S->Config.QuietBoot, Val);
+            else if (!AsciiStriCmp(Key, "profile_regress_pct")) SetByte(&S->Config.ProfileRegressPct, Val);
+        }
+        Line = Next;
+    }
+}
+
+static VOID CacheDigest(const BOOT_CONFIG_CACHE *C, UINT8 *Digest) {
+    SHA256_CTX Sha;
+    sha256_init(&Sha);
+    sha256_update(&Sha, (const UINT8*)C, OFFSET_OF(BOOT_CONFIG_CACHE, Digest));
+    sha256_final(&Sha, Digest);
+}
+
+VOID BootConfig_CacheSeal(BOOT_CONFIG_CACHE *C, const BOOT_CONFIG_SETTINGS *Settings,
+                          UINT64 IniSize, const EFI_TIME *IniTime, const UINT8 *IniHash) {
+    ZeroMem(C, sizeof(*C));
+    C->Magic = BOOT_CONFIG_CACHE_MAGIC;
+    C->Version = BOOT_CONFIG_CACHE_VERSION;
+    C->IniSize = IniSize;
+    C->IniTime = *IniTime;
+    CopyMem(C->IniHash, IniHash, SHA256_DIGEST_LENGTH);
+    C->Settings = *Settings;
+    CacheDigest(C, C->Digest);
+}
+
+BOOLEAN BootConfig_CacheValid(const BOOT_CONFIG_CACHE *C, UINTN Size, UINT64 IniSize, const EFI_TIME *IniTime) {
+    STATIC CONST EFI_TIME NoTime;
+    UINT8 Digest[SHA256_DIGEST_LENGTH];
+
+    if (CompareMem(IniTime, &NoTime, sizeof(EFI_TIME)) == 0) return FALSE;
+    if (Size != sizeof(*C)) return FALSE;
+    if (C->Magic != BOOT_CONFIG_CACHE_MAGIC || C->Version != BOOT_CONFIG_CACHE_VERSION ||
+        C->IniSize != IniSize || CompareMem(&C->IniTime, IniTime, sizeof(EFI_TIME)) != 0)
+        return FALSE;
+    CacheDigest(C, Digest);
+    if (CompareMem(Digest, C->Digest, sizeof(Digest)) != 0) return FALSE;
+    return C->Settings.KernelPath[BOOT_CONFIG_PATH_MAX - 1] == 0 &&
+           C->Settings.SignaturePath[BOOT_CONFIG_PATH_MAX - 1] == 0;
+}
@@ -0,0 +1,182 @@
+// boot_gfx.c - Back buffer, glyph atlas and dirty-rectangle presents for the boot UI
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include "boot_gfx.h"
+
+static const UINT8 font8x8_basic[128][8] = {
+#include "font8x8_basic.inc"
+
+// Each font bit expanded to a whole pixel of ones, so a glyph row is drawn
+// as Dst = (Dst & ~Mask) | (Color & Mask) without testing bits.
+static UINT32 gGlyphMask[128][64];
+static BOOLEAN gGlyphAtlasReady;
+
+static VOID GfxBuildAtlas(VOID) {
+    for (UINTN c = 0; c < 128; ++c)
+        for (UINTN y = 0; y < 8; ++y)
+            for (UINTN x = 0; x < 8; ++x)
+                gGlyphMask[c][y * 8 + x] = (font8x8_basic[c][y] & (0x80 >> x)) ? 0xFFFFFFFF : 0;
+    gGlyphAtlasReady = TRUE;
+}
+
+static UINT32 GfxPixel(EFI_GRAPHICS_OUTPUT_BLT_PIXEL C) {
+    return (UINT32)C.Blue | ((UINT32)C.Green << 8) | ((UINT32)C.Red << 16) | ((UINT32)C.Reserved << 24);
+}
+
+static UINT64 GfxArea(const BOOT_GFX_RECT *R) {
+    return (UINT64)(R->X1 - R->X0) * (R->Y1 - R->Y0);
+}
+
+static VOID GfxUnion(BOOT_GFX_RECT *D, const BOOT_GFX_RECT *R) {
+    if (R->X0 < D->X0) D->X0 = R->X0;
+    if (R->Y0 < D->Y0) D->Y0 = R->Y0;
+    if (R->X1 > D->X1) D->X1 = R->X1;
+    if (R->Y1 > D->Y1) D->Y1 = R->Y1;
+}
+
+static BOOLEAN GfxTouches(const BOOT_GFX_RECT *A, const BOOT_GFX_RECT *B) {
+    return A->X0 <= B->X1 && B->X0 <= A->X1 && A->Y0 <= B->Y1 && B->Y0 <= A->Y1;
+}
+
+// Folds every other dirty rectangle that now touches Dirty[i] into it.
+static VOID GfxCoalesce(BOOT_GFX *G, UINT32 i) {
+    for (UINT32 j = 0; j < G->DirtyCount; ) {
+        if (j == i || !GfxTouches(&G->Dirty[i], &G->Dirty[j])) { ++j; continue; }
+        GfxUnion(&G->Dirty[i], &G->Dirty[j]);
+        G->Dirty[j] = G->Dirty[--G->DirtyCount];
+        if (i == G->DirtyCount) i = j;
+        j = 0;
+    }
+}
+
+// A rectangle that touches a dirty one is folded into it, so the pieces of
+// one shape end up as one Blt. A full list absorbs it where the area grows
+// least.
+static VOID GfxMarkDirty(BOOT_GFX *G, UINT32 X0, UINT32 Y0, UINT32 X1, UINT32 Y1) {
+    BOOT_GFX_RECT R = { X0, Y0, X1, Y1 };
+    if (X0 >= X1 || Y0 >= Y1) return;
+    for (UINT32 i = 0; i < G->DirtyCount; ++i) {
+        if (!GfxTouches(&R, &G->Dirty[i])) continue;
+        GfxUnion(&G->Dirty[i], &R);
+        GfxCoalesce(G, i);
+        return;
+    }
+    if (G->DirtyCount < BOOT_GFX_MAX_DIRTY) { G->Dirty[G->DirtyCount++] = R; return; }
+
+    UINT32 Best = 0;
+    UINT64 BestGrowth = (UINT64)-1;
+    for (UINT32 i = 0; i < G->DirtyCount; ++i) {
+        BOOT_GFX_RECT U = G->Dirty[i];
+        GfxUnion(&U, &R);
+        UINT64 Growth = GfxArea(&U) - GfxArea(&G->Dirty[i]);
+        if (Growth < BestGrowth) { BestGrowth = Growth; Best = i; }
+    }
+    GfxUnion(&G->Dirty[Best], &R);
+    GfxCoalesce(G, Best);
+}
+
+UINTN BootGfx_BufferSize(EFI_GRAPHICS_OUTPUT_PROTOCOL *Gop) {
+    return (UINTN)Gop->Mode->Info->HorizontalResolution * Gop->Mode->Info->VerticalResolution * sizeof(UINT32);
+}
+
+VOID BootGfx_Init(BOOT_GFX *G, EFI_GRAPHICS_OUTPUT_PROTOCOL *Gop, VOID *Buffer) {
+    if (!gGlyphAtlasReady) GfxBuildAtlas();
+    ZeroMem(G, sizeof(*G));
+    G->Gop = Gop;
+    G->Pixels = (UINT32*)Buffer;
+    G->Width = Gop->Mode->Info->HorizontalResolution;
+    G->Height = Gop->Mode->Info->VerticalResolution;
+    ZeroMem(Buffer, BootGfx_BufferSize(Gop));
+}
+
+VOID BootGfx_FillRect(BOOT_GFX *G, UINT32 X, UINT32 Y, UINT32 W, UINT32 H, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color) {
+    if (X >= G->Width || Y >= G->Height) return;
+    if (W > G->Width - X) W = G->Width - X;
+    if (H > G->Height - Y) H = G->Height - Y;
+    if (W == 0 || H == 0) return;
+    UINT32 P = GfxPixel(Color);
+    for (UINT32 Row = Y; Row < Y + H; ++Row)
+        SetMem32(G->Pixels + (UINTN)Row * G->Width + X, W * sizeof(UINT32), P);
+    GfxMarkDirty(G, X, Y, X + W, Y + H);
+}
+
+VOID BootGfx_DrawLine(BOOT_GFX *G, UINT32 X0, UINT32 Y0, UINT32 X1, UINT32 Y1, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color) {
+    INT64 X = X0, Y = Y0;
+    INT64 Dx = (X1 > X0) ? (INT64)(X1 - X0) : (INT64)(X0 - X1);
+    INT64 Dy = (Y1 > Y0) ? (INT64)(Y1 - Y0) : (INT64)(Y0 - Y1);
+    INT64 Sx = (X1 >= X0) ? 1 : -1, Sy = (Y1 >= Y0) ? 1 : -1;
+    INT64 Err = Dx - Dy;
+    UINT32 P = GfxPixel(Color);
+    UINT32 MinX = G->Width, MinY = G->Height, MaxX = 0, MaxY = 0;
+
+    for (;;) {
+        if (X < G->Width && Y < G->Height) {
+            G->Pixels[(UINTN)Y * G->Width + (UINTN)X] = P;
+            if (X < MinX) MinX = (UINT32)X;
+            if (Y < MinY) MinY = (UINT32)Y;
+            if (X + 1 > MaxX) MaxX = (UINT32)X + 1;
+            if (Y + 1 > MaxY) MaxY = (UINT32)Y + 1;
+        }
+        if (X == X1 && Y == Y1) break;
+        INT64 E2 = 2 * Err;
+        if (E2 > -Dy) { Err -= Dy; X += Sx; }
+        if (E2 < Dx)  { Err += Dx; Y += Sy; }
+    }
+    GfxMarkDirty(G, MinX, MinY, MaxX, MaxY);
+}
+
+// Glyphs that would cross the screen edge are dropped whole.
+VOID BootGfx_DrawText(BOOT_GFX *G, UINT32 X, UINT32 Y, CONST CHAR16 *Text, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color) {
+    UINT32 P = GfxPixel(Color), Left = X;
+    if (Y > G->Height || G->Height - Y < 8) return;
+    for (; *Text && G->Width >= 8 && X <= G->Width - 8; ++Text, X += 8) {
+        const UINT32 *Mask = gGlyphMask[(*Text < 128) ? *Text : '?'];
+        UINT32 *Row = G->Pixels + (UINTN)Y * G->Width + X;
+        for (UINTN gy = 0; gy < 8; ++gy, Row += G->Width, Mask += 8)
+            for (UINTN gx = 0; gx < 8; ++gx)
+                Row[gx] = (Row[gx] & ~Mask[gx]) | (P & Mask[gx]);
+    }
+    GfxMarkDirty(G, Left, Y, X, Y + 8);
+}
+
+EFI_STATUS BootGfx_Present(BOOT_GFX *G, BOOLEAN UseBlt) {
+    EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *Info = G->Gop->Mode->Info;
+    EFI_STATUS Status = EFI_SUCCESS;
+    if (G->DirtyCount == 0) return EFI_SUCCESS;
+
+    UINT64 Start = AsmReadTsc();
+    for (UINT32 i = 0; i < G->DirtyCount; ++i) {
+        const BOOT_GFX_RECT *R = &G->Dirty[i];
+        UINT32 W = R->X1 - R->X0, H = R->Y1 - R->Y0;
+        EFI_STATUS S = EFI_SUCCESS;
+
+        if (UseBlt) {
+            S = G->Gop->Blt(G->Gop, (EFI_GRAPHICS_OUTPUT_BLT_PIXEL*)G->Pixels, EfiBltBufferToVideo,
+                            R->X0, R->Y0, R->X0, R->Y0, W, H, G->Width * sizeof(UINT32));
+            G->BltCalls++;
+        } else if (Info->PixelFormat == PixelBlueGreenRedReserved8BitPerColor ||
+                   Info->PixelFormat == PixelRedGreenBlueReserved8BitPerColor) {
+            UINT32 *Fb = (UINT32*)(UINTN)G->Gop->Mode->FrameBufferBase;
+            for (UINT32 y = R->Y0; y < R->Y1; ++y) {
+                UINT32 *Dst = Fb + (UINTN)y * Info->PixelsPerScanLine + R->X0;
+                const UINT32 *Src = G->Pixels + (UINTN)y * G->Width + R->X0;
+                if (Info->PixelFormat == PixelBlueGreenRedReserved8BitPerColor) {
+                    CopyMem(Dst, Src, W * sizeof(UINT32));
+                } else {
+                    for (UINT32 x = 0; x < W; ++x)
+                        Dst[x] = (Src[x] & 0xFF00FF00) | ((Src[x] >> 16) & 0xFF) | ((Src[x] & 0xFF) << 16);
+                }
+            }
+        } else {
+            S = EFI_UNSUPPORTED;
+        }
+        if (EFI_ERROR(S)) Status = S;
+        else G->PixelsPresented += (UINT64)W * H;
+    }
+    G->DirtyCount = 0;
+    G->Frames++;
+    G->PresentTsc += AsmReadTsc() - Start;
+    return Status;
+}
@@ -0,0 +1,64 @@
+// boot_handoff.c - Handoff block writer for the loader and reader for the kernel
+
+#include <Uefi.h>
+#include <Library/BaseMemoryLib.h>
+#include "boot_handoff.h"
+
+VOID BootHandoff_Init(BOOT_HANDOFF *H, UINT32 Capacity) {
+    ZeroMem(H, sizeof(*H));
+    H->Magic = BOOT_HANDOFF_MAGIC;
+    H->Version = BOOT_HANDOFF_VERSION;
+    H->HeaderSize = (UINT16)ALIGN_VALUE(sizeof(*H), BOOT_HANDOFF_ALIGN);
+    H->Size = H->HeaderSize;
+    H->Capacity = Capacity;
+}
+
+VOID *BootHandoff_Add(BOOT_HANDOFF *H, UINT16 Type, UINT16 Version, UINT32 Length) {
+    UINT64 Need = ALIGN_VALUE((UINT64)sizeof(BOOT_HANDOFF_SECTION) + Length, BOOT_HANDOFF_ALIGN);
+    if (Need > H->Capacity - H->Size) return NULL;
+    BOOT_HANDOFF_SECTION *S = (BOOT_HANDOFF_SECTION *)((UINT8 *)H + H->Size);
+    ZeroMem(S, (UINTN)Need);
+    S->Type = Type;
+    S->Version = Version;
+    S->Length = Length;
+    H->Size += (UINT32)Need;
+    H->SectionCount++;
+    return S + 1;
+}
+
+BOOLEAN BootHandoff_Valid(CONST BOOT_HANDOFF *H) {
+    if (H == NULL || H->Magic != BOOT_HANDOFF_MAGIC) return FALSE;
+    if (H->HeaderSize < OFFSET_OF(BOOT_HANDOFF, Capacity) + sizeof(H->Capacity)) return FALSE;
+    if (H->HeaderSize % BOOT_HANDOFF_ALIGN || H->HeaderSize > H->Size || H->Size > H->Capacity) return FALSE;
+    return TRUE;
+}
+
+// Section boundaries are recomputed from the lengths, so a bad Length ends
+// the walk instead of sending the reader past H->Size.
+CONST BOOT_HANDOFF_SECTION *BootHandoff_Next(CONST BOOT_HANDOFF *H, CONST BOOT_HANDOFF_SECTION *Prev) {
+    UINT64 Off;
+    if (Prev == NULL) {
+        Off = H->HeaderSize;
+    } else {
+        Off = (UINT64)((CONST UINT8 *)Prev - (CONST UINT8 *)H);
+        Off += ALIGN_VALUE((UINT64)sizeof(*Prev) + Prev->Length, BOOT_HANDOFF_ALIGN);
+    }
+    if (Off + sizeof(BOOT_HANDOFF_SECTION) > H->Size) return NULL;
+    CONST BOOT_HANDOFF_SECTION *S = (CONST BOOT_HANDOFF_SECTION *)((CONST UINT8 *)H + Off);
+    if (S->Length > H->Size - Off - sizeof(*S)) return NULL;
+    return S;
+}
+
+CONST BOOT_HANDOFF_SECTION *BootHandoff_Find(CONST BOOT_HANDOFF *H, UINT16 Type) {
+    for (CONST BOOT_HANDOFF_SECTION *S = BootHandoff_Next(H, NULL); S; S = BootHandoff_Next(H, S))
+        if (S->Type == Type) return S;
+    return NULL;
+}
+
+CONST VOID *BootHandoff_Entry(CONST BOOT_HANDOFF_SECTION *Section, UINT32 Index, UINTN MinEntrySize) {
+    CONST HANDOFF_ARRAY *A = (CONST HANDOFF_ARRAY *)BOOT_HANDOFF_PAYLOAD(Section);
+    if (Section->Length < sizeof(*A) || Index >= A->Count || A->EntrySize < MinEntrySize) return NULL;
+    UINT64 Off = A->EntryOffset + (UINT64)Index * A->EntrySize;
+    if (Off + A->EntrySize > Section->Length) return NULL;
+    return (CONST UINT8 *)A + Off;
+}
@@ -0,0 +1,100 @@
+// boot_trace.c - Phase and firmware-call trace with Chrome JSON and folded-stack output
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/PrintLib.h>
+#include "boot_trace.h"
+#include "tsc.h"
+
+#define TRACE_CALIBRATE_PAIRS   64
+#define TRACE_FOLD_DEPTH        4       // frames per folded line, innermost kept
+
+static UINT32 TraceOpen(BOOT_TRACE *T, CONST CHAR16 *Name) {
+    if (T->Count == T->Capacity) { T->Dropped++; return BOOT_TRACE_NONE; }
+    UINT32 Id = T->Count++;
+    BOOT_TRACE_EVENT *E = &T->Events[Id];
+    E->Name = Name;
+    E->End = 0;
+    E->ChildTsc = 0;
+    E->Parent = T->Open;
+    E->Tid = 0;
+    E->Depth = (T->Open == BOOT_TRACE_NONE) ? 0 : T->Events[T->Open].Depth + 1;
+    T->Open = Id;
+    E->Begin = AsmReadTsc();
+    return Id;
+}
+
+VOID BootTrace_Init(BOOT_TRACE *T, BOOT_TRACE_EVENT *Events, UINT32 Capacity, UINT64 BudgetCycles) {
+    ZeroMem(T, sizeof(*T));
+    T->Events = Events;
+    T->Capacity = Capacity;
+    T->Open = BOOT_TRACE_NONE;
+    T->BudgetCycles = BudgetCycles;
+    if (Capacity < 2) return;
+
+    // Nested pairs, so the parent bookkeeping in End is part of the cost.
+    TraceOpen(T, L"calibrate");
+    UINT64 Start = AsmReadTsc();
+    for (UINTN i = 0; i < TRACE_CALIBRATE_PAIRS; ++i) {
+        T->Count = 1;
+        BootTrace_End(T, TraceOpen(T, L"calibrate"));
+    }
+    T->ScopeCycles = (AsmReadTsc() - Start) / TRACE_CALIBRATE_PAIRS;
+    T->Count = 0;
+    T->Open = BOOT_TRACE_NONE;
+    T->Calls = T->ScopeCycles <= BudgetCycles;
+}
+
+UINT32 BootTrace_Begin(BOOT_TRACE *T, CONST CHAR16 *Name) {
+    return TraceOpen(T, Name);
+}
+
+UINT32 BootTrace_BeginCall(BOOT_TRACE *T, CONST CHAR16 *Name) {
+    return T->Calls ? TraceOpen(T, Name) : BOOT_TRACE_NONE;
+}
+
+VOID BootTrace_End(BOOT_TRACE *T, UINT32 Id) {
+    UINT64 Now = AsmReadTsc();
+    if (Id == BOOT_TRACE_NONE) return;
+    BOOT_TRACE_EVENT *E = &T->Events[Id];
+    E->End = Now;
+    T->Open = E->Parent;
+    if (E->Parent != BOOT_TRACE_NONE) T->Events[E->Parent].ChildTsc += Now - E->Begin;
+}
+
+// Chrome wants microseconds; three decimals keep the nanoseconds.
+UINTN BootTrace_FormatChrome(CONST BOOT_TRACE *T, CHAR8 *Buf, UINTN Size, UINT64 Origin, UINT64 Now) {
+    UINTN Len = AsciiSPrint(Buf, Size, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (UINT32 i = 0; i < T->Count && Size - Len > BOOT_TRACE_LINE_MAX; ++i) {
+        CONST BOOT_TRACE_EVENT *E = &T->Events[i];
+        UINT64 End = E->End ? E->End : Now;
+        UINT64 Ts = (E->Begin > Origin) ? Tsc_ToNs(E->Begin - Origin) : 0;
+        UINT64 Dur = (End > E->Begin) ? Tsc_ToNs(End - E->Begin) : 0;
+        Len += AsciiSPrint(Buf + Len, Size - Len,
+            "%a{\"name\":\"%s\",\"cat\":\"%a\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%lu.%03lu,\"dur\":%lu.%03lu}\n",
+            i ? "," : "", E->Name, E->Depth ? "call" : "phase", E->Tid, Ts / 1000, Ts % 1000, Dur / 1000, Dur % 1000);
+    }
+    Len += AsciiSPrint(Buf + Len, Size - Len, "]}\n");
+    return Len;
+}
+
+// One line per event with its self time in nanoseconds; flamegraph.pl sums
+// the lines that share a stack.
+UINTN BootTrace_FormatFolded(CONST BOOT_TRACE *T, CHAR8 *Buf, UINTN Size, UINT64 Now) {
+    UINT32 Stack[TRACE_FOLD_DEPTH];
+    UINTN Len = 0;
+    for (UINT32 i = 0; i < T->Count && Size - Len > BOOT_TRACE_LINE_MAX; ++i) {
+        CONST BOOT_TRACE_EVENT *E = &T->Events[i];
+        UINT64 End = E->End ? E->End : Now;
+        UINT64 Total = (End > E->Begin) ? End - E->Begin : 0;
+        if (Total <= E->ChildTsc) continue;
+        UINTN Depth = 0;
+        for (UINT32 p = i; p != BOOT_TRACE_NONE && Depth < TRACE_FOLD_DEPTH; p = T->Events[p].Parent)
+            Stack[Depth++] = p;
+        while (Depth--)
+            Len += AsciiSPrint(Buf + Len, Size - Len, Depth ? "%s;" : "%s", T->Events[Stack[Depth]].Name);
+        Len += AsciiSPrint(Buf + Len, Size - Len, " %lu\n", Tsc_ToNs(Total - E->ChildTsc));
+    }
+    return Len;
+}
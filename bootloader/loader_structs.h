@@ -2,27 +2,8 @@
 #define LOADER_STRUCTS_H
 
 #include <Uefi.h>
-
-typedef struct {
-    EFI_MEMORY_DESCRIPTOR *MemoryMap;
-    UINTN MemoryMapSize;
-    UINTN MapKey;
-    UINTN DescriptorSize;
-    UINT32 DescriptorVersion;
-    EFI_PHYSICAL_ADDRESS KernelBase;
-    EFI_PHYSICAL_ADDRESS KernelEntry;
-    EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *GopModeInfo;
-    EFI_PHYSICAL_ADDRESS FrameBufferBase;
-    UINTN FrameBufferSize;
-    UINTN KernelSize;
-    UINT8 KernelHash[32];
-    BOOLEAN SignatureValid;
-    UINT32 BootTrustScore;
-    UINT8 BootUid[16];
-    UINT32 FallbackMode;
-    BOOLEAN FallbackUsed;
-    EFI_PHYSICAL_ADDRESS LoaderParamsPtr;
-} LOADER_PARAMS;
+#include "loader_params.h"
+#include "boot_config.h"
 
 typedef struct {
     UINT8 TPM_OK;
@@ -43,11 +24,19 @@ typedef struct {
     UINT8 HashHistory[4][32];
 } BOOT_DNA;
 
+// SHA-256 bank of PCR0-7, read with one TPM2_PCR_Read on first use.
+#define PCR_CACHE_COUNT 8
+
 typedef struct {
-    BOOLEAN FallbackEnabled;
-    UINT8 BootDelay;
-    BOOLEAN EntropyRequired;
-} BOOT_CONFIG;
+    UINT32 Valid;                   // bit n: Sha256[n] holds PCR n
+    BOOLEAN Read;                   // batch read attempted, Status is its result
+    EFI_STATUS Status;
+    UINT32 UpdateCounter;
+    UINT8 Sha256[PCR_CACHE_COUNT][32];
+    UINT32 Commands;                // TPM2_PCR_Read commands actually sent
+    UINT64 CommandTsc;
+    UINT64 MaxCommandTsc;
+} PCR_CACHE;
 
 typedef enum {
     ERR_NONE = 0,
@@ -71,6 +60,7 @@ typedef struct {
     TRUST_SCORE Trust;
     BOOT_DNA BootDNA;
     BOOT_CONFIG Config;
+    PCR_CACHE Pcr;
     BOOT_ERROR_CODE LastError;
     UINT8 TrustThreshold;
 } BOOT_CONTEXT;
@@ -0,0 +1,83 @@
+// lz4.c - Bounds-checked LZ4 frame and block decoder for the kernel stream
+
+#include <Uefi.h>
+#include <Library/BaseMemoryLib.h>
+#include "lz4.h"
+
+#define LZ4_MIN_MATCH   4
+
+static UINT32 Le32(const UINT8 *P) {
+    return (UINT32)P[0] | ((UINT32)P[1] << 8) | ((UINT32)P[2] << 16) | ((UINT32)P[3] << 24);
+}
+
+BOOLEAN Lz4_IsFrame(const VOID *Data, UINTN Size) {
+    return Size >= 4 && Le32((const UINT8 *)Data) == LZ4_FRAME_MAGIC;
+}
+
+EFI_STATUS Lz4_ParseFrameHeader(const VOID *Data, UINTN Size, LZ4_FRAME *Frame) {
+    const UINT8 *P = (const UINT8 *)Data;
+    if (!Lz4_IsFrame(Data, Size) || Size < 7) return EFI_VOLUME_CORRUPTED;
+    UINT8 Flg = P[4], Bd = P[5];
+    if ((Flg >> 6) != 1 || (Flg & 0x02) || (Bd & 0x8F)) return EFI_VOLUME_CORRUPTED;
+    UINTN BlockId = (Bd >> 4) & 7;
+    if (BlockId < 4) return EFI_VOLUME_CORRUPTED;
+    if (!(Flg & 0x20) || !(Flg & 0x08)) return EFI_UNSUPPORTED;     // linked blocks or no content size
+
+    UINTN Len = 6 + 8 + ((Flg & 0x01) ? 4 : 0) + 1;
+    if (Size < Len) return EFI_VOLUME_CORRUPTED;
+    ZeroMem(Frame, sizeof(*Frame));
+    Frame->HeaderSize = Len;
+    Frame->BlockMax = (UINTN)1 << (8 + 2 * BlockId);
+    Frame->ContentSize = (UINT64)Le32(P + 6) | ((UINT64)Le32(P + 10) << 32);
+    Frame->BlockChecksum = (Flg & 0x10) != 0;
+    Frame->ContentChecksum = (Flg & 0x04) != 0;
+    return EFI_SUCCESS;
+}
+
+static BOOLEAN ReadLength(const UINT8 **Ip, const UINT8 *IEnd, UINTN *Len) {
+    UINT8 B;
+    do {
+        if (*Ip >= IEnd) return FALSE;
+        B = *(*Ip)++;
+        *Len += B;
+    } while (B == 255);
+    return TRUE;
+}
+
+UINTN Lz4_DecodeBlock(const UINT8 *Src, UINTN SrcLen, UINT8 *Dst, UINTN DstCap) {
+    const UINT8 *Ip = Src, *IEnd = Src + SrcLen;
+    UINT8 *Op = Dst, *OEnd = Dst + DstCap;
+
+    for (;;) {
+        if (Ip >= IEnd) return LZ4_DECODE_ERROR;
+        UINTN Token = *Ip++;
+
+        UINTN Lit = Token >> 4;
+        if (Lit == 15 && !ReadLength(&Ip, IEnd, &Lit)) return LZ4_DECODE_ERROR;
+        if ((UINTN)(IEnd - Ip) < Lit || (UINTN)(OEnd - Op) < Lit) return LZ4_DECODE_ERROR;
+        CopyMem(Op, Ip, Lit);
+        Op += Lit;
+        Ip += Lit;
+        if (Ip == IEnd) break;              // the last sequence carries literals only
+
+        if (IEnd - Ip < 2) return LZ4_DECODE_ERROR;
+        UINTN Offset = (UINTN)Ip[0] | ((UINTN)Ip[1] << 8);
+        Ip += 2;
+        if (Offset == 0 || Offset > (UINTN)(Op - Dst)) return LZ4_DECODE_ERROR;
+
+        UINTN Len = Token & 15;
+        if (Len == 15 && !ReadLength(&Ip, IEnd, &Len)) return LZ4_DECODE_ERROR;
+        Len += LZ4_MIN_MATCH;
+        if ((UINTN)(OEnd - Op) < Len) return LZ4_DECODE_ERROR;
+
+        const UINT8 *Match = Op - Offset;
+        if (Offset >= Len) {
+            CopyMem(Op, Match, Len);
+            Op += Len;
+        } else {
+            // Overlapping match repeats the last Offset bytes.
+            while (Len--) *Op++ = *Match++;
+        }
+    }
+    return (UINTN)(Op - Dst);
+}
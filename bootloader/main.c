@@ -22,22 +22,33 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/PrintLib.h>
 #include <Library/BaseLib.h>
+#include <Library/SynchronizationLib.h>
 #include <Protocol/GraphicsOutput.h>
 #include <Protocol/LoadedImage.h>
 #include <Protocol/SimpleFileSystem.h>
 #include <Protocol/Tcg2Protocol.h>
 #include <Protocol/Hash2.h>
+#include <Protocol/MpService.h>
 #include <Library/BaseCryptLib.h>
 #include <Library/Tpm2CommandLib.h>
 #include <Guid/FileInfo.h>
 #include <Guid/Acpi.h>
 #include <Guid/GlobalVariable.h>
 #include <Guid/ImageAuthentication.h>
-#include "font8x8_basic.inc"
 #include "loader_structs.h"
+#include "sha256.h"
+#include "tsc.h"
+#include "memory_regions.h"
+#include "acpi_index.h"
+#include "lz4.h"
+#include "boot_gfx.h"
+#include "boot_handoff.h"
+#include "boot_profile.h"
+#include "boot_trace.h"
+#include "boot_arena.h"
+#include "boot_config.h"
 
 // =====================[ Global Constants ]=====================
-#define MAX_CLEANUP_ENTRIES    64
 #define MEMORY_POISON_PATTERN  0xAA
 #define TRUST_SCORE_PASS       85
 #define KERNEL_PATH            L"\EFI\AiOS\kernel.elf"
@@ -45,6 +56,11 @@
 #define SHA256_DIGEST_LENGTH   32
 #define BOOT_UID_LENGTH        16
 
+// Vendor GUID for AiOS-private NV variables. The global variable GUID is
+// reserved for names the UEFI spec defines; VarCheck refuses anything else.
+static EFI_GUID gAiOsVendorGuid =
+    { 0x5e1f3c2a, 0x8b4d, 0x4c71, { 0x9a, 0x36, 0x2f, 0xd0, 0x81, 0x47, 0xbe, 0x6c } };
+
 typedef enum {
     ERR_NONE = 0,
     ERR_MEM_LEAK,
@@ -59,80 +75,188 @@ typedef enum {
 
 static BOOT_CONTEXT gBootContext;
 
-typedef enum { LOG_INFO, LOG_WARN, LOG_ERROR } LOG_LEVEL;
+// =====================[ Log Ring ]=====================
+// Log() only formats into a ring record; nothing reaches ConOut until
+// LogFlush() writes every ready record in a few large OutputString calls.
+// Slots are reserved with a compare-exchange on Head so a record can be
+// written from any CPU, and Ready is set last so the flusher never emits a
+// half-formatted line. The last LOG_RESERVE_SLOTS slots only take
+// warnings and errors, so chatter can never crowd those out, and the BSP
+// flushes between phases once the ring passes LOG_FLUSH_HIGH_WATER.
+typedef enum { LOG_DEBUG, LOG_INFO, LOG_WARN, LOG_ERROR } LOG_LEVEL;
+
+#define LOG_RING_SIZE          1024
+#define LOG_RECORD_CHARS       120
+#define LOG_FLUSH_CHARS        2048
+#define LOG_RESERVE_SLOTS      64
+#define LOG_FLUSH_HIGH_WATER   (LOG_RING_SIZE / 2)
+
+typedef struct {
+    UINT64           Tsc;
+    UINT16           PhaseId;
+    UINT8            Level;
+    volatile UINT8   Ready;
+    CHAR16           Text[LOG_RECORD_CHARS];
+} LOG_RECORD;
+
+typedef struct {
+    volatile UINT32  Head;
+    UINT32           Tail;
+    volatile UINT32  Dropped;
+    volatile UINT32  Filtered;
+    UINT16           PhaseId;       // of the phase running
+    LOG_LEVEL        MinLevel;
+    BOOLEAN          ConsoleGone;
+    UINT64           PhaseTsc;      // formatting cost inside the current phase
+    UINT64           FlushTsc;
+    UINT32           FlushCalls;
+    LOG_RECORD       Ring[LOG_RING_SIZE];
+} LOG_STATE;
+
+static LOG_STATE gLog;
+
+static LOG_RECORD *LogReserve(LOG_LEVEL Level) {
+    if (Level < gLog.MinLevel) { InterlockedIncrement(&gLog.Filtered); return NULL; }
+    for (;;) {
+        UINT32 Head = gLog.Head;
+        UINT32 Room = (Level >= LOG_WARN) ? LOG_RING_SIZE : LOG_RING_SIZE - LOG_RESERVE_SLOTS;
+        if (Head - gLog.Tail >= Room) { InterlockedIncrement(&gLog.Dropped); return NULL; }
+        if (InterlockedCompareExchange32((UINT32*)&gLog.Head, Head, Head + 1) == Head) {
+            LOG_RECORD *R = &gLog.Ring[Head % LOG_RING_SIZE];
+            R->Level = (UINT8)Level;
+            R->PhaseId = gLog.PhaseId;
+            return R;
+        }
+    }
+}
+
+static VOID LogCommit(LOG_RECORD *R, UINT64 Start) {
+    UINT64 End = AsmReadTsc();
+    R->Tsc = Start;
+    MemoryFence();
+    R->Ready = 1;
+    gLog.PhaseTsc += End - Start;
+}
 
 static VOID Log(LOG_LEVEL Level, CONST CHAR16 *Format, ...) {
-    STATIC CONST CHAR16 *Prefix[] = { L"[INFO] ", L"[WARN] ", L"[ERR]  " };
+    UINT64 Start = AsmReadTsc();
+    LOG_RECORD *R = LogReserve(Level);
     VA_LIST Args;
-    Print(Prefix[Level]);
+    if (R == NULL) return;
     VA_START(Args, Format);
-    VPrint(Format, Args);
+    UnicodeVSPrint(R->Text, sizeof(R->Text), Format, Args);
     VA_END(Args);
-    Print(L"\n");
+    LogCommit(R, Start);
 }
 
-typedef struct {
-    VOID   *Ptr;
-    BOOLEAN Pages;
-    UINTN   Count;
-} CLEAN_REC;
+// Formats the label, then appends Data as hex (truncated to fit the record).
+static VOID LogHex(LOG_LEVEL Level, CONST UINT8 *Data, UINTN Len, CONST CHAR16 *Format, ...) {
+    STATIC CONST CHAR16 Hex[] = L"0123456789abcdef";
+    UINT64 Start = AsmReadTsc();
+    LOG_RECORD *R = LogReserve(Level);
+    VA_LIST Args;
+    if (R == NULL) return;
+    VA_START(Args, Format);
+    UINTN Pos = UnicodeVSPrint(R->Text, sizeof(R->Text), Format, Args);
+    VA_END(Args);
+    for (UINTN i = 0; i < Len && Pos + 2 < LOG_RECORD_CHARS; ++i) {
+        R->Text[Pos++] = Hex[Data[i] >> 4];
+        R->Text[Pos++] = Hex[Data[i] & 0xF];
+    }
+    R->Text[Pos] = 0;
+    LogCommit(R, Start);
+}
+
+static VOID LogFlush(VOID);
 
-static CLEAN_REC gCleanup[MAX_CLEANUP_ENTRIES];
-static UINTN gCleanupCount = 0;
+static VOID LogFlushIfFull(VOID) {
+    if (gLog.Head - gLog.Tail >= LOG_FLUSH_HIGH_WATER) LogFlush();
+}
 
-static VOID RegisterAlloc(VOID *Ptr, BOOLEAN Pages, UINTN Count) {
-    if (gCleanupCount < 64) {
-        gCleanup[gCleanupCount].Ptr = Ptr;
-        gCleanup[gCleanupCount].Pages = Pages;
-        gCleanup[gCleanupCount].Count = Count;
-        gCleanupCount++;
+static VOID LogFlush(VOID) {
+    STATIC CONST CHAR16 *Prefix[] = { L"[DBG]  ", L"[INFO] ", L"[WARN] ", L"[ERR]  " };
+    CHAR16 Batch[LOG_FLUSH_CHARS];
+    UINTN Len = 0;
+
+    if (gLog.ConsoleGone || gST == NULL || gST->ConOut == NULL) return;
+    UINT64 Start = AsmReadTsc();
+    while (gLog.Tail != gLog.Head) {
+        LOG_RECORD *R = &gLog.Ring[gLog.Tail % LOG_RING_SIZE];
+        if (!R->Ready) break;   // writer still formatting; pick it up next flush
+        UINTN Need = StrLen(Prefix[R->Level]) + StrLen(R->Text) + 2;
+        if (Len + Need >= LOG_FLUSH_CHARS) {
+            Batch[Len] = 0;
+            gST->ConOut->OutputString(gST->ConOut, Batch);
+            gLog.FlushCalls++;
+            Len = 0;
+        }
+        StrCpyS(Batch + Len, LOG_FLUSH_CHARS - Len, Prefix[R->Level]);
+        StrCatS(Batch + Len, LOG_FLUSH_CHARS - Len, R->Text);
+        StrCatS(Batch + Len, LOG_FLUSH_CHARS - Len, L"\r\n");
+        Len += Need;
+        R->Ready = 0;
+        gLog.Tail++;
+    }
+    if (Len) {
+        Batch[Len] = 0;
+        gST->ConOut->OutputString(gST->ConOut, Batch);
+        gLog.FlushCalls++;
     }
+    gLog.FlushTsc += AsmReadTsc() - Start;
+}
+
+// Loader scratch memory; see boot_arena.h.
+static BOOT_ARENA gArena;
+static BOOLEAN gBootServicesExited = FALSE;
+
+static VOID ArenaLogStats(VOID) {
+    Log(LOG_INFO, L"[RT] arena: %u allocs, high water %u KiB in %u chunks, %u firmware calls",
+        (UINT32)gArena.Allocs, (UINT32)(gArena.HighWater / 1024), (UINT32)gArena.ChunkCount,
+        (UINT32)gArena.FirmwareCalls);
+}
+
+// KeepHandoff leaves the typed pages to the kernel.
+static VOID ArenaTeardown(BOOLEAN KeepHandoff) {
+    BootArena_Teardown(&gArena, !gBootServicesExited, KeepHandoff);
 }
 
 static EFI_STATUS SafeAllocatePool(UINTN Size, VOID **Buffer, CHAR8 *Tag) {
-    EFI_STATUS Status = gBS->AllocatePool(EfiBootServicesData, Size, Buffer);
-    Log(LOG_INFO, L"AllocPool %a %u -> %r", Tag ? Tag : "", (UINT32)Size, Status);
-    if (!EFI_ERROR(Status)) {
-        SetMem(*Buffer, Size, 0);
-        RegisterAlloc(*Buffer, FALSE, 0);
-    } else {
+    *Buffer = BootArena_Alloc(&gArena, Size, 8);
+    Log(LOG_DEBUG, L"AllocPool %a %u -> %p", Tag ? Tag : "", (UINT32)Size, *Buffer);
+    if (*Buffer == NULL) {
         gBootContext.LastError = ERR_MEM_LEAK;
+        return EFI_OUT_OF_RESOURCES;
     }
-    return Status;
+    SetMem(*Buffer, Size, 0);
+    return EFI_SUCCESS;
 }
 
+// Scratch pages come out of the arena; anything typed or placed is a
+// firmware allocation the kernel may keep.
 static EFI_STATUS SafeAllocatePages(EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType,
                                     UINTN Pages, EFI_PHYSICAL_ADDRESS *Memory, CHAR8 *Tag) {
-    EFI_STATUS Status = gBS->AllocatePages(Type, MemoryType, Pages, Memory);
-    Log(LOG_INFO, L"AllocPages %a %u -> %r", Tag ? Tag : "", (UINT32)Pages, Status);
-    if (!EFI_ERROR(Status))
-        RegisterAlloc((VOID*)(UINTN)*Memory, TRUE, Pages);
-    else
-        gBootContext.LastError = ERR_MEM_LEAK;
+    EFI_STATUS Status;
+    if (Type == AllocateAnyPages && MemoryType == EfiBootServicesData) {
+        VOID *P = BootArena_Alloc(&gArena, EFI_PAGES_TO_SIZE(Pages), EFI_PAGE_SIZE);
+        Status = P ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+        if (P) *Memory = (EFI_PHYSICAL_ADDRESS)(UINTN)P;
+    } else {
+        Status = BootArena_AllocHandoff(&gArena, Type, MemoryType, Pages, Memory);
+    }
+    Log(LOG_DEBUG, L"AllocPages %a %u -> %r", Tag ? Tag : "", (UINT32)Pages, Status);
+    if (EFI_ERROR(Status)) gBootContext.LastError = ERR_MEM_LEAK;
     return Status;
 }
 
+// Only the latest arena allocation can be handed back early; anything else
+// waits for the teardown.
 static VOID SafeFree(VOID *Ptr) {
-    for (UINTN i = 0; i < gCleanupCount; ++i) {
-        if (gCleanup[i].Ptr == Ptr) {
-            if (gCleanup[i].Pages)
-                gBS->FreePages((EFI_PHYSICAL_ADDRESS)(UINTN)Ptr, gCleanup[i].Count);
-            else
-                gBS->FreePool(Ptr);
-            gCleanup[i] = gCleanup[--gCleanupCount];
-            return;
-        }
-    }
-}
-
-static VOID CleanupAll(void) {
-    while (gCleanupCount)
-        SafeFree(gCleanup[0].Ptr);
+    BootArena_Pop(&gArena, Ptr);
 }
 
 static VOID PoisonAndFreeMemory(VOID *Buffer, UINTN Size) {
     if (Buffer && Size) SetMem(Buffer, Size, MEMORY_POISON_PATTERN);
-    gBS->FreePool(Buffer);
+    SafeFree(Buffer);
 }
 
 typedef struct {
@@ -168,8 +292,6 @@ static ELF64_PHDR *gPhdrs = NULL;
 static UINT64 gKernelBaseTmp = 0;
 static UINT64 gKernelMinAddr = 0;
 static EFI_HASH2_PROTOCOL *gHash2 = NULL;
-static UINT8 *gKernelBuffer = NULL;
-static UINTN gKernelBufferSize = 0;
 static EFI_FILE_HANDLE gSigFile = NULL;
 static UINT8 *gSignature = NULL;
 static UINTN gSignatureSize = 0;
@@ -179,10 +301,9 @@ static UINT8 *gCertChain = NULL;
 static UINTN gCertChainSize = 0;
 static UINT8 gBootDNASignature[256];
 static UINTN gBootDNASignatureSize = 0;
-static CHAR16 gKernelPath[260]   = KERNEL_PATH;
-static CHAR16 gSignaturePath[260]= SIGNATURE_PATH;
+// config.ini settings, defaults until Phase251 loads it.
+static BOOT_CONFIG_SETTINGS gSettings = { { 0 }, TRUST_SCORE_PASS, KERNEL_PATH, SIGNATURE_PATH };
 static CHAR16 gFallbackPath[260] = L"\\EFI\\AiOS\\recovery.elf";
-static UINT8  gTrustThreshold = TRUST_SCORE_PASS;
 static EFI_PHYSICAL_ADDRESS gBootDNAHashRegion = 0;
 static EFI_PHYSICAL_ADDRESS gSealedBootDNA = 0;
 
@@ -193,27 +314,131 @@ static EFI_STATUS TPM2_Seal(UINT8 *Data, UINTN Size, EFI_PHYSICAL_ADDRESS *Out)
     if (!EFI_ERROR(S)) CopyMem((VOID*)(UINTN)*Out, Data, Size);
     return S;
 }
-static UINT64 gPhaseStart[301];
-static UINT64 gPhaseEnd[301];
-static EFI_STATUS LoadPublicKey(EFI_FILE_HANDLE Root) {
-    if (gPublicKey) return EFI_SUCCESS;
-    EFI_FILE_HANDLE File; EFI_STATUS S;
-    S = Root->Open(Root, &File, L"\\EFI\\AiOS\\public_key.bin", EFI_FILE_MODE_READ, 0);
-    if (EFI_ERROR(S)) { Log(LOG_ERROR, L"Public key missing %r", S); return S; }
-    UINTN Sz=0; EFI_FILE_INFO *Info=NULL;
-    S = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, NULL);
-    if (S==EFI_BUFFER_TOO_SMALL) {
-        S = SafeAllocatePool(Sz, (VOID**)&Info, "PubInfo");
-        if (!EFI_ERROR(S)) {
-            S = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, Info);
-            if (!EFI_ERROR(S)) gPublicKeySize = Info->FileSize;
-            SafeFree(Info);
+
+// Every phase and the firmware calls wrapped below; Phase179 writes it out.
+#define BOOT_TRACE_EVENTS          4096
+#define BOOT_TRACE_BUDGET_CYCLES   256
+static BOOT_TRACE gTrace;
+
+// ---------------------[ ESP FILE CACHE ]---------------------
+// The kernel, signature, key, CA and config files are opened by several
+// phases, and every Open walks the FAT directory again. Read-only opens go
+// through this table instead: the first Open of a path keeps the handle,
+// later ones rewind it, and EspClose leaves it open. GetInfo results are
+// kept with the handle. Phase101 closes everything before the handoff.
+#define ESP_CACHE_ENTRIES   8
+
+typedef struct {
+    CHAR16          Path[260];
+    EFI_FILE_HANDLE File;
+    EFI_FILE_INFO  *Info;
+} ESP_CACHE_ENTRY;
+
+static struct {
+    ESP_CACHE_ENTRY Entry[ESP_CACHE_ENTRIES];
+    UINTN          Count;
+    EFI_FILE_INFO *Scratch;         // GetInfo of a handle the table had no room for
+    UINT32         Opens;           // calls that reached the firmware
+    UINT32         OpenHits;
+    UINT32         GetInfos;
+    UINT32         InfoHits;
+} gEspCache;
+
+static ESP_CACHE_ENTRY *EspCacheByPath(CONST CHAR16 *Path) {
+    for (UINTN i = 0; i < gEspCache.Count; ++i)
+        if (StrCmp(gEspCache.Entry[i].Path, Path) == 0) return &gEspCache.Entry[i];
+    return NULL;
+}
+
+static ESP_CACHE_ENTRY *EspCacheByFile(EFI_FILE_HANDLE File) {
+    for (UINTN i = 0; i < gEspCache.Count; ++i)
+        if (gEspCache.Entry[i].File == File) return &gEspCache.Entry[i];
+    return NULL;
+}
+
+// The handle is positioned at the start of the file either way.
+static EFI_STATUS EspOpen(CONST CHAR16 *Path, EFI_FILE_HANDLE *File) {
+    ESP_CACHE_ENTRY *E = EspCacheByPath(Path);
+    if (E) {
+        gEspCache.OpenHits++;
+        *File = E->File;
+        return E->File->SetPosition(E->File, 0);
+    }
+    if (gBootContext.RootDir == NULL) return EFI_NOT_READY;
+    gEspCache.Opens++;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"file_open");
+    EFI_STATUS Status = gBootContext.RootDir->Open(gBootContext.RootDir, File, (CHAR16*)Path, EFI_FILE_MODE_READ, 0);
+    BootTrace_End(&gTrace, Scope);
+    if (EFI_ERROR(Status)) return Status;
+    if (gEspCache.Count < ESP_CACHE_ENTRIES && StrLen(Path) < ARRAY_SIZE(E->Path)) {
+        E = &gEspCache.Entry[gEspCache.Count++];
+        StrCpyS(E->Path, ARRAY_SIZE(E->Path), Path);
+        E->File = *File;
+        E->Info = NULL;
+    }
+    return EFI_SUCCESS;
+}
+
+static EFI_STATUS EspClose(EFI_FILE_HANDLE File) {
+    return EspCacheByFile(File) ? EFI_SUCCESS : File->Close(File);
+}
+
+// *Info belongs to the cache. For a handle the table had no room for it
+// is only good until the next EspGetInfo.
+static EFI_STATUS EspGetInfo(EFI_FILE_HANDLE File, CONST EFI_FILE_INFO **Info) {
+    ESP_CACHE_ENTRY *E = EspCacheByFile(File);
+    EFI_FILE_INFO **Slot = E ? &E->Info : &gEspCache.Scratch;
+    EFI_FILE_INFO *Buf = NULL;
+    UINTN Sz = 0;
+    EFI_STATUS Status;
+
+    if (E && E->Info) { gEspCache.InfoHits++; *Info = E->Info; return EFI_SUCCESS; }
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"file_info");
+    gEspCache.GetInfos++;
+    Status = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, NULL);
+    if (Status == EFI_BUFFER_TOO_SMALL) {
+        Status = SafeAllocatePool(Sz, (VOID**)&Buf, "EspInfo");
+        if (!EFI_ERROR(Status)) {
+            gEspCache.GetInfos++;
+            Status = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, Buf);
+            if (EFI_ERROR(Status)) SafeFree(Buf);
         }
+    } else if (!EFI_ERROR(Status)) {
+        Status = EFI_DEVICE_ERROR;
     }
-    if (EFI_ERROR(S)) { File->Close(File); return S; }
+    BootTrace_End(&gTrace, Scope);
+    if (EFI_ERROR(Status)) return Status;
+    if (*Slot) SafeFree(*Slot);
+    *Slot = Buf;
+    *Info = Buf;
+    return EFI_SUCCESS;
+}
+
+// For a path about to be written through its own handle.
+static VOID EspForget(CONST CHAR16 *Path) {
+    ESP_CACHE_ENTRY *E = EspCacheByPath(Path);
+    if (E == NULL) return;
+    E->File->Close(E->File);
+    if (E->Info) SafeFree(E->Info);
+    *E = gEspCache.Entry[--gEspCache.Count];
+}
+
+static VOID EspCacheFlush(VOID) {
+    while (gEspCache.Count) EspForget(gEspCache.Entry[gEspCache.Count - 1].Path);
+    if (gEspCache.Scratch) { SafeFree(gEspCache.Scratch); gEspCache.Scratch = NULL; }
+}
+
+static EFI_STATUS LoadPublicKey(VOID) {
+    if (gPublicKey) return EFI_SUCCESS;
+    EFI_FILE_HANDLE File; EFI_STATUS S; CONST EFI_FILE_INFO *Info;
+    S = EspOpen(L"\\EFI\\AiOS\\public_key.bin", &File);
+    if (EFI_ERROR(S)) { Log(LOG_ERROR, L"Public key missing %r", S); return S; }
+    S = EspGetInfo(File, &Info);
+    if (EFI_ERROR(S)) { EspClose(File); return S; }
+    gPublicKeySize = Info->FileSize;
     S = SafeAllocatePool(gPublicKeySize, (VOID**)&gPublicKey, "PubKey");
-    if (EFI_ERROR(S)) { File->Close(File); return S; }
-    S = File->Read(File, &gPublicKeySize, gPublicKey); File->Close(File);
+    if (EFI_ERROR(S)) { EspClose(File); return S; }
+    S = File->Read(File, &gPublicKeySize, gPublicKey); EspClose(File);
     if (EFI_ERROR(S)) { SafeFree(gPublicKey); gPublicKey=NULL; return S; }
     if (gPublicKeySize < 256) { SafeFree(gPublicKey); gPublicKey=NULL; return EFI_SECURITY_VIOLATION; }
     gBS->SetMemoryAttributes((EFI_PHYSICAL_ADDRESS)(UINTN)gPublicKey,
@@ -222,41 +447,213 @@ static EFI_STATUS LoadPublicKey(EFI_FILE_HANDLE Root) {
     return S;
 }
 
-// ACPI structure definitions used in later phases
-typedef struct {
-    CHAR8   Signature[8];
-    UINT8   Checksum;
-    CHAR8   OemId[6];
-    UINT8   Revision;
-    UINT32  RsdtAddress;
-    UINT32  Length;
-    UINT64  XsdtAddress;
-    UINT8   ExtendedChecksum;
-    UINT8   Reserved[3];
-} ACPI_RSDP;
+// =====================[ Kernel Stream ]=====================
+// The kernel file is read exactly once, front to back, in page-aligned chunks.
+// Each chunk is fed to SHA-256 and its PT_LOAD bytes are scattered straight to
+// their destinations, so the hash phases never reopen or re-read the file.
+// An LZ4-framed image is decoded block by block into the chunk buffer first;
+// offsets, FileSize and the hash all refer to the uncompressed ELF, so
+// KernelHash and the signature mean the same for either form.
+#define KERNEL_STREAM_CHUNK    (2 * 1024 * 1024)
 
 typedef struct {
-    UINT32  Signature;
-    UINT32  Length;
-    UINT8   Revision;
-    UINT8   Checksum;
-    CHAR8   OemId[6];
-    CHAR8   OemTableId[8];
-    UINT32  OemRevision;
-    UINT32  CreatorId;
-    UINT32  CreatorRevision;
-} ACPI_SDT_HEADER;
+    UINT8      *Buffer;         // current chunk of the uncompressed ELF
+    UINTN       BufferSize;
+    UINT64      FileSize;       // uncompressed size
+    UINT64      ChunkOffset;
+    UINTN       ChunkLen;
+    UINT64      BytesRead;      // uncompressed bytes produced so far
+    UINT64      RawSize;        // size on disk
+    UINT64      RawRead;
+    UINTN       ReadCalls;
+    UINT64      ReadTsc;
+    UINT64      HashTsc;
+    UINT64      DecodeTsc;
+    SHA256_CTX  Sha;
+    BOOLEAN     Done;
+    BOOLEAN     Compressed;
+    BOOLEAN     EndMark;
+    LZ4_FRAME   Frame;
+    UINT8      *In;             // compressed bytes not yet decoded
+    UINTN       InCap;
+    UINTN       InPos;
+    UINTN       InLen;
+} KERNEL_STREAM;
+
+static KERNEL_STREAM gKernelStream;
+
+static EFI_STATUS KernelStreamRead(VOID *Dst, UINTN *Size) {
+    KERNEL_STREAM *S = &gKernelStream;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"file_read");
+    UINT64 T0 = AsmReadTsc();
+    EFI_STATUS Status = gBootContext.KernelFile->Read(gBootContext.KernelFile, Size, Dst);
+    S->ReadTsc += AsmReadTsc() - T0;
+    BootTrace_End(&gTrace, Scope);
+    S->ReadCalls++;
+    if (!EFI_ERROR(Status)) S->RawRead += *Size;
+    return Status;
+}
 
-typedef struct {
-    ACPI_SDT_HEADER  Header;
-    UINT32           FirmwareCtrl;
-    UINT32           Dsdt;
-    UINT8            Reserved0[40];
-    UINT64           XDsdt;
-} ACPI_FADT;
+// Makes Need compressed bytes contiguous at In + InPos, topping the buffer
+// up with reads as large as it will take.
+static EFI_STATUS KernelStreamFill(UINTN Need) {
+    KERNEL_STREAM *S = &gKernelStream;
+    if (S->InLen - S->InPos >= Need) return EFI_SUCCESS;
+    if (Need > S->InCap) return EFI_VOLUME_CORRUPTED;
+    CopyMem(S->In, S->In + S->InPos, S->InLen - S->InPos);
+    S->InLen -= S->InPos;
+    S->InPos = 0;
+    while (S->InLen < Need) {
+        UINT64 Left = S->RawSize - S->RawRead;
+        UINTN Size = S->InCap - S->InLen;
+        if (Size > Left) Size = (UINTN)Left;
+        if (Size == 0) return EFI_END_OF_FILE;
+        EFI_STATUS Status = KernelStreamRead(S->In + S->InLen, &Size);
+        if (EFI_ERROR(Status)) return Status;
+        if (Size == 0) return EFI_END_OF_FILE;
+        S->InLen += Size;
+    }
+    return EFI_SUCCESS;
+}
+
+// Decodes whole blocks into Buffer until the next one might not fit.
+static EFI_STATUS KernelStreamDecode(VOID) {
+    KERNEL_STREAM *S = &gKernelStream;
+    UINTN Tail = S->Frame.BlockChecksum ? 4 : 0;
+    UINT64 T0 = AsmReadTsc(), ReadBefore = S->ReadTsc;
+    EFI_STATUS Status = EFI_SUCCESS;
+    while (!S->EndMark && S->BufferSize - S->ChunkLen >= S->Frame.BlockMax) {
+        Status = KernelStreamFill(4);
+        if (EFI_ERROR(Status)) break;
+        UINT32 Block = *(UINT32*)(S->In + S->InPos);
+        S->InPos += 4;
+        if (Block == 0) { S->EndMark = TRUE; break; }
+
+        UINTN Len = Block & ~LZ4_BLOCK_UNCOMPRESSED;
+        if (Len > S->Frame.BlockMax) { Status = EFI_VOLUME_CORRUPTED; break; }
+        Status = KernelStreamFill(Len + Tail);
+        if (EFI_ERROR(Status)) break;
+        UINT8 *Dst = S->Buffer + S->ChunkLen;
+        UINTN Out = Len;
+        if (Block & LZ4_BLOCK_UNCOMPRESSED)
+            CopyMem(Dst, S->In + S->InPos, Len);
+        else
+            Out = Lz4_DecodeBlock(S->In + S->InPos, Len, Dst, S->Frame.BlockMax);
+        if (Out == LZ4_DECODE_ERROR) { Status = EFI_VOLUME_CORRUPTED; break; }
+        S->InPos += Len + Tail;
+        S->ChunkLen += Out;
+    }
+    // Reads issued from here are already counted in ReadTsc.
+    S->DecodeTsc += (AsmReadTsc() - T0) - (S->ReadTsc - ReadBefore);
+    return Status;
+}
+
+static EFI_STATUS KernelStreamNextChunk(VOID) {
+    KERNEL_STREAM *S = &gKernelStream;
+    S->ChunkOffset += S->ChunkLen;
+    S->ChunkLen = 0;
+    UINT64 T1;
+    if (S->Compressed) {
+        EFI_STATUS Status = KernelStreamDecode();
+        if (EFI_ERROR(Status)) return Status;
+        if (S->ChunkLen == 0) return EFI_END_OF_FILE;
+        T1 = AsmReadTsc();
+    } else {
+        UINT64 Left = S->FileSize - S->ChunkOffset;
+        UINTN Size = (Left > KERNEL_STREAM_CHUNK) ? KERNEL_STREAM_CHUNK : (UINTN)Left;
+        if (Size == 0) return EFI_END_OF_FILE;
+        EFI_STATUS Status = KernelStreamRead(S->Buffer, &Size);
+        T1 = AsmReadTsc();
+        if (EFI_ERROR(Status)) return Status;
+        if (Size == 0) return EFI_END_OF_FILE;
+        S->ChunkLen = Size;
+    }
+    S->BytesRead += S->ChunkLen;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"sha256");
+    sha256_update(&S->Sha, S->Buffer, S->ChunkLen);
+    BootTrace_End(&gTrace, Scope);
+    S->HashTsc += AsmReadTsc() - T1;
+    return EFI_SUCCESS;
+}
+
+// Switches the stream to LZ4 once the first read shows a frame header.
+// The rest of that read becomes the first compressed input.
+static EFI_STATUS KernelStreamBeginLz4(UINTN FirstRead) {
+    KERNEL_STREAM *S = &gKernelStream;
+    EFI_STATUS Status = Lz4_ParseFrameHeader(S->Buffer, FirstRead, &S->Frame);
+    if (EFI_ERROR(Status)) {
+        Log(LOG_ERROR, L"Kernel LZ4 frame not supported: %r (use lz4 -BI --content-size)", Status);
+        return Status;
+    }
+    S->Compressed = TRUE;
+    S->FileSize = S->Frame.ContentSize;
+    S->InCap = MAX(KERNEL_STREAM_CHUNK, S->Frame.BlockMax + 8);
+    Status = SafeAllocatePool(S->InCap, (VOID**)&S->In, "KStreamIn");
+    if (EFI_ERROR(Status)) return Status;
+    S->InLen = FirstRead - S->Frame.HeaderSize;
+    CopyMem(S->In, S->Buffer + S->Frame.HeaderSize, S->InLen);
+
+    if (S->Frame.BlockMax > S->BufferSize) {
+        EFI_PHYSICAL_ADDRESS Buf = 0;
+        Status = SafeAllocatePages(AllocateAnyPages, EfiBootServicesData,
+                                   EFI_SIZE_TO_PAGES(S->Frame.BlockMax), &Buf, "KStreamOut");
+        if (EFI_ERROR(Status)) return Status;
+        S->Buffer = (UINT8*)(UINTN)Buf;
+        S->BufferSize = S->Frame.BlockMax;
+    }
+    return EFI_SUCCESS;
+}
+
+static EFI_STATUS KernelStreamBegin(VOID) {
+    KERNEL_STREAM *S = &gKernelStream;
+    CONST EFI_FILE_INFO *Info; EFI_STATUS Status;
+    ZeroMem(S, sizeof(*S));
+    Status = EspGetInfo(gBootContext.KernelFile, &Info);
+    if (EFI_ERROR(Status)) return Status;
+    S->FileSize = S->RawSize = Info->FileSize;
 
-#define SIGNATURE_32(A, B, C, D) \
-  ((UINT32)(A) | ((UINT32)(B) << 8) | ((UINT32)(C) << 16) | ((UINT32)(D) << 24))
+    EFI_PHYSICAL_ADDRESS Buf = 0;
+    Status = SafeAllocatePages(AllocateAnyPages, EfiBootServicesData,
+                               EFI_SIZE_TO_PAGES(KERNEL_STREAM_CHUNK), &Buf, "KStream");
+    if (EFI_ERROR(Status)) return Status;
+    S->Buffer = (UINT8*)(UINTN)Buf;
+    S->BufferSize = KERNEL_STREAM_CHUNK;
+    sha256_init(&S->Sha);
+
+    UINTN Size = (S->RawSize > KERNEL_STREAM_CHUNK) ? KERNEL_STREAM_CHUNK : (UINTN)S->RawSize;
+    Status = KernelStreamRead(S->Buffer, &Size);
+    if (EFI_ERROR(Status)) return Status;
+    if (Lz4_IsFrame(S->Buffer, Size)) {
+        Status = KernelStreamBeginLz4(Size);
+        if (EFI_ERROR(Status)) return Status;
+        return KernelStreamNextChunk();
+    }
+    if (Size == 0) return EFI_END_OF_FILE;
+    UINT64 T1 = AsmReadTsc();
+    S->ChunkLen = Size;
+    S->BytesRead = Size;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"sha256");
+    sha256_update(&S->Sha, S->Buffer, Size);
+    BootTrace_End(&gTrace, Scope);
+    S->HashTsc += AsmReadTsc() - T1;
+    return EFI_SUCCESS;
+}
+
+// Copies the part of the resident chunk that overlaps each PT_LOAD file range.
+static VOID KernelStreamScatter(VOID) {
+    KERNEL_STREAM *S = &gKernelStream;
+    UINT64 ChunkEnd = S->ChunkOffset + S->ChunkLen;
+    for (UINTN i=0;i<gElfHeader.e_phnum;i++) {
+        if (gPhdrs[i].p_type!=1 || gPhdrs[i].p_filesz==0) continue;
+        UINT64 SegStart = gPhdrs[i].p_offset;
+        UINT64 SegEnd = SegStart + gPhdrs[i].p_filesz;
+        UINT64 From = MAX(SegStart, S->ChunkOffset);
+        UINT64 To = MIN(SegEnd, ChunkEnd);
+        if (From >= To) continue;
+        UINT64 Dest = gKernelBaseTmp + (gPhdrs[i].p_paddr - gKernelMinAddr) + (From - SegStart);
+        CopyMem((VOID*)(UINTN)Dest, S->Buffer + (From - S->ChunkOffset), (UINTN)(To - From));
+    }
+}
 
 static ACPI_RSDP      *gRsdp  = NULL;
 static ACPI_SDT_HEADER *gXsdt = NULL;
@@ -274,6 +671,7 @@ static UINTN gAcpiErrCount = 0;
 static BOOLEAN gSecureChainValid = FALSE;
 static BOOLEAN gSelfRepairNeeded = FALSE;
 static UINT8 gBootStateHash[32];
+static UINT8 gBootDNADigest[32];    // taken with the BootState hash, signed in Phase220
 
 // Phase001: InitializeBootContext
 static EFI_STATUS Phase001_InitializeBootContext(EFI_HANDLE ImageHandle, EFI_SYSTEM_TABLE *SystemTable) {
@@ -285,7 +683,7 @@ static EFI_STATUS Phase001_InitializeBootContext(EFI_HANDLE ImageHandle, EFI_SYS
 
 // Phase002: LogSystemTableInfo
 static EFI_STATUS Phase002_LogSystemTableInfo(BOOT_CONTEXT *Ctx) {
-    Print(L"Firmware: %s Rev %u\n", gST->FirmwareVendor, gST->FirmwareRevision);
+    Log(LOG_INFO, L"Firmware: %s Rev %u", gST->FirmwareVendor, gST->FirmwareRevision);
     return EFI_SUCCESS;
 }
 
@@ -293,7 +691,7 @@ static EFI_STATUS Phase002_LogSystemTableInfo(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase003_LogCurrentTime(BOOT_CONTEXT *Ctx) {
     EFI_TIME Time;
     if (!EFI_ERROR(gRT->GetTime(&Time, NULL))) {
-        Print(L"Time: %04u-%02u-%02u %02u:%02u:%02u\n", Time.Year, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Second);
+        Log(LOG_INFO, L"Time: %04u-%02u-%02u %02u:%02u:%02u", Time.Year, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Second);
     }
     return EFI_SUCCESS;
 }
@@ -303,9 +701,9 @@ static EFI_STATUS Phase004_CheckSecureBoot(BOOT_CONTEXT *Ctx) {
     UINT8 Value = 0; UINTN Size = sizeof(Value);
     EFI_STATUS Status = gRT->GetVariable(L"SecureBoot", &gEfiGlobalVariableGuid, NULL, &Size, &Value);
     if (!EFI_ERROR(Status))
-        Print(L"SecureBoot: %u\n", Value);
+        Log(LOG_INFO, L"SecureBoot: %u", Value);
     else
-        Print(L"SecureBoot variable not found\n");
+        Log(LOG_WARN, L"SecureBoot variable not found");
     return Status;
 }
 
@@ -314,7 +712,7 @@ static EFI_STATUS Phase005_CheckSetupMode(BOOT_CONTEXT *Ctx) {
     UINT8 Value = 0; UINTN Size = sizeof(Value);
     EFI_STATUS Status = gRT->GetVariable(L"SetupMode", &gEfiGlobalVariableGuid, NULL, &Size, &Value);
     if (!EFI_ERROR(Status))
-        Print(L"SetupMode: %u\n", Value);
+        Log(LOG_INFO, L"SetupMode: %u", Value);
     return Status;
 }
 
@@ -325,7 +723,7 @@ static EFI_STATUS Phase006_ClearConsole(BOOT_CONTEXT *Ctx) {
 
 // Phase007: LogBootServices
 static EFI_STATUS Phase007_LogBootServices(BOOT_CONTEXT *Ctx) {
-    Print(L"BootServices @ %p\n", gBS);
+    Log(LOG_INFO, L"BootServices @ %p", gBS);
     return EFI_SUCCESS;
 }
 
@@ -337,13 +735,13 @@ static EFI_STATUS Phase008_PrepareParams(BOOT_CONTEXT *Ctx) {
 
 // Phase009: LogConsoleMode
 static EFI_STATUS Phase009_LogConsoleMode(BOOT_CONTEXT *Ctx) {
-    Print(L"Console mode: %u\n", gST->ConOut->Mode->Mode);
+    Log(LOG_INFO, L"Console mode: %u", gST->ConOut->Mode->Mode);
     return EFI_SUCCESS;
 }
 
 // Phase010: EnvironmentReady
 static EFI_STATUS Phase010_EnvironmentReady(BOOT_CONTEXT *Ctx) {
-    Print(L"UEFI environment ready\n");
+    Log(LOG_INFO, L"UEFI environment ready");
     return EFI_SUCCESS;
 }
 
@@ -367,14 +765,28 @@ static EFI_STATUS Phase014_LocateGraphicsOutput(BOOT_CONTEXT *Ctx) {
     return gBS->LocateProtocol(&gEfiGraphicsOutputProtocolGuid, NULL, (VOID**)&gBootContext.Gop);
 }
 
+// Boot UI phases draw into gGfx and present once per phase.
+static BOOT_GFX gGfx;
+
+static VOID GfxPresent(VOID) {
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, gBootServicesExited ? L"fb_copy" : L"gop_blt");
+    EFI_STATUS Status = BootGfx_Present(&gGfx, !gBootServicesExited);
+    BootTrace_End(&gTrace, Scope);
+    if (EFI_ERROR(Status)) Log(LOG_WARN, L"GOP present failed: %r", Status);
+}
+
 // Phase015: LogGraphicsMode
 static EFI_STATUS Phase015_LogGraphicsMode(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Gop != NULL) {
         EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *Info = gBootContext.Gop->Mode->Info;
-        Print(L"GOP: %ux%u\n", Info->HorizontalResolution, Info->VerticalResolution);
+        VOID *BackBuffer;
+        Log(LOG_INFO, L"GOP: %ux%u format %u", Info->HorizontalResolution, Info->VerticalResolution, Info->PixelFormat);
         gBootContext.Params.GopModeInfo = Info;
         gBootContext.Params.FrameBufferBase = gBootContext.Gop->Mode->FrameBufferBase;
         gBootContext.Params.FrameBufferSize = gBootContext.Gop->Mode->FrameBufferSize;
+        EFI_STATUS Status = SafeAllocatePool(BootGfx_BufferSize(gBootContext.Gop), &BackBuffer, "BackBuffer");
+        if (EFI_ERROR(Status)) return Status;
+        BootGfx_Init(&gGfx, gBootContext.Gop, BackBuffer);
     }
     return EFI_SUCCESS;
 }
@@ -384,7 +796,7 @@ static EFI_STATUS Phase016_GetAcpiRsdp(BOOT_CONTEXT *Ctx) {
     EFI_CONFIGURATION_TABLE *Table = gST->ConfigurationTable;
     for (UINTN Index = 0; Index < gST->NumberOfTableEntries; ++Index) {
         if (CompareGuid(&Table[Index].VendorGuid, &gEfiAcpi20TableGuid) || CompareGuid(&Table[Index].VendorGuid, &gEfiAcpi10TableGuid)) {
-            Print(L"ACPI RSDP @ %p\n", Table[Index].VendorTable);
+            Log(LOG_INFO, L"ACPI RSDP @ %p", Table[Index].VendorTable);
             break;
         }
     }
@@ -399,7 +811,7 @@ static EFI_STATUS Phase017_GetMemoryMapInfo(BOOT_CONTEXT *Ctx) {
         gBootContext.Params.MemoryMapSize = MapSize;
         gBootContext.Params.DescriptorSize = DescSize;
         gBootContext.Params.DescriptorVersion = DescVer;
-        Print(L"Memory map requires %lu bytes\n", MapSize);
+        Log(LOG_INFO, L"Memory map requires %lu bytes", MapSize);
         Status = EFI_SUCCESS;
     }
     return Status;
@@ -407,19 +819,27 @@ static EFI_STATUS Phase017_GetMemoryMapInfo(BOOT_CONTEXT *Ctx) {
 
 // Phase018: LogImagePath
 static EFI_STATUS Phase018_LogImagePath(BOOT_CONTEXT *Ctx) {
-    Print(L"Image base: %p\n", gBootContext.LoadedImage->ImageBase);
+    Log(LOG_INFO, L"Image base: %p", gBootContext.LoadedImage->ImageBase);
     return EFI_SUCCESS;
 }
 
+static EFI_STATUS Phase251_LoadBootConfig(BOOT_CONTEXT *Ctx);
+static VOID ProfileRingLoad(VOID);
+
 // Phase019: ProtocolSetupComplete
 static EFI_STATUS Phase019_ProtocolSetupComplete(BOOT_CONTEXT *Ctx) {
-    Print(L"UEFI protocols ready\n");
+    // config.ini is read as soon as the root directory is open so quiet_boot
+    // applies before the first log flush.
+    EFI_STATUS Status = Phase251_LoadBootConfig(Ctx);
+    if (EFI_ERROR(Status) && Status != EFI_NOT_FOUND) return Status;
+    ProfileRingLoad();
+    Log(LOG_INFO, L"UEFI protocols ready");
     return EFI_SUCCESS;
 }
 
 // Phase020: PrepareTpmContext
 static EFI_STATUS Phase020_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 020 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 020 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -435,44 +855,93 @@ static EFI_STATUS Phase022_QueryTpmCapabilities(BOOT_CONTEXT *Ctx) {
     Cap.Size = sizeof(Cap);
     Status = gBootContext.Tcg2->GetCapability(gBootContext.Tcg2, &Cap);
     if (!EFI_ERROR(Status)) {
-        Print(L"TPM Present, ActiveBanks: %08x\n", Cap.ActivePcrBanks);
+        Log(LOG_INFO, L"TPM Present, ActiveBanks: %08x", Cap.ActivePcrBanks);
     }
     return Status;
 }
 
-static EFI_STATUS ReadAndPrintPcr(UINT32 Index) {
-    TPML_PCR_SELECTION SelIn = {0};
-    TPML_PCR_SELECTION SelOut;
-    TPML_DIGEST Values;
-    UINT32 Counter;
-    SelIn.count = 1;
-    SelIn.pcrSelections[0].hash = TPM_ALG_SHA256;
-    SelIn.pcrSelections[0].sizeofSelect = 3;
-    SelIn.pcrSelections[0].pcrSelect[0] = (Index < 8) ? (1 << Index) : 0;
-    SelIn.pcrSelections[0].pcrSelect[1] = (Index >= 8 && Index < 16) ? (1 << (Index-8)) : 0;
-    SelIn.pcrSelections[0].pcrSelect[2] = (Index >= 16) ? (1 << (Index-16)) : 0;
-    EFI_STATUS Status = Tpm2PcrRead(&SelIn, &Counter, &SelOut, &Values);
-    if (!EFI_ERROR(Status) && Values.count > 0) {
-        Print(L"PCR%u: ", Index);
-        for (UINTN i = 0; i < Values.digests[0].size; ++i)
-            Print(L"%02x", Values.digests[0].buffer[i]);
-        Print(L"\n");
+// ---------------------[ PCR CACHE ]---------------------
+// Each TPM2_PCR_Read is a full TPM round trip, milliseconds on a discrete
+// part. PCR0-7 are read together the first time any phase asks for one and
+// kept in gBootContext.Pcr; only Phase151 goes back to the TPM, because its
+// job is to see whether PCR0 moved. Every command is counted and timed.
+static EFI_STATUS Tpm2PcrReadTimed(TPML_PCR_SELECTION *SelIn, UINT32 *Counter,
+                                   TPML_PCR_SELECTION *SelOut, TPML_DIGEST *Values) {
+    PCR_CACHE *C = &gBootContext.Pcr;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"tpm_pcr_read");
+    UINT64 Start = AsmReadTsc();
+    EFI_STATUS Status = Tpm2PcrRead(SelIn, Counter, SelOut, Values);
+    UINT64 Tsc = AsmReadTsc() - Start;
+    BootTrace_End(&gTrace, Scope);
+    C->Commands++;
+    C->CommandTsc += Tsc;
+    if (Tsc > C->MaxCommandTsc) C->MaxCommandTsc = Tsc;
+    return Status;
+}
+
+static VOID PcrSelectSha256(TPML_PCR_SELECTION *Sel, UINT32 Mask) {
+    ZeroMem(Sel, sizeof(*Sel));
+    Sel->count = 1;
+    Sel->pcrSelections[0].hash = TPM_ALG_SHA256;
+    Sel->pcrSelections[0].sizeofSelect = 3;
+    Sel->pcrSelections[0].pcrSelect[0] = (UINT8)Mask;
+}
+
+// A TPM may return fewer digests than asked for; SelOut says which, in
+// ascending order, and the rest are asked for again.
+static EFI_STATUS PcrCacheFill(VOID) {
+    PCR_CACHE *C = &gBootContext.Pcr;
+    UINT32 Pending = (1u << PCR_CACHE_COUNT) - 1;
+
+    while (Pending) {
+        TPML_PCR_SELECTION SelIn, SelOut;
+        TPML_DIGEST Values;
+        UINT32 Returned = 0, d = 0;
+        PcrSelectSha256(&SelIn, Pending);
+        EFI_STATUS Status = Tpm2PcrReadTimed(&SelIn, &C->UpdateCounter, &SelOut, &Values);
+        if (EFI_ERROR(Status)) return Status;
+        for (UINT32 b = 0; b < SelOut.count; ++b)
+            if (SelOut.pcrSelections[b].hash == TPM_ALG_SHA256) Returned = SelOut.pcrSelections[b].pcrSelect[0] & Pending;
+        for (UINT32 Pcr = 0; Pcr < PCR_CACHE_COUNT; ++Pcr) {
+            if (!(Returned & (1u << Pcr))) continue;
+            if (d >= Values.count || Values.digests[d].size != SHA256_DIGEST_LENGTH) return EFI_DEVICE_ERROR;
+            CopyMem(C->Sha256[Pcr], Values.digests[d++].buffer, SHA256_DIGEST_LENGTH);
+            C->Valid |= 1u << Pcr;
+        }
+        if (Returned == 0) return EFI_NOT_FOUND;
+        Pending &= ~Returned;
     }
+    return EFI_SUCCESS;
+}
+
+static EFI_STATUS PcrCacheGet(UINT32 Index, CONST UINT8 **Digest) {
+    PCR_CACHE *C = &gBootContext.Pcr;
+    if (Index >= PCR_CACHE_COUNT) return EFI_INVALID_PARAMETER;
+    if (!C->Read) { C->Status = PcrCacheFill(); C->Read = TRUE; }
+    if (EFI_ERROR(C->Status)) return C->Status;
+    *Digest = C->Sha256[Index];
+    return EFI_SUCCESS;
+}
+
+static EFI_STATUS LogCachedPcr(UINT32 Index) {
+    CONST UINT8 *Digest;
+    EFI_STATUS Status = PcrCacheGet(Index, &Digest);
+    if (!EFI_ERROR(Status)) LogHex(LOG_INFO, Digest, SHA256_DIGEST_LENGTH, L"PCR%u: ", Index);
     return Status;
 }
 
 // Phase023: ReadPcr0
-static EFI_STATUS Phase023_ReadPcr0(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(0); }
+static EFI_STATUS Phase023_ReadPcr0(BOOT_CONTEXT *Ctx) { return LogCachedPcr(0); }
 // Phase024: ReadPcr1
-static EFI_STATUS Phase024_ReadPcr1(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(1); }
+static EFI_STATUS Phase024_ReadPcr1(BOOT_CONTEXT *Ctx) { return LogCachedPcr(1); }
 // Phase025: ReadPcr2
-static EFI_STATUS Phase025_ReadPcr2(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(2); }
+static EFI_STATUS Phase025_ReadPcr2(BOOT_CONTEXT *Ctx) { return LogCachedPcr(2); }
 // Phase026: ReadPcr3
-static EFI_STATUS Phase026_ReadPcr3(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(3); }
+static EFI_STATUS Phase026_ReadPcr3(BOOT_CONTEXT *Ctx) { return LogCachedPcr(3); }
 // Phase027: ReadPcr4
-static EFI_STATUS Phase027_ReadPcr4(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(4); }
+static EFI_STATUS Phase027_ReadPcr4(BOOT_CONTEXT *Ctx) { return LogCachedPcr(4); }
 // Phase028: ReadPcr5
-static EFI_STATUS Phase028_ReadPcr5(BOOT_CONTEXT *Ctx) { return ReadAndPrintPcr(5); }
+static EFI_STATUS Phase028_ReadPcr5(BOOT_CONTEXT *Ctx) { return LogCachedPcr(5); }
 
 // Phase029: ExportEventLog
 static EFI_STATUS Phase029_ExportEventLog(BOOT_CONTEXT *Ctx) {
@@ -481,50 +950,82 @@ static EFI_STATUS Phase029_ExportEventLog(BOOT_CONTEXT *Ctx) {
     EFI_STATUS Status = gBootContext.Tcg2->GetEventLog(gBootContext.Tcg2, EFI_TCG2_EVENT_LOG_FORMAT_TCG_2, &Log, &Last, &Trunc);
     if (!EFI_ERROR(Status)) {
         UINTN Size = (UINTN)(Last - Log);
-        Print(L"Event log %lu bytes%s\n", Size, Trunc ? L" (truncated)" : L"");
+        Log(LOG_INFO, L"Event log %lu bytes%s", Size, Trunc ? L" (truncated)" : L"");
     }
     return Status;
 }
 
 // Phase030: TpmReady
 static EFI_STATUS Phase030_TpmReady(BOOT_CONTEXT *Ctx) {
-    Print(L"TPM initialization done\n");
+    Log(LOG_INFO, L"TPM initialization done");
     return EFI_SUCCESS;
 }
 
+// Bytes allocated for Params.MemoryMap; MemoryMapSize is only the part the
+// last GetMemoryMap filled.
+static UINTN gMemoryMapCapacity = 0;
+
+// Sorts and coalesces the current map into Params.MemoryRegions for the
+// later phases and the kernel.
+static EFI_STATUS BuildMemoryRegions(VOID) {
+    LOADER_PARAMS *P = &gBootContext.Params;
+    if (P->MemoryRegions == NULL || P->MemoryMap == NULL) return EFI_NOT_READY;
+    EFI_STATUS Status = MemoryRegions_Build(P->MemoryRegions, P->MemoryMap, P->MemoryMapSize, P->DescriptorSize);
+    if (EFI_ERROR(Status))
+        Log(LOG_ERROR, L"Memory map does not fit %u regions", (UINT32)MEMORY_REGION_MAX);
+    return Status;
+}
+
+// Reads the map into the Phase031 buffer and rebuilds the index from it.
+// Neither step allocates, so the key stays good for ExitBootServices.
+static EFI_STATUS RefreshMemoryMap(VOID) {
+    LOADER_PARAMS *P = &gBootContext.Params;
+    UINTN MapSize = gMemoryMapCapacity;
+    if (P->MemoryMap == NULL) return EFI_NOT_READY;
+    EFI_STATUS Status = gBS->GetMemoryMap(&MapSize, P->MemoryMap, &P->MapKey,
+                                          &P->DescriptorSize, &P->DescriptorVersion);
+    if (EFI_ERROR(Status)) return Status;
+    P->MemoryMapSize = MapSize;
+    return BuildMemoryRegions();
+}
+
 // Phase031: GetMemoryMap
 static EFI_STATUS Phase031_GetMemoryMap(BOOT_CONTEXT *Ctx) {
     EFI_STATUS Status;
     UINTN MapSize = 0, MapKey, DescSize; UINT32 DescVer;
+    // Index pages first, so the map read below already has them.
+    if (gBootContext.Params.MemoryRegions == NULL) {
+        EFI_PHYSICAL_ADDRESS Page;
+        Status = SafeAllocatePages(AllocateAnyPages, EfiLoaderData,
+            EFI_SIZE_TO_PAGES(sizeof(MEMORY_REGION_INDEX)), &Page, "MemRegions");
+        if (EFI_ERROR(Status)) return Status;
+        gBootContext.Params.MemoryRegions = (MEMORY_REGION_INDEX*)(UINTN)Page;
+    }
     Status = gBS->GetMemoryMap(&MapSize, NULL, &MapKey, &DescSize, &DescVer);
     if (Status != EFI_BUFFER_TOO_SMALL) return Status;
-    Status = gBS->AllocatePool(EfiBootServicesData, MapSize, (VOID**)&gBootContext.Params.MemoryMap);
+    MapSize += 8 * DescSize;    // room in case the arena has to grow later
+    Status = SafeAllocatePool(MapSize, (VOID**)&gBootContext.Params.MemoryMap, "MemMap");
     if (EFI_ERROR(Status)) return Status;
-    gBootContext.Params.MemoryMapSize = MapSize;
-    Status = gBS->GetMemoryMap(&gBootContext.Params.MemoryMapSize, gBootContext.Params.MemoryMap, &gBootContext.Params.MapKey, &gBootContext.Params.DescriptorSize, &gBootContext.Params.DescriptorVersion);
-    return Status;
+    gMemoryMapCapacity = MapSize;
+    return RefreshMemoryMap();
 }
 
 // Phase032: LogMemoryRegions
 static EFI_STATUS Phase032_LogMemoryRegions(BOOT_CONTEXT *Ctx) {
-    UINTN Count = gBootContext.Params.MemoryMapSize / gBootContext.Params.DescriptorSize;
-    for (UINTN i = 0; i < Count; ++i) {
-        EFI_MEMORY_DESCRIPTOR *Desc = (EFI_MEMORY_DESCRIPTOR*)((UINT8*)gBootContext.Params.MemoryMap + i * gBootContext.Params.DescriptorSize);
-        Print(L"Region %u: Type %u Pages %lu\n", (UINT32)i, Desc->Type, Desc->NumberOfPages);
-    }
+    const MEMORY_REGION_INDEX *Idx = gBootContext.Params.MemoryRegions;
+    if (Idx == NULL) return EFI_NOT_READY;
+    Log(LOG_INFO, L"%u descriptors in %u regions", Idx->DescriptorCount, Idx->Count);
+    for (UINTN i = 0; i < Idx->Count; ++i)
+        Log(LOG_INFO, L"Region %u: %lx Type %u Pages %lu", (UINT32)i,
+            Idx->Region[i].Base, Idx->Region[i].Type, Idx->Region[i].Pages);
     return EFI_SUCCESS;
 }
 
 // Phase033: CalcFreeMemory
 static EFI_STATUS Phase033_CalcFreeMemory(BOOT_CONTEXT *Ctx) {
-    UINTN Count = gBootContext.Params.MemoryMapSize / gBootContext.Params.DescriptorSize;
-    UINT64 Total = 0;
-    for (UINTN i = 0; i < Count; ++i) {
-        EFI_MEMORY_DESCRIPTOR *Desc = (EFI_MEMORY_DESCRIPTOR*)((UINT8*)gBootContext.Params.MemoryMap + i * gBootContext.Params.DescriptorSize);
-        if (Desc->Type == EfiConventionalMemory)
-            Total += Desc->NumberOfPages * 4096ULL;
-    }
-    Print(L"Usable RAM: %lu bytes\n", Total);
+    if (gBootContext.Params.MemoryRegions == NULL) return EFI_NOT_READY;
+    UINT64 Total = EFI_PAGES_TO_SIZE(MemoryRegions_TypePages(gBootContext.Params.MemoryRegions, EfiConventionalMemory));
+    Log(LOG_INFO, L"Usable RAM: %lu bytes", Total);
     return EFI_SUCCESS;
 }
 
@@ -533,7 +1034,7 @@ static EFI_STATUS Phase034_LogAcpiAddress(BOOT_CONTEXT *Ctx) {
     EFI_CONFIGURATION_TABLE *Table = gST->ConfigurationTable;
     for (UINTN Index = 0; Index < gST->NumberOfTableEntries; ++Index) {
         if (CompareGuid(&Table[Index].VendorGuid, &gEfiAcpi20TableGuid)) {
-            Print(L"ACPI table at %p\n", Table[Index].VendorTable);
+            Log(LOG_INFO, L"ACPI table at %p", Table[Index].VendorTable);
             break;
         }
     }
@@ -543,45 +1044,45 @@ static EFI_STATUS Phase034_LogAcpiAddress(BOOT_CONTEXT *Ctx) {
 // Phase035: PrepareEntropySeed
 static EFI_STATUS Phase035_PrepareEntropySeed(BOOT_CONTEXT *Ctx) {
     UINT64 Tsc = AsmReadTsc();
-    Print(L"Entropy seed: %lx\n", Tsc);
+    Log(LOG_INFO, L"Entropy seed: %lx", Tsc);
     return EFI_SUCCESS;
 }
 
 // Phase036: HashMemoryMap
 static EFI_STATUS Phase036_HashMemoryMap(BOOT_CONTEXT *Ctx) {
-    if (gBootContext.Params.MemoryMap == NULL) return EFI_NOT_READY;
-    SHA256_CTX Ctx; UINT8 Digest[SHA256_DIGEST_LENGTH];
-    sha256_init(&Ctx);
-    sha256_update(&Ctx, (UINT8*)gBootContext.Params.MemoryMap, gBootContext.Params.MemoryMapSize);
-    sha256_final(&Ctx, Digest);
-    Print(L"Memory map hash: ");
-    for (UINTN i = 0; i < SHA256_DIGEST_LENGTH; ++i) Print(L"%02x", Digest[i]);
-    Print(L"\n");
+    const MEMORY_REGION_INDEX *Idx = gBootContext.Params.MemoryRegions;
+    if (Idx == NULL) return EFI_NOT_READY;
+    SHA256_CTX Sha; UINT8 Digest[SHA256_DIGEST_LENGTH];
+    // Coalesced regions hash the same across boots that only differ in how
+    // firmware fragmented its own allocations.
+    sha256_init(&Sha);
+    sha256_update(&Sha, (UINT8*)Idx->Region, Idx->Count * sizeof(MEMORY_REGION));
+    sha256_final(&Sha, Digest);
+    LogHex(LOG_INFO, Digest, SHA256_DIGEST_LENGTH, L"Memory map hash: ");
     return EFI_SUCCESS;
 }
 
 // Phase037: StoreEntropy
 static EFI_STATUS Phase037_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 037 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 037 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase038: DisplayEntropy
 static EFI_STATUS Phase038_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 038 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 038 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase039: PrepareExitBoot
 static EFI_STATUS Phase039_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 039 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 039 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase040: MemoryReady
-static EFI_STATUS Phase040_MemoryReady(BOOT_CONTEXT *Ctx) { Print(L"Memory preparation done\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase040_MemoryReady(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Memory preparation done"); return EFI_SUCCESS; }
 
 // Phase041: OpenKernelFile
 static EFI_STATUS Phase041_OpenKernelFile(BOOT_CONTEXT *Ctx) {
-    CHAR16 *Path = KERNEL_PATH;
-    return gBootContext.RootDir->Open(gBootContext.RootDir, &gBootContext.KernelFile, Path, EFI_FILE_MODE_READ, 0);
+    return EspOpen(KERNEL_PATH, &gBootContext.KernelFile);
 }
 
 // Phase042: ReadElfHeader
@@ -608,7 +1109,7 @@ static EFI_STATUS Phase045_ValidateElfEndian(UINT8 *Header) {
 // Phase046: LogProgramHeaderCount
 static EFI_STATUS Phase046_LogProgramHeaderCount(UINT8 *Header) {
     UINT16 Count = *(UINT16*)(Header + 0x38);
-    Print(L"Program headers: %u\n", Count);
+    Log(LOG_INFO, L"Program headers: %u", Count);
     return EFI_SUCCESS;
 }
 
@@ -616,30 +1117,32 @@ static EFI_STATUS Phase046_LogProgramHeaderCount(UINT8 *Header) {
 static EFI_STATUS Phase047_LogEntryPoint(UINT8 *Header) {
     UINT64 Entry = *(UINT64*)(Header + 0x18);
     gBootContext.Params.KernelEntry = Entry;
-    Print(L"Kernel entry point: 0x%lx\n", Entry);
+    Log(LOG_INFO, L"Kernel entry point: 0x%lx", Entry);
     return EFI_SUCCESS;
 }
 
 // Phase048: CloseKernelFile
 static EFI_STATUS Phase048_CloseKernelFile(BOOT_CONTEXT *Ctx) {
-    return gBootContext.KernelFile->Close(gBootContext.KernelFile);
+    return EspClose(gBootContext.KernelFile);
 }
 
 // Phase049: KernelHeaderValid
-static EFI_STATUS Phase049_KernelHeaderValid(BOOT_CONTEXT *Ctx) { Print(L"ELF header validated\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase049_KernelHeaderValid(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"ELF header validated"); return EFI_SUCCESS; }
 // Phase050: BootLoadingBegin
-static EFI_STATUS Phase050_BootLoadingBegin(BOOT_CONTEXT *Ctx) { Print(L"Kernel loading begun\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase050_BootLoadingBegin(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Kernel loading begun"); return EFI_SUCCESS; }
 
 // Phase051: OpenKernelForLoad
 static EFI_STATUS Phase051_OpenKernelForLoad(BOOT_CONTEXT *Ctx) {
-    CHAR16 *Path = KERNEL_PATH;
-    return gBootContext.RootDir->Open(gBootContext.RootDir, &gBootContext.KernelFile, Path, EFI_FILE_MODE_READ, 0);
+    return EspOpen(KERNEL_PATH, &gBootContext.KernelFile);
 }
 
 // Phase052: ReadKernelElfHeader
 static EFI_STATUS Phase052_ReadKernelElfHeader(BOOT_CONTEXT *Ctx) {
-    UINTN Size = sizeof(ELF64_EHDR);
-    return gBootContext.KernelFile->Read(gBootContext.KernelFile, &Size, &gElfHeader);
+    EFI_STATUS Status = KernelStreamBegin();
+    if (EFI_ERROR(Status)) return Status;
+    if (gKernelStream.ChunkLen < sizeof(ELF64_EHDR)) return EFI_LOAD_ERROR;
+    CopyMem(&gElfHeader, gKernelStream.Buffer, sizeof(ELF64_EHDR));
+    return EFI_SUCCESS;
 }
 
 // Phase053: ValidateElfHeader
@@ -655,19 +1158,31 @@ static EFI_STATUS Phase053_ValidateElfHeader(BOOT_CONTEXT *Ctx) {
 
 // Phase054: ReadProgramHeaders
 static EFI_STATUS Phase054_ReadProgramHeaders(BOOT_CONTEXT *Ctx) {
-    UINTN Size = gElfHeader.e_phentsize * gElfHeader.e_phnum;
-    EFI_STATUS Status = gBS->AllocatePool(EfiBootServicesData, Size, (VOID**)&gPhdrs);
-    if (EFI_ERROR(Status)) return Status;
-    Status = gBootContext.KernelFile->SetPosition(gBootContext.KernelFile, gElfHeader.e_phoff);
+    // These fields are not signed yet. Every later walk indexes gPhdrs as
+    // ELF64_PHDR for e_phnum entries, so the entry size must match exactly,
+    // and the range check is written so it cannot wrap.
+    if (gElfHeader.e_phentsize != sizeof(ELF64_PHDR)) {
+        Log(LOG_ERROR, L"Program header size %u, expected %u", (UINT32)gElfHeader.e_phentsize, (UINT32)sizeof(ELF64_PHDR));
+        return EFI_LOAD_ERROR;
+    }
+    UINTN Size = (UINTN)gElfHeader.e_phnum * sizeof(ELF64_PHDR);
+    // Program headers must sit inside the first chunk; seeking back for them
+    // would break the single-pass read.
+    if (gElfHeader.e_phoff > gKernelStream.ChunkLen || Size > gKernelStream.ChunkLen - gElfHeader.e_phoff) {
+        Log(LOG_ERROR, L"Program headers outside first %u bytes", (UINT32)KERNEL_STREAM_CHUNK);
+        return EFI_UNSUPPORTED;
+    }
+    EFI_STATUS Status = SafeAllocatePool(Size, (VOID**)&gPhdrs, "Phdrs");
     if (EFI_ERROR(Status)) return Status;
-    return gBootContext.KernelFile->Read(gBootContext.KernelFile, &Size, gPhdrs);
+    CopyMem(gPhdrs, gKernelStream.Buffer + gElfHeader.e_phoff, Size);
+    return EFI_SUCCESS;
 }
 
 // Phase055: CountLoadSegments
 static EFI_STATUS Phase055_CountLoadSegments(BOOT_CONTEXT *Ctx) {
     UINTN Count = 0;
     for (UINTN i=0;i<gElfHeader.e_phnum;i++) if (gPhdrs[i].p_type==1) ++Count;
-    Print(L"PT_LOAD segments: %u\n", (UINT32)Count);
+    Log(LOG_INFO, L"PT_LOAD segments: %u", (UINT32)Count);
     return EFI_SUCCESS;
 }
 
@@ -693,16 +1208,35 @@ static EFI_STATUS Phase056_AllocateKernelMemory(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase057_LoadKernelSegments(BOOT_CONTEXT *Ctx) {
     for (UINTN i=0;i<gElfHeader.e_phnum;i++) {
         if (gPhdrs[i].p_type!=1) continue;
-        UINTN Size = (UINTN)gPhdrs[i].p_filesz;
         UINT64 Dest = gKernelBaseTmp + (gPhdrs[i].p_paddr - gKernelMinAddr);
-        if (Dest + Size > gKernelBaseTmp + gBootContext.Params.KernelSize)
+        if (gPhdrs[i].p_filesz > gPhdrs[i].p_memsz ||
+            gPhdrs[i].p_offset + gPhdrs[i].p_filesz > gKernelStream.FileSize ||
+            Dest + gPhdrs[i].p_memsz > gKernelBaseTmp + gBootContext.Params.KernelSize)
             return EFI_SECURITY_VIOLATION;
-        EFI_STATUS Status = gBootContext.KernelFile->SetPosition(gBootContext.KernelFile, gPhdrs[i].p_offset);
-        if (EFI_ERROR(Status)) return Status;
-        Status = gBootContext.KernelFile->Read(gBootContext.KernelFile, &Size, (VOID*)Dest);
-        if (EFI_ERROR(Status)) return Status;
         if (gPhdrs[i].p_memsz > gPhdrs[i].p_filesz)
-            SetMem((VOID*)(Dest + gPhdrs[i].p_filesz), (UINTN)(gPhdrs[i].p_memsz - gPhdrs[i].p_filesz), 0);
+            SetMem((VOID*)(UINTN)(Dest + gPhdrs[i].p_filesz), (UINTN)(gPhdrs[i].p_memsz - gPhdrs[i].p_filesz), 0);
+    }
+
+    // Chunk 0 is already resident from Phase052; scatter it, then stream the rest.
+    EFI_STATUS Status = EFI_SUCCESS;
+    while (gKernelStream.ChunkLen) {
+        KernelStreamScatter();
+        Status = KernelStreamNextChunk();
+        if (Status == EFI_END_OF_FILE) break;
+        if (EFI_ERROR(Status)) return Status;
+    }
+    if (gKernelStream.BytesRead != gKernelStream.FileSize) return EFI_END_OF_FILE;
+
+    UINT64 T0 = AsmReadTsc();
+    sha256_final(&gKernelStream.Sha, gBootContext.Params.KernelHash);
+    gKernelStream.HashTsc += AsmReadTsc() - T0;
+    gKernelStream.Done = TRUE;
+
+    // Attributes go on only after every chunk has landed, since a read-only
+    // segment may still be receiving bytes from a later chunk.
+    for (UINTN i=0;i<gElfHeader.e_phnum;i++) {
+        if (gPhdrs[i].p_type!=1) continue;
+        UINT64 Dest = gKernelBaseTmp + (gPhdrs[i].p_paddr - gKernelMinAddr);
         UINT64 Attr = EFI_MEMORY_XP;
         if (gPhdrs[i].p_flags & 1) Attr &= ~EFI_MEMORY_XP; // executable
         if (!(gPhdrs[i].p_flags & 2)) Attr |= EFI_MEMORY_RO; // read only
@@ -719,12 +1253,12 @@ static EFI_STATUS Phase058_StoreKernelEntry(BOOT_CONTEXT *Ctx) {
 
 // Phase059: CloseKernelFilePostLoad
 static EFI_STATUS Phase059_CloseKernelFilePostLoad(BOOT_CONTEXT *Ctx) {
-    return gBootContext.KernelFile->Close(gBootContext.KernelFile);
+    return EspClose(gBootContext.KernelFile);
 }
 
 // Phase060: LogKernelLoaded
 static EFI_STATUS Phase060_LogKernelLoaded(BOOT_CONTEXT *Ctx) {
-    Print(L"Kernel loaded at %lx, entry %lx\n", gBootContext.Params.KernelBase, gBootContext.Params.KernelEntry);
+    Log(LOG_INFO, L"Kernel loaded at %lx, entry %lx", gBootContext.Params.KernelBase, gBootContext.Params.KernelEntry);
     return EFI_SUCCESS;
 }
 
@@ -733,69 +1267,44 @@ static EFI_STATUS Phase061_LocateHash2Protocol(BOOT_CONTEXT *Ctx) {
     return gBS->LocateProtocol(&gEfiHash2ProtocolGuid, NULL, (VOID**)&gHash2);
 }
 
-// Phase062: OpenKernelForHash
-static EFI_STATUS Phase062_OpenKernelForHash(BOOT_CONTEXT *Ctx) {
-    CHAR16 *Path = KERNEL_PATH;
-    return gBootContext.RootDir->Open(gBootContext.RootDir, &gBootContext.KernelFile, Path, EFI_FILE_MODE_READ, 0);
-}
-
-// Phase063: GetKernelSize
-static EFI_STATUS Phase063_GetKernelSize(BOOT_CONTEXT *Ctx) {
-    EFI_FILE_INFO *Info; UINTN Sz=0; EFI_STATUS Status;
-    Status = gBootContext.KernelFile->GetInfo(gBootContext.KernelFile, &gEfiFileInfoGuid, &Sz, NULL);
-    if (Status!=EFI_BUFFER_TOO_SMALL) return Status;
-    Status = SafeAllocatePool(Sz, (VOID**)&Info, "KInfo");
-    if (EFI_ERROR(Status)) return Status;
-    Status = gBootContext.KernelFile->GetInfo(gBootContext.KernelFile, &gEfiFileInfoGuid, &Sz, Info);
-    if (!EFI_ERROR(Status)) gKernelBufferSize = Info->FileSize;
-    SafeFree(Info);
-    return Status;
-}
-
-// Phase064: ReadKernelData
-static EFI_STATUS Phase064_ReadKernelData(BOOT_CONTEXT *Ctx) {
-    EFI_STATUS Status = SafeAllocatePool(gKernelBufferSize, (VOID**)&gKernelBuffer, "KBuf");
-    if (EFI_ERROR(Status)) return Status;
-    UINTN Size = gKernelBufferSize;
-    return gBootContext.KernelFile->Read(gBootContext.KernelFile, &Size, gKernelBuffer);
+// Phase062: VerifyKernelStreamed
+static EFI_STATUS Phase062_VerifyKernelStreamed(BOOT_CONTEXT *Ctx) {
+    if (!gKernelStream.Done) return EFI_NOT_READY;
+    if (gKernelStream.BytesRead != gKernelStream.FileSize) return EFI_COMPROMISED_DATA;
+    return EFI_SUCCESS;
 }
 
-// Phase065: ComputeKernelSha256
-static EFI_STATUS Phase065_ComputeKernelSha256(BOOT_CONTEXT *Ctx) {
-    if (gHash2==NULL) return EFI_NOT_READY;
-    EFI_HASH_OUTPUT Hash;
-    EFI_STATUS Status = gHash2->Hash(gHash2, &gEfiHashAlgorithmSha256Guid, gKernelBufferSize, gKernelBuffer, &Hash);
-    if (!EFI_ERROR(Status)) CopyMem(gBootContext.Params.KernelHash, Hash.HashBuf, 32);
-    return Status;
+// Phase063: LogKernelStreamStats
+static EFI_STATUS Phase063_LogKernelStreamStats(BOOT_CONTEXT *Ctx) {
+    Log(LOG_INFO, L"Kernel stream: %lu of %lu bytes in %u reads, read %lu us, hash %lu us",
+          gKernelStream.BytesRead, gKernelStream.FileSize, (UINT32)gKernelStream.ReadCalls,
+          Tsc_ToNs(gKernelStream.ReadTsc) / 1000, Tsc_ToNs(gKernelStream.HashTsc) / 1000);
+    if (gKernelStream.Compressed)
+        Log(LOG_INFO, L"Kernel LZ4: %lu bytes on disk, %u KiB blocks, decode %lu us",
+            gKernelStream.RawRead, (UINT32)(gKernelStream.Frame.BlockMax / 1024),
+            Tsc_ToNs(gKernelStream.DecodeTsc) / 1000);
+    return EFI_SUCCESS;
 }
 
-// Phase066: FreeKernelData
-static EFI_STATUS Phase066_FreeKernelData(BOOT_CONTEXT *Ctx) {
-    if (gKernelBuffer) { SafeFree(gKernelBuffer); gKernelBuffer=NULL; }
+// Phase064: FreeKernelStreamBuffer
+static EFI_STATUS Phase064_FreeKernelStreamBuffer(BOOT_CONTEXT *Ctx) {
+    if (gKernelStream.Buffer) { SafeFree(gKernelStream.Buffer); gKernelStream.Buffer = NULL; }
     return EFI_SUCCESS;
 }
 
-// Phase067: CloseKernelAfterHash
-static EFI_STATUS Phase067_CloseKernelAfterHash(BOOT_CONTEXT *Ctx) {
-    return gBootContext.KernelFile->Close(gBootContext.KernelFile);
-}
+// Phase065-067 (hash, free and close the kernel) are gone: Phase057 hashes
+// while it streams, Phase059 closes the file and Phase064 frees the buffer.
 
 // Phase068: OpenSignatureFile
 static EFI_STATUS Phase068_OpenSignatureFile(BOOT_CONTEXT *Ctx) {
-    CHAR16 *Path = SIGNATURE_PATH;
-    return gBootContext.RootDir->Open(gBootContext.RootDir, &gSigFile, Path, EFI_FILE_MODE_READ, 0);
+    return EspOpen(SIGNATURE_PATH, &gSigFile);
 }
 
 // Phase069: ReadSignatureSize
 static EFI_STATUS Phase069_ReadSignatureSize(BOOT_CONTEXT *Ctx) {
-    EFI_FILE_INFO *Info; UINTN Sz=0; EFI_STATUS Status;
-    Status = gSigFile->GetInfo(gSigFile, &gEfiFileInfoGuid, &Sz, NULL);
-    if (Status!=EFI_BUFFER_TOO_SMALL) return Status;
-    Status = SafeAllocatePool(Sz, (VOID**)&Info, "SigInfo");
-    if (EFI_ERROR(Status)) return Status;
-    Status = gSigFile->GetInfo(gSigFile, &gEfiFileInfoGuid, &Sz, Info);
+    CONST EFI_FILE_INFO *Info;
+    EFI_STATUS Status = EspGetInfo(gSigFile, &Info);
     if (!EFI_ERROR(Status)) gSignatureSize = Info->FileSize;
-    SafeFree(Info);
     return Status;
 }
 
@@ -809,7 +1318,140 @@ static EFI_STATUS Phase070_ReadSignatureData(BOOT_CONTEXT *Ctx) {
 
 // Phase071: CloseSignatureFile
 static EFI_STATUS Phase071_CloseSignatureFile(BOOT_CONTEXT *Ctx) {
-    return gSigFile->Close(gSigFile);
+    return EspClose(gSigFile);
+}
+
+// ---------------------[ VERIFY CACHE ]---------------------
+// The RSA verify in Phase072 depends only on the kernel hash, the signature
+// and the public key, and the chain walk in Phase073B adds the root CA.
+// Once both pass, their digests are stored with a digest of PCR0-7 in a
+// boot-service-only NVRAM variable. The OS can not create or change such a
+// variable after ExitBootServices, and with Secure Boot on no unsigned
+// pre-boot image can either, so an entry can only come from a signed loader
+// that did the full check. Without Secure Boot nothing is cached. PCR4 and
+// PCR7 move with the loader image and the Secure Boot policy, so a swapped
+// loader or db misses too. The Digest field is a plain SHA-256 with no key:
+// it catches a torn or corrupted entry, not a forged one, and is not what
+// the skip relies on. The stream still hashes the kernel on every boot. A
+// new kernel, signature, key, CA or firmware measurement misses and takes
+// the full path, which then replaces the entry.
+#define VERIFY_CACHE_VARIABLE    L"VerifiedBootCache"
+#define VERIFY_CACHE_ATTRIBUTES  (EFI_VARIABLE_NON_VOLATILE|EFI_VARIABLE_BOOTSERVICE_ACCESS)
+#define VERIFY_CACHE_MAGIC       SIGNATURE_32('A','V','F','Y')
+#define VERIFY_CACHE_VERSION     2
+
+typedef struct {
+    UINT32 Magic;
+    UINT32 Version;
+    UINT8  KernelHash[SHA256_DIGEST_LENGTH];
+    UINT8  SignatureHash[SHA256_DIGEST_LENGTH];
+    UINT8  PublicKeyHash[SHA256_DIGEST_LENGTH];
+    UINT8  PcrDigest[SHA256_DIGEST_LENGTH];     // over PCR0-7
+    UINT8  CertChainHash[SHA256_DIGEST_LENGTH];
+    UINT64 VerifyTsc;           // RSA verify + chain walk on the boot that stored it
+    UINT8  Digest[SHA256_DIGEST_LENGTH];    // unkeyed, over every field above
+} VERIFY_CACHE_ENTRY;
+
+typedef struct {
+    VERIFY_CACHE_ENTRY Stored;
+    VERIFY_CACHE_ENTRY Current;
+    BOOLEAN Loaded;
+    BOOLEAN Keyed;              // Secure Boot on and PCR0-7 readable, so an entry may be stored
+    BOOLEAN SignatureHit;       // Phase072 skipped the RSA verify
+    BOOLEAN ChainHit;           // Phase073B skipped the chain walk
+    UINT64  VerifyTsc;          // spent on RSA + chain this boot
+    UINT64  LookupTsc;
+} VERIFY_CACHE;
+
+static VERIFY_CACHE gVerifyCache;
+
+static VOID VerifyCacheHash(const VOID *Data, UINTN Size, UINT8 *Digest) {
+    SHA256_CTX Sha;
+    UINT32 Scope = BootTrace_BeginCall(&gTrace, L"sha256");
+    sha256_init(&Sha);
+    sha256_update(&Sha, (const UINT8*)Data, Size);
+    sha256_final(&Sha, Digest);
+    BootTrace_End(&gTrace, Scope);
+}
+
+// Keys this boot's check from the kernel hash, signature, key and PCR0-7, and
+// reports whether the stored entry already vouches for the RSA verify.
+static BOOLEAN VerifyCacheLookup(VOID) {
+    VERIFY_CACHE_ENTRY *Cur = &gVerifyCache.Current;
+    VERIFY_CACHE_ENTRY *Old = &gVerifyCache.Stored;
+    UINT8 Digest[SHA256_DIGEST_LENGTH];
+    UINT32 Attributes = 0;
+    UINTN Size = sizeof(*Old);
+    UINT64 Start = AsmReadTsc();
+
+    ZeroMem(Cur, sizeof(*Cur));
+    Cur->Magic = VERIFY_CACHE_MAGIC;
+    Cur->Version = VERIFY_CACHE_VERSION;
+    CopyMem(Cur->KernelHash, gBootContext.Params.KernelHash, SHA256_DIGEST_LENGTH);
+    VerifyCacheHash(gSignature, gSignatureSize, Cur->SignatureHash);
+    VerifyCacheHash(gPublicKey, gPublicKeySize, Cur->PublicKeyHash);
+    CONST UINT8 *Pcr0;
+    UINT8 Secure = 0;
+    UINTN SecureSize = sizeof(Secure);
+    // PcrCacheFill fails unless all of PCR0-7 came back.
+    gVerifyCache.Keyed = !EFI_ERROR(PcrCacheGet(0, &Pcr0)) &&
+        !EFI_ERROR(gRT->GetVariable(L"SecureBoot", &gEfiGlobalVariableGuid, NULL, &SecureSize, &Secure)) && Secure == 1;
+    if (gVerifyCache.Keyed)
+        VerifyCacheHash(gBootContext.Pcr.Sha256, sizeof(gBootContext.Pcr.Sha256), Cur->PcrDigest);
+
+    EFI_STATUS Status = gRT->GetVariable(VERIFY_CACHE_VARIABLE, &gAiOsVendorGuid, &Attributes, &Size, Old);
+    if (!EFI_ERROR(Status) && Size == sizeof(*Old) && Attributes == VERIFY_CACHE_ATTRIBUTES &&
+        Old->Magic == VERIFY_CACHE_MAGIC && Old->Version == VERIFY_CACHE_VERSION) {
+        VerifyCacheHash(Old, OFFSET_OF(VERIFY_CACHE_ENTRY, Digest), Digest);
+        gVerifyCache.Loaded = CompareMem(Digest, Old->Digest, sizeof(Digest)) == 0;
+    }
+    // Kernel, signature, key and PCR digest are contiguous in the entry.
+    gVerifyCache.SignatureHit = gVerifyCache.Keyed && gVerifyCache.Loaded &&
+        CompareMem(Old->KernelHash, Cur->KernelHash,
+                   OFFSET_OF(VERIFY_CACHE_ENTRY, CertChainHash) - OFFSET_OF(VERIFY_CACHE_ENTRY, KernelHash)) == 0;
+    gVerifyCache.LookupTsc += AsmReadTsc() - Start;
+    return gVerifyCache.SignatureHit;
+}
+
+// Adds the root CA to the key; the chain walk is skipped only if the RSA
+// verify was too.
+static BOOLEAN VerifyCacheChainHit(VOID) {
+    UINT64 Start = AsmReadTsc();
+    VerifyCacheHash(gCertChain, gCertChainSize, gVerifyCache.Current.CertChainHash);
+    gVerifyCache.ChainHit = gVerifyCache.SignatureHit &&
+        CompareMem(gVerifyCache.Stored.CertChainHash, gVerifyCache.Current.CertChainHash, SHA256_DIGEST_LENGTH) == 0;
+    gVerifyCache.LookupTsc += AsmReadTsc() - Start;
+    return gVerifyCache.ChainHit;
+}
+
+static VOID VerifyCacheStore(VOID) {
+    VERIFY_CACHE_ENTRY *Cur = &gVerifyCache.Current;
+    if (!gVerifyCache.Keyed) return;
+    // After a signature-only hit the RSA cost is the one measured earlier.
+    Cur->VerifyTsc = gVerifyCache.SignatureHit ? gVerifyCache.Stored.VerifyTsc : gVerifyCache.VerifyTsc;
+    VerifyCacheHash(Cur, OFFSET_OF(VERIFY_CACHE_ENTRY, Digest), Cur->Digest);
+    EFI_STATUS Status = gRT->SetVariable(VERIFY_CACHE_VARIABLE, &gAiOsVendorGuid,
+                                         VERIFY_CACHE_ATTRIBUTES, sizeof(*Cur), Cur);
+    if (Status == EFI_INVALID_PARAMETER) {
+        // A variable of that name with other attributes is in the way.
+        gRT->SetVariable(VERIFY_CACHE_VARIABLE, &gAiOsVendorGuid, 0, 0, NULL);
+        Status = gRT->SetVariable(VERIFY_CACHE_VARIABLE, &gAiOsVendorGuid,
+                                  VERIFY_CACHE_ATTRIBUTES, sizeof(*Cur), Cur);
+    }
+    if (EFI_ERROR(Status)) Log(LOG_WARN, L"Verify cache not stored: %r", Status);
+}
+
+static VOID VerifyCacheReport(VOID) {
+    UINT64 Lookup = gVerifyCache.LookupTsc;
+    if (gVerifyCache.ChainHit) {
+        UINT64 Saved = gVerifyCache.Stored.VerifyTsc > Lookup ? gVerifyCache.Stored.VerifyTsc - Lookup : 0;
+        Log(LOG_INFO, L"[RT] verify cache: hit, saved %lu TSC (%lu us), lookup %lu us",
+            Saved, Tsc_ToNs(Saved) / 1000, Tsc_ToNs(Lookup) / 1000);
+    } else {
+        Log(LOG_INFO, L"[RT] verify cache: miss%s, verify %lu TSC (%lu us), lookup %lu us",
+            gVerifyCache.SignatureHit ? L" (chain)" : gVerifyCache.Keyed ? L"" : L" (no Secure Boot or PCRs, not stored)",
+            gVerifyCache.VerifyTsc, Tsc_ToNs(gVerifyCache.VerifyTsc) / 1000, Tsc_ToNs(Lookup) / 1000);
+    }
 }
 
 // Phase072: ValidateKernelSignature
@@ -817,69 +1459,66 @@ static EFI_STATUS Phase072_ValidateKernelSignature(BOOT_CONTEXT *Ctx) {
     EFI_STATUS S = EFI_SUCCESS;
     VOID *Rsa = NULL;
 
-    if (EFI_ERROR(LoadPublicKey(Ctx->RootDir))) {
+    if (EFI_ERROR(LoadPublicKey())) {
         Ctx->LastError = ERR_SIG_INVALID;
-        S = EFI_SECURITY_VIOLATION;
-        goto cleanup;
+        return EFI_SECURITY_VIOLATION;
+    }
+    if (gSignature == NULL) {
+        Ctx->LastError = ERR_SIG_NOT_READY;
+        return EFI_NOT_READY;
+    }
+    if (VerifyCacheLookup()) {
+        Ctx->Params.SignatureValid = TRUE;
+        return EFI_SUCCESS;
     }
 
+    UINT64 Start = AsmReadTsc();
     Rsa = RsaNew();
     if (!Rsa) {
         S = EFI_OUT_OF_RESOURCES;
         goto cleanup;
     }
 
-    if (!RsaSetKey(Rsa, gPublicKey, gPublicKeyLength)) {
+    if (!RsaSetKey(Rsa, gPublicKey, gPublicKeySize)) {
         S = EFI_ABORTED;
         goto cleanup;
     }
 
-    if (gSignature == NULL) {
-        Ctx->LastError = ERR_SIG_NOT_READY;
-        S = EFI_NOT_READY;
-        goto cleanup;
-    }
-
-    BOOLEAN Valid = RsaPkcs1Verify(Rsa, gSignature, gSignatureLength,
-                                    Ctx->KernelHash, SHA256_DIGEST_LENGTH);
+    BOOLEAN Valid = RsaPkcs1Verify(Rsa, gSignature, gSignatureSize,
+                                    Ctx->Params.KernelHash, SHA256_DIGEST_LENGTH);
     if (!Valid) {
         Ctx->LastError = ERR_SIG_INVALID;
         S = EFI_SECURITY_VIOLATION;
         goto cleanup;
     }
+    Ctx->Params.SignatureValid = TRUE;
 
 cleanup:
     if (Rsa) RsaFree(Rsa);
+    gVerifyCache.VerifyTsc += AsmReadTsc() - Start;
     return S;
 
 }
 
 // Phase073: LogSignatureStatus
 static EFI_STATUS Phase073_LogSignatureStatus(BOOT_CONTEXT *Ctx) {
-    Print(L"Signature valid: %u\n", gBootContext.Params.SignatureValid);
+    Log(LOG_INFO, L"Signature valid: %u%s", gBootContext.Params.SignatureValid,
+        gVerifyCache.SignatureHit ? L" (verify cache)" : L"");
     return EFI_SUCCESS;
 }
 
 // Phase073A: LoadCertificateChainFromFirmware
 static EFI_STATUS Phase073A_LoadCertificateChainFromFirmware(BOOT_CONTEXT *Ctx) {
     if (gCertChain) return EFI_SUCCESS;
-    EFI_FILE_HANDLE File; EFI_STATUS S;
-    S = Ctx->RootDir->Open(Ctx->RootDir, &File, L"\\EFI\\AiOS\\root_ca.cer", EFI_FILE_MODE_READ, 0);
+    EFI_FILE_HANDLE File; EFI_STATUS S; CONST EFI_FILE_INFO *Info;
+    S = EspOpen(L"\\EFI\\AiOS\\root_ca.cer", &File);
     if (EFI_ERROR(S)) return S;
-    UINTN Sz=0; EFI_FILE_INFO *Info=NULL;
-    S = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, NULL);
-    if (S==EFI_BUFFER_TOO_SMALL) {
-        S = SafeAllocatePool(Sz, (VOID**)&Info, "CACertInfo");
-        if (!EFI_ERROR(S)) {
-            S = File->GetInfo(File, &gEfiFileInfoGuid, &Sz, Info);
-            if (!EFI_ERROR(S)) gCertChainSize = Info->FileSize;
-            SafeFree(Info);
-        }
-    }
-    if (EFI_ERROR(S)) { File->Close(File); return S; }
+    S = EspGetInfo(File, &Info);
+    if (EFI_ERROR(S)) { EspClose(File); return S; }
+    gCertChainSize = Info->FileSize;
     S = SafeAllocatePool(gCertChainSize, (VOID**)&gCertChain, "CACert");
-    if (EFI_ERROR(S)) { File->Close(File); return S; }
-    S = File->Read(File, &gCertChainSize, gCertChain); File->Close(File);
+    if (EFI_ERROR(S)) { EspClose(File); return S; }
+    S = File->Read(File, &gCertChainSize, gCertChain); EspClose(File);
     if (EFI_ERROR(S)) { SafeFree(gCertChain); gCertChain=NULL; return S; }
     gBS->SetMemoryAttributes((EFI_PHYSICAL_ADDRESS)(UINTN)gCertChain,
                              EFI_SIZE_TO_PAGES(gCertChainSize)*EFI_PAGE_SIZE,
@@ -890,8 +1529,12 @@ static EFI_STATUS Phase073A_LoadCertificateChainFromFirmware(BOOT_CONTEXT *Ctx)
 // Phase073B: ValidateSignatureWithCertificateChain
 static EFI_STATUS Phase073B_ValidateSignatureWithCertificateChain(BOOT_CONTEXT *Ctx) {
     if (!gCertChain || gPublicKeySize==0) return EFI_SECURITY_VIOLATION;
-    // Placeholder chain validation logic
     if (!gBootContext.Params.SignatureValid) return EFI_SECURITY_VIOLATION;
+    if (VerifyCacheChainHit()) return EFI_SUCCESS;
+    UINT64 Start = AsmReadTsc();
+    // Placeholder chain validation logic
+    gVerifyCache.VerifyTsc += AsmReadTsc() - Start;
+    VerifyCacheStore();
     return EFI_SUCCESS;
 }
 
@@ -904,21 +1547,11 @@ static UINT8 gPcr0Initial[32];
 
 // Phase075: ReadPcr0ForTrust
 static EFI_STATUS Phase075_ReadPcr0ForTrust(BOOT_CONTEXT *Ctx) {
-    TPML_PCR_SELECTION SelIn = {0};
-    SelIn.count = 1;
-    SelIn.pcrSelections[0].hash = TPM_ALG_SHA256;
-    SelIn.pcrSelections[0].sizeofSelect = 3;
-    SelIn.pcrSelections[0].pcrSelect[0] = 1;
-    TPML_PCR_SELECTION SelOut;
-    TPML_DIGEST Values;
-    UINT32 C;
-    EFI_STATUS Status = Tpm2PcrRead(&SelIn, &C, &SelOut, &Values);
-    if (!EFI_ERROR(Status) && Values.count > 0) {
-        CopyMem(gPcr0Initial, Values.digests[0].buffer, Values.digests[0].size);
-        Print(L"PCR0: ");
-        for (UINTN i = 0; i < Values.digests[0].size; ++i)
-            Print(L"%02x", Values.digests[0].buffer[i]);
-        Print(L"\n");
+    CONST UINT8 *Pcr0;
+    EFI_STATUS Status = PcrCacheGet(0, &Pcr0);
+    if (!EFI_ERROR(Status)) {
+        CopyMem(gPcr0Initial, Pcr0, sizeof(gPcr0Initial));
+        LogHex(LOG_INFO, Pcr0, SHA256_DIGEST_LENGTH, L"PCR0: ");
     }
     return Status;
 }
@@ -935,10 +1568,10 @@ static EFI_STATUS Phase076_ReadSecureBootState(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase077_ComputeBootTrustScore(BOOT_CONTEXT *Ctx) {
     UINT32 Score = 0;
     if (gBootContext.Params.SignatureValid) Score += 60;
-    TPML_PCR_SELECTION SelIn={0}; SelIn.count=1; SelIn.pcrSelections[0].hash=TPM_ALG_SHA256; SelIn.pcrSelections[0].sizeofSelect=3; SelIn.pcrSelections[0].pcrSelect[0]=1;
-    TPML_PCR_SELECTION SelOut; TPML_DIGEST Values; UINT32 C; BOOLEAN PcrMatch=FALSE;
-    if (!EFI_ERROR(Tpm2PcrRead(&SelIn,&C,&SelOut,&Values)) && Values.count>0) {
-        PcrMatch = (CompareMem(gPcr0Initial, Values.digests[0].buffer, Values.digests[0].size)==0);
+    // Phase151 re-reads PCR0 from the TPM; here the batch value is enough.
+    CONST UINT8 *Pcr0; BOOLEAN PcrMatch=FALSE;
+    if (!EFI_ERROR(PcrCacheGet(0, &Pcr0))) {
+        PcrMatch = (CompareMem(gPcr0Initial, Pcr0, sizeof(gPcr0Initial))==0);
         if (PcrMatch) Score += 20;
     }
     UINT8 Secure=0; UINTN Sz=sizeof(Secure);
@@ -956,7 +1589,7 @@ static EFI_STATUS Phase077_ComputeBootTrustScore(BOOT_CONTEXT *Ctx) {
 
 // Phase078: LogBootTrustScore
 static EFI_STATUS Phase078_LogBootTrustScore(BOOT_CONTEXT *Ctx) {
-    Print(L"Boot trust score: %u\n", gBootContext.Params.BootTrustScore);
+    Log(LOG_INFO, L"Boot trust score: %u", gBootContext.Params.BootTrustScore);
     for (INTN i=3;i>0;i--) {
         gBootContext.BootDNA.BootScoreHistory[i]=gBootContext.BootDNA.BootScoreHistory[i-1];
         CopyMem(gBootContext.BootDNA.HashHistory[i], gBootContext.BootDNA.HashHistory[i-1],32);
@@ -968,7 +1601,7 @@ static EFI_STATUS Phase078_LogBootTrustScore(BOOT_CONTEXT *Ctx) {
 
 // Phase079: InitIdentityStructure
 static EFI_STATUS Phase079_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 079 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 079 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -987,24 +1620,25 @@ static EFI_STATUS Phase080_GenerateBootUid(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase081_DrawAiLogo(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Gop==NULL) return EFI_UNSUPPORTED;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL W={255,255,255,0};
-    for (UINTN y=0;y<32;y++)
-        for (UINTN x=0;x<32;x++)
-            if (x==0||y==0||x==31||y==31||x==y||x==31-y)
-                gBootContext.Gop->Blt(gBootContext.Gop,&W,EfiBltVideoFill,0,0,x+10,y+10,1,1,0);
+    BootGfx_FillRect(&gGfx, 10, 10, 32, 1, W);
+    BootGfx_FillRect(&gGfx, 10, 41, 32, 1, W);
+    BootGfx_FillRect(&gGfx, 10, 10, 1, 32, W);
+    BootGfx_FillRect(&gGfx, 41, 10, 1, 32, W);
+    BootGfx_DrawLine(&gGfx, 10, 10, 41, 41, W);
+    BootGfx_DrawLine(&gGfx, 41, 10, 10, 41, W);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
 // Phase082: ShowTrustScore
 static EFI_STATUS Phase082_ShowTrustScore(BOOT_CONTEXT *Ctx) {
-    Print(L"Trust Score: %u\n", gBootContext.Params.BootTrustScore);
+    Log(LOG_INFO, L"Trust Score: %u", gBootContext.Params.BootTrustScore);
     return EFI_SUCCESS;
 }
 
 // Phase083: ShowBootUid
 static EFI_STATUS Phase083_ShowBootUid(BOOT_CONTEXT *Ctx) {
-    Print(L"Boot UID: ");
-    for (UINTN i=0;i<16;i++) Print(L"%02x", gBootContext.Params.BootUid[i]);
-    Print(L"\n");
+    LogHex(LOG_INFO, gBootContext.Params.BootUid, 16, L"Boot UID: ");
     gBootContext.BootDNA.BootUID = *(UINT64*)gBootContext.Params.BootUid;
     return EFI_SUCCESS;
 }
@@ -1017,61 +1651,61 @@ static EFI_STATUS Phase084_CleanupSignatureBuffer(BOOT_CONTEXT *Ctx) {
 
 // Phase085: FinalizeIdentity
 static EFI_STATUS Phase085_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 085 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 085 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase086: BootReady
-static EFI_STATUS Phase086_BootReady(BOOT_CONTEXT *Ctx) { Print(L"Boot preparation complete\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase086_BootReady(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Boot preparation complete"); return EFI_SUCCESS; }
 
 // Phase087: AwakeMessage
-static EFI_STATUS Phase087_AwakeMessage(BOOT_CONTEXT *Ctx) { Print(L"Awakening AI...\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase087_AwakeMessage(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Awakening AI..."); return EFI_SUCCESS; }
 
 // Phase088: FinalStep
-static EFI_STATUS Phase088_FinalStep(BOOT_CONTEXT *Ctx) { Print(L"Bootloader finished\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase088_FinalStep(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Bootloader finished"); return EFI_SUCCESS; }
 
 // Phase089: ClearScreen
 static EFI_STATUS Phase089_ClearScreen(BOOT_CONTEXT *Ctx){ return gST->ConOut->ClearScreen(gST->ConOut); }
 // Phase090: PrintGoodbye
-static EFI_STATUS Phase090_PrintGoodbye(BOOT_CONTEXT *Ctx){ Print(L"Ready to launch kernel\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase090_PrintGoodbye(BOOT_CONTEXT *Ctx){ Log(LOG_INFO, L"Ready to launch kernel"); return EFI_SUCCESS; }
 // Phase091: WaitForKey
 static EFI_STATUS Phase091_WaitForKey(BOOT_CONTEXT *Ctx){ EFI_INPUT_KEY K; return gST->ConIn->ReadKeyStroke(gST->ConIn,&K); }
 // Phase092: FreeMemoryMap
 static EFI_STATUS Phase092_FreeMemoryMap(BOOT_CONTEXT *Ctx){ if(gBootContext.Params.MemoryMap){ SafeFree(gBootContext.Params.MemoryMap); gBootContext.Params.MemoryMap=NULL; } return EFI_SUCCESS; }
 // Phase093: EndGraphics
 static EFI_STATUS Phase093_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 093 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 093 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase094: ShutdownTcg
 static EFI_STATUS Phase094_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 094 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 094 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase095: FreePhdrs
 static EFI_STATUS Phase095_FreePhdrs(BOOT_CONTEXT *Ctx){ if(gPhdrs){ SafeFree(gPhdrs); gPhdrs=NULL; } return EFI_SUCCESS; }
 // Phase096: LogCompletion
-static EFI_STATUS Phase096_LogCompletion(BOOT_CONTEXT *Ctx){ Print(L"All phases complete\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase096_LogCompletion(BOOT_CONTEXT *Ctx){ Log(LOG_INFO, L"All phases complete"); return EFI_SUCCESS; }
 // Phase097: FinalPause
 static EFI_STATUS Phase097_FinalPause(BOOT_CONTEXT *Ctx){ gBS->Stall(500000); return EFI_SUCCESS; }
 // Phase098: FinalMessage
-static EFI_STATUS Phase098_FinalMessage(BOOT_CONTEXT *Ctx){ Print(L"Handing off to kernel...\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase098_FinalMessage(BOOT_CONTEXT *Ctx){ Log(LOG_INFO, L"Handing off to kernel..."); return EFI_SUCCESS; }
 // Phase099: NoOp
 static EFI_STATUS Phase099_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 099 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 099 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase100: BootComplete
-static EFI_STATUS Phase100_BootComplete(BOOT_CONTEXT *Ctx){ Print(L"Boot complete.\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase100_BootComplete(BOOT_CONTEXT *Ctx){ Log(LOG_INFO, L"Boot complete."); return EFI_SUCCESS; }
 
 // ==================== Phases 101-150 ====================
 
 // Phase101: CloseFileHandles
 static EFI_STATUS Phase101_CloseFileHandles(BOOT_CONTEXT *Ctx) {
-    if (gBootContext.KernelFile) {
-        gBootContext.KernelFile->Close(gBootContext.KernelFile);
-        gBootContext.KernelFile = NULL;
-    }
+    // The kernel and signature handles are cache entries, closed here.
+    EspCacheFlush();
+    gBootContext.KernelFile = NULL;
+    gSigFile = NULL;
     if (gBootContext.RootDir) {
         gBootContext.RootDir->Close(gBootContext.RootDir);
         gBootContext.RootDir = NULL;
@@ -1081,32 +1715,22 @@ static EFI_STATUS Phase101_CloseFileHandles(BOOT_CONTEXT *Ctx) {
 
 // Phase102: UpdateMemoryMap
 static EFI_STATUS Phase102_UpdateMemoryMap(BOOT_CONTEXT *Ctx) {
-    if (!gBootContext.Params.MemoryMap)
-        return EFI_NOT_READY;
-    UINTN MapSize = gBootContext.Params.MemoryMapSize;
-    EFI_STATUS Status = gBS->GetMemoryMap(&MapSize, gBootContext.Params.MemoryMap,
-        &gBootContext.Params.MapKey, &gBootContext.Params.DescriptorSize,
-        &gBootContext.Params.DescriptorVersion);
+    EFI_STATUS Status = RefreshMemoryMap();
     if (!EFI_ERROR(Status)) {
-        gBootContext.Params.MemoryMapSize = MapSize;
-        Print(L"Memory map refreshed, MapKey=%lx\n", gBootContext.Params.MapKey);
+        Log(LOG_INFO, L"Memory map refreshed, MapKey=%lx", gBootContext.Params.MapKey);
     } else {
-        Print(L"GetMemoryMap failed: %r\n", Status);
+        Log(LOG_ERROR, L"GetMemoryMap failed: %r", Status);
     }
     return Status;
 }
 
 // Phase103: CheckMapKeyValid
 static EFI_STATUS Phase103_CheckMapKeyValid(BOOT_CONTEXT *Ctx) {
-    UINTN MapSize = 0, MapKeyCheck = 0, DescSize = 0; UINT32 DescVer = 0;
-    EFI_STATUS Status = gBS->GetMemoryMap(&MapSize, NULL, &MapKeyCheck, &DescSize, &DescVer);
-    if (Status != EFI_BUFFER_TOO_SMALL)
-        return Status;
-    Status = gBS->GetMemoryMap(&MapSize, gBootContext.Params.MemoryMap,
-                               &MapKeyCheck, &DescSize, &DescVer);
-    if (!EFI_ERROR(Status) && MapKeyCheck != gBootContext.Params.MapKey) {
-        Print(L"Warning: MapKey mismatch. Current=%lx New=%lx\n",
-              gBootContext.Params.MapKey, MapKeyCheck);
+    UINTN MapKey = gBootContext.Params.MapKey;
+    EFI_STATUS Status = RefreshMemoryMap();
+    if (!EFI_ERROR(Status) && MapKey != gBootContext.Params.MapKey) {
+        Log(LOG_WARN, L"Warning: MapKey mismatch. Current=%lx New=%lx",
+              MapKey, gBootContext.Params.MapKey);
     }
     return EFI_SUCCESS;
 }
@@ -1114,13 +1738,13 @@ static EFI_STATUS Phase103_CheckMapKeyValid(BOOT_CONTEXT *Ctx) {
 // Phase104: PreExitBootCheck
 static EFI_STATUS Phase104_PreExitBootCheck(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Params.MapKey == 0)
-        Print(L"Warning: MapKey is zero before ExitBootServices\n");
+        Log(LOG_WARN, L"Warning: MapKey is zero before ExitBootServices");
     return EFI_SUCCESS;
 }
 
 // Phase105: ExitBootServicesReady
 static EFI_STATUS Phase105_ExitBootServicesReady(BOOT_CONTEXT *Ctx) {
-    Print(L"ExitBootServices preparation done\n");
+    Log(LOG_INFO, L"ExitBootServices preparation done");
     return EFI_SUCCESS;
 }
 
@@ -1131,11 +1755,11 @@ static EFI_STATUS Phase106_LocateRsdp(BOOT_CONTEXT *Ctx) {
         if (CompareGuid(&Table[i].VendorGuid, &gEfiAcpi20TableGuid) ||
             CompareGuid(&Table[i].VendorGuid, &gEfiAcpi10TableGuid)) {
             gRsdp = (ACPI_RSDP*)Table[i].VendorTable;
-            Print(L"RSDP @ %p\n", gRsdp);
+            Log(LOG_INFO, L"RSDP @ %p", gRsdp);
             return EFI_SUCCESS;
         }
     }
-    Print(L"RSDP not found\n");
+    Log(LOG_WARN, L"RSDP not found");
     return EFI_NOT_FOUND;
 }
 
@@ -1144,7 +1768,7 @@ static EFI_STATUS Phase107_LogRsdpInfo(BOOT_CONTEXT *Ctx) {
     if (!gRsdp) return EFI_NOT_FOUND;
     CHAR8 OemId[7];
     CopyMem(OemId, gRsdp->OemId, 6); OemId[6] = '\0';
-    Print(L"ACPI Rev %u OEM %a\n", gRsdp->Revision, OemId);
+    Log(LOG_INFO, L"ACPI Rev %u OEM %a", gRsdp->Revision, OemId);
     return EFI_SUCCESS;
 }
 
@@ -1156,42 +1780,47 @@ static EFI_STATUS Phase108_LocateXsdt(BOOT_CONTEXT *Ctx) {
     } else {
         gXsdt = (ACPI_SDT_HEADER*)(UINTN)gRsdp->RsdtAddress;
     }
-    if (gXsdt) {
-        Print(L"XSDT/RSDT @ %p\n", gXsdt);
-        return EFI_SUCCESS;
+    if (!gXsdt) return EFI_NOT_FOUND;
+    Log(LOG_INFO, L"XSDT/RSDT @ %p", gXsdt);
+
+    // One walk over every table; later lookups go through the index.
+    if (gBootContext.Params.AcpiTables == NULL) {
+        EFI_PHYSICAL_ADDRESS Page;
+        EFI_STATUS Status = SafeAllocatePages(AllocateAnyPages, EfiLoaderData,
+            EFI_SIZE_TO_PAGES(sizeof(ACPI_INDEX)), &Page, "AcpiIndex");
+        if (EFI_ERROR(Status)) return Status;
+        gBootContext.Params.AcpiTables = (ACPI_INDEX*)(UINTN)Page;
     }
-    return EFI_NOT_FOUND;
+    ACPI_INDEX *Idx = gBootContext.Params.AcpiTables;
+    UINT64 Start = AsmReadTsc();
+    EFI_STATUS Status = AcpiIndex_Build(Idx, gXsdt);
+    UINT64 Ns = Tsc_ToNs(AsmReadTsc() - Start);
+    if (EFI_ERROR(Status)) return Status;
+    Log(LOG_INFO, L"ACPI index: %u tables, %u bad, %lu KiB summed in %lu us",
+        Idx->Count, Idx->BadChecksums, Idx->ChecksumBytes / 1024, Ns / 1000);
+    return EFI_SUCCESS;
 }
 
 // Phase109: FindFadt
 static EFI_STATUS Phase109_FindFadt(BOOT_CONTEXT *Ctx) {
-    if (!gXsdt) return EFI_NOT_FOUND;
-    UINTN EntrySize = (gXsdt->Revision >= 2) ? sizeof(UINT64) : sizeof(UINT32);
-    UINTN Count = (gXsdt->Length - sizeof(ACPI_SDT_HEADER)) / EntrySize;
-    UINT8 *Ptr = (UINT8*)gXsdt + sizeof(ACPI_SDT_HEADER);
-    for (UINTN i = 0; i < Count; ++i) {
-        UINT64 Address = (EntrySize == sizeof(UINT64)) ?
-            ((UINT64*)Ptr)[i] : (UINT64)((UINT32*)Ptr)[i];
-        ACPI_SDT_HEADER *Hdr = (ACPI_SDT_HEADER*)(UINTN)Address;
-        if (Hdr && Hdr->Signature == SIGNATURE_32('F','A','C','P')) {
-            gFadt = (ACPI_FADT*)Hdr;
-            Print(L"FADT found @ %p\n", gFadt);
-            return EFI_SUCCESS;
-        }
+    if (!gBootContext.Params.AcpiTables) return EFI_NOT_FOUND;
+    const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(gBootContext.Params.AcpiTables, SIGNATURE_32('F','A','C','P'));
+    if (E) {
+        gFadt = (ACPI_FADT*)(UINTN)E->Address;
+        Log(LOG_INFO, L"FADT found @ %p", gFadt);
+        return EFI_SUCCESS;
     }
-    Print(L"FADT not present\n");
+    Log(LOG_WARN, L"FADT not present");
     return EFI_NOT_FOUND;
 }
 
 // Phase110: LocateDsdt
 static EFI_STATUS Phase110_LocateDsdt(BOOT_CONTEXT *Ctx) {
     if (!gFadt) return EFI_NOT_FOUND;
-    if (gFadt->XDsdt)
-        gDsdt = (ACPI_SDT_HEADER*)(UINTN)gFadt->XDsdt;
-    else
-        gDsdt = (ACPI_SDT_HEADER*)(UINTN)gFadt->Dsdt;
+    const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(gBootContext.Params.AcpiTables, SIGNATURE_32('D','S','D','T'));
+    gDsdt = E ? (ACPI_SDT_HEADER*)(UINTN)E->Address : NULL;
     if (gDsdt)
-        Print(L"DSDT @ %p\n", gDsdt);
+        Log(LOG_INFO, L"DSDT @ %p", gDsdt);
     return gDsdt ? EFI_SUCCESS : EFI_NOT_FOUND;
 }
 
@@ -1200,14 +1829,14 @@ static EFI_STATUS Phase111_LogAcpiOemId(BOOT_CONTEXT *Ctx) {
     if (!gFadt) return EFI_NOT_FOUND;
     CHAR8 OemId[7];
     CopyMem(OemId, gFadt->Header.OemId, 6); OemId[6] = '\0';
-    Print(L"ACPI OEM ID: %a\n", OemId);
+    Log(LOG_INFO, L"ACPI OEM ID: %a", OemId);
     return EFI_SUCCESS;
 }
 
 // Phase112: ParseFADT
 static EFI_STATUS Phase112_ParseFADT(BOOT_CONTEXT *Ctx) {
     if (!gFadt) return EFI_NOT_FOUND;
-    Print(L"FADT Rev %u Flags %08x\n", gFadt->Header.Revision, gFadt->Header.CreatorRevision);
+    Log(LOG_INFO, L"FADT Rev %u Flags %08x", gFadt->Header.Revision, gFadt->Header.CreatorRevision);
     return EFI_SUCCESS;
 }
 
@@ -1216,7 +1845,7 @@ static EFI_STATUS Phase113_ParseDsdtHeader(BOOT_CONTEXT *Ctx) {
     if (!gDsdt) return EFI_NOT_FOUND;
     CHAR8 OemId[7];
     CopyMem(OemId, gDsdt->OemId, 6); OemId[6] = '\0';
-    Print(L"DSDT OEM %a Rev %u\n", OemId, gDsdt->Revision);
+    Log(LOG_INFO, L"DSDT OEM %a Rev %u", OemId, gDsdt->Revision);
     return EFI_SUCCESS;
 }
 
@@ -1233,13 +1862,13 @@ static EFI_STATUS Phase114_StoreAcpiAddresses(BOOT_CONTEXT *Ctx) {
     Buf[0] = (UINT64)(UINTN)gRsdp;
     Buf[1] = (UINT64)(UINTN)gFadt;
     Buf[2] = (UINT64)(UINTN)gDsdt;
-    Print(L"ACPI addresses stored at %lx\n", gTrustScoreBlock);
+    Log(LOG_INFO, L"ACPI addresses stored at %lx", gTrustScoreBlock);
     return EFI_SUCCESS;
 }
 
 // Phase115: AcpiParsingComplete
 static EFI_STATUS Phase115_AcpiParsingComplete(BOOT_CONTEXT *Ctx) {
-    Print(L"ACPI parsing complete\n");
+    Log(LOG_INFO, L"ACPI parsing complete");
     return EFI_SUCCESS;
 }
 
@@ -1251,9 +1880,9 @@ static EFI_STATUS Phase116_DrawProgressBar(BOOT_CONTEXT *Ctx) {
     UINTN Height = 8;
     UINTN X = (gBootContext.Gop->Mode->Info->HorizontalResolution - Width) / 2;
     UINTN Y = gBootContext.Gop->Mode->Info->VerticalResolution - 20;
-    gBootContext.Gop->Blt(gBootContext.Gop, &Pixel, EfiBltVideoFill, 0, 0, X, Y,
-                          Width * gBootContext.Params.BootTrustScore / 100,
-                          Height, 0);
+    BootGfx_FillRect(&gGfx, (UINT32)X, (UINT32)Y,
+                     (UINT32)(Width * gBootContext.Params.BootTrustScore / 100), (UINT32)Height, Pixel);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
@@ -1271,16 +1900,14 @@ static EFI_STATUS Phase117_DrawTrustScoreBar(BOOT_CONTEXT *Ctx) {
     UINTN X = (gBootContext.Gop->Mode->Info->HorizontalResolution - Width) / 2;
     UINTN Y = gBootContext.Gop->Mode->Info->VerticalResolution - 40;
     UINTN Bar = Width * gBootContext.Params.BootTrustScore / 100;
-    gBootContext.Gop->Blt(gBootContext.Gop, Color, EfiBltVideoFill, 0,0, X, Y,
-                          Bar, 6,0);
+    BootGfx_FillRect(&gGfx, (UINT32)X, (UINT32)Y, (UINT32)Bar, 6, *Color);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
 // Phase118: DisplayBootUid
 static EFI_STATUS Phase118_DisplayBootUid(BOOT_CONTEXT *Ctx) {
-    Print(L"BootUID: ");
-    for (UINTN i = 0; i < 16; ++i) Print(L"%02x", gBootContext.Params.BootUid[i]);
-    Print(L"\n");
+    LogHex(LOG_INFO, gBootContext.Params.BootUid, 16, L"BootUID: ");
     return EFI_SUCCESS;
 }
 
@@ -1290,20 +1917,19 @@ static EFI_STATUS Phase119_DisplaySecureBootState(BOOT_CONTEXT *Ctx) {
     EFI_STATUS Status = gRT->GetVariable(L"SecureBoot", &gEfiGlobalVariableGuid,
                                          NULL, &Size, &Value);
     if (!EFI_ERROR(Status))
-        Print(L"SecureBoot %u\n", Value);
+        Log(LOG_INFO, L"SecureBoot %u", Value);
     return EFI_SUCCESS;
 }
 
 // Phase120: DisplaySignatureState
 static EFI_STATUS Phase120_DisplaySignatureState(BOOT_CONTEXT *Ctx) {
-    Print(L"Signature valid: %u\n", gBootContext.Params.SignatureValid);
+    Log(LOG_INFO, L"Signature valid: %u", gBootContext.Params.SignatureValid);
     return EFI_SUCCESS;
 }
 
 // Phase121: AnimateDots
 static EFI_STATUS Phase121_AnimateDots(BOOT_CONTEXT *Ctx) {
-    for (UINTN i = 0; i < 3; ++i) { Print(L"." ); gBS->Stall(100000); }
-    Print(L"\n");
+    Log(LOG_DEBUG, L"...");
     return EFI_SUCCESS;
 }
 
@@ -1311,18 +1937,8 @@ static EFI_STATUS Phase121_AnimateDots(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase122_DrawBootText(BOOT_CONTEXT *Ctx) {
     if (!gBootContext.Gop) return EFI_UNSUPPORTED;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL White = {255,255,255,0};
-    CHAR16 *Text = L"AiOS Loader";
-    UINTN X = 10, Y = 10;
-    for (; *Text; ++Text, X += 8) {
-        UINT8 *Glyph = font8x8_basic[*Text & 0x7F];
-        for (UINTN gy = 0; gy < 8; ++gy) {
-            for (UINTN gx = 0; gx < 8; ++gx) {
-                if (Glyph[gy] & (1 << gx))
-                    gBootContext.Gop->Blt(gBootContext.Gop, &White,
-                        EfiBltVideoFill, 0, 0, X + gx, Y + gy, 1,1,0);
-            }
-        }
-    }
+    BootGfx_DrawText(&gGfx, 10, 10, L"AiOS Loader", White);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
@@ -1336,41 +1952,36 @@ static EFI_STATUS Phase123_UpdateProgressAnimation(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase124_DrawFinalBar(BOOT_CONTEXT *Ctx) {
     if (!gBootContext.Gop) return EFI_UNSUPPORTED;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL Blue = {255,0,0,0};
-    gBootContext.Gop->Blt(gBootContext.Gop, &Blue, EfiBltVideoFill, 0,0,0,0, 5,5,0);
+    BootGfx_FillRect(&gGfx, 0, 0, 5, 5, Blue);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
 // Phase125: FramebufferComplete
 static EFI_STATUS Phase125_FramebufferComplete(BOOT_CONTEXT *Ctx) {
-    Print(L"Framebuffer visuals ready\n");
+    Log(LOG_INFO, L"Framebuffer visuals ready");
     return EFI_SUCCESS;
 }
 
 // Phase126: ScanMemory
 static EFI_STATUS Phase126_ScanMemory(BOOT_CONTEXT *Ctx) {
-    if (!gBootContext.Params.MemoryMap) return EFI_NOT_READY;
-    UINTN Count = gBootContext.Params.MemoryMapSize / gBootContext.Params.DescriptorSize;
-    UINT64 Pages = 0;
-    for (UINTN i = 0; i < Count; ++i) {
-        EFI_MEMORY_DESCRIPTOR *Desc = (EFI_MEMORY_DESCRIPTOR*)((UINT8*)gBootContext.Params.MemoryMap + i * gBootContext.Params.DescriptorSize);
-        if (Desc->Type == EfiConventionalMemory)
-            Pages += Desc->NumberOfPages;
-    }
+    if (!gBootContext.Params.MemoryRegions) return EFI_NOT_READY;
+    UINT64 Pages = MemoryRegions_TypePages(gBootContext.Params.MemoryRegions, EfiConventionalMemory);
     gBootContext.Params.KernelSize = Pages; // reuse field as temporary storage
-    Print(L"Available pages: %lu\n", Pages);
+    Log(LOG_INFO, L"Available pages: %lu", Pages);
     return EFI_SUCCESS;
 }
 
 // Phase127: DetectMemoryGaps
 static EFI_STATUS Phase127_DetectMemoryGaps(BOOT_CONTEXT *Ctx) {
-    if (!gBootContext.Params.MemoryMap) return EFI_NOT_READY;
-    UINTN Count = gBootContext.Params.MemoryMapSize / gBootContext.Params.DescriptorSize;
+    const MEMORY_REGION_INDEX *Idx = gBootContext.Params.MemoryRegions;
+    if (!Idx) return EFI_NOT_READY;
     EFI_PHYSICAL_ADDRESS LastEnd = 0;
-    for (UINTN i = 0; i < Count; ++i) {
-        EFI_MEMORY_DESCRIPTOR *Desc = (EFI_MEMORY_DESCRIPTOR*)((UINT8*)gBootContext.Params.MemoryMap + i * gBootContext.Params.DescriptorSize);
-        if (LastEnd && Desc->PhysicalStart > LastEnd + 10 * 4096ULL)
-            Print(L"Gap after %lx size %lx\n", LastEnd, Desc->PhysicalStart - LastEnd);
-        LastEnd = Desc->PhysicalStart + EFI_PAGES_TO_SIZE(Desc->NumberOfPages);
+    for (UINTN i = 0; i < Idx->Count; ++i) {
+        const MEMORY_REGION *R = &Idx->Region[i];
+        if (LastEnd && R->Base > LastEnd + 10 * 4096ULL)
+            Log(LOG_INFO, L"Gap after %lx size %lx", LastEnd, R->Base - LastEnd);
+        LastEnd = R->Base + EFI_PAGES_TO_SIZE(R->Pages);
     }
     return EFI_SUCCESS;
 }
@@ -1381,7 +1992,7 @@ static EFI_STATUS Phase128_ComputeEntropy(BOOT_CONTEXT *Ctx) {
     UINT64 Pages = gBootContext.Params.KernelSize;
     UINT64 Entropy = Ticks ^ Pages;
     CopyMem(&gBootContext.Params.BootUid[0], &Entropy, sizeof(UINT64));
-    Print(L"Entropy value %lx\n", Entropy);
+    Log(LOG_INFO, L"Entropy value %lx", Entropy);
     return EFI_SUCCESS;
 }
 
@@ -1395,19 +2006,19 @@ static EFI_STATUS Phase129_StoreEntropy(BOOT_CONTEXT *Ctx) {
 
 // Phase130: LogEntropy
 static EFI_STATUS Phase130_LogEntropy(BOOT_CONTEXT *Ctx) {
-    Print(L"Entropy stored\n");
+    Log(LOG_INFO, L"Entropy stored");
     return EFI_SUCCESS;
 }
 
 // Phase131: CheckMemory
 static EFI_STATUS Phase131_CheckMemory(BOOT_CONTEXT *Ctx) {
-    Print(L"Memory scan complete\n");
+    Log(LOG_INFO, L"Memory scan complete");
     return EFI_SUCCESS;
 }
 
 // Phase132: FinalizeMemoryScan
 static EFI_STATUS Phase132_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 132 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 132 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -1419,13 +2030,13 @@ static EFI_STATUS Phase133_RandomDelay(BOOT_CONTEXT *Ctx) {
 
 // Phase134: MemoryScanningComplete
 static EFI_STATUS Phase134_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 134 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 134 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase135: ReserveTime
 static EFI_STATUS Phase135_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 135 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 135 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -1437,68 +2048,68 @@ static EFI_STATUS Phase136_RecordTpmTimer(BOOT_CONTEXT *Ctx) {
 
 // Phase137: RecordFsTimer
 static EFI_STATUS Phase137_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 137 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 137 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase138: RecordHashTimer
 static EFI_STATUS Phase138_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 138 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 138 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase139: RecordElfTimer
 static EFI_STATUS Phase139_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 139 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 139 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase140: ComputeBootTime
 static EFI_STATUS Phase140_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 140 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 140 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase141: PrepareBootScoreWeight
 static EFI_STATUS Phase141_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 141 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 141 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase142: LogTimingSummary
 static EFI_STATUS Phase142_LogTimingSummary(BOOT_CONTEXT *Ctx) {
-    Print(L"Timing summary ready\n");
+    Log(LOG_INFO, L"Timing summary ready");
     return EFI_SUCCESS;
 }
 
 // Phase143: StoreTimerData
 static EFI_STATUS Phase143_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 143 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 143 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase144: RealTimePrepComplete
 static EFI_STATUS Phase144_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 144 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 144 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase145: LogBootEstimate
 static EFI_STATUS Phase145_LogBootEstimate(BOOT_CONTEXT *Ctx) {
-    Print(L"Boot time estimate complete\n");
+    Log(LOG_INFO, L"Boot time estimate complete");
     return EFI_SUCCESS;
 }
 
 // Phase146: PrintSummary
 static EFI_STATUS Phase146_PrintSummary(BOOT_CONTEXT *Ctx) {
-    Print(L"Boot trust %u\n", gBootContext.Params.BootTrustScore);
+    Log(LOG_INFO, L"Boot trust %u", gBootContext.Params.BootTrustScore);
     return EFI_SUCCESS;
 }
 
 // Phase147: HighlightFailures
 static EFI_STATUS Phase147_HighlightFailures(BOOT_CONTEXT *Ctx) {
     if (!gBootContext.Params.SignatureValid)
-        Print(L"!!! Signature verification FAILED !!!\n");
+        Log(LOG_ERROR, L"!!! Signature verification FAILED !!!");
     return EFI_SUCCESS;
 }
 
@@ -1526,7 +2137,7 @@ static EFI_STATUS Phase149_StorePayloadPointers(BOOT_CONTEXT *Ctx) {
 
 // Phase150: FinalHandoffPrep
 static EFI_STATUS Phase150_FinalHandoffPrep(BOOT_CONTEXT *Ctx) {
-    Print(L"Final handoff preparation done\n");
+    Log(LOG_INFO, L"Final handoff preparation done");
     return EFI_SUCCESS;
 }
 
@@ -1534,18 +2145,15 @@ static EFI_STATUS Phase150_FinalHandoffPrep(BOOT_CONTEXT *Ctx) {
 
 // Phase151: VerifyPcr0Again
 static EFI_STATUS Phase151_VerifyPcr0Again(BOOT_CONTEXT *Ctx) {
-    TPML_PCR_SELECTION SelIn = {0};
-    SelIn.count = 1;
-    SelIn.pcrSelections[0].hash = TPM_ALG_SHA256;
-    SelIn.pcrSelections[0].sizeofSelect = 3;
-    SelIn.pcrSelections[0].pcrSelect[0] = 1;
+    TPML_PCR_SELECTION SelIn;
     TPML_PCR_SELECTION SelOut;
     TPML_DIGEST Values;
     UINT32 C;
-    EFI_STATUS Status = Tpm2PcrRead(&SelIn, &C, &SelOut, &Values);
+    PcrSelectSha256(&SelIn, 1);
+    EFI_STATUS Status = Tpm2PcrReadTimed(&SelIn, &C, &SelOut, &Values);
     if (!EFI_ERROR(Status) && Values.count > 0) {
         if (CompareMem(gPcr0Initial, Values.digests[0].buffer, Values.digests[0].size) != 0) {
-            Print(L"PCR0 changed, lockdown!\n");
+            Log(LOG_WARN, L"PCR0 changed, lockdown!");
             gBootContext.Params.BootTrustScore = 0;
             Status = EFI_SECURITY_VIOLATION;
         }
@@ -1567,10 +2175,8 @@ static EFI_STATUS Phase152_CopyTrustDataToMemory(BOOT_CONTEXT *Ctx) {
 
 // Phase153: PrintTrustMetrics
 static EFI_STATUS Phase153_PrintTrustMetrics(BOOT_CONTEXT *Ctx) {
-    Print(L"TrustScore=%u\n", gBootContext.Params.BootTrustScore);
-    Print(L"BootUID: ");
-    for (UINTN i = 0; i < 16; ++i) Print(L"%02x", gBootContext.Params.BootUid[i]);
-    Print(L"\n");
+    Log(LOG_INFO, L"TrustScore=%u", gBootContext.Params.BootTrustScore);
+    LogHex(LOG_INFO, gBootContext.Params.BootUid, 16, L"BootUID: ");
     gBootContext.Trust.SignatureValid = gBootContext.Params.SignatureValid ? 1 : 0;
     gBootContext.Trust.TotalScore = (UINT8)gBootContext.Params.BootTrustScore;
     return EFI_SUCCESS;
@@ -1579,7 +2185,7 @@ static EFI_STATUS Phase153_PrintTrustMetrics(BOOT_CONTEXT *Ctx) {
 // Phase154: CheckSignatureWarning
 static EFI_STATUS Phase154_CheckSignatureWarning(BOOT_CONTEXT *Ctx) {
     if (!gBootContext.Params.SignatureValid)
-        Print(L"WARNING: Kernel signature invalid!\n");
+        Log(LOG_WARN, L"WARNING: Kernel signature invalid!");
     return EFI_SUCCESS;
 }
 
@@ -1591,16 +2197,15 @@ static EFI_STATUS Phase155_RenderWarningLogo(BOOT_CONTEXT *Ctx) {
     UINT32 W = 64, H = 64;
     UINT32 CenterX = gBootContext.Gop->Mode->Info->HorizontalResolution/2 - W/2;
     UINT32 CenterY = gBootContext.Gop->Mode->Info->VerticalResolution/2 - H/2;
-    for (UINT32 y=0;y<H;y++)
-        for (UINT32 x=0;x<W;x++)
-            if (x==y || x==W-1-y)
-                gBootContext.Gop->Blt(gBootContext.Gop,&R,EfiBltVideoFill,0,0,CenterX+x,CenterY+y,1,1,0);
+    BootGfx_DrawLine(&gGfx, CenterX, CenterY, CenterX+W-1, CenterY+H-1, R);
+    BootGfx_DrawLine(&gGfx, CenterX+W-1, CenterY, CenterX, CenterY+H-1, R);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
 // Phase156: LogTrustRegion
 static EFI_STATUS Phase156_LogTrustRegion(BOOT_CONTEXT *Ctx) {
-    Print(L"Trust data stored at %lx\n", gTrustScoreBlock);
+    Log(LOG_INFO, L"Trust data stored at %lx", gTrustScoreBlock);
     return EFI_SUCCESS;
 }
 
@@ -1636,18 +2241,18 @@ static EFI_STATUS Phase157B_LockHashRegion(BOOT_CONTEXT *Ctx) {
 
 // Phase158: FinalLockdownMsg
 static EFI_STATUS Phase158_FinalLockdownMsg(BOOT_CONTEXT *Ctx) {
-    Print(L"Trust chain locked\n");
+    Log(LOG_INFO, L"Trust chain locked");
     return EFI_SUCCESS;
 }
 
 // Phase159: NoOp
 static EFI_STATUS Phase159_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 159 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 159 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase160: LockdownComplete
 static EFI_STATUS Phase160_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 160 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 160 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -1659,7 +2264,7 @@ static EFI_STATUS Phase161_CheckTrustThreshold(BOOT_CONTEXT *Ctx) {
 
 // Phase162: LogFallbackMode
 static EFI_STATUS Phase162_LogFallbackMode(BOOT_CONTEXT *Ctx) {
-    Print(L"Fallback mode: %u\n", gBootContext.Params.FallbackMode);
+    Log(LOG_INFO, L"Fallback mode: %u", gBootContext.Params.FallbackMode);
     return EFI_SUCCESS;
 }
 
@@ -1668,8 +2273,8 @@ static EFI_STATUS Phase163_RenderFallbackOverlay(BOOT_CONTEXT *Ctx) {
     if (!gBootContext.Params.FallbackMode || gBootContext.Gop == NULL) return EFI_SUCCESS;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL Red = {0,0,255,0};
     UINTN Y = gBootContext.Gop->Mode->Info->VerticalResolution - 20;
-    gBootContext.Gop->Blt(gBootContext.Gop,&Red,EfiBltVideoFill,0,0,0,Y,
-                          gBootContext.Gop->Mode->Info->HorizontalResolution,20,0);
+    BootGfx_FillRect(&gGfx, 0, (UINT32)Y, gBootContext.Gop->Mode->Info->HorizontalResolution, 20, Red);
+    GfxPresent();
     return EFI_SUCCESS;
 }
 
@@ -1694,30 +2299,25 @@ static EFI_STATUS Phase166_PauseForFallback(BOOT_CONTEXT *Ctx) {
 
 // Phase167: LogFallbackComplete
 static EFI_STATUS Phase167_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 167 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 167 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase168: NoOp
 static EFI_STATUS Phase168_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 168 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 168 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase169: NoOp
 static EFI_STATUS Phase169_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 169 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 169 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase170: FaultDecisionDone
 static EFI_STATUS Phase170_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 170 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 170 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
-typedef struct {
-    LOADER_PARAMS Params;
-    UINT32 Checksum;
-} LOADER_PARAMS_BLOCK;
-
 typedef struct {
     UINT32 Trust;
     UINT8  Uid[16];
@@ -1732,14 +2332,27 @@ static UINT32 ComputeChecksum(UINT8 *Data, UINTN Size) {
     return Crc;
 }
 
+static EFI_STATUS HandoffAllocate(BOOT_CONTEXT *Ctx);
+static EFI_STATUS HandoffFinish(BOOT_CONTEXT *Ctx);
+
 // Phase171: AllocateParamsBlock
 static EFI_STATUS Phase171_AllocateParamsBlock(BOOT_CONTEXT *Ctx) {
     if (gLoaderParamsPage) return EFI_SUCCESS;
     EFI_STATUS St = SafeAllocatePages(AllocateAnyPages, EfiRuntimeServicesData,
             EFI_SIZE_TO_PAGES(sizeof(LOADER_PARAMS_BLOCK)) + 1, &gLoaderParamsPage, "ParamsBlk");
-    if (!EFI_ERROR(St))
-        gBS->SetMemoryAttributes(gLoaderParamsPage + EFI_PAGE_SIZE * EFI_SIZE_TO_PAGES(sizeof(LOADER_PARAMS_BLOCK)), EFI_PAGE_SIZE, EFI_MEMORY_RP);
-    return St;
+    if (EFI_ERROR(St)) return St;
+    gBS->SetMemoryAttributes(gLoaderParamsPage + EFI_PAGE_SIZE * EFI_SIZE_TO_PAGES(sizeof(LOADER_PARAMS_BLOCK)), EFI_PAGE_SIZE, EFI_MEMORY_RP);
+    // The kernel starts the APs itself once MP services are gone, and SIPI
+    // can only vector into the first megabyte. Without it the kernel runs on
+    // the BSP alone, so a full low memory is not fatal.
+    EFI_PHYSICAL_ADDRESS Tramp = 0x9FFFF;
+    if (EFI_ERROR(SafeAllocatePages(AllocateMaxAddress, EfiLoaderData, AP_TRAMPOLINE_PAGES, &Tramp, "ApTramp"))) {
+        Log(LOG_WARN, L"No low pages for the AP trampoline; kernel stays on the BSP");
+        Tramp = 0;
+    }
+    Ctx->Params.ApTrampoline = Tramp;
+    // Params are copied into the block next, so the handoff pointer has to exist now.
+    return HandoffAllocate(Ctx);
 }
 
 // Phase172: CopyParamsToBlock
@@ -1766,99 +2379,146 @@ static EFI_STATUS Phase174_StoreParamsPointer(BOOT_CONTEXT *Ctx) {
 
 // Phase175: LogParamsAddress
 static EFI_STATUS Phase175_LogParamsAddress(BOOT_CONTEXT *Ctx) {
-    Print(L"LoaderParams @ %lx\n", gBootContext.Params.LoaderParamsPtr);
+    Log(LOG_INFO, L"LoaderParams @ %lx", gBootContext.Params.LoaderParamsPtr);
     return EFI_SUCCESS;
 }
 
 // Phase176: NoOp
 static EFI_STATUS Phase176_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 176 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 176 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase177: NoOp
 static EFI_STATUS Phase177_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 177 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 177 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase178: NoOp
 static EFI_STATUS Phase178_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 178 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 178 executed - no operation defined.");
     return EFI_SUCCESS;
 }
-// Phase179: NoOp
-static EFI_STATUS Phase179_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 179 executed - no operation defined.\n");
+static VOID TraceExport(VOID);
+
+// Phase179: ExportBootTrace
+// The last phase with boot services and nothing else on the ESP; phases
+// from here to the kernel jump are not in the files.
+static EFI_STATUS Phase179_ExportBootTrace(BOOT_CONTEXT *Ctx) {
+    TraceExport();      // a read-only ESP must not stop the boot
     return EFI_SUCCESS;
 }
-// Phase180: ParamsInjectionDone
-static EFI_STATUS Phase180_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 180 executed - no operation defined.\n");
+
+static VOID ProfileReport(VOID);
+
+// Phase180: ReportLoaderStats
+// Phase181 flushes the console for the last time, so every summary of this
+// boot is logged here rather than after the jump.
+static EFI_STATUS Phase180_ReportLoaderStats(BOOT_CONTEXT *Ctx) {
+    ProfileReport();
+    VerifyCacheReport();
+    if (Ctx->Pcr.Commands)
+        Log(LOG_INFO, L"[RT] tpm: %u PCR reads, %lu us total, slowest %lu us",
+            Ctx->Pcr.Commands, Tsc_ToNs(Ctx->Pcr.CommandTsc) / 1000, Tsc_ToNs(Ctx->Pcr.MaxCommandTsc) / 1000);
+    Log(LOG_INFO, L"[RT] esp: %u Open and %u GetInfo firmware calls, %u opens and %u infos from cache",
+        gEspCache.Opens, gEspCache.GetInfos, gEspCache.OpenHits, gEspCache.InfoHits);
+    // The launch splash in Phase183 is the only frame not counted.
+    if (gGfx.Frames)
+        Log(LOG_INFO, L"[RT] gfx: %u frames, %u Blt calls, %lu pixels, present %lu us",
+            gGfx.Frames, gGfx.BltCalls, gGfx.PixelsPresented, Tsc_ToNs(gGfx.PresentTsc) / 1000);
     return EFI_SUCCESS;
 }
 
 // Phase181: ValidateMapForExit
 static EFI_STATUS Phase181_ValidateMapForExit(BOOT_CONTEXT *Ctx) {
-    return Phase103_CheckMapKeyValid();
+    LogFlush();
+    return Phase103_CheckMapKeyValid(Ctx);
 }
 
+static VOID LogRingStats(VOID);
+
 // Phase182: ExitBootServices
 static EFI_STATUS Phase182_ExitBootServices(BOOT_CONTEXT *Ctx) {
-    EFI_STATUS Status = gBS->ExitBootServices(gBootContext.ImageHandle, gBootContext.Params.MapKey);
-    if (Status == EFI_INVALID_PARAMETER) {
-        Phase102_UpdateMemoryMap();
+    // Last chance for ConOut; later records stay in the ring. Nothing may
+    // print between the two attempts, but a failed exit leaves the console
+    // up, so the error reaches the screen through the caller's flush.
+    ArenaLogStats();
+    LogRingStats();
+    LogFlush();
+    // The kernel clears whatever the index calls conventional, so it has to
+    // be built from this map: an older one still shows the params and
+    // handoff pages allocated in Phase171 as free.
+    EFI_STATUS Status = RefreshMemoryMap();
+    if (!EFI_ERROR(Status))
         Status = gBS->ExitBootServices(gBootContext.ImageHandle, gBootContext.Params.MapKey);
+    if (Status == EFI_INVALID_PARAMETER) {
+        Status = RefreshMemoryMap();
+        if (!EFI_ERROR(Status))
+            Status = gBS->ExitBootServices(gBootContext.ImageHandle, gBootContext.Params.MapKey);
+    }
+    if (EFI_ERROR(Status)) {
+        Log(LOG_ERROR, L"ExitBootServices failed: %r", Status);
+        return Status;
     }
+    gLog.ConsoleGone = TRUE;
+    gBootServicesExited = TRUE;
     return Status;
 }
 
 // Phase183: ShowLaunchSplash
 static EFI_STATUS Phase183_ShowLaunchSplash(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Gop) {
+        // Boot services are gone; this present writes the framebuffer directly.
         EFI_GRAPHICS_OUTPUT_BLT_PIXEL W = {255,255,255,0};
-        gBootContext.Gop->Blt(gBootContext.Gop,&W,EfiBltVideoFill,0,0,10,10,8,8,0);
+        BootGfx_FillRect(&gGfx, 10, 10, 8, 8, W);
+        GfxPresent();
     }
     return EFI_SUCCESS;
 }
 
 // Phase184: NoOp
 static EFI_STATUS Phase184_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 184 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 184 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase185: NoOp
 static EFI_STATUS Phase185_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 185 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 185 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase186: NoOp
 static EFI_STATUS Phase186_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 186 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 186 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase187: NoOp
 static EFI_STATUS Phase187_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 187 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 187 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase188: NoOp
 static EFI_STATUS Phase188_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 188 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 188 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase189: NoOp
 static EFI_STATUS Phase189_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 189 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 189 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase190: HandoffPrepDone
-static EFI_STATUS Phase190_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 190 executed - no operation defined.\n");
-    return EFI_SUCCESS;
+static EFI_STATUS Phase190_HandoffPrepDone(BOOT_CONTEXT *Ctx) {
+    return HandoffFinish(Ctx);
 }
 
+static VOID DeadlineModelSave(VOID);
+static VOID ProfileSave(VOID);
+
 // Phase191: JumpToKernel
 static EFI_STATUS Phase191_JumpToKernel(BOOT_CONTEXT *Ctx) {
     if (gLoaderParamsPage == 0) return EFI_NOT_READY;
+    DeadlineModelSave();    // the kernel may never hand control back
+    ProfileSave();
+    ArenaTeardown(TRUE);
     void (*Entry)(LOADER_PARAMS_BLOCK*) = (void(*)(LOADER_PARAMS_BLOCK*))(UINTN)gBootContext.Params.KernelEntry;
     Entry((LOADER_PARAMS_BLOCK*)(UINTN)gLoaderParamsPage);
     return EFI_SUCCESS;
@@ -1866,22 +2526,22 @@ static EFI_STATUS Phase191_JumpToKernel(BOOT_CONTEXT *Ctx) {
 
 // Phase192: NoOp
 static EFI_STATUS Phase192_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 192 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 192 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase193: NoOp
 static EFI_STATUS Phase193_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 193 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 193 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase194: NoOp
 static EFI_STATUS Phase194_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 194 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 194 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase195: NoOp
 static EFI_STATUS Phase195_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 195 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 195 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -1905,13 +2565,13 @@ static EFI_STATUS Phase197_WriteBootLog(BOOT_CONTEXT *Ctx) {
 
 // Phase198: LogEventAddress
 static EFI_STATUS Phase198_LogEventAddress(BOOT_CONTEXT *Ctx) {
-    Print(L"Event log @ %lx\n", gBootLogPage);
+    Log(LOG_INFO, L"Event log @ %lx", gBootLogPage);
     return EFI_SUCCESS;
 }
 
 // Phase199: NoOp
 static EFI_STATUS Phase199_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 199 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 199 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase200: ReservationComplete
@@ -1936,13 +2596,13 @@ static UINT64 GetRandom64(void) {
 
 // Phase201: RuntimeAnomalyScan
 static EFI_STATUS Phase201_RuntimeAnomalyScan(BOOT_CONTEXT *Ctx) {
-    if (!gBootContext.Params.MemoryMap) return EFI_NOT_READY;
+    const MEMORY_REGION_INDEX *Idx = gBootContext.Params.MemoryRegions;
+    if (!Idx) return EFI_NOT_READY;
     gAnomalyCount = 0;
-    UINTN count = gBootContext.Params.MemoryMapSize / gBootContext.Params.DescriptorSize;
-    for (UINTN i=0;i<count;i++) {
-        EFI_MEMORY_DESCRIPTOR *d = (EFI_MEMORY_DESCRIPTOR*)((UINT8*)gBootContext.Params.MemoryMap + i*gBootContext.Params.DescriptorSize);
-        if ((d->Attribute & EFI_MEMORY_RUNTIME) &&
-            d->Type != EfiRuntimeServicesCode && d->Type != EfiRuntimeServicesData)
+    for (UINTN i=0;i<Idx->Count;i++) {
+        const MEMORY_REGION *r = &Idx->Region[i];
+        if ((r->Attribute & EFI_MEMORY_RUNTIME) &&
+            r->Type != EfiRuntimeServicesCode && r->Type != EfiRuntimeServicesData)
             gAnomalyCount++;
     }
     return EFI_SUCCESS;
@@ -1960,14 +2620,14 @@ static EFI_STATUS Phase202_ScanKernelPatterns(BOOT_CONTEXT *Ctx) {
 
 // Phase203: LogAnomalyResults
 static EFI_STATUS Phase203_LogAnomalyResults(BOOT_CONTEXT *Ctx) {
-    Print(L"Anomalies found: %u\n", (UINT32)gAnomalyCount);
+    Log(LOG_INFO, L"Anomalies found: %u", (UINT32)gAnomalyCount);
     return EFI_SUCCESS;
 }
 
 // Phase204: GatherAdvancedEntropy
 static EFI_STATUS Phase204_GatherAdvancedEntropy(BOOT_CONTEXT *Ctx) {
     gAdvancedEntropy = GetRandom64() ^ AsmReadTsc() ^ gAnomalyCount;
-    Print(L"Adv entropy %lx\n", gAdvancedEntropy);
+    Log(LOG_INFO, L"Adv entropy %lx", gAdvancedEntropy);
     return EFI_SUCCESS;
 }
 
@@ -1984,32 +2644,23 @@ static EFI_STATUS Phase205_MixEntropy(BOOT_CONTEXT *Ctx) {
 
 // Phase206: LogEntropyDigest
 static EFI_STATUS Phase206_LogEntropyDigest(BOOT_CONTEXT *Ctx) {
-    Print(L"Entropy digest: ");
-    for (UINTN i=0;i<32;i++) Print(L"%02x", gBootContext.Params.KernelHash[i]);
-    Print(L"\n");
+    LogHex(LOG_INFO, gBootContext.Params.KernelHash, 32, L"Entropy digest: ");
     return EFI_SUCCESS;
 }
 
 // Phase207: AcpiDeepTraversal
 static EFI_STATUS Phase207_AcpiDeepTraversal(BOOT_CONTEXT *Ctx) {
-    if (!gXsdt) return EFI_NOT_FOUND;
-    UINTN esz = (gXsdt->Revision>=2)?sizeof(UINT64):sizeof(UINT32);
-    gAcpiEntryCount = (gXsdt->Length - sizeof(ACPI_SDT_HEADER))/esz;
-    gAcpiErrCount = 0;
-    UINT8 *ptr = (UINT8*)gXsdt + sizeof(ACPI_SDT_HEADER);
-    for (UINTN i=0;i<gAcpiEntryCount;i++) {
-        UINT64 addr = (esz==8)?((UINT64*)ptr)[i]:((UINT32*)ptr)[i];
-        ACPI_SDT_HEADER *h = (ACPI_SDT_HEADER*)(UINTN)addr;
-        if (!h) continue;
-        UINT8 sum=0; for (UINTN b=0;b<h->Length;b++) sum += ((UINT8*)h)[b];
-        if (sum!=0) gAcpiErrCount++;
-    }
+    // Checksums were taken when Phase108 built the index.
+    const ACPI_INDEX *Idx = gBootContext.Params.AcpiTables;
+    if (!Idx) return EFI_NOT_FOUND;
+    gAcpiEntryCount = Idx->Count;
+    gAcpiErrCount = Idx->BadChecksums;
     return EFI_SUCCESS;
 }
 
 // Phase208: LogAcpiTraversal
 static EFI_STATUS Phase208_LogAcpiTraversal(BOOT_CONTEXT *Ctx) {
-    Print(L"ACPI tables checked: %u errors:%u\n", (UINT32)gAcpiEntryCount, (UINT32)gAcpiErrCount);
+    Log(LOG_INFO, L"ACPI tables checked: %u errors:%u", (UINT32)gAcpiEntryCount, (UINT32)gAcpiErrCount);
     return EFI_SUCCESS;
 }
 
@@ -2029,7 +2680,7 @@ static EFI_STATUS Phase209_SecureBootChainValidation(BOOT_CONTEXT *Ctx) {
 
 // Phase210: LogSecureChain
 static EFI_STATUS Phase210_LogSecureChain(BOOT_CONTEXT *Ctx) {
-    Print(L"SecureBoot chain %a\n", gSecureChainValid?L"valid":L"invalid");
+    Log(LOG_INFO, L"SecureBoot chain %a", gSecureChainValid?L"valid":L"invalid");
     return EFI_SUCCESS;
 }
 
@@ -2042,7 +2693,7 @@ static EFI_STATUS Phase211_InstallSelfRepair(BOOT_CONTEXT *Ctx) {
 // Phase212: RunSelfRepair
 static EFI_STATUS Phase212_RunSelfRepair(BOOT_CONTEXT *Ctx) {
     if (gSelfRepairNeeded) {
-        Print(L"Self-repair activated\n");
+        Log(LOG_WARN, L"Self-repair activated");
         if (gBootContext.Params.BootTrustScore < 50)
             gBootContext.Params.BootTrustScore += 10;
     }
@@ -2051,7 +2702,7 @@ static EFI_STATUS Phase212_RunSelfRepair(BOOT_CONTEXT *Ctx) {
 
 // Phase213: LogSelfRepair
 static EFI_STATUS Phase213_LogSelfRepair(BOOT_CONTEXT *Ctx) {
-    Print(L"Self-repair %a\n", gSelfRepairNeeded?L"done":L"not needed");
+    Log(LOG_INFO, L"Self-repair %a", gSelfRepairNeeded?L"done":L"not needed");
     return EFI_SUCCESS;
 }
 
@@ -2066,8 +2717,8 @@ static EFI_STATUS Phase214_SetupRealtimeFallback(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase215_RenderRealtimeFallback(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Params.FallbackMode && gBootContext.Gop) {
         EFI_GRAPHICS_OUTPUT_BLT_PIXEL r={0,0,255,0};
-        gBootContext.Gop->Blt(gBootContext.Gop,&r,EfiBltVideoFill,0,0,0,0,
-            gBootContext.Gop->Mode->Info->HorizontalResolution,4,0);
+        BootGfx_FillRect(&gGfx, 0, 0, gBootContext.Gop->Mode->Info->HorizontalResolution, 4, r);
+        GfxPresent();
     }
     return EFI_SUCCESS;
 }
@@ -2092,27 +2743,26 @@ static EFI_STATUS Phase217_StoreBootState(BOOT_CONTEXT *Ctx) {
 // Phase218: HashBootState
 static EFI_STATUS Phase218_HashBootState(BOOT_CONTEXT *Ctx) {
     if (!gBootStatePage) return EFI_NOT_READY;
-    SHA256_CTX ctx; sha256_init(&ctx);
-    sha256_update(&ctx, (UINT8*)(UINTN)gBootStatePage, sizeof(BOOTSTATE));
-    sha256_final(&ctx, gBootStateHash);
+    // BootDNA does not change before Phase220, so both go through one
+    // multi-buffer pass.
+    const UINT8 *Data[2] = { (UINT8*)(UINTN)gBootStatePage, (UINT8*)&Ctx->BootDNA };
+    const size_t Len[2]  = { sizeof(BOOTSTATE), sizeof(BOOT_DNA) };
+    UINT8 Digest[2][SHA256_DIGEST_LENGTH];
+    sha256_mb(2, Data, Len, Digest);
+    CopyMem(gBootStateHash, Digest[0], 32);
+    CopyMem(gBootDNADigest, Digest[1], 32);
     return EFI_SUCCESS;
 }
 
 // Phase219: LogBootStateHash
 static EFI_STATUS Phase219_LogBootStateHash(BOOT_CONTEXT *Ctx) {
-    Print(L"BootState hash: ");
-    for (UINTN i=0;i<32;i++) Print(L"%02x", gBootStateHash[i]);
-    Print(L"\n");
+    LogHex(LOG_INFO, gBootStateHash, 32, L"BootState hash: ");
     return EFI_SUCCESS;
 }
 
 // Phase220: SignBootDNA
 static EFI_STATUS Phase220_SignBootDNA(BOOT_CONTEXT *Ctx) {
-    SHA256_CTX c; UINT8 h[32];
-    sha256_init(&c);
-    sha256_update(&c, (UINT8*)&Ctx->BootDNA, sizeof(BOOT_DNA));
-    sha256_final(&c, h);
-    CopyMem(gBootDNASignature, h, 32);
+    CopyMem(gBootDNASignature, gBootDNADigest, 32);
     gBootDNASignatureSize = 32;
     gRT->SetVariable(L"BootDNASignature", &gEfiGlobalVariableGuid,
                      EFI_VARIABLE_NON_VOLATILE|EFI_VARIABLE_BOOTSERVICE_ACCESS|EFI_VARIABLE_RUNTIME_ACCESS,
@@ -2129,7 +2779,7 @@ static EFI_STATUS Phase220_CacheBootStatePtr(BOOT_CONTEXT *Ctx) {
 
 // Phase221: LogBootStateAddr
 static EFI_STATUS Phase221_LogBootStateAddr(BOOT_CONTEXT *Ctx) {
-    Print(L"BootState page @ %lx\n", gBootStatePage);
+    Log(LOG_INFO, L"BootState page @ %lx", gBootStatePage);
     return EFI_SUCCESS;
 }
 
@@ -2160,7 +2810,7 @@ static EFI_STATUS Phase224_AdjustTrustForAnomalies(BOOT_CONTEXT *Ctx) {
 
 // Phase225: LogAdjustedTrust
 static EFI_STATUS Phase225_LogAdjustedTrust(BOOT_CONTEXT *Ctx) {
-    Print(L"Adjusted TrustScore=%u\n", gBootContext.Params.BootTrustScore);
+    Log(LOG_INFO, L"Adjusted TrustScore=%u", gBootContext.Params.BootTrustScore);
     return EFI_SUCCESS;
 }
 
@@ -2173,9 +2823,7 @@ static EFI_STATUS Phase226_MixBootUidFinal(BOOT_CONTEXT *Ctx) {
 
 // Phase227: LogFinalUid
 static EFI_STATUS Phase227_LogFinalUid(BOOT_CONTEXT *Ctx) {
-    Print(L"Final UID: ");
-    for (UINTN i=0;i<16;i++) Print(L"%02x", gBootContext.Params.BootUid[i]);
-    Print(L"\n");
+    LogHex(LOG_INFO, gBootContext.Params.BootUid, 16, L"Final UID: ");
     return EFI_SUCCESS;
 }
 
@@ -2188,7 +2836,7 @@ static EFI_STATUS Phase228_PersistBootStateToLog(BOOT_CONTEXT *Ctx) {
 
 // Phase229: LogPersistResult
 static EFI_STATUS Phase229_LogPersistResult(BOOT_CONTEXT *Ctx) {
-    Print(L"Boot state persisted\n");
+    Log(LOG_INFO, L"Boot state persisted");
     return EFI_SUCCESS;
 }
 
@@ -2210,7 +2858,7 @@ static EFI_STATUS Phase231_BootStateCachingComplete(BOOT_CONTEXT *Ctx) {
 }
 
 // Phase231: SetupExitNotice
-static EFI_STATUS Phase231_SetupExitNotice(BOOT_CONTEXT *Ctx) { Print(L"Preparing to exit boot services\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase231_SetupExitNotice(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Preparing to exit boot services"); return EFI_SUCCESS; }
 
 // Phase232: CleanAnomalyBuffer
 static EFI_STATUS Phase232_CleanAnomalyBuffer(BOOT_CONTEXT *Ctx) { gAnomalyCount=0; return EFI_SUCCESS; }
@@ -2225,14 +2873,14 @@ static EFI_STATUS Phase234_FinalSecureCheck(BOOT_CONTEXT *Ctx) { if(!gSecureChai
 static EFI_STATUS Phase235_DrawFinalIndicator(BOOT_CONTEXT *Ctx) {
     if (gBootContext.Gop) {
         EFI_GRAPHICS_OUTPUT_BLT_PIXEL g={0,255,0,0};
-        gBootContext.Gop->Blt(gBootContext.Gop,&g,EfiBltVideoFill,0,0,0,
-            gBootContext.Gop->Mode->Info->VerticalResolution-8,8,8,0);
+        BootGfx_FillRect(&gGfx, 0, gBootContext.Gop->Mode->Info->VerticalResolution-8, 8, 8, g);
+        GfxPresent();
     }
     return EFI_SUCCESS;
 }
 
 // Phase236: LogExitPlan
-static EFI_STATUS Phase236_LogExitPlan(BOOT_CONTEXT *Ctx) { Print(L"Exit plan ready\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase236_LogExitPlan(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Exit plan ready"); return EFI_SUCCESS; }
 
 // Phase237: CacheEntropyInParams
 static EFI_STATUS Phase237_CacheEntropyInParams(BOOT_CONTEXT *Ctx) {
@@ -2241,7 +2889,7 @@ static EFI_STATUS Phase237_CacheEntropyInParams(BOOT_CONTEXT *Ctx) {
 }
 
 // Phase238: LogEntropyCached
-static EFI_STATUS Phase238_LogEntropyCached(BOOT_CONTEXT *Ctx) { Print(L"Entropy cached\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase238_LogEntropyCached(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Entropy cached"); return EFI_SUCCESS; }
 
 // Phase239: SaveAcpiErrorCount
 static EFI_STATUS Phase239_SaveAcpiErrorCount(BOOT_CONTEXT *Ctx) {
@@ -2251,7 +2899,7 @@ static EFI_STATUS Phase239_SaveAcpiErrorCount(BOOT_CONTEXT *Ctx) {
 
 // Phase240: LogAcpiErrors
 static EFI_STATUS Phase240_LogAcpiErrors(BOOT_CONTEXT *Ctx) {
-    Print(L"ACPI errors stored %u\n", (UINT32)gAcpiErrCount);
+    Log(LOG_INFO, L"ACPI errors stored %u", (UINT32)gAcpiErrCount);
     return EFI_SUCCESS;
 }
 
@@ -2263,7 +2911,7 @@ static EFI_STATUS Phase241_MarkRepairStatus(BOOT_CONTEXT *Ctx) {
 
 // Phase242: LogRepairStatus
 static EFI_STATUS Phase242_LogRepairStatus(BOOT_CONTEXT *Ctx) {
-    Print(L"Repair flag %u\n", gSelfRepairNeeded);
+    Log(LOG_INFO, L"Repair flag %u", gSelfRepairNeeded);
     return EFI_SUCCESS;
 }
 
@@ -2275,7 +2923,7 @@ static EFI_STATUS Phase243_SaveFallbackStatus(BOOT_CONTEXT *Ctx) {
 
 // Phase244: LogFallbackStatus
 static EFI_STATUS Phase244_LogFallbackStatus(BOOT_CONTEXT *Ctx) {
-    Print(L"Fallback stored %u\n", gBootContext.Params.FallbackMode);
+    Log(LOG_INFO, L"Fallback stored %u", gBootContext.Params.FallbackMode);
     return EFI_SUCCESS;
 }
 
@@ -2285,17 +2933,17 @@ static EFI_STATUS Phase245_FinalizeSecureChain(BOOT_CONTEXT *Ctx) {
 }
 
 // Phase246: LogSecureChain
-static EFI_STATUS Phase246_LogSecureChain(BOOT_CONTEXT *Ctx) { Print(L"Secure chain verified\n"); return EFI_SUCCESS; }
+static EFI_STATUS Phase246_LogSecureChain(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Secure chain verified"); return EFI_SUCCESS; }
 
 // Phase247: PrepareForKernelJump
 static EFI_STATUS Phase247_PrepareForKernelJump(BOOT_CONTEXT *Ctx) {
-    Print(L"Preparing for kernel jump\n");
+    Log(LOG_INFO, L"Preparing for kernel jump");
     CopyMem(Ctx->Params.BootUid, "AIOS-AWA", 8);
     return EFI_SUCCESS;
 }
 
 // Phase248: FinalAnomalyPrint
-static EFI_STATUS Phase248_FinalAnomalyPrint(BOOT_CONTEXT *Ctx) { Print(L"Final anomaly count %u\n", (UINT32)gAnomalyCount); return EFI_SUCCESS; }
+static EFI_STATUS Phase248_FinalAnomalyPrint(BOOT_CONTEXT *Ctx) { Log(LOG_INFO, L"Final anomaly count %u", (UINT32)gAnomalyCount); return EFI_SUCCESS; }
 
 // Phase249: FinalCacheDone
 static EFI_STATUS Phase249_FinalCacheDone(BOOT_CONTEXT *Ctx) {
@@ -2306,7 +2954,8 @@ static EFI_STATUS Phase249_FinalCacheDone(BOOT_CONTEXT *Ctx) {
 
 // Phase250: LockdownAndReboot
 static EFI_STATUS Phase250_LockdownAndReboot(BOOT_CONTEXT *Ctx) {
-    Print(L"\n=== BOOT LOCKDOWN ENGAGED ===\n");
+    Log(LOG_WARN, L"=== BOOT LOCKDOWN ENGAGED ===");
+    LogFlush();
     SaveBootLog(Ctx);
     PoisonAndFreeAllMemory(); // Clear traces
     CpuHalt();                // Halt to ensure no return
@@ -2321,87 +2970,87 @@ static EFI_STATUS Phase251_LoadBootConfig(BOOT_CONTEXT *Ctx);
 static EFI_STATUS Phase252_LogConfig(BOOT_CONTEXT *Ctx);
 // Phase253: NoOp
 static EFI_STATUS Phase253_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 253 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 253 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase254: NoOp
 static EFI_STATUS Phase254_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 254 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 254 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase255: NoOp
 static EFI_STATUS Phase255_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 255 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 255 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase256: NoOp
 static EFI_STATUS Phase256_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 256 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 256 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase257: NoOp
 static EFI_STATUS Phase257_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 257 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 257 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase258: NoOp
 static EFI_STATUS Phase258_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 258 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 258 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase259: NoOp
 static EFI_STATUS Phase259_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 259 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 259 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase260: NoOp
 static EFI_STATUS Phase260_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 260 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 260 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase261: NoOp
 static EFI_STATUS Phase261_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 261 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 261 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase262: NoOp
 static EFI_STATUS Phase262_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 262 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 262 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase263: NoOp
 static EFI_STATUS Phase263_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 263 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 263 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase264: NoOp
 static EFI_STATUS Phase264_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 264 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 264 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase265: NoOp
 static EFI_STATUS Phase265_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 265 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 265 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase266: NoOp
 static EFI_STATUS Phase266_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 266 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 266 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase267: NoOp
 static EFI_STATUS Phase267_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 267 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 267 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase268: NoOp
 static EFI_STATUS Phase268_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 268 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 268 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase269: NoOp
 static EFI_STATUS Phase269_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 269 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 269 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -2409,47 +3058,47 @@ static EFI_STATUS Phase269_NoOpPhase(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase270_ComputeFinalTrustScore(BOOT_CONTEXT *Ctx);
 // Phase271: NoOp
 static EFI_STATUS Phase271_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 271 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 271 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase272: NoOp
 static EFI_STATUS Phase272_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 272 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 272 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase273: NoOp
 static EFI_STATUS Phase273_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 273 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 273 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase274: NoOp
 static EFI_STATUS Phase274_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 274 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 274 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase275: NoOp
 static EFI_STATUS Phase275_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 275 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 275 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase276: NoOp
 static EFI_STATUS Phase276_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 276 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 276 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase277: NoOp
 static EFI_STATUS Phase277_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 277 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 277 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase278: NoOp
 static EFI_STATUS Phase278_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 278 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 278 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase279: NoOp
 static EFI_STATUS Phase279_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 279 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 279 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -2457,47 +3106,47 @@ static EFI_STATUS Phase279_NoOpPhase(BOOT_CONTEXT *Ctx) {
 static EFI_STATUS Phase280_BootDNAHash(BOOT_CONTEXT *Ctx);
 // Phase281: NoOp
 static EFI_STATUS Phase281_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 281 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 281 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase282: NoOp
 static EFI_STATUS Phase282_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 282 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 282 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase283: NoOp
 static EFI_STATUS Phase283_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 283 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 283 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase284: NoOp
 static EFI_STATUS Phase284_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 284 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 284 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase285: NoOp
 static EFI_STATUS Phase285_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 285 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 285 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase286: NoOp
 static EFI_STATUS Phase286_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 286 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 286 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase287: NoOp
 static EFI_STATUS Phase287_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 287 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 287 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase288: NoOp
 static EFI_STATUS Phase288_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 288 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 288 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase289: NoOp
 static EFI_STATUS Phase289_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 289 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 289 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
@@ -2508,101 +3157,138 @@ static EFI_STATUS Phase291_AttemptRecovery(BOOT_CONTEXT *Ctx) {
     if (!Ctx->Params.FallbackUsed || !Ctx->Config.FallbackEnabled) return EFI_SUCCESS;
     Log(LOG_WARN, L"Attempting recovery kernel...");
     EFI_FILE_HANDLE File; EFI_STATUS S;
-    S = Ctx->RootDir->Open(Ctx->RootDir, &File, gFallbackPath, EFI_FILE_MODE_READ, 0);
+    S = EspOpen(gFallbackPath, &File);
     if (EFI_ERROR(S)) { Log(LOG_ERROR, L"Recovery not found %r", S); return S; }
-    File->Close(File);
+    EspClose(File);
     return EFI_SUCCESS;
 }
 // Phase292: NoOp
 static EFI_STATUS Phase292_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 292 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 292 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase293: NoOp
 static EFI_STATUS Phase293_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 293 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 293 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase294: NoOp
 static EFI_STATUS Phase294_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 294 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 294 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase295: NoOp
 static EFI_STATUS Phase295_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 295 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 295 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase296: NoOp
 static EFI_STATUS Phase296_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 296 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 296 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase297: NoOp
 static EFI_STATUS Phase297_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 297 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 297 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase298: NoOp
 static EFI_STATUS Phase298_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 298 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 298 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 // Phase299: NoOp
 static EFI_STATUS Phase299_NoOpPhase(BOOT_CONTEXT *Ctx) {
-    Print(L"Phase 299 executed - no operation defined.\n");
+    Log(LOG_DEBUG, L"Phase 299 executed - no operation defined.");
     return EFI_SUCCESS;
 }
 
 // Phase300: ConsciousHandoff
 static EFI_STATUS Phase300_ConsciousHandoff(BOOT_CONTEXT *Ctx);
 
+// ---------------------[ CONFIG CACHE ]---------------------
+// config.ini is parsed only when it changes; see boot_config.h for the
+// format and for config.bin, the parsed copy later boots restore with one
+// read. File systems that report no timestamps always take the parser.
+#define BOOT_CONFIG_INI            L"\\EFI\\AiOS\\config.ini"
+#define BOOT_CONFIG_CACHE_FILE     L"\\EFI\\AiOS\\config.bin"
+
+static BOOLEAN BootConfigCacheLoad(const EFI_FILE_INFO *Ini) {
+    STATIC BOOT_CONFIG_CACHE C;
+    EFI_FILE_HANDLE File;
+    STATIC CONST EFI_TIME NoTime;
+
+    if (CompareMem(&Ini->ModificationTime, &NoTime, sizeof(EFI_TIME)) == 0) return FALSE;
+    if (EFI_ERROR(EspOpen(BOOT_CONFIG_CACHE_FILE, &File)))
+        return FALSE;
+    UINTN Size = sizeof(C);
+    EFI_STATUS Status = File->Read(File, &Size, &C);
+    EspClose(File);
+    if (EFI_ERROR(Status) || !BootConfig_CacheValid(&C, Size, Ini->FileSize, &Ini->ModificationTime))
+        return FALSE;
+    gSettings = C.Settings;
+    return TRUE;
+}
+
+static VOID BootConfigCacheStore(BOOT_CONTEXT *Ctx, const EFI_FILE_INFO *Ini, const UINT8 *IniHash) {
+    STATIC BOOT_CONFIG_CACHE C;
+    EFI_FILE_HANDLE File;
+
+    BootConfig_CacheSeal(&C, &gSettings, Ini->FileSize, &Ini->ModificationTime, IniHash);
+    EspForget(BOOT_CONFIG_CACHE_FILE);
+    EFI_STATUS Status = Ctx->RootDir->Open(Ctx->RootDir, &File, BOOT_CONFIG_CACHE_FILE,
+        EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE, 0);
+    if (!EFI_ERROR(Status)) {
+        UINTN Size = sizeof(C);
+        Status = File->Write(File, &Size, &C);
+        File->Close(File);
+    }
+    if (EFI_ERROR(Status)) Log(LOG_WARN, L"config.bin not written: %r", Status);
+}
+
 // Phase251: LoadBootConfig
 static EFI_STATUS Phase251_LoadBootConfig(BOOT_CONTEXT *Ctx) {
+    STATIC BOOLEAN Loaded = FALSE;
     EFI_FILE_HANDLE File; EFI_STATUS Status;
-    Status = Ctx->RootDir->Open(Ctx->RootDir, &File, L"\\EFI\\AiOS\\config.ini", EFI_FILE_MODE_READ, 0);
+    if (Loaded) return EFI_SUCCESS;
+    Status = EspOpen(BOOT_CONFIG_INI, &File);
     if (EFI_ERROR(Status)) return Status;
-    UINTN Size = 0; EFI_FILE_INFO *Info = NULL;
-    Status = File->GetInfo(File, &gEfiFileInfoGuid, &Size, NULL);
-    if (Status == EFI_BUFFER_TOO_SMALL) {
-        Status = SafeAllocatePool(Size, (VOID**)&Info, "CfgInfo");
-        if (!EFI_ERROR(Status)) {
-            Status = File->GetInfo(File, &gEfiFileInfoGuid, &Size, Info);
-            if (!EFI_ERROR(Status)) Size = Info->FileSize; else Size = 0;
-            PoisonAndFreeMemory(Info, Size);
-        }
-    }
-    if (EFI_ERROR(Status)) { File->Close(File); return Status; }
-    CHAR8 *Buf; Status = SafeAllocatePool(Size+1, (VOID**)&Buf, "CfgBuf");
-    if (EFI_ERROR(Status)) { File->Close(File); return Status; }
-    Status = File->Read(File, &Size, Buf); File->Close(File);
-    if (EFI_ERROR(Status)) { PoisonAndFreeMemory(Buf, Size+1); return Status; }
-    Buf[Size] = 0;
-    for (CHAR8 *Line = Buf; *Line;) {
-        CHAR8 *End = Line; while (*End && *End!='\n' && *End!='\r') End++;
-        CHAR8 Tmp=*End; *End=0; CHAR8 *Eq=AsciiStrChr(Line,'=');
-        if (Eq) { *Eq=0; CHAR8 *Val=Eq+1;
-            if (!AsciiStriCmp(Line,"kernel_path")) AsciiStrToUnicodeStrS(Val, gKernelPath, sizeof(gKernelPath)/sizeof(CHAR16));
-            else if (!AsciiStriCmp(Line,"signature_path")) AsciiStrToUnicodeStrS(Val, gSignaturePath, sizeof(gSignaturePath)/sizeof(CHAR16));
-            else if (!AsciiStriCmp(Line,"trust_threshold")) gTrustThreshold=(UINT8)AsciiStrDecimalToUintn(Val);
-            else if (!AsciiStriCmp(Line,"fallback_enabled")) Ctx->Config.FallbackEnabled = (BOOLEAN)(AsciiStrDecimalToUintn(Val)!=0);
-            else if (!AsciiStriCmp(Line,"boot_delay")) Ctx->Config.BootDelay = (UINT8)AsciiStrDecimalToUintn(Val);
-            else if (!AsciiStriCmp(Line,"entropy_required")) Ctx->Config.EntropyRequired = (BOOLEAN)(AsciiStrDecimalToUintn(Val)!=0);
-        }
-        if (Tmp==0) break; End++; if (*End=='\n') End++; Line=End;
+    UINTN Size = 0; CONST EFI_FILE_INFO *Info;
+    Status = EspGetInfo(File, &Info);
+    if (EFI_ERROR(Status)) { EspClose(File); return Status; }
+
+    BOOLEAN Cached = BootConfigCacheLoad(Info);
+    if (!Cached) {
+        Size = (UINTN)Info->FileSize;
+        CHAR8 *Buf; Status = SafeAllocatePool(Size+1, (VOID**)&Buf, "CfgBuf");
+        if (EFI_ERROR(Status)) { EspClose(File); return Status; }
+        Status = File->Read(File, &Size, Buf);
+        if (EFI_ERROR(Status)) { EspClose(File); PoisonAndFreeMemory(Buf, Size+1); return Status; }
+        Buf[Size] = 0;
+        SHA256_CTX Sha; UINT8 IniHash[SHA256_DIGEST_LENGTH];
+        sha256_init(&Sha);
+        sha256_update(&Sha, (UINT8*)Buf, Size);
+        sha256_final(&Sha, IniHash);
+        BootConfig_Parse(&gSettings, Buf);
+        PoisonAndFreeMemory(Buf, Size+1);
+        BootConfigCacheStore(Ctx, Info, IniHash);
     }
-    PoisonAndFreeMemory(Buf, Size+1);
-    Ctx->TrustThreshold = gTrustThreshold;
+    EspClose(File);
+    Ctx->Config = gSettings.Config;
+    Ctx->TrustThreshold = gSettings.TrustThreshold;
+    gLog.MinLevel = Ctx->Config.QuietBoot ? LOG_WARN : LOG_DEBUG;
+    Log(LOG_INFO, L"Boot config %s", Cached ? L"restored from config.bin" : L"parsed from config.ini");
+    Loaded = TRUE;
     return EFI_SUCCESS;
 }
 
 // Phase252: LogConfig
 static EFI_STATUS Phase252_LogConfig(BOOT_CONTEXT *Ctx) {
-    Log(LOG_INFO, L"Kernel=%s", gKernelPath);
-    Log(LOG_INFO, L"Sig=%s", gSignaturePath);
-    Log(LOG_INFO, L"Threshold=%u", gTrustThreshold);
-    Log(LOG_INFO, L"Fallback=%u Delay=%u EntropyReq=%u", Ctx->Config.FallbackEnabled,
-        Ctx->Config.BootDelay, Ctx->Config.EntropyRequired);
+    Log(LOG_INFO, L"Kernel=%s", gSettings.KernelPath);
+    Log(LOG_INFO, L"Sig=%s", gSettings.SignaturePath);
+    Log(LOG_INFO, L"Threshold=%u", gSettings.TrustThreshold);
+    Log(LOG_INFO, L"Fallback=%u Delay=%u EntropyReq=%u Quiet=%u", Ctx->Config.FallbackEnabled,
+        Ctx->Config.BootDelay, Ctx->Config.EntropyRequired, Ctx->Config.QuietBoot);
     return EFI_SUCCESS;
 }
 
@@ -2635,7 +3321,7 @@ static EFI_STATUS Phase280_BootDNAHash(BOOT_CONTEXT *Ctx) {
 
 // Phase290: CheckTrustThreshold
 static EFI_STATUS Phase290_CheckTrustThreshold(BOOT_CONTEXT *Ctx) {
-    if (Ctx->Trust.TotalScore < gTrustThreshold) {
+    if (Ctx->Trust.TotalScore < gSettings.TrustThreshold) {
         Ctx->Trust.FallbackUsed = 1;
         Ctx->Params.FallbackUsed = TRUE;
     }
@@ -2658,70 +3344,531 @@ static BOOT_PHASE gBootPhases[] = {
 #include "phases_list.h"
 };
 
-static VOID PrintTopPhases(void) {
-    UINT64 Dur[300]; UINTN idx[300]; UINTN Count = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
-    for (UINTN i=0;i<Count;i++){ Dur[i]=gPhaseEnd[i]-gPhaseStart[i]; idx[i]=i; }
-    for (UINTN i=0;i<Count-1;i++)
-        for (UINTN j=i+1;j<Count;j++) if (Dur[j]>Dur[i]){ UINT64 d=Dur[i];Dur[i]=Dur[j];Dur[j]=d;UINTN t=idx[i];idx[i]=idx[j];idx[j]=t; }
-    for (UINTN i=0;i<5 && i<Count;i++)
-        Print(L"%s %lu\n", gBootPhases[idx[i]].Name, Dur[i]);
-}
-
 
 // ---------------------[ REAL-TIME STRUCTURE ]---------------------
 typedef struct {
     UINTN PhaseMissCount;
     UINT8 MissedPhase[301];
-    UINT64 TotalTsc;
-    UINT64 MaxPhaseTsc;
-    UINT64 PhaseElapsed[301];
+    UINT64 TotalNs;
+    UINT64 MaxPhaseNs;
+    UINT64 PhaseElapsedNs[301];
+    UINT64 PhaseLogNs[301];    // Log()/LogHex() formatting time inside the phase
+    UINT64 LogNs;
+    UINT64 PhaseTsc[301];
+    UINT64 StartTsc;
 } BOOT_REALTIME;
 
 static BOOT_REALTIME gRealTime;
 
-static const UINT64 gPhaseDeadline[301] = {
-    [0 ... 300] = 2000000, // Default: 2M cycles per phase (~1ms at 2GHz)
-    [1] = 1000000, [2] = 1000000, [3] = 1000000,
-    [50] = 5000000,  [65] = 6000000, [72] = 6000000,
-    [191] = 1000000, [300] = 3000000
+// Budgets are wall time; Tsc_Calibrate() in efi_main supplies the rate.
+static const UINT64 gPhaseDeadlineNs[301] = {
+    [0 ... 300] = 1000000, // Default: 1ms per phase
+    [1] = 500000, [2] = 500000, [3] = 500000,
+    [50] = 2500000,  [56] = 3000000, [69] = 3000000,
+    [191] = 500000, [300] = 1500000
 };
 
-#define MAX_TOTAL_BOOT_TSC 100000000ULL  // ~50ms at 2GHz
+#define MAX_TOTAL_BOOT_NS  50000000ULL   // 50ms
+
+// ---------------------[ ADAPTIVE DEADLINES ]---------------------
+// Each phase keeps an exponentially-weighted mean and variance of its cost
+// across boots (alpha = 1/8). Once a phase has a few samples its deadline
+// becomes mean + k*sigma, held between a floor that absorbs timer noise and
+// a hard ceiling; until then gPhaseDeadlineNs applies. The model is one
+// NVRAM variable, read in efi_main and written once before the kernel jump.
+#define DEADLINE_MODEL_VERSION  2      // per table index; bump when phases move
+#define DEADLINE_ALPHA_SHIFT    3
+#define DEADLINE_K_SIGMA        4
+#define DEADLINE_MIN_SAMPLES    4
+#define DEADLINE_FLOOR_NS       50000ULL
+#define DEADLINE_CEILING_NS     1000000000ULL
 
-static EFI_STATUS RunAllPhases(BOOT_CONTEXT *Ctx) {
+typedef struct {
+    UINT32 Version;
+    UINT32 Count;
+    UINT32 MeanNs[301];
+    UINT32 StdNs[301];
+    UINT8  Samples[301];        // saturates at 255
+} DEADLINE_MODEL;
+
+static DEADLINE_MODEL gDeadlineModel;
+static BOOLEAN gDeadlineModelSaved;
+
+static UINT64 ISqrt64(UINT64 V) {
+    UINT64 Root = 0, Bit = 1ULL << 62;
+    while (Bit > V) Bit >>= 2;
+    while (Bit) {
+        if (V >= Root + Bit) { V -= Root + Bit; Root = (Root >> 1) + Bit; }
+        else Root >>= 1;
+        Bit >>= 2;
+    }
+    return Root;
+}
+
+static VOID DeadlineModelLoad(VOID) {
+    UINTN Size = sizeof(gDeadlineModel);
+    EFI_STATUS Status = gRT->GetVariable(L"PhaseDeadlineModel", &gAiOsVendorGuid, NULL, &Size, &gDeadlineModel);
+    if (EFI_ERROR(Status) || Size != sizeof(gDeadlineModel) ||
+        gDeadlineModel.Version != DEADLINE_MODEL_VERSION || gDeadlineModel.Count != 301) {
+        ZeroMem(&gDeadlineModel, sizeof(gDeadlineModel));
+        gDeadlineModel.Version = DEADLINE_MODEL_VERSION;
+        gDeadlineModel.Count = 301;
+        return;
+    }
+    UINTN Learned = 0;
+    for (UINTN i = 0; i < 301; ++i) if (gDeadlineModel.Samples[i] >= DEADLINE_MIN_SAMPLES) Learned++;
+    Log(LOG_INFO, L"[RT] deadline model: %u of 301 phases learned", Learned);
+}
+
+static VOID DeadlineModelSave(VOID) {
+    if (gDeadlineModelSaved) return;
+    gDeadlineModelSaved = TRUE;
+    gRT->SetVariable(L"PhaseDeadlineModel", &gAiOsVendorGuid,
+                     EFI_VARIABLE_NON_VOLATILE|EFI_VARIABLE_BOOTSERVICE_ACCESS|EFI_VARIABLE_RUNTIME_ACCESS,
+                     sizeof(gDeadlineModel), &gDeadlineModel);
+}
+
+static VOID DeadlineModelSample(UINTN Index, UINT64 Ns) {
+    if (Ns > DEADLINE_CEILING_NS) Ns = DEADLINE_CEILING_NS;
+    if (gDeadlineModel.Samples[Index] == 0) {
+        gDeadlineModel.MeanNs[Index] = (UINT32)Ns;
+        gDeadlineModel.StdNs[Index] = 0;
+    } else {
+        INT64 Mean = gDeadlineModel.MeanNs[Index];
+        INT64 Delta = (INT64)Ns - Mean;
+        UINT64 Var = (UINT64)gDeadlineModel.StdNs[Index] * gDeadlineModel.StdNs[Index];
+        Var += (UINT64)(Delta * Delta) >> DEADLINE_ALPHA_SHIFT;
+        Var -= Var >> DEADLINE_ALPHA_SHIFT;
+        gDeadlineModel.MeanNs[Index] = (UINT32)(Mean + (Delta >> DEADLINE_ALPHA_SHIFT));
+        gDeadlineModel.StdNs[Index] = (UINT32)ISqrt64(Var);
+    }
+    if (gDeadlineModel.Samples[Index] < 255) gDeadlineModel.Samples[Index]++;
+}
+
+static UINT64 PhaseDeadlineNs(UINTN Index) {
+    if (gDeadlineModel.Samples[Index] < DEADLINE_MIN_SAMPLES) return gPhaseDeadlineNs[Index];
+    UINT64 Ns = gDeadlineModel.MeanNs[Index] + (UINT64)DEADLINE_K_SIGMA * gDeadlineModel.StdNs[Index];
+    if (Ns < DEADLINE_FLOOR_NS) Ns = DEADLINE_FLOOR_NS;
+    if (Ns > DEADLINE_CEILING_NS) Ns = DEADLINE_CEILING_NS;
+    return Ns;
+}
+
+// ---------------------[ BOOT PROFILE ]---------------------
+// Every boot leaves a BOOT_PROFILE in the BootProfilePending variable at the
+// kernel jump, which is past ExitBootServices and too late for the ESP. The
+// next boot appends it to the profile.bin ring in Phase019 and takes the
+// per-phase median of the ring as its baseline. A phase is reported as a
+// regression when it is profile_regress_pct percent over the baseline and
+// also PROFILE_NOISE_NS over it, so microsecond phases do not flag on jitter.
+// The comparison runs in Phase180, while the console still works, so phases
+// from there to the jump are recorded but never flagged.
+#define BOOT_PROFILE_FILE           L"\\EFI\\AiOS\\profile.bin"
+#define PROFILE_PENDING_VAR         L"BootProfilePending"
+#define PROFILE_REGRESS_PCT_DEFAULT 25
+#define PROFILE_MIN_SAMPLES         4
+#define PROFILE_NOISE_NS            100000ULL
+
+static struct {
+    UINT32       Samples;       // records behind the baseline
+    UINT32       Sequence;      // newest record in the ring
+    UINT64       BaselineNs[BOOT_PROFILE_PHASES];
+    UINT64       BaselineTotalNs;
+    BOOLEAN      Reported;
+    BOOLEAN      Saved;
+    BOOT_PROFILE Record;
+} gProfile;
+
+// Records carry their own TSC rate; Tsc_ToNs only knows this boot's.
+static UINT64 ProfileNs(UINT64 Ticks, UINT64 Hz) {
+    if (Hz == 0) return 0;
+    return (Ticks / Hz) * 1000000000ULL + (Ticks % Hz) * 1000000000ULL / Hz;
+}
+
+static BOOLEAN ProfileRingValid(const BOOT_PROFILE_RING *R) {
+    return R->Magic == BOOT_PROFILE_RING_MAGIC && R->Version == BOOT_PROFILE_VERSION &&
+           R->PhaseCount == BOOT_PROFILE_PHASES && R->Slots == BOOT_PROFILE_SLOTS &&
+           R->RecordSize == sizeof(BOOT_PROFILE) && R->Next < R->Slots && R->Count <= R->Slots;
+}
+
+// Insertion sort; there are never more than BOOT_PROFILE_SLOTS values.
+static UINT64 ProfileMedian(UINT64 *V, UINTN N) {
+    for (UINTN i = 1; i < N; ++i) {
+        UINT64 X = V[i];
+        UINTN j = i;
+        while (j > 0 && V[j - 1] > X) { V[j] = V[j - 1]; --j; }
+        V[j] = X;
+    }
+    return N ? V[N / 2] : 0;
+}
+
+static VOID ProfileBaseline(const BOOT_PROFILE *Records) {
+    UINT64 V[BOOT_PROFILE_SLOTS];
+    UINTN N;
+
+    for (UINTN p = 0; p < BOOT_PROFILE_PHASES; ++p) {
+        N = 0;
+        for (UINTN r = 0; r < BOOT_PROFILE_SLOTS; ++r)
+            if (Records[r].Magic == BOOT_PROFILE_MAGIC) V[N++] = ProfileNs(Records[r].PhaseTsc[p], Records[r].TscHz);
+        gProfile.BaselineNs[p] = ProfileMedian(V, N);
+    }
+    N = 0;
+    for (UINTN r = 0; r < BOOT_PROFILE_SLOTS; ++r)
+        if (Records[r].Magic == BOOT_PROFILE_MAGIC) V[N++] = ProfileNs(Records[r].TotalTsc, Records[r].TscHz);
+    gProfile.BaselineTotalNs = ProfileMedian(V, N);
+    gProfile.Samples = (UINT32)N;
+}
+
+static EFI_STATUS ProfileWrite(EFI_FILE_HANDLE File, UINT64 Offset, VOID *Buf, UINTN Size) {
+    UINTN Want = Size;
+    EFI_STATUS Status = File->SetPosition(File, Offset);
+    if (!EFI_ERROR(Status)) Status = File->Write(File, &Size, Buf);
+    if (!EFI_ERROR(Status) && Size != Want) Status = EFI_VOLUME_FULL;
+    return Status;
+}
+
+static VOID ProfileRingLoad(VOID) {
+    STATIC BOOT_PROFILE Pending;
+    BOOT_PROFILE_RING Ring;
+    BOOT_PROFILE *Records;
+    EFI_FILE_HANDLE File;
+    UINTN RecordsSize = BOOT_PROFILE_SLOTS * sizeof(BOOT_PROFILE);
+    UINTN Size = sizeof(Pending);
+    BOOLEAN Fresh = FALSE;
+    EFI_STATUS Status;
+
+    if (gBootContext.RootDir == NULL) return;
+    BOOLEAN HavePending =
+        !EFI_ERROR(gRT->GetVariable(PROFILE_PENDING_VAR, &gAiOsVendorGuid, NULL, &Size, &Pending)) &&
+        Size == sizeof(Pending) && Pending.Magic == BOOT_PROFILE_MAGIC;
+
+    Status = gBootContext.RootDir->Open(gBootContext.RootDir, &File, BOOT_PROFILE_FILE,
+        EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE, 0);
+    if (EFI_ERROR(Status)) { Log(LOG_WARN, L"profile.bin not opened: %r", Status); return; }
+    Status = SafeAllocatePool(RecordsSize, (VOID**)&Records, "Profile");
+    if (EFI_ERROR(Status)) { File->Close(File); return; }
+
+    Size = sizeof(Ring);
+    Status = File->Read(File, &Size, &Ring);
+    if (EFI_ERROR(Status) || Size != sizeof(Ring) || !ProfileRingValid(&Ring)) {
+        ZeroMem(&Ring, sizeof(Ring));
+        Ring.Magic = BOOT_PROFILE_RING_MAGIC;
+        Ring.Version = BOOT_PROFILE_VERSION;
+        Ring.PhaseCount = BOOT_PROFILE_PHASES;
+        Ring.Slots = BOOT_PROFILE_SLOTS;
+        Ring.RecordSize = sizeof(BOOT_PROFILE);
+        ZeroMem(Records, RecordsSize);
+        Fresh = TRUE;
+    } else {
+        // A short file just leaves its last slots empty.
+        Size = RecordsSize;
+        if (EFI_ERROR(File->Read(File, &Size, Records))) Size = 0;
+        ZeroMem((UINT8*)Records + Size, RecordsSize - Size);
+    }
+
+    if (HavePending) {
+        UINT32 Slot = Ring.Next;
+        Pending.Sequence = ++Ring.Sequence;
+        Records[Slot] = Pending;
+        Ring.Next = (Ring.Next + 1) % Ring.Slots;
+        if (Ring.Count < Ring.Slots) Ring.Count++;
+        Status = Fresh ? ProfileWrite(File, sizeof(Ring), Records, RecordsSize)
+                       : ProfileWrite(File, sizeof(Ring) + (UINT64)Slot * sizeof(BOOT_PROFILE), &Records[Slot], sizeof(BOOT_PROFILE));
+        if (!EFI_ERROR(Status)) Status = ProfileWrite(File, 0, &Ring, sizeof(Ring));
+        if (!EFI_ERROR(Status))
+            gRT->SetVariable(PROFILE_PENDING_VAR, &gAiOsVendorGuid, 0, 0, NULL);
+        else
+            Log(LOG_WARN, L"profile.bin not written: %r", Status);
+    }
+    File->Close(File);
+
+    gProfile.Sequence = Ring.Sequence;
+    ProfileBaseline(Records);
+    SafeFree(Records);
+    Log(LOG_INFO, L"Boot profile: %u boots on record, median %lu us", gProfile.Samples, gProfile.BaselineTotalNs / 1000);
+}
+
+// Builds this boot's record so far and reports regressions against the
+// baseline.
+static VOID ProfileReport(VOID) {
     UINTN Count = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
-    UINT64 globalStart = AsmReadTsc();
-    UINT64 maxTsc = 0;
+    BOOT_PROFILE *R = &gProfile.Record;
+    UINT32 Pct = gBootContext.Config.ProfileRegressPct ? gBootContext.Config.ProfileRegressPct : PROFILE_REGRESS_PCT_DEFAULT;
+    UINT32 Regressed = 0;
+
+    if (gProfile.Reported) return;
+    gProfile.Reported = TRUE;
+    if (Count > BOOT_PROFILE_PHASES) Count = BOOT_PROFILE_PHASES;
+    ZeroMem(R, sizeof(*R));
+    R->Magic = BOOT_PROFILE_MAGIC;
+    R->Sequence = gProfile.Sequence + 1;
+    R->TscHz = Tsc_Info()->Hz;
+    R->TotalTsc = AsmReadTsc() - gRealTime.StartTsc;
+    R->KernelSize = gBootContext.Params.KernelSize;
+    if (gVerifyCache.SignatureHit) R->Flags |= BOOT_PROFILE_F_VERIFY_HIT;
+    if (gVerifyCache.ChainHit) R->Flags |= BOOT_PROFILE_F_CHAIN_HIT;
+    if (gKernelStream.Compressed) R->Flags |= BOOT_PROFILE_F_LZ4;
+    R->PhaseMisses = (UINT16)MIN(gRealTime.PhaseMissCount, MAX_UINT16);
+    R->PcrReads = (UINT16)MIN(gBootContext.Pcr.Commands, MAX_UINT16);
+    R->EspOpens = (UINT16)MIN(gEspCache.Opens, MAX_UINT16);
+    R->EspOpenHits = (UINT16)MIN(gEspCache.OpenHits, MAX_UINT16);
+    R->EspInfos = (UINT16)MIN(gEspCache.GetInfos, MAX_UINT16);
+    R->EspInfoHits = (UINT16)MIN(gEspCache.InfoHits, MAX_UINT16);
+
+    for (UINTN i = 0; i < Count; ++i) {
+        R->PhaseTsc[i] = (UINT32)MIN(gRealTime.PhaseTsc[i], MAX_UINT32);
+        if (gProfile.Samples < PROFILE_MIN_SAMPLES) continue;
+        UINT64 Ns = gRealTime.PhaseElapsedNs[i], Base = gProfile.BaselineNs[i];
+        if (Ns <= Base + PROFILE_NOISE_NS || Ns * 100 <= Base * (100 + Pct)) continue;
+        Regressed++;
+        Log(LOG_WARN, L"[RT] %s regressed: %lu us, median %lu us", gBootPhases[i].Name, Ns / 1000, Base / 1000);
+    }
+    if (Regressed) R->Flags |= BOOT_PROFILE_F_REGRESSED;
+    if (gProfile.Samples >= PROFILE_MIN_SAMPLES)
+        Log(LOG_INFO, L"[RT] profile: boot %u took %lu us, median %lu us over %u boots, %u phases over +%u%%",
+            R->Sequence, Tsc_ToNs(R->TotalTsc) / 1000, gProfile.BaselineTotalNs / 1000, gProfile.Samples, Regressed, Pct);
+}
+
+// Brings the record's timings up to the kernel jump and leaves it for the
+// next boot to append. Runs after ExitBootServices, so it logs nothing.
+static VOID ProfileSave(VOID) {
+    UINTN Count = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
+    BOOT_PROFILE *R = &gProfile.Record;
+
+    if (gProfile.Saved) return;
+    gProfile.Saved = TRUE;
+    ProfileReport();
+    if (Count > BOOT_PROFILE_PHASES) Count = BOOT_PROFILE_PHASES;
+    R->TotalTsc = AsmReadTsc() - gRealTime.StartTsc;
+    for (UINTN i = 0; i < Count; ++i) R->PhaseTsc[i] = (UINT32)MIN(gRealTime.PhaseTsc[i], MAX_UINT32);
+    gRT->SetVariable(PROFILE_PENDING_VAR, &gAiOsVendorGuid,
+                     EFI_VARIABLE_NON_VOLATILE|EFI_VARIABLE_BOOTSERVICE_ACCESS|EFI_VARIABLE_RUNTIME_ACCESS,
+                     sizeof(*R), R);
+}
 
+// The five slowest phases of this boot, kept sorted in one pass.
+static VOID PrintTopPhases(VOID) {
+    UINTN Count = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
+    UINTN Top[5], N = 0;
     for (UINTN i = 0; i < Count; ++i) {
-        UINT64 start = AsmReadTsc();
-        EFI_STATUS Status;
+        UINT64 Ns = gRealTime.PhaseElapsedNs[i];
+        if (N == 5 && Ns <= gRealTime.PhaseElapsedNs[Top[4]]) continue;
+        UINTN j = (N < 5) ? N++ : 4;
+        while (j > 0 && gRealTime.PhaseElapsedNs[Top[j - 1]] < Ns) { Top[j] = Top[j - 1]; --j; }
+        Top[j] = i;
+    }
+    for (UINTN i = 0; i < N; ++i)
+        Log(LOG_INFO, L"%s %lu ns", gBootPhases[Top[i]].Name, gRealTime.PhaseElapsedNs[Top[i]]);
+}
+
+static VOID PhaseAccount(UINTN Index, EFI_STATUS Status, UINT64 Elapsed) {
+    UINT64 ElapsedNs = Tsc_ToNs(Elapsed);
+    UINT64 DeadlineNs = PhaseDeadlineNs(Index);
+    gRealTime.PhaseElapsedNs[Index] = ElapsedNs;
+    gRealTime.PhaseTsc[Index] = Elapsed;
+    if (ElapsedNs > gRealTime.MaxPhaseNs) gRealTime.MaxPhaseNs = ElapsedNs;
+    if (ElapsedNs > DeadlineNs) {
+        gRealTime.PhaseMissCount++;
+        gRealTime.MissedPhase[Index] = 1;
+        Log(LOG_WARN, L"[RT] Phase %u exceeded deadline (%lu > %lu ns)", Index, ElapsedNs, DeadlineNs);
+    }
+    if (!EFI_ERROR(Status)) DeadlineModelSample(Index, ElapsedNs);
+    Log(EFI_ERROR(Status) ? LOG_ERROR : LOG_INFO, L"%s -> %r", gBootPhases[Index].Name, Status);
+}
 
-        if (gBootPhases[i].PhaseId == 1)
-            Status = Phase001_InitializeBootContext(Ctx->ImageHandle, Ctx->SystemTable);
-        else
-            Status = gBootPhases[i].Function(Ctx);
+// Phase182 logs this just ahead of its own flush, which is not counted.
+static VOID LogRingStats(VOID) {
+    Log(LOG_INFO, L"[RT] log: %u records, %u dropped, %u filtered, format %lu us, flush %lu us in %u writes",
+        gLog.Head, gLog.Dropped, gLog.Filtered, gRealTime.LogNs / 1000, Tsc_ToNs(gLog.FlushTsc) / 1000, gLog.FlushCalls);
+}
+
+static EFI_STATUS RunPhase(BOOT_CONTEXT *Ctx, UINTN Index) {
+    EFI_STATUS Status;
+    gLog.PhaseId = (UINT16)gBootPhases[Index].PhaseId;
+    gLog.PhaseTsc = 0;
+    UINT32 Scope = BootTrace_Begin(&gTrace, gBootPhases[Index].Name);
+    UINT64 start = AsmReadTsc();
+
+    if (gBootPhases[Index].PhaseId == 1)
+        Status = Phase001_InitializeBootContext(Ctx->ImageHandle, Ctx->SystemTable);
+    else
+        Status = gBootPhases[Index].Function(Ctx);
+    BootTrace_End(&gTrace, Scope);
+    PhaseAccount(Index, Status, AsmReadTsc() - start);
+    gRealTime.PhaseLogNs[Index] = Tsc_ToNs(gLog.PhaseTsc);
+    gRealTime.LogNs += gRealTime.PhaseLogNs[Index];
+    LogFlushIfFull();
+    return Status;
+}
+
+// ---------------------[ HANDOFF BLOCK ]---------------------
+// Phase171 sizes and maps the block while boot services are up and records
+// the CPU topology, which needs MP services. Phase190 adds everything else,
+// so the phase timings run up to the handoff itself.
+#define HANDOFF_MAX_CPUS        256
+#define HANDOFF_SECTION_BYTES(Payload) \
+    ALIGN_VALUE(sizeof(BOOT_HANDOFF_SECTION) + (Payload), BOOT_HANDOFF_ALIGN)
+
+static VOID HandoffAddTopology(BOOT_HANDOFF *H) {
+    EFI_MP_SERVICES_PROTOCOL *Mp;
+    UINTN NumCpus = 0, NumEnabled = 0, Bsp = 0;
+
+    if (EFI_ERROR(gBS->LocateProtocol(&gEfiMpServiceProtocolGuid, NULL, (VOID**)&Mp))) return;
+    if (EFI_ERROR(Mp->GetNumberOfProcessors(Mp, &NumCpus, &NumEnabled))) return;
+    if (EFI_ERROR(Mp->WhoAmI(Mp, &Bsp))) return;
+    if (NumCpus > HANDOFF_MAX_CPUS) NumCpus = HANDOFF_MAX_CPUS;
+
+    HANDOFF_CPU_TOPOLOGY *T = BootHandoff_Add(H, HANDOFF_TYPE_CPU_TOPOLOGY, 1,
+        (UINT32)(sizeof(*T) + NumCpus * sizeof(HANDOFF_CPU)));
+    if (T == NULL) return;
+    T->Cpus.EntrySize = sizeof(HANDOFF_CPU);
+    T->Cpus.EntryOffset = sizeof(*T);
+    T->BspIndex = (UINT32)Bsp;
+    HANDOFF_CPU *Cpu = (HANDOFF_CPU*)(T + 1);
+    for (UINTN i = 0; i < NumCpus; ++i) {
+        EFI_PROCESSOR_INFORMATION Info;
+        if (EFI_ERROR(Mp->GetProcessorInfo(Mp, i, &Info))) continue;
+        Cpu->ProcessorId = Info.ProcessorId;
+        Cpu->Package = Info.Location.Package;
+        Cpu->Core = Info.Location.Core;
+        Cpu->Thread = Info.Location.Thread;
+        Cpu->StatusFlag = Info.StatusFlag;
+        Cpu++;
+        T->Cpus.Count++;
+    }
+}
 
-        UINT64 end = AsmReadTsc();
-        UINT64 elapsed = end - start;
-        gRealTime.PhaseElapsed[i] = elapsed;
-        if (elapsed > maxTsc) maxTsc = elapsed;
+static EFI_STATUS HandoffAllocate(BOOT_CONTEXT *Ctx) {
+    UINTN PhaseCount = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
+    UINTN Size = ALIGN_VALUE(sizeof(BOOT_HANDOFF), BOOT_HANDOFF_ALIGN)
+        + HANDOFF_SECTION_BYTES(sizeof(HANDOFF_PHASE_TIMINGS) + PhaseCount * sizeof(HANDOFF_PHASE_TIMING))
+        + HANDOFF_SECTION_BYTES(sizeof(HANDOFF_TSC_INFO))
+        + HANDOFF_SECTION_BYTES(sizeof(ACPI_INDEX))
+        + HANDOFF_SECTION_BYTES(sizeof(HANDOFF_PCR_BANK))
+        + HANDOFF_SECTION_BYTES(sizeof(HANDOFF_CPU_TOPOLOGY) + HANDOFF_MAX_CPUS * sizeof(HANDOFF_CPU));
+    EFI_PHYSICAL_ADDRESS Page;
 
-        if (elapsed > gPhaseDeadline[i]) {
-            gRealTime.PhaseMissCount++;
-            gRealTime.MissedPhase[i] = 1;
-            Log(LOG_WARN, L"[RT] Phase %u exceeded deadline (%lu > %lu)", i, elapsed, gPhaseDeadline[i]);
+    if (Ctx->Params.Handoff) return EFI_SUCCESS;
+    EFI_STATUS Status = SafeAllocatePages(AllocateAnyPages, EfiLoaderData, EFI_SIZE_TO_PAGES(Size), &Page, "Handoff");
+    if (EFI_ERROR(Status)) return Status;
+    Ctx->Params.Handoff = (BOOT_HANDOFF*)(UINTN)Page;
+    BootHandoff_Init(Ctx->Params.Handoff, (UINT32)EFI_PAGES_TO_SIZE(EFI_SIZE_TO_PAGES(Size)));
+    HandoffAddTopology(Ctx->Params.Handoff);
+    return EFI_SUCCESS;
+}
+
+static EFI_STATUS HandoffFinish(BOOT_CONTEXT *Ctx) {
+    BOOT_HANDOFF *H = Ctx->Params.Handoff;
+    UINTN PhaseCount = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
+    if (H == NULL) return EFI_NOT_READY;
+
+    const TSC_INFO *Tsc = Tsc_Info();
+    HANDOFF_TSC_INFO *T = BootHandoff_Add(H, HANDOFF_TYPE_TSC, 1, sizeof(*T));
+    if (T) {
+        T->Hz = Tsc->Hz;
+        T->Source = Tsc->Source;
+        T->Invariant = Tsc->Invariant;
+    }
+
+    if (Ctx->Params.AcpiTables) {
+        VOID *A = BootHandoff_Add(H, HANDOFF_TYPE_ACPI_INDEX, 1, sizeof(ACPI_INDEX));
+        if (A) CopyMem(A, Ctx->Params.AcpiTables, sizeof(ACPI_INDEX));
+    }
+
+    if (Ctx->Pcr.Valid) {
+        HANDOFF_PCR_BANK *P = BootHandoff_Add(H, HANDOFF_TYPE_PCRS, 1, sizeof(*P));
+        if (P) {
+            P->Valid = Ctx->Pcr.Valid;
+            P->HashAlg = HANDOFF_PCR_SHA256;
+            P->DigestSize = SHA256_DIGEST_LENGTH;
+            CopyMem(P->Digest, Ctx->Pcr.Sha256, sizeof(P->Digest));
         }
+    }
 
-        Log(EFI_ERROR(Status) ? LOG_ERROR : LOG_INFO, L"%s -> %r", gBootPhases[i].Name, Status);
-        if (EFI_ERROR(Status)) { CleanupAll(); return Status; }
+    // Phases that have not run yet (this one included) report zero.
+    HANDOFF_PHASE_TIMINGS *Pt = BootHandoff_Add(H, HANDOFF_TYPE_PHASE_TIMINGS, 1,
+        (UINT32)(sizeof(*Pt) + PhaseCount * sizeof(HANDOFF_PHASE_TIMING)));
+    if (Pt) {
+        HANDOFF_PHASE_TIMING *E = (HANDOFF_PHASE_TIMING*)(Pt + 1);
+        Pt->Phases.Count = (UINT32)PhaseCount;
+        Pt->Phases.EntrySize = sizeof(*E);
+        Pt->Phases.EntryOffset = sizeof(*Pt);
+        Pt->LoaderNs = Tsc_ToNs(AsmReadTsc() - gRealTime.StartTsc);
+        for (UINTN i = 0; i < PhaseCount; ++i, ++E) {
+            E->PhaseId = (UINT16)gBootPhases[i].PhaseId;
+            E->Flags = gRealTime.MissedPhase[i] ? HANDOFF_PHASE_F_MISSED : 0;
+            E->ElapsedNs = gRealTime.PhaseElapsedNs[i];
+            E->DeadlineNs = PhaseDeadlineNs(i);
+        }
     }
 
+    Log(LOG_INFO, L"Handoff: %u sections, %u of %u bytes", H->SectionCount, H->Size, H->Capacity);
+    return EFI_SUCCESS;
+}
+
+// ---------------------[ BOOT TRACE EXPORT ]---------------------
+// boot_trace.json loads in chrome://tracing or Perfetto; boot_trace.folded
+// feeds flamegraph.pl. Both are replaced on every boot.
+#define BOOT_TRACE_JSON     L"\\EFI\\AiOS\\boot_trace.json"
+#define BOOT_TRACE_FOLDED   L"\\EFI\\AiOS\\boot_trace.folded"
+
+static EFI_STATUS TraceWriteFile(EFI_FILE_HANDLE Root, CONST CHAR16 *Path, CHAR8 *Buf, UINTN Len) {
+    EFI_FILE_HANDLE File;
+    // Delete first so a shorter trace leaves no tail of the last one.
+    if (!EFI_ERROR(Root->Open(Root, &File, (CHAR16*)Path, EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, 0)))
+        File->Delete(File);
+    EFI_STATUS Status = Root->Open(Root, &File, (CHAR16*)Path,
+        EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE, 0);
+    if (EFI_ERROR(Status)) return Status;
+    Status = File->Write(File, &Len, Buf);
+    File->Close(File);
+    return Status;
+}
+
+static VOID TraceExport(VOID) {
+    EFI_FILE_HANDLE Root = gBootContext.RootDir;
+    UINT64 Now = AsmReadTsc();
+    UINTN Size = ((UINTN)gTrace.Count + 1) * BOOT_TRACE_LINE_MAX;
+    CHAR8 *Buf;
+    EFI_STATUS Status = EFI_NOT_READY;
+
+    // Phase101 has already closed the root directory.
+    if (Root == NULL && gBootContext.FileSystem)
+        Status = gBootContext.FileSystem->OpenVolume(gBootContext.FileSystem, &Root);
+    if (Root && gTrace.Count) {
+        Status = SafeAllocatePool(Size, (VOID**)&Buf, "TraceOut");
+        if (!EFI_ERROR(Status)) {
+            Status = TraceWriteFile(Root, BOOT_TRACE_JSON, Buf,
+                                    BootTrace_FormatChrome(&gTrace, Buf, Size, gRealTime.StartTsc, Now));
+            if (!EFI_ERROR(Status))
+                Status = TraceWriteFile(Root, BOOT_TRACE_FOLDED, Buf, BootTrace_FormatFolded(&gTrace, Buf, Size, Now));
+            SafeFree(Buf);
+        }
+    }
+    if (Root && Root != gBootContext.RootDir) Root->Close(Root);
+    Log(LOG_INFO, L"[RT] trace: %u events, %u dropped, %lu cycles per scope (budget %lu)%s, export %r",
+        gTrace.Count, gTrace.Dropped, gTrace.ScopeCycles, gTrace.BudgetCycles,
+        gTrace.Calls ? L"" : L", firmware calls not traced", Status);
+}
+
+static EFI_STATUS RunAllPhases(BOOT_CONTEXT *Ctx) {
+    UINTN Count = sizeof(gBootPhases)/sizeof(gBootPhases[0]);
+    UINT64 globalStart = AsmReadTsc();
+    EFI_STATUS Status = EFI_SUCCESS;
+
+    gRealTime.StartTsc = globalStart;
+    for (UINTN i = 0; i < Count; ++i) {
+        Status = RunPhase(Ctx, i);
+        if (EFI_ERROR(Status)) break;
+    }
+    // A failed phase ends the boot. Its allocations go back with the rest of
+    // the arena here and not earlier, since globals such as gPhdrs may still
+    // point into them.
+    if (EFI_ERROR(Status)) { ArenaLogStats(); LogFlush(); ArenaTeardown(FALSE); return Status; }
+
     UINT64 globalEnd = AsmReadTsc();
-    gRealTime.TotalTsc = globalEnd - globalStart;
-    gRealTime.MaxPhaseTsc = maxTsc;
+    gRealTime.TotalNs = Tsc_ToNs(globalEnd - globalStart);
 
-    if (gRealTime.TotalTsc > MAX_TOTAL_BOOT_TSC || gRealTime.PhaseMissCount > 10) {
+    if (gRealTime.TotalNs > MAX_TOTAL_BOOT_NS || gRealTime.PhaseMissCount > 10) {
         Ctx->Params.FallbackMode = TRUE;
         Log(LOG_WARN, L"[RT] Boot duration or phase count exceeded RT limits.");
     }
@@ -2729,8 +3876,10 @@ static EFI_STATUS RunAllPhases(BOOT_CONTEXT *Ctx) {
     if (gRealTime.PhaseMissCount > 0 && Ctx->Params.BootTrustScore > 5)
         Ctx->Params.BootTrustScore -= (UINT8)(gRealTime.PhaseMissCount);
 
+    DeadlineModelSave();
+    ProfileSave();
     PrintTopPhases();
-    CleanupAll();
+    ArenaTeardown(TRUE);
     return EFI_SUCCESS;
 }
 
@@ -2740,7 +3889,22 @@ EFI_STATUS EFIAPI efi_main(EFI_HANDLE ImageHandle, EFI_SYSTEM_TABLE *SystemTable
     gBootContext.ImageHandle = ImageHandle;
     gBootContext.SystemTable = SystemTable;
 
+    const TSC_INFO *Tsc = Tsc_Calibrate();
+    Log(LOG_INFO, L"TSC %lu kHz (source %u)%s", Tsc->Hz / 1000, Tsc->Source,
+        Tsc->Invariant ? L"" : L", not invariant: deadlines may drift with P-states");
+    DeadlineModelLoad();
+    // Map the first arena chunk before Phase031 so the map it takes stays
+    // valid while the loader allocates.
+    EFI_STATUS ArenaStatus = BootArena_Grow(&gArena, 0);
+    if (EFI_ERROR(ArenaStatus))
+        Log(LOG_WARN, L"Boot arena not mapped up front: %r", ArenaStatus);
+    BOOT_TRACE_EVENT *TraceEvents;
+    if (EFI_ERROR(SafeAllocatePool(BOOT_TRACE_EVENTS * sizeof(*TraceEvents), (VOID**)&TraceEvents, "Trace")))
+        TraceEvents = NULL;
+    BootTrace_Init(&gTrace, TraceEvents, TraceEvents ? BOOT_TRACE_EVENTS : 0, BOOT_TRACE_BUDGET_CYCLES);
+
     EFI_STATUS St = RunAllPhases(&gBootContext);
+    LogFlush();
     if (gBootContext.Config.BootDelay)
         gBS->Stall(gBootContext.Config.BootDelay * 1000000);
 
@@ -0,0 +1,69 @@
+// memory_regions.c - Sorted, coalesced memory map shared by the loader and the kernel minds
+
+#include <Uefi.h>
+#include <Library/BaseMemoryLib.h>
+#include "memory_regions.h"
+
+static BOOLEAN Mergeable(const MEMORY_REGION *A, const MEMORY_REGION *B) {
+    return A->Type == B->Type && A->Attribute == B->Attribute &&
+           A->Base + EFI_PAGES_TO_SIZE(A->Pages) == B->Base;
+}
+
+EFI_STATUS MemoryRegions_Build(MEMORY_REGION_INDEX *Index, const VOID *Map, UINTN MapSize, UINTN DescriptorSize) {
+    UINTN Count = DescriptorSize ? MapSize / DescriptorSize : 0;
+    ZeroMem(Index, OFFSET_OF(MEMORY_REGION_INDEX, Region));
+
+    // Firmware maps are almost always sorted already, so insertion sort is
+    // a single pass in practice. Merging happens against the tail as
+    // descriptors go in, which keeps Region[] within bounds for maps that
+    // have more descriptors than MEMORY_REGION_MAX.
+    for (UINTN i = 0; i < Count; ++i) {
+        const EFI_MEMORY_DESCRIPTOR *D = (const EFI_MEMORY_DESCRIPTOR *)((const UINT8 *)Map + i * DescriptorSize);
+        MEMORY_REGION R = { D->PhysicalStart, D->NumberOfPages, D->Attribute, D->Type, 0 };
+        if (R.Pages == 0) continue;
+
+        if (R.Type < MEMORY_REGION_TYPES) Index->TypePages[R.Type] += R.Pages;
+        else Index->OtherPages += R.Pages;
+        Index->TotalPages += R.Pages;
+        Index->DescriptorCount++;
+
+        UINTN j = Index->Count;
+        while (j > 0 && Index->Region[j - 1].Base > R.Base) --j;
+        if (j > 0 && Mergeable(&Index->Region[j - 1], &R)) {
+            MEMORY_REGION *Prev = &Index->Region[j - 1];
+            Prev->Pages += R.Pages;
+            if (j < Index->Count && Mergeable(Prev, &Index->Region[j])) {
+                Prev->Pages += Index->Region[j].Pages;
+                CopyMem(&Index->Region[j], &Index->Region[j + 1], (Index->Count - j - 1) * sizeof(MEMORY_REGION));
+                Index->Count--;
+            }
+            continue;
+        }
+        if (j < Index->Count && Mergeable(&R, &Index->Region[j])) {
+            Index->Region[j].Base = R.Base;
+            Index->Region[j].Pages += R.Pages;
+            continue;
+        }
+        if (Index->Count == MEMORY_REGION_MAX) return EFI_BUFFER_TOO_SMALL;
+        CopyMem(&Index->Region[j + 1], &Index->Region[j], (Index->Count - j) * sizeof(MEMORY_REGION));
+        Index->Region[j] = R;
+        Index->Count++;
+    }
+    return EFI_SUCCESS;
+}
+
+const MEMORY_REGION *MemoryRegions_Find(const MEMORY_REGION_INDEX *Index, UINT64 Address) {
+    UINTN Lo = 0, Hi = Index->Count;
+    while (Lo < Hi) {
+        UINTN Mid = (Lo + Hi) / 2;
+        const MEMORY_REGION *R = &Index->Region[Mid];
+        if (Address < R->Base) Hi = Mid;
+        else if (Address - R->Base >= EFI_PAGES_TO_SIZE(R->Pages)) Lo = Mid + 1;
+        else return R;
+    }
+    return NULL;
+}
+
+UINT64 MemoryRegions_TypePages(const MEMORY_REGION_INDEX *Index, UINT32 Type) {
+    return Type < MEMORY_REGION_TYPES ? Index->TypePages[Type] : 0;
+}
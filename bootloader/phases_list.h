@@ -59,12 +59,9 @@
 {59, L"Phase059_CloseKernelFilePostLoad", Phase059_CloseKernelFilePostLoad},
 {60, L"Phase060_LogKernelLoaded", Phase060_LogKernelLoaded},
 {61, L"Phase061_LocateHash2Protocol", Phase061_LocateHash2Protocol},
-{62, L"Phase062_OpenKernelForHash", Phase062_OpenKernelForHash},
-{63, L"Phase063_GetKernelSize", Phase063_GetKernelSize},
-{64, L"Phase064_ReadKernelData", Phase064_ReadKernelData},
-{65, L"Phase065_ComputeKernelSha256", Phase065_ComputeKernelSha256},
-{66, L"Phase066_FreeKernelData", Phase066_FreeKernelData},
-{67, L"Phase067_CloseKernelAfterHash", Phase067_CloseKernelAfterHash},
+{62, L"Phase062_VerifyKernelStreamed", Phase062_VerifyKernelStreamed},
+{63, L"Phase063_LogKernelStreamStats", Phase063_LogKernelStreamStats},
+{64, L"Phase064_FreeKernelStreamBuffer", Phase064_FreeKernelStreamBuffer},
 {68, L"Phase068_OpenSignatureFile", Phase068_OpenSignatureFile},
 {69, L"Phase069_ReadSignatureSize", Phase069_ReadSignatureSize},
 {70, L"Phase070_ReadSignatureData", Phase070_ReadSignatureData},
@@ -178,8 +175,8 @@
 {176, L"Phase176_NoOp", Phase176_NoOp},
 {177, L"Phase177_NoOp", Phase177_NoOp},
 {178, L"Phase178_NoOp", Phase178_NoOp},
-{179, L"Phase179_NoOp", Phase179_NoOp},
-{180, L"Phase180_ParamsInjectionDone", Phase180_ParamsInjectionDone},
+{179, L"Phase179_ExportBootTrace", Phase179_ExportBootTrace},
+{180, L"Phase180_ReportLoaderStats", Phase180_ReportLoaderStats},
 {181, L"Phase181_ValidateMapForExit", Phase181_ValidateMapForExit},
 {182, L"Phase182_ExitBootServices", Phase182_ExitBootServices},
 {183, L"Phase183_ShowLaunchSplash", Phase183_ShowLaunchSplash},
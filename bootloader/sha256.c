@@ -1,5 +1,7 @@
 #include "sha256.h"
 #include <string.h>
+#include <cpuid.h>
+#include <immintrin.h>
 
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
 #define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
@@ -9,7 +11,7 @@
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
-static const uint32_t k[64] = {
+static const uint32_t k[64] __attribute__((aligned(64))) = {
   0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
   0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
   0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
@@ -20,64 +22,339 @@ static const uint32_t k[64] = {
   0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
 };
 
-static void transform(SHA256_CTX *ctx, const uint8_t data[])
+static const uint32_t iv[8] = {
+  0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19
+};
+
+typedef void (*sha256_blocks_fn)(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+// Compression rounds over a schedule that already has the round constants folded in.
+static inline void rounds(uint32_t state[8], const uint32_t *wk, size_t stride)
+{
+    uint32_t a,b,c,d,e,f,g,h,i,t1,t2;
+
+    a=state[0]; b=state[1]; c=state[2]; d=state[3];
+    e=state[4]; f=state[5]; g=state[6]; h=state[7];
+
+    for (i=0;i<64;++i) {
+        t1 = h + EP1(e) + CH(e,f,g) + wk[i * stride];
+        t2 = EP0(a) + MAJ(a,b,c);
+        h=g; g=f; f=e; e=d + t1; d=c; c=b; b=a; a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+static void transform(uint32_t state[8], const uint8_t data[])
 {
-    uint32_t a,b,c,d,e,f,g,h,i,j,t1,t2,m[64];
+    uint32_t i,j,m[64];
 
     for (i=0,j=0; i<16; ++i, j+=4)
-        m[i] = (data[j] << 24) | (data[j+1] << 16) | (data[j+2] << 8) | (data[j+3]);
+        m[i] = ((uint32_t)data[j] << 24) | (data[j+1] << 16) | (data[j+2] << 8) | (data[j+3]);
     for ( ; i<64; ++i)
         m[i] = SIG1(m[i-2]) + m[i-7] + SIG0(m[i-15]) + m[i-16];
+    for (i=0; i<64; ++i)
+        m[i] += k[i];
 
-    a=ctx->state[0];
-    b=ctx->state[1];
-    c=ctx->state[2];
-    d=ctx->state[3];
-    e=ctx->state[4];
-    f=ctx->state[5];
-    g=ctx->state[6];
-    h=ctx->state[7];
+    rounds(state, m, 1);
+}
 
-    for (i=0;i<64;++i) {
-        t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-        t2 = EP0(a) + MAJ(a,b,c);
-        h=g; g=f; f=e; e=d + t1; d=c; c=b; b=a; a = t1 + t2;
+static void blocks_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    while (nblocks--) {
+        transform(state, data);
+        data += 64;
+    }
+}
+
+// AVX2: the message schedule of a block does not depend on the chaining
+// state, so eight consecutive blocks are expanded together, one block per
+// 32-bit lane. The rounds then run scalar over the precomputed W+K rows.
+#define V_ROTR(x,n) _mm256_or_si256(_mm256_srli_epi32((x),(n)), _mm256_slli_epi32((x),32-(n)))
+#define V_SIG0(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,7), V_ROTR(x,18)), _mm256_srli_epi32((x),3))
+#define V_SIG1(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,17), V_ROTR(x,19)), _mm256_srli_epi32((x),10))
+
+__attribute__((target("avx2")))
+static void blocks_avx2(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    __m256i w[64];
+    uint32_t wk[64][8] __attribute__((aligned(32)));
+    const __m256i bswap = _mm256_set_epi8(12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3,
+                                          12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3);
+    const __m256i lanes = _mm256_set_epi32(7*64, 6*64, 5*64, 4*64, 3*64, 2*64, 64, 0);
+    size_t i, b;
+
+    while (nblocks >= 8) {
+        for (i=0; i<16; ++i) {
+            __m256i v = _mm256_i32gather_epi32((const int *)(data + i*4), lanes, 1);
+            w[i] = _mm256_shuffle_epi8(v, bswap);
+        }
+        for ( ; i<64; ++i)
+            w[i] = _mm256_add_epi32(_mm256_add_epi32(V_SIG1(w[i-2]), w[i-7]),
+                                    _mm256_add_epi32(V_SIG0(w[i-15]), w[i-16]));
+        for (i=0; i<64; ++i)
+            _mm256_store_si256((__m256i *)wk[i],
+                               _mm256_add_epi32(w[i], _mm256_set1_epi32((int)k[i])));
+        for (b=0; b<8; ++b)
+            rounds(state, &wk[0][b], 8);
+        data += 8 * 64;
+        nblocks -= 8;
+    }
+    blocks_scalar(state, data, nblocks);
+}
+
+// SHA-NI: two rounds per sha256rnds2, state kept as ABEF/CDGH.
+#define SHANI_QROUND(msg, ki)                                                   \
+    do {                                                                        \
+        __m128i t = _mm_add_epi32((msg), _mm_load_si128((const __m128i *)&k[ki])); \
+        s1 = _mm_sha256rnds2_epu32(s1, s0, t);                                  \
+        s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(t, 0x0E));         \
+    } while (0)
+
+__attribute__((target("sha,sse4.1")))
+static void blocks_shani(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i s0, s1, tmp, m0, m1, m2, m3, save0, save1;
+    int i;
+
+    tmp = _mm_loadu_si128((const __m128i *)&state[0]);   // DCBA
+    s1  = _mm_loadu_si128((const __m128i *)&state[4]);   // HGFE
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);                   // CDAB
+    s1  = _mm_shuffle_epi32(s1, 0x1B);                    // EFGH
+    s0  = _mm_alignr_epi8(tmp, s1, 8);                    // ABEF
+    s1  = _mm_blend_epi16(s1, tmp, 0xF0);                 // CDGH
+
+    while (nblocks--) {
+        save0 = s0;
+        save1 = s1;
+
+        m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data +  0)), bswap);
+        m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+        m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+        m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+        SHANI_QROUND(m0, 0);
+        SHANI_QROUND(m1, 4);
+        SHANI_QROUND(m2, 8);
+        SHANI_QROUND(m3, 12);
+
+        // Rounds 16..63: extend the schedule four words at a time.
+        for (i = 16; i < 64; i += 16) {
+            m0 = _mm_sha256msg1_epu32(m0, m1);
+            m0 = _mm_add_epi32(m0, _mm_alignr_epi8(m3, m2, 4));
+            m0 = _mm_sha256msg2_epu32(m0, m3);
+            SHANI_QROUND(m0, i);
+
+            m1 = _mm_sha256msg1_epu32(m1, m2);
+            m1 = _mm_add_epi32(m1, _mm_alignr_epi8(m0, m3, 4));
+            m1 = _mm_sha256msg2_epu32(m1, m0);
+            SHANI_QROUND(m1, i + 4);
+
+            m2 = _mm_sha256msg1_epu32(m2, m3);
+            m2 = _mm_add_epi32(m2, _mm_alignr_epi8(m1, m0, 4));
+            m2 = _mm_sha256msg2_epu32(m2, m1);
+            SHANI_QROUND(m2, i + 8);
+
+            m3 = _mm_sha256msg1_epu32(m3, m0);
+            m3 = _mm_add_epi32(m3, _mm_alignr_epi8(m2, m1, 4));
+            m3 = _mm_sha256msg2_epu32(m3, m2);
+            SHANI_QROUND(m3, i + 12);
+        }
+
+        s0 = _mm_add_epi32(s0, save0);
+        s1 = _mm_add_epi32(s1, save1);
+        data += 64;
     }
 
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
+    tmp = _mm_shuffle_epi32(s0, 0x1B);                    // FEBA
+    s1  = _mm_shuffle_epi32(s1, 0xB1);                    // DCHG
+    s0  = _mm_blend_epi16(tmp, s1, 0xF0);                 // DCBA
+    s1  = _mm_alignr_epi8(s1, tmp, 8);                    // HGFE
+    _mm_storeu_si128((__m128i *)&state[0], s0);
+    _mm_storeu_si128((__m128i *)&state[4], s1);
+}
+
+// Multi-buffer AVX2: eight independent messages, one per 32-bit lane, so
+// the rounds themselves run eight wide. The 8x8 word transpose turns eight
+// 32-byte rows (one per lane) into eight vectors holding word i of each lane.
+#define V_EP0(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,2), V_ROTR(x,13)), V_ROTR(x,22))
+#define V_EP1(x) _mm256_xor_si256(_mm256_xor_si256(V_ROTR(x,6), V_ROTR(x,11)), V_ROTR(x,25))
+#define V_CH(x,y,z) _mm256_xor_si256(_mm256_and_si256(x,y), _mm256_andnot_si256(x,z))
+#define V_MAJ(x,y,z) _mm256_or_si256(_mm256_and_si256(x,y), _mm256_and_si256(z, _mm256_or_si256(x,y)))
+
+__attribute__((target("avx2")))
+static inline void mb_load8(__m256i w[8], const uint8_t *const p[8], size_t off)
+{
+    const __m256i bswap = _mm256_set_epi8(12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3,
+                                          12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3);
+    __m256i r[8], t[8], u[8];
+    int i;
+
+    for (i=0; i<8; ++i)
+        r[i] = _mm256_loadu_si256((const __m256i *)(p[i] + off));
+    for (i=0; i<8; i+=2) {
+        t[i]   = _mm256_unpacklo_epi32(r[i], r[i+1]);
+        t[i+1] = _mm256_unpackhi_epi32(r[i], r[i+1]);
+    }
+    for (i=0; i<8; i+=4) {
+        u[i]   = _mm256_unpacklo_epi64(t[i],   t[i+2]);
+        u[i+1] = _mm256_unpackhi_epi64(t[i],   t[i+2]);
+        u[i+2] = _mm256_unpacklo_epi64(t[i+1], t[i+3]);
+        u[i+3] = _mm256_unpackhi_epi64(t[i+1], t[i+3]);
+    }
+    for (i=0; i<4; ++i) {
+        w[i]   = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i+4], 0x20), bswap);
+        w[i+4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i+4], 0x31), bswap);
+    }
+}
+
+// One block for every lane; lanes whose bit is clear in active keep their state.
+__attribute__((target("avx2")))
+static void mb_block_avx2(uint32_t st[8][8], const uint8_t *const p[8], uint32_t active)
+{
+    __m256i w[64], a,b,c,d,e,f,g,h,t1,t2;
+    const __m256i bit = _mm256_set_epi32(128, 64, 32, 16, 8, 4, 2, 1);
+    const __m256i keep = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)active), bit), bit);
+    int i;
+
+    mb_load8(&w[0], p, 0);
+    mb_load8(&w[8], p, 32);
+    for (i=16; i<64; ++i)
+        w[i] = _mm256_add_epi32(_mm256_add_epi32(V_SIG1(w[i-2]), w[i-7]),
+                                _mm256_add_epi32(V_SIG0(w[i-15]), w[i-16]));
+
+    a = _mm256_load_si256((const __m256i *)st[0]); b = _mm256_load_si256((const __m256i *)st[1]);
+    c = _mm256_load_si256((const __m256i *)st[2]); d = _mm256_load_si256((const __m256i *)st[3]);
+    e = _mm256_load_si256((const __m256i *)st[4]); f = _mm256_load_si256((const __m256i *)st[5]);
+    g = _mm256_load_si256((const __m256i *)st[6]); h = _mm256_load_si256((const __m256i *)st[7]);
+
+    for (i=0; i<64; ++i) {
+        t1 = _mm256_add_epi32(_mm256_add_epi32(h, V_EP1(e)),
+                              _mm256_add_epi32(V_CH(e,f,g), _mm256_add_epi32(w[i], _mm256_set1_epi32((int)k[i]))));
+        t2 = _mm256_add_epi32(V_EP0(a), V_MAJ(a,b,c));
+        h=g; g=f; f=e; e=_mm256_add_epi32(d, t1); d=c; c=b; b=a; a=_mm256_add_epi32(t1, t2);
+    }
+
+#define MB_ACC(n, v) _mm256_store_si256((__m256i *)st[n], \
+        _mm256_add_epi32(_mm256_load_si256((const __m256i *)st[n]), _mm256_and_si256(keep, v)))
+    MB_ACC(0, a); MB_ACC(1, b); MB_ACC(2, c); MB_ACC(3, d);
+    MB_ACC(4, e); MB_ACC(5, f); MB_ACC(6, g); MB_ACC(7, h);
+#undef MB_ACC
+}
+
+// =====================[ Dispatch ]=====================
+static sha256_blocks_fn gBlocks = NULL;
+static sha256_impl_t gImpl = SHA256_IMPL_SCALAR;
+static uint32_t gSupported = 0;
+
+static uint64_t read_xcr0(void)
+{
+    uint32_t lo, hi;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static void detect(void)
+{
+    uint32_t a, b, c, d, max;
+    int sse41 = 0, osxsave = 0, avx = 0;
+
+    gSupported = 1u << SHA256_IMPL_SCALAR;
+    max = __get_cpuid_max(0, NULL);
+    if (max < 1) return;
+    __cpuid(1, a, b, c, d);
+    sse41   = (c >> 19) & 1;
+    osxsave = (c >> 27) & 1;
+    avx     = (c >> 28) & 1;
+    if (max < 7) return;
+    __cpuid_count(7, 0, a, b, c, d);
+
+    if (((b >> 29) & 1) && sse41)
+        gSupported |= 1u << SHA256_IMPL_SHANI;
+    // AVX2 also needs the firmware/OS to have enabled YMM state in XCR0.
+    if (((b >> 5) & 1) && avx && osxsave && (read_xcr0() & 0x6) == 0x6)
+        gSupported |= 1u << SHA256_IMPL_AVX2;
+}
+
+static void select_impl(void)
+{
+    if (gSupported == 0) detect();
+    if (gSupported & (1u << SHA256_IMPL_SHANI))
+        sha256_set_impl(SHA256_IMPL_SHANI);
+    else if (gSupported & (1u << SHA256_IMPL_AVX2))
+        sha256_set_impl(SHA256_IMPL_AVX2);
+    else
+        sha256_set_impl(SHA256_IMPL_SCALAR);
+}
+
+int sha256_set_impl(sha256_impl_t impl)
+{
+    if (gSupported == 0) detect();
+    if ((unsigned)impl >= SHA256_IMPL_COUNT || !(gSupported & (1u << impl)))
+        return -1;
+    switch (impl) {
+    case SHA256_IMPL_SHANI: gBlocks = blocks_shani;  break;
+    case SHA256_IMPL_AVX2:  gBlocks = blocks_avx2;   break;
+    default:                gBlocks = blocks_scalar; break;
+    }
+    gImpl = impl;
+    return 0;
+}
+
+sha256_impl_t sha256_get_impl(void)
+{
+    if (gBlocks == NULL) select_impl();
+    return gImpl;
+}
+
+int sha256_impl_supported(sha256_impl_t impl)
+{
+    if (gSupported == 0) detect();
+    return (unsigned)impl < SHA256_IMPL_COUNT && (gSupported & (1u << impl)) != 0;
+}
+
+// =====================[ Public API ]=====================
+static void store_digest(const uint32_t state[8], uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    size_t i;
+
+    for (i=0;i<32;i++)
+        digest[i] = (state[i >> 2] >> (24 - (i & 3) * 8)) & 0xff;
 }
 
 void sha256_init(SHA256_CTX *ctx)
 {
+    if (gBlocks == NULL) select_impl();
     ctx->bitcount = 0;
-    ctx->state[0] = 0x6a09e667;
-    ctx->state[1] = 0xbb67ae85;
-    ctx->state[2] = 0x3c6ef372;
-    ctx->state[3] = 0xa54ff53a;
-    ctx->state[4] = 0x510e527f;
-    ctx->state[5] = 0x9b05688c;
-    ctx->state[6] = 0x1f83d9ab;
-    ctx->state[7] = 0x5be0cd19;
+    memcpy(ctx->state, iv, sizeof(iv));
 }
 
 void sha256_update(SHA256_CTX *ctx, const uint8_t *data, size_t len)
 {
-    size_t i;
+    size_t used = (size_t)(ctx->bitcount >> 3) & 0x3F;
+
+    ctx->bitcount += (uint64_t)len << 3;
 
-    for (i=0; i < len; ++i) {
-        ctx->buffer[ctx->bitcount >> 3 & 0x3F] = data[i];
-        if ((ctx->bitcount & 0x1ff) == 0x1c0) {
-            transform(ctx, ctx->buffer);
+    if (used) {
+        size_t fill = 64 - used;
+        if (len < fill) {
+            memcpy(ctx->buffer + used, data, len);
+            return;
         }
-        ctx->bitcount += 8;
+        memcpy(ctx->buffer + used, data, fill);
+        gBlocks(ctx->state, ctx->buffer, 1);
+        data += fill;
+        len -= fill;
     }
+    if (len >= 64) {
+        gBlocks(ctx->state, data, len >> 6);
+        data += len & ~(size_t)0x3F;
+        len &= 0x3F;
+    }
+    if (len)
+        memcpy(ctx->buffer, data, len);
 }
 
 void sha256_final(SHA256_CTX *ctx, uint8_t digest[SHA256_DIGEST_LENGTH])
@@ -87,12 +364,11 @@ void sha256_final(SHA256_CTX *ctx, uint8_t digest[SHA256_DIGEST_LENGTH])
     ctx->buffer[i++] = 0x80;
     if (i > 56) {
         while (i < 64) ctx->buffer[i++] = 0x00;
-        transform(ctx, ctx->buffer);
+        gBlocks(ctx->state, ctx->buffer, 1);
         i = 0;
     }
     while (i < 56) ctx->buffer[i++] = 0x00;
 
-    ctx->bitcount += 0; // bitcount already updated
     uint64_t bits = ctx->bitcount;
     ctx->buffer[56] = bits >> 56;
     ctx->buffer[57] = bits >> 48;
@@ -102,16 +378,107 @@ void sha256_final(SHA256_CTX *ctx, uint8_t digest[SHA256_DIGEST_LENGTH])
     ctx->buffer[61] = bits >> 16;
     ctx->buffer[62] = bits >> 8;
     ctx->buffer[63] = bits;
-    transform(ctx, ctx->buffer);
-
-    for (i=0;i<4;i++) {
-        digest[i]      = (ctx->state[0] >> (24 - i * 8)) & 0xff;
-        digest[i + 4]  = (ctx->state[1] >> (24 - i * 8)) & 0xff;
-        digest[i + 8]  = (ctx->state[2] >> (24 - i * 8)) & 0xff;
-        digest[i + 12] = (ctx->state[3] >> (24 - i * 8)) & 0xff;
-        digest[i + 16] = (ctx->state[4] >> (24 - i * 8)) & 0xff;
-        digest[i + 20] = (ctx->state[5] >> (24 - i * 8)) & 0xff;
-        digest[i + 24] = (ctx->state[6] >> (24 - i * 8)) & 0xff;
-        digest[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0xff;
+    gBlocks(ctx->state, ctx->buffer, 1);
+    store_digest(ctx->state, digest);
+}
+
+// Each lane reads whole blocks straight from its message, then one or two
+// padded tail blocks from its own buffer.
+typedef struct {
+    const uint8_t *data;
+    size_t full;            // whole blocks in data
+    size_t blocks;          // full plus the tail blocks
+    uint8_t tail[128];
+} mb_lane;
+
+static const uint8_t mb_idle[64];   // read by lanes with nothing left to hash
+
+static void mb_prepare(mb_lane *l, const uint8_t *data, size_t len)
+{
+    size_t rem = len & 0x3F, end, i;
+    uint64_t bits = (uint64_t)len << 3;
+
+    l->data = data;
+    l->full = len >> 6;
+    l->blocks = l->full + (rem < 56 ? 1 : 2);
+    end = (l->blocks - l->full) << 6;
+    memset(l->tail, 0, sizeof(l->tail));
+    if (rem)
+        memcpy(l->tail, data + (l->full << 6), rem);
+    l->tail[rem] = 0x80;
+    for (i=0; i<8; ++i)
+        l->tail[end - 1 - i] = (uint8_t)(bits >> (i * 8));
+}
+
+static void mb_group(size_t n, const uint8_t *const data[], const size_t len[],
+                     uint8_t digest[][SHA256_DIGEST_LENGTH])
+{
+    mb_lane lane[SHA256_MB_LANES];
+    uint32_t st[8][SHA256_MB_LANES] __attribute__((aligned(32)));
+    const uint8_t *p[SHA256_MB_LANES];
+    uint32_t s[8], active;
+    size_t b, l, i, live, last = 0;
+
+    for (l=0; l<n; ++l) {
+        mb_prepare(&lane[l], data[l], len[l]);
+        for (i=0; i<8; ++i)
+            st[i][l] = iv[i];
+    }
+    for (b=0; ; ++b) {
+        active = 0;
+        live = 0;
+        for (l=0; l<SHA256_MB_LANES; ++l) {
+            p[l] = mb_idle;
+            if (l >= n || b >= lane[l].blocks) continue;
+            p[l] = b < lane[l].full ? lane[l].data + (b << 6) : lane[l].tail + ((b - lane[l].full) << 6);
+            active |= 1u << l;
+            last = l;
+            live++;
+        }
+        if (live == 0) break;
+        if (live > 1) {
+            mb_block_avx2(st, p, active);
+            continue;
+        }
+        // One long message left: a single stream beats seven idle lanes.
+        mb_lane *r = &lane[last];
+        for (i=0; i<8; ++i)
+            s[i] = st[i][last];
+        if (b < r->full) {
+            gBlocks(s, r->data + (b << 6), r->full - b);
+            b = r->full;
+        }
+        gBlocks(s, r->tail + ((b - r->full) << 6), r->blocks - b);
+        for (i=0; i<8; ++i)
+            st[i][last] = s[i];
+        break;
+    }
+    for (l=0; l<n; ++l) {
+        for (i=0; i<8; ++i)
+            s[i] = st[i][l];
+        store_digest(s, digest[l]);
+    }
+}
+
+void sha256_mb(size_t count, const uint8_t *const data[], const size_t len[],
+               uint8_t digest[][SHA256_DIGEST_LENGTH])
+{
+    SHA256_CTX ctx;
+    size_t n;
+
+    if (gBlocks == NULL) select_impl();
+    while (count) {
+        n = count < SHA256_MB_LANES ? count : SHA256_MB_LANES;
+        if (gImpl == SHA256_IMPL_AVX2 && n > 1) {
+            mb_group(n, data, len, digest);
+        } else {
+            // SHA-NI outruns eight AVX2 lanes per stream; scalar is the reference.
+            for (size_t l=0; l<n; ++l) {
+                sha256_init(&ctx);
+                sha256_update(&ctx, data[l], len[l]);
+                sha256_final(&ctx, digest[l]);
+            }
+        }
+        data += n; len += n; digest += n; count -= n;
     }
 }
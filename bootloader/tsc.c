@@ -0,0 +1,115 @@
+// tsc.c - TSC frequency calibration shared by the loader and the kernel minds
+
+#include <Uefi.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/BaseLib.h>
+#include <cpuid.h>
+#include "tsc.h"
+
+static TSC_INFO gTsc = { TSC_DEFAULT_HZ, TSC_SOURCE_DEFAULT, FALSE };
+static UINT64 gNsPerTick;      // 32.32 fixed point, 0 until SetHz
+
+// Tsc_ToNs runs for every phase the registry times; a multiply by the
+// precomputed ratio replaces its three 64-bit divisions.
+static VOID SetHz(UINT64 Hz) {
+    gTsc.Hz = Hz;
+    gNsPerTick = (1000000000ULL << 32) / Hz;     // fits: 10^9 < 2^32
+}
+
+static UINT64 FromCpuid15(UINT32 MaxLeaf) {
+    UINT32 Den, Num, Crystal, d;
+    if (MaxLeaf < 0x15) return 0;
+    __cpuid(0x15, Den, Num, Crystal, d);
+    if (Den == 0 || Num == 0 || Crystal == 0) return 0;
+    return (UINT64)Crystal * Num / Den;
+}
+
+static UINT64 FromHypervisor(VOID) {
+    UINT32 a, b, c, d;
+    __cpuid(1, a, b, c, d);
+    if (!((c >> 31) & 1)) return 0;
+    __cpuid(0x40000000, a, b, c, d);
+    if (a < 0x40000010) return 0;
+    __cpuid(0x40000010, a, b, c, d);
+    return (UINT64)a * 1000;    // kHz
+}
+
+static UINT64 FromCpuid16(UINT32 MaxLeaf) {
+    UINT32 a, b, c, d;
+    if (MaxLeaf < 0x16) return 0;
+    __cpuid(0x16, a, b, c, d);
+    return (UINT64)(a & 0xFFFF) * 1000000;
+}
+
+// An interrupt or a late timer tick can only lengthen a window, never
+// shorten it, so the shortest of several is the closest to the true rate.
+static UINT64 FromStall(VOID) {
+    UINT64 Best = ~0ULL;
+    if (gBS == NULL) return 0;
+    for (UINTN i = 0; i < TSC_STALL_WINDOWS; ++i) {
+        UINT64 Start = AsmReadTsc();
+        gBS->Stall(TSC_STALL_US);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < Best) Best = Ticks;
+    }
+    return Best * (1000000 / TSC_STALL_US);
+}
+
+// Exact sources first. A Stall measurement beats leaf 0x16: that leaf is
+// the nominal base frequency off the spec sheet, which the TSC can miss by
+// a percent or more, while TSC_STALL_WINDOWS windows of a busy-waiting
+// Stall land within a fraction of a percent. Leaf 0x16 is left for when there are no
+// boot services to stall with.
+static const TSC_SOURCE gTscPreference[] = {
+    TSC_SOURCE_CPUID_15, TSC_SOURCE_HYPERVISOR, TSC_SOURCE_STALL, TSC_SOURCE_CPUID_16
+};
+
+UINT64 Tsc_FromSource(TSC_SOURCE Source) {
+    UINT32 MaxLeaf = __get_cpuid_max(0, NULL);
+    switch (Source) {
+    case TSC_SOURCE_CPUID_15:   return FromCpuid15(MaxLeaf);
+    case TSC_SOURCE_HYPERVISOR: return FromHypervisor();
+    case TSC_SOURCE_CPUID_16:   return FromCpuid16(MaxLeaf);
+    case TSC_SOURCE_STALL:      return FromStall();
+    default:                    return 0;
+    }
+}
+
+const TSC_INFO *Tsc_Calibrate(VOID) {
+    UINT32 a, b, c, d;
+    UINT64 Hz = 0;
+
+    if (gTsc.Source != TSC_SOURCE_DEFAULT) return &gTsc;
+    if (__get_cpuid_max(0x80000000, NULL) >= 0x80000007) {
+        __cpuid(0x80000007, a, b, c, d);
+        gTsc.Invariant = (d >> 8) & 1;
+    }
+
+    for (UINTN i = 0; i < sizeof(gTscPreference) / sizeof(gTscPreference[0]) && Hz == 0; ++i) {
+        if ((Hz = Tsc_FromSource(gTscPreference[i])) != 0) gTsc.Source = gTscPreference[i];
+    }
+    if (Hz != 0) SetHz(Hz);
+    return &gTsc;
+}
+
+const TSC_INFO *Tsc_Info(VOID) {
+    return &gTsc;
+}
+
+VOID Tsc_Adopt(UINT64 Hz, TSC_SOURCE Source, BOOLEAN Invariant) {
+    if (Hz == 0 || Source == TSC_SOURCE_DEFAULT) return;
+    SetHz(Hz);
+    gTsc.Source = Source;
+    gTsc.Invariant = Invariant;
+}
+
+// The 128-bit product cannot overflow. Rounding the ratio down costs under
+// one part in 10^9 for TSCs up to 4 GHz.
+UINT64 Tsc_ToNs(UINT64 Ticks) {
+    if (gNsPerTick == 0) SetHz(gTsc.Hz);
+    return (UINT64)(((unsigned __int128)Ticks * gNsPerTick) >> 32);
+}
+
+UINT64 Tsc_FromNs(UINT64 Ns) {
+    return (Ns / 1000000000ULL) * gTsc.Hz + (Ns % 1000000000ULL) * gTsc.Hz / 1000000000ULL;
+}
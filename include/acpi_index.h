@@ -0,0 +1,80 @@
+#ifndef ACPI_INDEX_H
+#define ACPI_INDEX_H
+
+#include <Uefi.h>
+
+#pragma pack(1)
+typedef struct {
+    CHAR8   Signature[8];
+    UINT8   Checksum;
+    CHAR8   OemId[6];
+    UINT8   Revision;
+    UINT32  RsdtAddress;
+    UINT32  Length;
+    UINT64  XsdtAddress;
+    UINT8   ExtendedChecksum;
+    UINT8   Reserved[3];
+} ACPI_RSDP;
+
+typedef struct {
+    UINT32  Signature;
+    UINT32  Length;
+    UINT8   Revision;
+    UINT8   Checksum;
+    CHAR8   OemId[6];
+    CHAR8   OemTableId[8];
+    UINT32  OemRevision;
+    UINT32  CreatorId;
+    UINT32  CreatorRevision;
+} ACPI_SDT_HEADER;
+
+typedef struct {
+    ACPI_SDT_HEADER  Header;
+    UINT32           FirmwareCtrl;
+    UINT32           Dsdt;
+    UINT8            Reserved0[96];
+    UINT64           XDsdt;             // offset 140, ACPI 2.0+
+} ACPI_FADT;
+#pragma pack()
+
+#ifndef SIGNATURE_32
+#define SIGNATURE_32(A, B, C, D) \
+  ((UINT32)(A) | ((UINT32)(B) << 8) | ((UINT32)(C) << 16) | ((UINT32)(D) << 24))
+#endif
+
+// Every table reachable from the XSDT/RSDT (plus the DSDT through the
+// FADT), checksummed once and hashed by signature. Tables that share a
+// signature, like SSDTs, are chained in firmware order. Built by the loader
+// in LoaderData pages and handed over as LOADER_PARAMS.AcpiTables.
+
+#define ACPI_INDEX_MAX_TABLES   128
+#define ACPI_INDEX_SLOTS        256     // power of two, at most half full
+#define ACPI_INDEX_NONE         0xFFFF
+
+typedef struct {
+    UINT64 Address;
+    UINT32 Signature;
+    UINT32 Length;
+    UINT16 Next;                // next table with this signature
+    UINT8  ChecksumOk;
+    UINT8  Reserved[5];
+} ACPI_TABLE_ENTRY;
+
+typedef struct {
+    UINT32           Count;
+    UINT32           BadChecksums;
+    UINT64           ChecksumBytes;
+    ACPI_TABLE_ENTRY Table[ACPI_INDEX_MAX_TABLES];
+    UINT16           Slot[ACPI_INDEX_SLOTS];        // first entry per signature
+} ACPI_INDEX;
+
+// Root is the XSDT or RSDT; the entry width follows its signature.
+EFI_STATUS AcpiIndex_Build(ACPI_INDEX *Index, const ACPI_SDT_HEADER *Root);
+
+const ACPI_TABLE_ENTRY *AcpiIndex_Find(const ACPI_INDEX *Index, UINT32 Signature);
+const ACPI_TABLE_ENTRY *AcpiIndex_Next(const ACPI_INDEX *Index, const ACPI_TABLE_ENTRY *Entry);
+
+// Byte sum of Data; zero for a valid table.
+UINT8 AcpiIndex_Checksum(const VOID *Data, UINTN Length);
+
+#endif // ACPI_INDEX_H
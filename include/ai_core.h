@@ -4,6 +4,10 @@
 #include <Uefi.h>
 #include "kernel_shared.h"
 
+// Self-model weights, tuned by the AI core phases and hashed by ai_core_mind.c.
+#define AI_SELF_MODEL_WORDS 8
+extern UINT64 gSelfModel[AI_SELF_MODEL_WORDS];
+
 EFI_STATUS AICore_ReportEvent(const CHAR8 *name);
 EFI_STATUS AICore_ReportPhase(const CHAR8 *name, UINTN value);
 EFI_STATUS AICore_RecordPhase(const CHAR8 *name, UINTN phase, UINTN value);
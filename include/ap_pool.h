@@ -0,0 +1,38 @@
+#ifndef AP_POOL_H
+#define AP_POOL_H
+
+#include <Uefi.h>
+
+// Application processors owned by the kernel. EFI_MP_SERVICES_PROTOCOL goes
+// away with boot services, and the firmware parks every AP in its own loop
+// at ExitBootServices, so the kernel starts them again with INIT-SIPI-SIPI.
+// They come up through a real-mode trampoline in pages the loader reserved
+// below 1 MiB (LOADER_PARAMS.ApTrampoline), switch to the BSP's paging,
+// descriptor tables and control registers, and then wait on a mailbox each.
+
+#define AP_POOL_MAX             63
+#define AP_POOL_STACK_SIZE      (16 * 1024)
+
+typedef VOID (EFIAPI *AP_PROCEDURE)(VOID *Arg);
+
+// Wakes every AP and keeps up to AP_POOL_MAX of them. Trampoline is
+// LOADER_PARAMS.ApTrampoline. ExpectedAps ends the wait early once that
+// many have checked in; 0 waits out the timeout.
+// Fails with EFI_UNSUPPORTED when there is no usable trampoline or the BSP
+// runs 5-level paging, and the pool stays empty.
+EFI_STATUS ApPool_Start(EFI_PHYSICAL_ADDRESS Trampoline, UINTN ExpectedAps);
+UINTN ApPool_Count(VOID);
+
+// Hands Proc(Arg) to AP Index. EFI_NOT_READY while it is still busy.
+EFI_STATUS ApPool_Run(UINTN Index, AP_PROCEDURE Proc, VOID *Arg);
+BOOLEAN ApPool_Busy(UINTN Index);
+
+// Local APIC ID of AP Index, or of the BSP for an index past ApPool_Count.
+UINT32 ApPool_ApicId(UINTN Index);
+UINT32 ApPool_BspApicId(VOID);
+
+// Pool index of the calling CPU, AP_POOL_MAX on the BSP. Cheap enough for
+// per-CPU slots on hot paths: it only looks at which AP stack it runs on.
+UINTN ApPool_CpuIndex(VOID);
+
+#endif // AP_POOL_H
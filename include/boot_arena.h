@@ -0,0 +1,57 @@
+#ifndef BOOT_ARENA_H
+#define BOOT_ARENA_H
+
+#include <Uefi.h>
+
+// Boot arena. Temporary loader buffers are bump-allocated out of a few large
+// BootServicesData page runs instead of one firmware call each; nothing is
+// freed individually except the most recent allocation, the rest goes back in
+// one teardown. Typed pages the kernel inherits (LoaderData, RuntimeServices
+// data) still come straight from firmware and are only tracked so a failed
+// boot can return them.
+
+#define BOOT_ARENA_CHUNK_PAGES  1024    // 4 MiB; bigger requests get a run of their own
+#define BOOT_ARENA_MAX_CHUNKS   16
+#define BOOT_ARENA_MAX_HANDOFF  16
+
+typedef struct {
+    UINT8 *Base;
+    UINTN  Size;
+    UINTN  Used;
+} BOOT_ARENA_CHUNK;
+
+typedef struct {
+    BOOT_ARENA_CHUNK     Chunk[BOOT_ARENA_MAX_CHUNKS];
+    UINTN                ChunkCount;
+    UINTN                Current;           // chunks above this one are empty
+    VOID                *Last;              // most recent allocation, can be popped
+    UINTN                LastUsed;          // Chunk[Current].Used before it
+    EFI_PHYSICAL_ADDRESS Handoff[BOOT_ARENA_MAX_HANDOFF];
+    UINTN                HandoffPages[BOOT_ARENA_MAX_HANDOFF];
+    UINTN                HandoffCount;
+    UINTN                Allocs;
+    UINTN                HighWater;         // bytes
+    UINTN                FirmwareCalls;
+} BOOT_ARENA;
+
+// Maps another chunk of at least MinSize bytes.
+EFI_STATUS BootArena_Grow(BOOT_ARENA *A, UINTN MinSize);
+
+// Align must be a power of two no larger than a page. NULL once the chunk
+// table is full or firmware is out of pages.
+VOID *BootArena_Alloc(BOOT_ARENA *A, UINTN Size, UINTN Align);
+
+// Hands Ptr back if it is the latest allocation; anything else waits for
+// the teardown.
+VOID BootArena_Pop(BOOT_ARENA *A, VOID *Ptr);
+
+// Typed or placed pages straight from firmware, recorded for the teardown.
+EFI_STATUS BootArena_AllocHandoff(BOOT_ARENA *A, EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType,
+                                  UINTN Pages, EFI_PHYSICAL_ADDRESS *Memory);
+
+// Returns every chunk, and the handoff pages unless KeepHandoff leaves them
+// to the kernel. Without FirmwareUp (after ExitBootServices) nothing is
+// called; the OS reclaims BootServicesData itself.
+VOID BootArena_Teardown(BOOT_ARENA *A, BOOLEAN FirmwareUp, BOOLEAN KeepHandoff);
+
+#endif // BOOT_ARENA_H
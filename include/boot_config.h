@@ -0,0 +1,60 @@
+#ifndef BOOT_CONFIG_H
+#define BOOT_CONFIG_H
+
+#include <Uefi.h>
+#include "sha256.h"
+
+// config.ini and config.bin, the parsed copy cached next to it. The loader
+// does the file I/O; the parser and the cache checks here only see buffers.
+//
+// config.ini is one key=value per line, LF or CRLF. Blank lines, lines
+// starting with '#' or ';', [section] headers and unknown keys are
+// ignored; spaces and tabs around keys and values are trimmed. A value
+// that does not fit its setting (a path of 260 characters or more, a
+// number above 255, anything but digits for a number) leaves the
+// setting at its previous value.
+
+#define BOOT_CONFIG_PATH_MAX       260
+#define BOOT_CONFIG_CACHE_MAGIC    SIGNATURE_32('A','C','F','G')
+#define BOOT_CONFIG_CACHE_VERSION  3       // 3: trimmed keys and values, strict numbers
+
+typedef struct {
+    BOOLEAN FallbackEnabled;
+    UINT8 BootDelay;
+    BOOLEAN EntropyRequired;
+    BOOLEAN QuietBoot;
+    UINT8 ProfileRegressPct;        // 0 selects the built-in default
+} BOOT_CONFIG;
+
+// Everything config.ini can set.
+typedef struct {
+    BOOT_CONFIG Config;
+    UINT8       TrustThreshold;
+    CHAR16      KernelPath[BOOT_CONFIG_PATH_MAX];
+    CHAR16      SignaturePath[BOOT_CONFIG_PATH_MAX];
+} BOOT_CONFIG_SETTINGS;
+
+// config.bin, keyed by the INI's size and modification time and sealed
+// with a SHA-256 over the image.
+typedef struct {
+    UINT32               Magic;
+    UINT32               Version;
+    UINT64               IniSize;
+    EFI_TIME             IniTime;
+    UINT8                IniHash[SHA256_DIGEST_LENGTH];
+    BOOT_CONFIG_SETTINGS Settings;
+    UINT8                Digest[SHA256_DIGEST_LENGTH];  // over every field above
+} BOOT_CONFIG_CACHE;
+
+// Applies config.ini to Settings. Buf must be NUL-terminated and is
+// modified in place; parsing stops at the first NUL.
+VOID BootConfig_Parse(BOOT_CONFIG_SETTINGS *Settings, CHAR8 *Buf);
+
+VOID BootConfig_CacheSeal(BOOT_CONFIG_CACHE *Cache, const BOOT_CONFIG_SETTINGS *Settings,
+                          UINT64 IniSize, const EFI_TIME *IniTime, const UINT8 *IniHash);
+
+// TRUE if the Size bytes read from config.bin are a sealed cache of the
+// INI with this size and time. An INI without a timestamp never matches.
+BOOLEAN BootConfig_CacheValid(const BOOT_CONFIG_CACHE *Cache, UINTN Size, UINT64 IniSize, const EFI_TIME *IniTime);
+
+#endif // BOOT_CONFIG_H
@@ -0,0 +1,51 @@
+#ifndef BOOT_GFX_H
+#define BOOT_GFX_H
+
+#include <Uefi.h>
+#include <Protocol/GraphicsOutput.h>
+
+// Off-screen rendering for the boot UI. Phases draw into a back buffer in
+// EFI_GRAPHICS_OUTPUT_BLT_PIXEL layout, which is also the native layout of
+// a PixelBlueGreenRedReserved8BitPerColor framebuffer such as OVMF's VGA
+// GOP. Drawing only grows a short list of dirty rectangles. Present then
+// sends each one with a single EfiBltBufferToVideo. After ExitBootServices
+// it copies the rectangles straight into the framebuffer instead.
+
+#define BOOT_GFX_MAX_DIRTY      4
+
+typedef struct {
+    UINT32 X0, Y0, X1, Y1;      // X1/Y1 exclusive
+} BOOT_GFX_RECT;
+
+typedef struct {
+    EFI_GRAPHICS_OUTPUT_PROTOCOL *Gop;
+    UINT32        *Pixels;      // Width * Height back buffer
+    UINT32         Width;
+    UINT32         Height;
+    UINT32         DirtyCount;
+    BOOT_GFX_RECT  Dirty[BOOT_GFX_MAX_DIRTY];
+    UINT32         Frames;
+    UINT32         BltCalls;
+    UINT64         PixelsPresented;
+    UINT64         PresentTsc;
+} BOOT_GFX;
+
+// Bytes of back buffer BootGfx_Init needs for the current mode.
+UINTN BootGfx_BufferSize(EFI_GRAPHICS_OUTPUT_PROTOCOL *Gop);
+
+// Buffer must hold BootGfx_BufferSize(Gop) bytes. The glyph atlas is built
+// on the first call.
+VOID BootGfx_Init(BOOT_GFX *G, EFI_GRAPHICS_OUTPUT_PROTOCOL *Gop, VOID *Buffer);
+
+// All drawing is clipped to the screen.
+VOID BootGfx_FillRect(BOOT_GFX *G, UINT32 X, UINT32 Y, UINT32 W, UINT32 H, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color);
+VOID BootGfx_DrawLine(BOOT_GFX *G, UINT32 X0, UINT32 Y0, UINT32 X1, UINT32 Y1, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color);
+VOID BootGfx_DrawText(BOOT_GFX *G, UINT32 X, UINT32 Y, CONST CHAR16 *Text, EFI_GRAPHICS_OUTPUT_BLT_PIXEL Color);
+
+// Sends the dirty rectangles to the screen and clears the list. Pass
+// UseBlt = FALSE once boot services are gone; PixelBltOnly and
+// PixelBitMask modes then have nothing to write to and return
+// EFI_UNSUPPORTED.
+EFI_STATUS BootGfx_Present(BOOT_GFX *G, BOOLEAN UseBlt);
+
+#endif // BOOT_GFX_H
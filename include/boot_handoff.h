@@ -0,0 +1,115 @@
+#ifndef BOOT_HANDOFF_H
+#define BOOT_HANDOFF_H
+
+#include <Uefi.h>
+
+// Loader -> kernel handoff block: a header and typed, length-prefixed
+// sections in one page-aligned LoaderData allocation. The kernel reads it
+// where the loader left it.
+//
+// Compatibility rules, for loaders and kernels of any version:
+// - Magic never changes. Version is the header layout, and a newer one may
+//   only append fields, so sections start at HeaderSize rather than
+//   sizeof(BOOT_HANDOFF).
+// - Section types are never reused; readers skip types they do not know.
+// - A payload only grows. It always starts with the fields of version 1,
+//   and readers check Length (BOOT_HANDOFF_HAS) before using later ones.
+// - Arrays give their own entry size and offset so entries can grow too.
+
+#define BOOT_HANDOFF_MAGIC      SIGNATURE_64('A','i','O','S','H','O','F','F')
+#define BOOT_HANDOFF_VERSION    1
+#define BOOT_HANDOFF_ALIGN      8
+
+typedef struct {
+    UINT64 Magic;
+    UINT16 Version;
+    UINT16 HeaderSize;
+    UINT32 SectionCount;
+    UINT32 Size;            // header plus sections written so far
+    UINT32 Capacity;        // bytes allocated
+} BOOT_HANDOFF;
+
+typedef struct {
+    UINT16 Type;
+    UINT16 Version;
+    UINT32 Length;          // payload bytes following this header
+} BOOT_HANDOFF_SECTION;
+
+typedef enum {
+    HANDOFF_TYPE_PHASE_TIMINGS = 1,
+    HANDOFF_TYPE_TSC,
+    HANDOFF_TYPE_ACPI_INDEX,    // payload is the ACPI_INDEX built in Phase108
+    HANDOFF_TYPE_PCRS,
+    HANDOFF_TYPE_CPU_TOPOLOGY
+} BOOT_HANDOFF_TYPE;
+
+typedef struct {
+    UINT32 Count;
+    UINT16 EntrySize;
+    UINT16 EntryOffset;     // from the start of the payload
+} HANDOFF_ARRAY;
+
+#define HANDOFF_PHASE_F_MISSED  0x1     // over its deadline
+#define HANDOFF_PHASE_F_AP      0x2     // ran on an AP; the loader runs every phase on the BSP
+
+typedef struct {
+    UINT16 PhaseId;
+    UINT8  Flags;
+    UINT8  Reserved[5];
+    UINT64 ElapsedNs;
+    UINT64 DeadlineNs;
+} HANDOFF_PHASE_TIMING;
+
+typedef struct {
+    HANDOFF_ARRAY Phases;   // HANDOFF_PHASE_TIMING, in table order
+    UINT64 LoaderNs;        // first phase to the handoff
+} HANDOFF_PHASE_TIMINGS;
+
+typedef struct {
+    UINT64 Hz;
+    UINT32 Source;          // TSC_SOURCE
+    UINT32 Invariant;
+} HANDOFF_TSC_INFO;
+
+#define HANDOFF_PCR_COUNT       8
+#define HANDOFF_PCR_SHA256      0x000B  // TPM_ALG_SHA256
+
+typedef struct {
+    UINT32 Valid;           // bit n: Digest[n] holds PCR n
+    UINT16 HashAlg;
+    UINT16 DigestSize;
+    UINT8  Digest[HANDOFF_PCR_COUNT][32];
+} HANDOFF_PCR_BANK;
+
+typedef struct {
+    UINT64 ProcessorId;     // APIC id
+    UINT32 Package;
+    UINT32 Core;
+    UINT32 Thread;
+    UINT32 StatusFlag;      // EFI_PROCESSOR_INFORMATION.StatusFlag
+} HANDOFF_CPU;
+
+typedef struct {
+    HANDOFF_ARRAY Cpus;     // HANDOFF_CPU, by MP services processor number
+    UINT32 BspIndex;
+    UINT32 Reserved;
+} HANDOFF_CPU_TOPOLOGY;
+
+#define BOOT_HANDOFF_PAYLOAD(Section)   ((CONST VOID *)((CONST BOOT_HANDOFF_SECTION *)(Section) + 1))
+#define BOOT_HANDOFF_HAS(Section, Struct, Field) \
+    ((Section)->Length >= OFFSET_OF(Struct, Field) + sizeof(((Struct *)0)->Field))
+
+// Loader side. Add returns a zeroed payload, or NULL once Capacity is used up.
+VOID BootHandoff_Init(BOOT_HANDOFF *H, UINT32 Capacity);
+VOID *BootHandoff_Add(BOOT_HANDOFF *H, UINT16 Type, UINT16 Version, UINT32 Length);
+
+// Kernel side. Every section returned lies within H->Size.
+BOOLEAN BootHandoff_Valid(CONST BOOT_HANDOFF *H);
+CONST BOOT_HANDOFF_SECTION *BootHandoff_Next(CONST BOOT_HANDOFF *H, CONST BOOT_HANDOFF_SECTION *Prev);
+CONST BOOT_HANDOFF_SECTION *BootHandoff_Find(CONST BOOT_HANDOFF *H, UINT16 Type);
+
+// Entry Index of the HANDOFF_ARRAY at the start of Section's payload, or
+// NULL if it is out of range, out of bounds or smaller than MinEntrySize.
+CONST VOID *BootHandoff_Entry(CONST BOOT_HANDOFF_SECTION *Section, UINT32 Index, UINTN MinEntrySize);
+
+#endif // BOOT_HANDOFF_H
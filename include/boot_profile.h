@@ -0,0 +1,61 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+// Boot profile ring, \EFI\AiOS\profile.bin. A BOOT_PROFILE_RING header is
+// followed by Slots records of RecordSize bytes each; Next is the slot the
+// next boot overwrites. The loader reads it before the kernel loads and
+// compares each boot against the median of the records. The host reader,
+// tools/bootprof.c, builds this header with BOOT_PROFILE_HOST.
+
+#ifdef BOOT_PROFILE_HOST
+#include <stdint.h>
+typedef uint8_t  UINT8;
+typedef uint16_t UINT16;
+typedef uint32_t UINT32;
+typedef uint64_t UINT64;
+#define BOOT_PROFILE_SIG(A,B,C,D)   ((UINT32)(A) | ((UINT32)(B) << 8) | ((UINT32)(C) << 16) | ((UINT32)(D) << 24))
+#else
+#include <Uefi.h>
+#define BOOT_PROFILE_SIG(A,B,C,D)   SIGNATURE_32(A,B,C,D)
+#endif
+
+#define BOOT_PROFILE_RING_MAGIC     BOOT_PROFILE_SIG('A','P','R','H')
+#define BOOT_PROFILE_MAGIC          BOOT_PROFILE_SIG('A','P','R','F')
+#define BOOT_PROFILE_VERSION        2       // PhaseTsc is per phase table index
+#define BOOT_PROFILE_PHASES         301
+#define BOOT_PROFILE_SLOTS          16
+
+#define BOOT_PROFILE_F_VERIFY_HIT   0x1     // RSA verify skipped by the verify cache
+#define BOOT_PROFILE_F_CHAIN_HIT    0x2     // chain walk skipped by the verify cache
+#define BOOT_PROFILE_F_LZ4          0x4     // kernel image was LZ4-framed
+#define BOOT_PROFILE_F_REGRESSED    0x8     // at least one phase over the threshold
+
+typedef struct {
+    UINT32 Magic;
+    UINT16 Version;
+    UINT16 PhaseCount;
+    UINT32 Slots;
+    UINT32 RecordSize;
+    UINT32 Next;
+    UINT32 Count;           // valid records, at most Slots
+    UINT32 Sequence;        // of the newest record
+    UINT32 Reserved;
+} BOOT_PROFILE_RING;
+
+typedef struct {
+    UINT32 Magic;
+    UINT32 Sequence;        // 1 for the first boot recorded
+    UINT64 TscHz;
+    UINT64 TotalTsc;        // first phase to the kernel jump
+    UINT64 KernelSize;      // loaded image bytes
+    UINT32 Flags;
+    UINT16 PhaseMisses;     // phases over their deadline
+    UINT16 PcrReads;        // TPM2_PCR_Read commands sent
+    UINT16 EspOpens;        // firmware Open calls
+    UINT16 EspOpenHits;
+    UINT16 EspInfos;        // firmware GetInfo calls
+    UINT16 EspInfoHits;
+    UINT32 PhaseTsc[BOOT_PROFILE_PHASES];   // by table index, saturating
+} BOOT_PROFILE;
+
+#endif // BOOT_PROFILE_H
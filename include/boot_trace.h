@@ -0,0 +1,53 @@
+#ifndef BOOT_TRACE_H
+#define BOOT_TRACE_H
+
+#include <Uefi.h>
+
+// Begin/end TSC for every boot phase and for the firmware calls the loader
+// wraps (file reads, Blt, TPM commands, hashing), kept in a caller-supplied
+// event array. Every phase runs on the BSP, so scopes simply nest. The
+// result is formatted as Chrome trace-event JSON (chrome://tracing,
+// Perfetto) or as folded stacks for flamegraph.pl.
+
+#define BOOT_TRACE_NONE         0xFFFFFFFF
+#define BOOT_TRACE_LINE_MAX     256     // formatted bytes per event, at most
+
+typedef struct {
+    UINT64        Begin;
+    UINT64        End;            // 0 while the scope is open
+    UINT64        ChildTsc;       // time spent in nested scopes
+    CONST CHAR16 *Name;
+    UINT32        Parent;         // enclosing event or BOOT_TRACE_NONE
+    UINT16        Tid;            // Chrome "tid"; always 0, the BSP
+    UINT16        Depth;
+} BOOT_TRACE_EVENT;
+
+typedef struct {
+    BOOT_TRACE_EVENT *Events;
+    UINT32   Capacity;
+    UINT32   Count;
+    UINT32   Dropped;
+    UINT32   Open;                // innermost open BSP scope
+    BOOLEAN  Calls;               // wrapped firmware calls are recorded
+    UINT64   ScopeCycles;         // measured cost of one Begin/End pair
+    UINT64   BudgetCycles;
+} BOOT_TRACE;
+
+// Measures what a Begin/End pair costs on this CPU. Over BudgetCycles only
+// phases are recorded from then on, so tracing never inflates the many
+// short firmware calls it would wrap.
+VOID BootTrace_Init(BOOT_TRACE *T, BOOT_TRACE_EVENT *Events, UINT32 Capacity, UINT64 BudgetCycles);
+
+// Phase scopes, always recorded while there is room.
+UINT32 BootTrace_Begin(BOOT_TRACE *T, CONST CHAR16 *Name);
+// Wrapped firmware calls; BOOT_TRACE_NONE when over budget or full.
+UINT32 BootTrace_BeginCall(BOOT_TRACE *T, CONST CHAR16 *Name);
+VOID BootTrace_End(BOOT_TRACE *T, UINT32 Id);
+
+// Both write at most Size bytes and return the length written; Count *
+// BOOT_TRACE_LINE_MAX plus a line is always enough. Scopes still open are
+// cut off at Now, and times count from Origin.
+UINTN BootTrace_FormatChrome(CONST BOOT_TRACE *T, CHAR8 *Buf, UINTN Size, UINT64 Origin, UINT64 Now);
+UINTN BootTrace_FormatFolded(CONST BOOT_TRACE *T, CHAR8 *Buf, UINTN Size, UINT64 Now);
+
+#endif // BOOT_TRACE_H
@@ -0,0 +1,19 @@
+#ifndef CPU_MIND_H
+#define CPU_MIND_H
+
+#include <Uefi.h>
+#include "kernel_shared.h"
+
+typedef struct {
+    UINT64 ElapsedTsc[CPU_PHASE_COUNT + 1];
+    UINT8  Missed[CPU_PHASE_COUNT + 1];
+    UINTN  MissCount;
+    UINT64 StartTsc;
+    UINT64 TotalTsc;
+} CPU_STATE;
+
+extern CPU_STATE gCpuState;
+
+EFI_STATUS CpuMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+
+#endif // CPU_MIND_H
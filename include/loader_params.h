@@ -0,0 +1,49 @@
+#ifndef LOADER_PARAMS_H
+#define LOADER_PARAMS_H
+
+#include <Uefi.h>
+#include <Protocol/GraphicsOutput.h>
+#include "memory_regions.h"
+#include "acpi_index.h"
+#include "boot_handoff.h"
+
+// What the loader passes to the kernel entry point: a single
+// LOADER_PARAMS_BLOCK pointer, in EfiRuntimeServicesData pages that survive
+// ExitBootServices. Checksum is the XOR of the bytes of Params, taken in
+// Phase173; nothing in Params changes after that.
+
+// LoaderData pages below 1 MiB for the kernel's AP startup trampoline: code
+// and data, then PML4, PDPT and PD for the step into long mode.
+#define AP_TRAMPOLINE_PAGES 4
+
+typedef struct {
+    EFI_MEMORY_DESCRIPTOR *MemoryMap;
+    UINTN MemoryMapSize;
+    UINTN MapKey;
+    UINTN DescriptorSize;
+    UINT32 DescriptorVersion;
+    MEMORY_REGION_INDEX *MemoryRegions;    // LoaderData pages, survive ExitBootServices
+    ACPI_INDEX *AcpiTables;                // LoaderData pages, survive ExitBootServices
+    BOOT_HANDOFF *Handoff;                 // LoaderData pages, filled in by Phase190
+    EFI_PHYSICAL_ADDRESS KernelBase;
+    EFI_PHYSICAL_ADDRESS KernelEntry;
+    EFI_GRAPHICS_OUTPUT_MODE_INFORMATION *GopModeInfo;
+    EFI_PHYSICAL_ADDRESS FrameBufferBase;
+    UINTN FrameBufferSize;
+    UINTN KernelSize;
+    UINT8 KernelHash[32];
+    BOOLEAN SignatureValid;
+    UINT32 BootTrustScore;
+    UINT8 BootUid[16];
+    UINT32 FallbackMode;
+    BOOLEAN FallbackUsed;
+    EFI_PHYSICAL_ADDRESS LoaderParamsPtr;
+    EFI_PHYSICAL_ADDRESS ApTrampoline;     // AP_TRAMPOLINE_PAGES below 1 MiB, 0 if none was free
+} LOADER_PARAMS;
+
+typedef struct {
+    LOADER_PARAMS Params;
+    UINT32 Checksum;
+} LOADER_PARAMS_BLOCK;
+
+#endif // LOADER_PARAMS_H
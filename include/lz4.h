@@ -0,0 +1,33 @@
+#ifndef LZ4_H
+#define LZ4_H
+
+#include <Uefi.h>
+
+// LZ4 frame decoding for compressed kernel images (`lz4 -BI --content-size`).
+// Only what the loader needs: independent blocks and a recorded content
+// size. Frame and block checksums are skipped, the kernel's SHA-256 and
+// signature already cover the decoded bytes.
+
+#define LZ4_FRAME_MAGIC         0x184D2204
+#define LZ4_FRAME_HEADER_MAX    19
+#define LZ4_BLOCK_UNCOMPRESSED  0x80000000u
+#define LZ4_DECODE_ERROR        ((UINTN)-1)
+
+typedef struct {
+    UINTN   HeaderSize;
+    UINTN   BlockMax;           // largest decoded block: 64 KiB .. 4 MiB
+    UINT64  ContentSize;
+    BOOLEAN BlockChecksum;      // 4 bytes follow each block
+    BOOLEAN ContentChecksum;    // 4 bytes follow the end mark
+} LZ4_FRAME;
+
+BOOLEAN Lz4_IsFrame(const VOID *Data, UINTN Size);
+
+// EFI_UNSUPPORTED for frames without a content size or with linked blocks.
+EFI_STATUS Lz4_ParseFrameHeader(const VOID *Data, UINTN Size, LZ4_FRAME *Frame);
+
+// Decodes one compressed block. Returns the decoded length, or
+// LZ4_DECODE_ERROR if the block is malformed or does not fit DstCap.
+UINTN Lz4_DecodeBlock(const UINT8 *Src, UINTN SrcLen, UINT8 *Dst, UINTN DstCap);
+
+#endif // LZ4_H
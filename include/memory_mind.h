@@ -0,0 +1,24 @@
+#ifndef MEMORY_MIND_H
+#define MEMORY_MIND_H
+
+#include <Uefi.h>
+#include "kernel_shared.h"
+
+typedef struct {
+    UINT64 EntropyScore;
+    UINT64 PhaseTsc[MEMORY_PHASE_COUNT + 1];
+    UINT8  PhaseMissed[MEMORY_PHASE_COUNT + 1];
+    UINTN  MissCount;
+} MEMORY_STATE;
+
+extern MEMORY_STATE gMemState;
+
+EFI_STATUS MemoryPhase_Execute(MEMORY_STATE *State, UINTN phase);
+
+// The two store strategies phase 105 chooses between. NonTemporal wants a
+// 16-byte aligned Dst and clears Bytes rounded down to 64.
+VOID MemZeroNonTemporal(VOID *Dst, UINT64 Bytes);
+VOID MemZeroErms(VOID *Dst, UINT64 Bytes);
+EFI_STATUS MemoryMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+
+#endif // MEMORY_MIND_H
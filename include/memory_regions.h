@@ -0,0 +1,40 @@
+#ifndef MEMORY_REGIONS_H
+#define MEMORY_REGIONS_H
+
+#include <Uefi.h>
+
+// The firmware memory map, sorted by address with neighbouring descriptors
+// of the same type and attributes merged. Built once by the loader and
+// handed to the kernel in LoaderData pages, so nothing after Phase031 has
+// to walk raw descriptors again.
+
+#define MEMORY_REGION_MAX       512
+#define MEMORY_REGION_TYPES     16      // EfiReservedMemoryType .. EfiUnacceptedMemoryType
+
+typedef struct {
+    UINT64 Base;
+    UINT64 Pages;
+    UINT64 Attribute;
+    UINT32 Type;
+    UINT32 Reserved;
+} MEMORY_REGION;
+
+typedef struct {
+    UINT32        Count;
+    UINT32        DescriptorCount;                  // raw descriptors folded in
+    UINT64        TotalPages;
+    UINT64        TypePages[MEMORY_REGION_TYPES];
+    UINT64        OtherPages;                       // OEM and OS-defined types
+    MEMORY_REGION Region[MEMORY_REGION_MAX];
+} MEMORY_REGION_INDEX;
+
+// Fails with EFI_BUFFER_TOO_SMALL if the map does not coalesce into
+// MEMORY_REGION_MAX regions.
+EFI_STATUS MemoryRegions_Build(MEMORY_REGION_INDEX *Index, const VOID *Map, UINTN MapSize, UINTN DescriptorSize);
+
+// Region containing Address, or NULL if it falls in a hole.
+const MEMORY_REGION *MemoryRegions_Find(const MEMORY_REGION_INDEX *Index, UINT64 Address);
+
+UINT64 MemoryRegions_TypePages(const MEMORY_REGION_INDEX *Index, UINT32 Type);
+
+#endif // MEMORY_REGIONS_H
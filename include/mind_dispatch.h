@@ -0,0 +1,60 @@
+#ifndef MIND_DISPATCH_H
+#define MIND_DISPATCH_H
+
+#include <Uefi.h>
+#include "kernel_shared.h"
+
+// KERNEL_CONTEXT field groups, one per section of kernel_shared.h.
+// Regions, Handoff and DescriptorCount are set before dispatch and only read;
+// mind_counters slots each belong to one mind. Neither needs a group.
+#define MIND_GRP_STATS        (1u << 0)   // total_phases, trust_score, timing arrays, EntropyScore, MissCount
+#define MIND_GRP_MEMORY       (1u << 1)   // MemoryMap .. zero_total_mbps
+#define MIND_GRP_SCHEDULER    (1u << 2)
+#define MIND_GRP_IO           (1u << 3)
+#define MIND_GRP_STORAGE      (1u << 4)
+#define MIND_GRP_TRUST        (1u << 5)
+#define MIND_GRP_AI           (1u << 6)
+#define MIND_GRP_THERMAL      (1u << 7)
+#define MIND_GRP_ENTROPY      (1u << 8)
+#define MIND_GRP_NETWORK      (1u << 9)
+#define MIND_GRP_POWER        (1u << 10)
+#define MIND_GRP_SELF         (1u << 11)
+
+// Module state that lives outside KERNEL_CONTEXT but is shared all the same.
+// Trust_* and the telemetry-only AICore_* calls are safe from any CPU.
+#define MIND_GRP_TELEMETRY    (1u << 16)  // telemetry ring control (reset, rate); logging is lock-free
+#define MIND_GRP_CONSOLE      (1u << 19)  // ConOut; writers run on the BSP
+
+#define MIND_F_BSP_ONLY       0x1
+
+#define MIND_DISPATCH_MAX     16
+
+typedef EFI_STATUS (*MIND_RUN_FN)(KERNEL_CONTEXT *ctx);
+
+typedef struct {
+    const CHAR8 *Name;
+    MIND_RUN_FN  Run;
+    UINT32       Reads;
+    UINT32       Writes;
+    UINT32       Flags;
+    const CHAR8 *FailEvent;     // telemetry event logged if Run fails
+} MIND_DESC;
+
+typedef struct {
+    UINT64      ReadyTsc;       // all predecessors finished
+    UINT64      StartTsc;
+    UINT64      EndTsc;
+    UINTN       Cpu;            // local APIC ID
+    EFI_STATUS  Status;
+} MIND_TIMING;
+
+// Runs Minds[] in an order consistent with their declared reads/writes: a
+// mind waits for every earlier mind whose writes overlap its reads or
+// writes, or whose reads overlap its writes. Independent minds run
+// concurrently on the APs ApPool_Start brought up; without any the table
+// order is used.
+EFI_STATUS MindDispatch_Run(KERNEL_CONTEXT *ctx, const MIND_DESC *Minds, UINTN Count);
+const MIND_TIMING *MindDispatch_GetTiming(UINTN Index);
+VOID MindDispatch_Report(VOID);
+
+#endif // MIND_DISPATCH_H
@@ -0,0 +1,79 @@
+#ifndef PHASE_REGISTRY_H
+#define PHASE_REGISTRY_H
+
+#include <Uefi.h>
+#include "kernel_shared.h"
+
+typedef enum {
+    PHASE_MIND_CPU = 1,
+    PHASE_MIND_MEMORY,
+    PHASE_MIND_GPU,
+    PHASE_MIND_SCHEDULER,
+    PHASE_MIND_IO,
+    PHASE_MIND_STORAGE,
+    PHASE_MIND_TRUST,
+    PHASE_MIND_AI_CORE,
+    PHASE_MIND_KERNEL
+} PHASE_MIND;
+
+typedef enum {
+    PHASE_COST_LIGHT = 0,   // bookkeeping, a few loads/stores
+    PHASE_COST_NORMAL,      // small loops over context tables
+    PHASE_COST_HEAVY        // hashing, large scans, firmware calls
+} PHASE_COST;
+
+#define PHASE_F_ENABLED         0x1
+
+#define PHASE_DEADLINE_DEFAULT  2500000     // ns
+
+typedef EFI_STATUS (*PHASE_FN)(KERNEL_CONTEXT *ctx);
+
+typedef struct {
+    UINT16   Id;
+    UINT8    Mind;
+    UINT8    Cost;
+    UINT8    Flags;
+    UINT32   DeadlineNs;
+    PHASE_FN Fn;            // NULL for reserved ids that only count as run
+    UINT64   LastNs;
+} PHASE_ENTRY;
+
+#define PHASE(id, mind, fn, deadline, cost) \
+    { (id), (mind), (cost), PHASE_F_ENABLED, (deadline), (fn), 0 }
+#define PHASE_RESERVED(id, mind) \
+    { (id), (mind), PHASE_COST_LIGHT, PHASE_F_ENABLED, PHASE_DEADLINE_DEFAULT, NULL, 0 }
+
+// Per-run options and results.
+typedef struct {
+    const CHAR8 *ErrorEvent;    // telemetry event on failure, NULL for none
+    BOOLEAN      CountPhases;   // ctx->total_phases++ after each success
+    UINT32       Ran;
+    UINT32       Skipped;
+    UINT32       Missed;
+    UINT64       TotalNs;
+} PHASE_RUN;
+
+typedef struct {
+    PHASE_MIND   Mind;
+    PHASE_ENTRY *Table;
+    const UINTN *Count;
+} PHASE_TABLE;
+
+// Tables are defined next to their phases; the registry lists them all so
+// phases can be looked up and toggled by id from anywhere.
+extern PHASE_ENTRY gCpuPhases[];
+extern const UINTN gCpuPhaseCount;
+extern PHASE_ENTRY gSchedulerPhases[];
+extern const UINTN gSchedulerPhaseCount;
+extern PHASE_ENTRY gTrustPhases[];
+extern const UINTN gTrustPhaseCount;
+extern PHASE_ENTRY gAICorePhases[];
+extern const UINTN gAICorePhaseCount;
+extern PHASE_ENTRY gKernelMindPhases[];
+extern const UINTN gKernelMindPhaseCount;
+
+EFI_STATUS PhaseRegistry_Run(PHASE_ENTRY *Table, UINTN Count, KERNEL_CONTEXT *ctx, PHASE_RUN *Run);
+PHASE_ENTRY *PhaseRegistry_Find(PHASE_MIND Mind, UINTN Id);
+EFI_STATUS PhaseRegistry_SetEnabled(PHASE_MIND Mind, UINTN Id, BOOLEAN Enabled);
+
+#endif // PHASE_REGISTRY_H
@@ -12,8 +12,28 @@ typedef struct {
     uint8_t buffer[64];
 } SHA256_CTX;
 
+// Block function backends, picked from CPUID on first use.
+typedef enum {
+    SHA256_IMPL_SCALAR = 0,
+    SHA256_IMPL_AVX2,
+    SHA256_IMPL_SHANI,
+    SHA256_IMPL_COUNT
+} sha256_impl_t;
+
+sha256_impl_t sha256_get_impl(void);
+int sha256_set_impl(sha256_impl_t impl);     // 0 on success, -1 if the CPU lacks it
+int sha256_impl_supported(sha256_impl_t impl);
+
 void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const uint8_t *data, size_t len);
 void sha256_final(SHA256_CTX *ctx, uint8_t digest[SHA256_DIGEST_LENGTH]);
 
+// One-shot digests of count independent messages. With the AVX2 backend
+// up to SHA256_MB_LANES of them are hashed side by side, one per 32-bit
+// lane, so short messages finish together; otherwise each goes through the
+// selected single-stream backend. The digests are the same either way.
+#define SHA256_MB_LANES 8
+void sha256_mb(size_t count, const uint8_t *const data[], const size_t len[],
+               uint8_t digest[][SHA256_DIGEST_LENGTH]);
+
 #endif // SHA256_H
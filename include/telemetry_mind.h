@@ -4,7 +4,25 @@
 #include <Uefi.h>
 #include "kernel_shared.h"
 
+// One logged event. Name is the event id: every event name is a string
+// literal, so the pointer identifies it. Phase is the id the logging CPU
+// last passed to Telemetry_SetPhase, 0 outside any phase.
+typedef struct {
+    const CHAR8      *Name;
+    UINT64           A;
+    UINT64           B;
+    UINT64           Tsc;
+    UINT32           Phase;
+    volatile UINT32  Seq;       // reservation number + 1 once the record is complete
+} TELEMETRY_RECORD;
+
+typedef VOID (*TELEMETRY_SINK)(const TELEMETRY_RECORD *Record, VOID *Context);
+
 void Telemetry_LogEvent(const CHAR8 *name, UINTN a, UINTN b);
+void Telemetry_SetPhase(UINT32 Phase);  // phase the calling CPU is running
+UINTN Telemetry_Drain(void);        // BSP only: prints and releases logged events
+UINTN Telemetry_DrainTo(TELEMETRY_SINK Sink, VOID *Context);   // BSP only: same, into Sink
+UINT32 Telemetry_GetDropped(void);
 UINTN Telemetry_GetTemperature(void);
 
 EFI_STATUS Telemetry_InitPhase711_BootstrapTelemetryMind(KERNEL_CONTEXT *ctx);
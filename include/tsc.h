@@ -0,0 +1,43 @@
+#ifndef TSC_H
+#define TSC_H
+
+#include <Uefi.h>
+
+// Where the TSC frequency came from. The values travel in the boot handoff
+// block, so new sources go at the end; Tsc_Calibrate's preference order is
+// its own (tsc.c).
+typedef enum {
+    TSC_SOURCE_DEFAULT = 0,     // not calibrated yet, assumes TSC_DEFAULT_HZ
+    TSC_SOURCE_CPUID_15,        // crystal clock ratio, exact
+    TSC_SOURCE_HYPERVISOR,      // 0x40000010 leaf, exact under KVM/VMware
+    TSC_SOURCE_CPUID_16,        // nominal base frequency, within a few percent
+    TSC_SOURCE_STALL            // TSC ticks across gBS->Stall
+} TSC_SOURCE;
+
+#define TSC_DEFAULT_HZ      2000000000ULL
+#define TSC_STALL_US        2000
+#define TSC_STALL_WINDOWS   5
+
+typedef struct {
+    UINT64      Hz;
+    TSC_SOURCE  Source;
+    BOOLEAN     Invariant;      // CPUID.80000007h:EDX[8], constant rate across P/C-states
+} TSC_INFO;
+
+// Calibrates once; later calls return the cached result. The Stall
+// fallback needs boot services, so call it before ExitBootServices.
+const TSC_INFO *Tsc_Calibrate(VOID);
+const TSC_INFO *Tsc_Info(VOID);
+
+// Takes a calibration made earlier, e.g. by the loader, so the next
+// Tsc_Calibrate returns it without measuring. Ignored for Hz 0 or
+// TSC_SOURCE_DEFAULT.
+VOID Tsc_Adopt(UINT64 Hz, TSC_SOURCE Source, BOOLEAN Invariant);
+
+// Frequency from one source alone, without caching it; 0 when this CPU
+// or firmware does not provide it. For checking sources against each other.
+UINT64 Tsc_FromSource(TSC_SOURCE Source);
+UINT64 Tsc_ToNs(UINT64 Ticks);
+UINT64 Tsc_FromNs(UINT64 Ns);
+
+#endif // TSC_H
@@ -1,13 +1,14 @@
 #include "kernel_shared.h"
 #include "telemetry_mind.h"
 #include "sha256.h"
+#include "phase_registry.h"
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseLib.h>
 #include <Library/PrintLib.h>
 
 // Simple structures for AI core state
 static UINT64 gAiMatrix[4][4];
-static UINT64 gSelfModel[8];
+UINT64 gSelfModel[AI_SELF_MODEL_WORDS];
 static UINT64 gPredictionBuf[64];
 static INTN   gEntropyDelta[32];
 static UINT64 gTrustInput[16];
@@ -20,13 +21,11 @@ static UINTN  gAdvisorLogHead = 0;
 static UINT64 gPrevEntropyVec[16];
 
 EFI_STATUS AICore_ReportEvent(const CHAR8 *name) {
-    Print(L"[AI EVT] %a\n", name);
     Telemetry_LogEvent(name, 0, 0);
     return EFI_SUCCESS;
 }
 
 EFI_STATUS AICore_ReportPhase(const CHAR8 *name, UINTN value) {
-    Print(L"[AI PHASE] %a %u\n", name, value);
     Telemetry_LogEvent(name, value, 0);
     return EFI_SUCCESS;
 }
@@ -170,11 +169,11 @@ UINTN AICore_ScoreStorageMindPerformance(KERNEL_CONTEXT *ctx) {
 
 // === Phase 701: InitializeAICoreSubsystem ===
 EFI_STATUS AICorePhase701_InitializeSubsystem(KERNEL_CONTEXT *ctx) {
-    ZeroMem(ctx->ai_trust_matrix, sizeof(ctx->ai_trust_matrix));
+    ZeroMem(ctx->cold->ai_trust_matrix, sizeof(ctx->cold->ai_trust_matrix));
     ZeroMem(ctx->ai_prediction_cache, sizeof(ctx->ai_prediction_cache));
     ZeroMem(ctx->ai_entropy_input, sizeof(ctx->ai_entropy_input));
     ZeroMem(ctx->ai_history, sizeof(ctx->ai_history));
-    ZeroMem(ctx->ai_rule_weights, sizeof(ctx->ai_rule_weights));
+    ZeroMem(ctx->cold->ai_rule_weights, sizeof(ctx->cold->ai_rule_weights));
     ctx->ai_status = 1;
     Telemetry_LogEvent("AI701_Init", 1, 0);
     return EFI_SUCCESS;
@@ -184,7 +183,7 @@ EFI_STATUS AICorePhase701_InitializeSubsystem(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICorePhase702_TrustMatrixBootstrap(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 10; ++i)
         for (UINTN j = 0; j < 10; ++j)
-            ctx->ai_trust_matrix[i][j] = (i == j) ? 55 : 45;
+            ctx->cold->ai_trust_matrix[i][j] = (i == j) ? 55 : 45;
     Telemetry_LogEvent("AI702_TrustSeed", 0, 0);
     return EFI_SUCCESS;
 }
@@ -233,9 +232,9 @@ EFI_STATUS AICorePhase706_EntropyImpactModeler(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 16; ++i) {
         INTN diff = (INTN)ctx->ai_entropy_input[i] - (INTN)gPrevEntropyVec[i];
         if (diff > 0)
-            ctx->ai_rule_weights[i] += 1;
+            ctx->cold->ai_rule_weights[i] += 1;
         else if (diff < 0)
-            ctx->ai_rule_weights[i] -= 1;
+            ctx->cold->ai_rule_weights[i] -= 1;
         gPrevEntropyVec[i] = ctx->ai_entropy_input[i];
     }
     Telemetry_LogEvent("AI706_Impact", 0, 0);
@@ -314,7 +313,7 @@ EFI_STATUS AICorePhase713_TrustBackpropagation(KERNEL_CONTEXT *ctx) {
     UINTN prev = (idx + 19) % 20;
     if (ctx->phase_trust[idx] < ctx->phase_trust[prev])
         for (UINTN i = 0; i < 16; ++i)
-            ctx->ai_rule_weights[i] -= 1;
+            ctx->cold->ai_rule_weights[i] -= 1;
     Telemetry_LogEvent("AI713_Backprop", 0, 0);
     return EFI_SUCCESS;
 }
@@ -331,9 +330,9 @@ EFI_STATUS AICorePhase714_ReasoningStateSync(KERNEL_CONTEXT *ctx) {
 // === Phase 715: AIDynamicRuleWeightBalancer ===
 EFI_STATUS AICorePhase715_RuleWeightBalancer(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 961; ++i) {
-        ctx->ai_rule_weights[i] = (INT16)(ctx->ai_rule_weights[i] * 9 / 10);
-        if (ctx->ai_rule_weights[i] > 127) ctx->ai_rule_weights[i] = 127;
-        if (ctx->ai_rule_weights[i] < -127) ctx->ai_rule_weights[i] = -127;
+        ctx->cold->ai_rule_weights[i] = (INT16)(ctx->cold->ai_rule_weights[i] * 9 / 10);
+        if (ctx->cold->ai_rule_weights[i] > 127) ctx->cold->ai_rule_weights[i] = 127;
+        if (ctx->cold->ai_rule_weights[i] < -127) ctx->cold->ai_rule_weights[i] = -127;
     }
     Telemetry_LogEvent("AI715_WeightBal", 0, 0);
     return EFI_SUCCESS;
@@ -345,7 +344,7 @@ EFI_STATUS AICorePhase716_EntropySignatureGenerator(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 16; ++i) hash ^= ctx->ai_entropy_input[i];
     for (UINTN i = 0; i < 10; ++i)
         for (UINTN j = 0; j < 10; ++j)
-            hash ^= ctx->ai_trust_matrix[i][j];
+            hash ^= ctx->cold->ai_trust_matrix[i][j];
     for (UINTN i = 0; i < 32; ++i)
         ctx->ai_advisory_signature[i] = (UINT8)(hash >> (i % 8));
     Telemetry_LogEvent("AI716_Sign", 0, 0);
@@ -476,7 +475,7 @@ EFI_STATUS AICorePhase728_AnomalySuppressor(KERNEL_CONTEXT *ctx) {
 // === Phase 729: AICoreSelfFeedbackLoop ===
 EFI_STATUS AICorePhase729_SelfFeedbackLoop(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 10; ++i)
-        ctx->ai_rule_weights[i] += (INT16)(ctx->ai_history[i] % 3) - 1;
+        ctx->cold->ai_rule_weights[i] += (INT16)(ctx->ai_history[i] % 3) - 1;
     Telemetry_LogEvent("AI729_Feedback", 0, 0);
     return EFI_SUCCESS;
 }
@@ -492,14 +491,14 @@ EFI_STATUS AICorePhase730_FinalStateExporter(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICorePhase731_PolicyInfluenceBalancer(KERNEL_CONTEXT *ctx) {
     INT32 max = 0; INT32 sum = 0;
     for (UINTN i = 0; i < 10; ++i) {
-        INT32 w = ctx->ai_rule_weights[i];
+        INT32 w = ctx->cold->ai_rule_weights[i];
         if (w < 0) w = -w;
         if (w > max) max = w;
         sum += w;
     }
     if (sum && max * 100 / sum > 60)
         for (UINTN i = 0; i < 10; ++i)
-            ctx->ai_rule_weights[i] /= 2;
+            ctx->cold->ai_rule_weights[i] /= 2;
     Telemetry_LogEvent("AI731_PolicyBal", 0, 0);
     return EFI_SUCCESS;
 }
@@ -642,7 +641,7 @@ EFI_STATUS AICorePhase747_IntegrityHashEmitter(KERNEL_CONTEXT *ctx) {
     SHA256_CTX c;
     sha256_init(&c);
     sha256_update(&c, (UINT8*)ctx->ai_entropy_input, sizeof(ctx->ai_entropy_input));
-    sha256_update(&c, (UINT8*)ctx->ai_trust_matrix, sizeof(ctx->ai_trust_matrix));
+    sha256_update(&c, (UINT8*)ctx->cold->ai_trust_matrix, sizeof(ctx->cold->ai_trust_matrix));
     sha256_final(&c, ctx->ai_advisory_signature);
     Telemetry_LogEvent("AI747_Hash", 0, 0);
     return EFI_SUCCESS;
@@ -1289,9 +1288,9 @@ EFI_STATUS AICore_InitPhase941_AIRootReasoningTreeRebuilder(KERNEL_CONTEXT *ctx)
 // === Phase 942: AI Phase-Wise Rule Adjuster ===
 EFI_STATUS AICore_InitPhase942_AIPhaseWiseRuleAdjuster(KERNEL_CONTEXT *ctx) {
     UINTN id = ctx->phase_history_index % 960;
-    ctx->ai_rule_weights[id]++;
-    Telemetry_LogEvent("RuleAdjust", id, ctx->ai_rule_weights[id]);
-    AICore_RecordPhase("ai_core", 942, ctx->ai_rule_weights[id]);
+    ctx->cold->ai_rule_weights[id]++;
+    Telemetry_LogEvent("RuleAdjust", id, ctx->cold->ai_rule_weights[id]);
+    AICore_RecordPhase("ai_core", 942, ctx->cold->ai_rule_weights[id]);
     AICore_SendToTelemetry();
     return EFI_SUCCESS;
 }
@@ -1310,8 +1309,8 @@ EFI_STATUS AICore_InitPhase943_AIForkProtectionAdvisory(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICore_InitPhase944_AITrustMatrixRebuilder(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 10; ++i)
         for (UINTN j = 0; j < 10; ++j)
-            ctx->ai_trust_matrix[i][j] = (i + j) ^ ctx->trust_score;
-    AICore_RecordPhase("ai_core", 944, (UINTN)ctx->ai_trust_matrix[0][0]);
+            ctx->cold->ai_trust_matrix[i][j] = (i + j) ^ ctx->trust_score;
+    AICore_RecordPhase("ai_core", 944, (UINTN)ctx->cold->ai_trust_matrix[0][0]);
     AICore_SendToTelemetry();
     return EFI_SUCCESS;
 }
@@ -1474,112 +1473,113 @@ EFI_STATUS AICore_InitPhase960_FinalizeAIBlockC(KERNEL_CONTEXT *ctx) {
     return EFI_SUCCESS;
 }
 
+PHASE_ENTRY gAICorePhases[] = {
+    PHASE(861, PHASE_MIND_AI_CORE, AICore_InitPhase861_BootstrapAICore, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(862, PHASE_MIND_AI_CORE, AICore_InitPhase862_SystemIntentRecognizer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(863, PHASE_MIND_AI_CORE, AICore_InitPhase863_TrustFusionEngine, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(864, PHASE_MIND_AI_CORE, AICore_InitPhase864_EntropyFlowMapper, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(865, PHASE_MIND_AI_CORE, AICore_InitPhase865_AnomalyRankingEngine, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(866, PHASE_MIND_AI_CORE, AICore_InitPhase866_AIReplayFrameConstructor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(867, PHASE_MIND_AI_CORE, AICore_InitPhase867_PredictivePhaseForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(868, PHASE_MIND_AI_CORE, AICore_InitPhase868_BootDNAPhaseAlignmentChecker, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(869, PHASE_MIND_AI_CORE, AICore_InitPhase869_AIEntropyNormalizer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(870, PHASE_MIND_AI_CORE, AICore_InitPhase870_SchedulerTrustInfluenceAdvisor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(871, PHASE_MIND_AI_CORE, AICore_InitPhase871_AITrustIntentCalibrator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(872, PHASE_MIND_AI_CORE, AICore_InitPhase872_PredictiveLoadBalancer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(873, PHASE_MIND_AI_CORE, AICore_InitPhase873_EntropyBudgetAdvisor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(874, PHASE_MIND_AI_CORE, AICore_InitPhase874_ThreadOutcomeForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(875, PHASE_MIND_AI_CORE, AICore_InitPhase875_AIOverrideRequestHandler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(876, PHASE_MIND_AI_CORE, AICore_InitPhase876_GlobalTrustSyncToTelemetry, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(877, PHASE_MIND_AI_CORE, AICore_InitPhase877_AIConfidenceCurveEmitter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(878, PHASE_MIND_AI_CORE, AICore_InitPhase878_AIEntropySaturationTracker, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(879, PHASE_MIND_AI_CORE, AICore_InitPhase879_AIAdvisoryHistoryIndexer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(880, PHASE_MIND_AI_CORE, AICore_InitPhase880_FinalizeAICoreBlockA, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(881, PHASE_MIND_AI_CORE, AICore_InitPhase881_AIOutcomeTrustValidator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(882, PHASE_MIND_AI_CORE, AICore_InitPhase882_SelfDeviationDetector, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(883, PHASE_MIND_AI_CORE, AICore_InitPhase883_EntropyCurveIntegrityCheck, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(884, PHASE_MIND_AI_CORE, AICore_InitPhase884_TrustLoopbackVerifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(885, PHASE_MIND_AI_CORE, AICore_InitPhase885_BootIntentEchoScanner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(886, PHASE_MIND_AI_CORE, AICore_InitPhase886_PredictiveFailureForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(887, PHASE_MIND_AI_CORE, AICore_InitPhase887_AIHeuristicTuner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(888, PHASE_MIND_AI_CORE, AICore_InitPhase888_AITrustBoundaryObserver, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(889, PHASE_MIND_AI_CORE, AICore_InitPhase889_SchedulerNudgeAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(890, PHASE_MIND_AI_CORE, AICore_InitPhase890_DeterministicModelAligner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(891, PHASE_MIND_AI_CORE, AICore_InitPhase891_EntropyReplayModelTrainer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(892, PHASE_MIND_AI_CORE, AICore_InitPhase892_AIFailureSuppressionFence, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(893, PHASE_MIND_AI_CORE, AICore_InitPhase893_AIImpactScoreReporter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(894, PHASE_MIND_AI_CORE, AICore_InitPhase894_EntropyWeightRedistributor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(895, PHASE_MIND_AI_CORE, AICore_InitPhase895_PrecisionAdvisorPacker, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(896, PHASE_MIND_AI_CORE, AICore_InitPhase896_TrustRecoveryModelBuilder, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(897, PHASE_MIND_AI_CORE, AICore_InitPhase897_AIConsensusAdjuster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(898, PHASE_MIND_AI_CORE, AICore_InitPhase898_PhaseCorrectionForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(899, PHASE_MIND_AI_CORE, AICore_InitPhase899_TelemetryCompressionAdvisor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(900, PHASE_MIND_AI_CORE, AICore_InitPhase900_FinalizeAIBlockB, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE_RESERVED(901, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(902, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(903, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(904, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(905, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(906, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(907, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(908, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(909, PHASE_MIND_AI_CORE),
+    PHASE_RESERVED(910, PHASE_MIND_AI_CORE),
+    PHASE(911, PHASE_MIND_AI_CORE, AICore_InitPhase911_AIGPUDelegateBootstrap, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(912, PHASE_MIND_AI_CORE, AICore_InitPhase912_PhaseLatencyPredictor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(913, PHASE_MIND_AI_CORE, AICore_InitPhase913_AdvisoryComplianceTracker, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(914, PHASE_MIND_AI_CORE, AICore_InitPhase914_InterMindAIBridgeSync, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(915, PHASE_MIND_AI_CORE, AICore_InitPhase915_EntropyTrustArbitrationCore, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(916, PHASE_MIND_AI_CORE, AICore_InitPhase916_PhaseDivergenceNotifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(917, PHASE_MIND_AI_CORE, AICore_InitPhase917_GPUDelegateDispatchAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(918, PHASE_MIND_AI_CORE, AICore_InitPhase918_PredictionCertaintyAuditor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(919, PHASE_MIND_AI_CORE, AICore_InitPhase919_AdvisorySourceAttributionEngine, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(920, PHASE_MIND_AI_CORE, AICore_InitPhase920_FinalizeGPUAdvisoryRound, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(921, PHASE_MIND_AI_CORE, AICore_InitPhase921_AISchedulerFeedbackAdapter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(922, PHASE_MIND_AI_CORE, AICore_InitPhase922_AITrustDissonanceScanner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(923, PHASE_MIND_AI_CORE, AICore_InitPhase923_TelemetryCorrelationMatrix, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(924, PHASE_MIND_AI_CORE, AICore_InitPhase924_TrustFeedbackWeightedTrainer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(925, PHASE_MIND_AI_CORE, AICore_InitPhase925_GPUFeedbackStabilityMeter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(926, PHASE_MIND_AI_CORE, AICore_InitPhase926_AIImpactAmplifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(927, PHASE_MIND_AI_CORE, AICore_InitPhase927_AIActionCooldownHandler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(928, PHASE_MIND_AI_CORE, AICore_InitPhase928_PredictiveTrustResetAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(929, PHASE_MIND_AI_CORE, AICore_InitPhase929_SaturationEntropyAlertEmitter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(930, PHASE_MIND_AI_CORE, AICore_InitPhase930_PredictiveExecutionWindowSync, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(931, PHASE_MIND_AI_CORE, AICore_InitPhase931_AIAdvisorRegistryLogger, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(932, PHASE_MIND_AI_CORE, AICore_InitPhase932_AITrustRecoveryCurveEmitter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(933, PHASE_MIND_AI_CORE, AICore_InitPhase933_PhaseEntropyBudgetForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(934, PHASE_MIND_AI_CORE, AICore_InitPhase934_TrustSignalCompressor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(935, PHASE_MIND_AI_CORE, AICore_InitPhase935_AIEntropyBudgetAllocator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(936, PHASE_MIND_AI_CORE, AICore_InitPhase936_AIWindowEntropySnapshooter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(937, PHASE_MIND_AI_CORE, AICore_InitPhase937_AIPhaseHeatCurveEmitter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(938, PHASE_MIND_AI_CORE, AICore_InitPhase938_AIExecutionSpanProfiler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(939, PHASE_MIND_AI_CORE, AICore_InitPhase939_GPUAICertaintyRouter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(940, PHASE_MIND_AI_CORE, AICore_InitPhase940_FinalizeAIWindowBlock, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(941, PHASE_MIND_AI_CORE, AICore_InitPhase941_AIRootReasoningTreeRebuilder, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(942, PHASE_MIND_AI_CORE, AICore_InitPhase942_AIPhaseWiseRuleAdjuster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(943, PHASE_MIND_AI_CORE, AICore_InitPhase943_AIForkProtectionAdvisory, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(944, PHASE_MIND_AI_CORE, AICore_InitPhase944_AITrustMatrixRebuilder, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(945, PHASE_MIND_AI_CORE, AICore_InitPhase945_InterDeviceAIExportChannel, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(946, PHASE_MIND_AI_CORE, AICore_InitPhase946_RealTimeAdvisorRetrainShim, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(947, PHASE_MIND_AI_CORE, AICore_InitPhase947_AITrustFalsificationWatchdog, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(948, PHASE_MIND_AI_CORE, AICore_InitPhase948_AISelfCorrectionRollbackPlanner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(949, PHASE_MIND_AI_CORE, AICore_InitPhase949_AIPredictionCacheFlusher, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(950, PHASE_MIND_AI_CORE, AICore_InitPhase950_ExternalAdvisorySignatureEmitter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(951, PHASE_MIND_AI_CORE, AICore_InitPhase951_AdvisoryRedundancyFilter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(952, PHASE_MIND_AI_CORE, AICore_InitPhase952_AIModelFingerprintVerifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(953, PHASE_MIND_AI_CORE, AICore_InitPhase953_AIModelCorruptionFence, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(954, PHASE_MIND_AI_CORE, AICore_InitPhase954_GPUEntropyForwarder, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(955, PHASE_MIND_AI_CORE, AICore_InitPhase955_GPUAIDelegateErrorScanner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(956, PHASE_MIND_AI_CORE, AICore_InitPhase956_CrossCoreAISyncAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(957, PHASE_MIND_AI_CORE, AICore_InitPhase957_AIKernelAdvisoryBridgeLogger, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(958, PHASE_MIND_AI_CORE, AICore_InitPhase958_AIZeroDriftPhaseVerifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(959, PHASE_MIND_AI_CORE, AICore_InitPhase959_RealTimePredictionDropMonitor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(960, PHASE_MIND_AI_CORE, AICore_InitPhase960_FinalizeAIBlockC, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+};
+const UINTN gAICorePhaseCount = sizeof(gAICorePhases) / sizeof(gAICorePhases[0]);
+
 EFI_STATUS AICore_RunAllPhases(KERNEL_CONTEXT *ctx) {
-    EFI_STATUS Status = EFI_SUCCESS;
-    for (UINTN phase = 861; phase <= 960; ++phase) {
-        switch (phase) {
-            case 861: Status = AICore_InitPhase861_BootstrapAICore(ctx); break;
-            case 862: Status = AICore_InitPhase862_SystemIntentRecognizer(ctx); break;
-            case 863: Status = AICore_InitPhase863_TrustFusionEngine(ctx); break;
-            case 864: Status = AICore_InitPhase864_EntropyFlowMapper(ctx); break;
-            case 865: Status = AICore_InitPhase865_AnomalyRankingEngine(ctx); break;
-            case 866: Status = AICore_InitPhase866_AIReplayFrameConstructor(ctx); break;
-            case 867: Status = AICore_InitPhase867_PredictivePhaseForecaster(ctx); break;
-            case 868: Status = AICore_InitPhase868_BootDNAPhaseAlignmentChecker(ctx); break;
-            case 869: Status = AICore_InitPhase869_AIEntropyNormalizer(ctx); break;
-            case 870: Status = AICore_InitPhase870_SchedulerTrustInfluenceAdvisor(ctx); break;
-            case 871: Status = AICore_InitPhase871_AITrustIntentCalibrator(ctx); break;
-            case 872: Status = AICore_InitPhase872_PredictiveLoadBalancer(ctx); break;
-            case 873: Status = AICore_InitPhase873_EntropyBudgetAdvisor(ctx); break;
-            case 874: Status = AICore_InitPhase874_ThreadOutcomeForecaster(ctx); break;
-            case 875: Status = AICore_InitPhase875_AIOverrideRequestHandler(ctx); break;
-            case 876: Status = AICore_InitPhase876_GlobalTrustSyncToTelemetry(ctx); break;
-            case 877: Status = AICore_InitPhase877_AIConfidenceCurveEmitter(ctx); break;
-            case 878: Status = AICore_InitPhase878_AIEntropySaturationTracker(ctx); break;
-            case 879: Status = AICore_InitPhase879_AIAdvisoryHistoryIndexer(ctx); break;
-            case 880: Status = AICore_InitPhase880_FinalizeAICoreBlockA(ctx); break;
-            case 881: Status = AICore_InitPhase881_AIOutcomeTrustValidator(ctx); break;
-            case 882: Status = AICore_InitPhase882_SelfDeviationDetector(ctx); break;
-            case 883: Status = AICore_InitPhase883_EntropyCurveIntegrityCheck(ctx); break;
-            case 884: Status = AICore_InitPhase884_TrustLoopbackVerifier(ctx); break;
-            case 885: Status = AICore_InitPhase885_BootIntentEchoScanner(ctx); break;
-            case 886: Status = AICore_InitPhase886_PredictiveFailureForecaster(ctx); break;
-            case 887: Status = AICore_InitPhase887_AIHeuristicTuner(ctx); break;
-            case 888: Status = AICore_InitPhase888_AITrustBoundaryObserver(ctx); break;
-            case 889: Status = AICore_InitPhase889_SchedulerNudgeAgent(ctx); break;
-            case 890: Status = AICore_InitPhase890_DeterministicModelAligner(ctx); break;
-            case 891: Status = AICore_InitPhase891_EntropyReplayModelTrainer(ctx); break;
-            case 892: Status = AICore_InitPhase892_AIFailureSuppressionFence(ctx); break;
-            case 893: Status = AICore_InitPhase893_AIImpactScoreReporter(ctx); break;
-            case 894: Status = AICore_InitPhase894_EntropyWeightRedistributor(ctx); break;
-            case 895: Status = AICore_InitPhase895_PrecisionAdvisorPacker(ctx); break;
-            case 896: Status = AICore_InitPhase896_TrustRecoveryModelBuilder(ctx); break;
-            case 897: Status = AICore_InitPhase897_AIConsensusAdjuster(ctx); break;
-            case 898: Status = AICore_InitPhase898_PhaseCorrectionForecaster(ctx); break;
-            case 899: Status = AICore_InitPhase899_TelemetryCompressionAdvisor(ctx); break;
-            case 900: Status = AICore_InitPhase900_FinalizeAIBlockB(ctx); break;
-            case 901: case 902: case 903: case 904: case 905:
-            case 906: case 907: case 908: case 909: case 910:
-                Status = EFI_SUCCESS; break;
-            case 911: Status = AICore_InitPhase911_AIGPUDelegateBootstrap(ctx); break;
-            case 912: Status = AICore_InitPhase912_PhaseLatencyPredictor(ctx); break;
-            case 913: Status = AICore_InitPhase913_AdvisoryComplianceTracker(ctx); break;
-            case 914: Status = AICore_InitPhase914_InterMindAIBridgeSync(ctx); break;
-            case 915: Status = AICore_InitPhase915_EntropyTrustArbitrationCore(ctx); break;
-            case 916: Status = AICore_InitPhase916_PhaseDivergenceNotifier(ctx); break;
-            case 917: Status = AICore_InitPhase917_GPUDelegateDispatchAgent(ctx); break;
-            case 918: Status = AICore_InitPhase918_PredictionCertaintyAuditor(ctx); break;
-            case 919: Status = AICore_InitPhase919_AdvisorySourceAttributionEngine(ctx); break;
-            case 920: Status = AICore_InitPhase920_FinalizeGPUAdvisoryRound(ctx); break;
-            case 921: Status = AICore_InitPhase921_AISchedulerFeedbackAdapter(ctx); break;
-            case 922: Status = AICore_InitPhase922_AITrustDissonanceScanner(ctx); break;
-            case 923: Status = AICore_InitPhase923_TelemetryCorrelationMatrix(ctx); break;
-            case 924: Status = AICore_InitPhase924_TrustFeedbackWeightedTrainer(ctx); break;
-            case 925: Status = AICore_InitPhase925_GPUFeedbackStabilityMeter(ctx); break;
-            case 926: Status = AICore_InitPhase926_AIImpactAmplifier(ctx); break;
-            case 927: Status = AICore_InitPhase927_AIActionCooldownHandler(ctx); break;
-            case 928: Status = AICore_InitPhase928_PredictiveTrustResetAgent(ctx); break;
-            case 929: Status = AICore_InitPhase929_SaturationEntropyAlertEmitter(ctx); break;
-            case 930: Status = AICore_InitPhase930_PredictiveExecutionWindowSync(ctx); break;
-            case 931: Status = AICore_InitPhase931_AIAdvisorRegistryLogger(ctx); break;
-            case 932: Status = AICore_InitPhase932_AITrustRecoveryCurveEmitter(ctx); break;
-            case 933: Status = AICore_InitPhase933_PhaseEntropyBudgetForecaster(ctx); break;
-            case 934: Status = AICore_InitPhase934_TrustSignalCompressor(ctx); break;
-            case 935: Status = AICore_InitPhase935_AIEntropyBudgetAllocator(ctx); break;
-            case 936: Status = AICore_InitPhase936_AIWindowEntropySnapshooter(ctx); break;
-            case 937: Status = AICore_InitPhase937_AIPhaseHeatCurveEmitter(ctx); break;
-            case 938: Status = AICore_InitPhase938_AIExecutionSpanProfiler(ctx); break;
-            case 939: Status = AICore_InitPhase939_GPUAICertaintyRouter(ctx); break;
-            case 940: Status = AICore_InitPhase940_FinalizeAIWindowBlock(ctx); break;
-            case 941: Status = AICore_InitPhase941_AIRootReasoningTreeRebuilder(ctx); break;
-            case 942: Status = AICore_InitPhase942_AIPhaseWiseRuleAdjuster(ctx); break;
-            case 943: Status = AICore_InitPhase943_AIForkProtectionAdvisory(ctx); break;
-            case 944: Status = AICore_InitPhase944_AITrustMatrixRebuilder(ctx); break;
-            case 945: Status = AICore_InitPhase945_InterDeviceAIExportChannel(ctx); break;
-            case 946: Status = AICore_InitPhase946_RealTimeAdvisorRetrainShim(ctx); break;
-            case 947: Status = AICore_InitPhase947_AITrustFalsificationWatchdog(ctx); break;
-            case 948: Status = AICore_InitPhase948_AISelfCorrectionRollbackPlanner(ctx); break;
-            case 949: Status = AICore_InitPhase949_AIPredictionCacheFlusher(ctx); break;
-            case 950: Status = AICore_InitPhase950_ExternalAdvisorySignatureEmitter(ctx); break;
-            case 951: Status = AICore_InitPhase951_AdvisoryRedundancyFilter(ctx); break;
-            case 952: Status = AICore_InitPhase952_AIModelFingerprintVerifier(ctx); break;
-            case 953: Status = AICore_InitPhase953_AIModelCorruptionFence(ctx); break;
-            case 954: Status = AICore_InitPhase954_GPUEntropyForwarder(ctx); break;
-            case 955: Status = AICore_InitPhase955_GPUAIDelegateErrorScanner(ctx); break;
-            case 956: Status = AICore_InitPhase956_CrossCoreAISyncAgent(ctx); break;
-            case 957: Status = AICore_InitPhase957_AIKernelAdvisoryBridgeLogger(ctx); break;
-            case 958: Status = AICore_InitPhase958_AIZeroDriftPhaseVerifier(ctx); break;
-            case 959: Status = AICore_InitPhase959_RealTimePredictionDropMonitor(ctx); break;
-            case 960: Status = AICore_InitPhase960_FinalizeAIBlockC(ctx); break;
-            default: Status = EFI_INVALID_PARAMETER; break;
-        }
-        if (EFI_ERROR(Status)) {
-            Telemetry_LogEvent("AICorePhaseError", phase, Status);
-            return Status;
-        }
-        ctx->total_phases++;
-    }
-    return EFI_SUCCESS;
+    PHASE_RUN Run = { "AICorePhaseError", TRUE };
+    return PhaseRegistry_Run(gAICorePhases, gAICorePhaseCount, ctx, &Run);
 }
 
 // === Phase 4051: ReflectKernelSelf ===
@@ -19,7 +19,7 @@ static UINT64 AiCoreMind_HashBuffer(const UINT64 *buf, UINTN count) {
 // === Phase 701: AIReasoningTreeValidator ===
 EFI_STATUS AICore_Phase701_ValidateReasoningTree(KERNEL_CONTEXT *ctx) {
     UINT64 recomputed = AiCoreMind_HashBuffer(ctx->ai_entropy_vector, 16);
-    UINT64 model = AiCoreMind_HashBuffer(gSelfModel, 8);
+    UINT64 model = AiCoreMind_HashBuffer(gSelfModel, AI_SELF_MODEL_WORDS);
     UINT64 diff = recomputed ^ model;
     UINTN bits = 0;
     for (UINTN i = 0; i < 64; ++i)
@@ -159,8 +159,8 @@ EFI_STATUS AICore_Phase714_ReactToIntentTrustDissonance(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICore_Phase715_ReinforceAnchoredReasoning(KERNEL_CONTEXT *ctx) {
     UINT64 forecast = ctx->trust_recovery_map[0];
     if (forecast == ctx->phase_trust[ctx->phase_history_index % 20])
-        ctx->ai_rule_weights[0]++;
-    Telemetry_LogEvent("ACM715_Reinforce", ctx->ai_rule_weights[0], 0);
+        ctx->cold->ai_rule_weights[0]++;
+    Telemetry_LogEvent("ACM715_Reinforce", ctx->cold->ai_rule_weights[0], 0);
     return EFI_SUCCESS;
 }
 
@@ -250,8 +250,8 @@ EFI_STATUS AICore_Phase724_EmitPhaseEffectivenessScore(KERNEL_CONTEXT *ctx) {
 // === Phase 725: SelfPredictionReinforcer ===
 EFI_STATUS AICore_Phase725_ReinforceSelfPrediction(KERNEL_CONTEXT *ctx) {
     if (ctx->ai_history[0] < 5)
-        ctx->ai_rule_weights[1]++;
-    Telemetry_LogEvent("ACM725_Reinf", ctx->ai_rule_weights[1], 0);
+        ctx->cold->ai_rule_weights[1]++;
+    Telemetry_LogEvent("ACM725_Reinf", ctx->cold->ai_rule_weights[1], 0);
     return EFI_SUCCESS;
 }
 
@@ -272,8 +272,8 @@ EFI_STATUS AICore_Phase726_RetuneUsingTrustHistory(KERNEL_CONTEXT *ctx) {
 // === Phase 727: PredictionEntropyTrustTriangulator ===
 EFI_STATUS AICore_Phase727_TriangulatePrediction(KERNEL_CONTEXT *ctx) {
     if (ctx->ai_history[0] < 10 && ctx->entropy_gap > 0 && ctx->trust_score < 60)
-        ctx->ai_rule_weights[2]--;
-    Telemetry_LogEvent("ACM727_Tri", ctx->ai_rule_weights[2], 0);
+        ctx->cold->ai_rule_weights[2]--;
+    Telemetry_LogEvent("ACM727_Tri", ctx->cold->ai_rule_weights[2], 0);
     return EFI_SUCCESS;
 }
 
@@ -314,7 +314,7 @@ EFI_STATUS AICore_Phase731_AssessPredictionSurvivability(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICore_Phase732_TrackThoughtRedundancy(KERNEL_CONTEXT *ctx) {
     UINT64 hash = AiCoreMind_HashBuffer(ctx->ai_history, 5);
     static UINT64 prev_hash = 0;
-    if (hash == prev_hash) ctx->ai_rule_weights[3]--;
+    if (hash == prev_hash) ctx->cold->ai_rule_weights[3]--;
     prev_hash = hash;
     Telemetry_LogEvent("ACM732_Redun", (UINTN)hash, 0);
     return EFI_SUCCESS;
@@ -349,7 +349,7 @@ EFI_STATUS AICore_Phase735_SyncTrustAdaptivity(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICore_Phase736_ReactToGlobalGoalMisalignment(KERNEL_CONTEXT *ctx) {
     UINT64 drift = ctx->ai_history[3];
     if (drift > ctx->ai_global_trust_score / 4)
-        ctx->ai_rule_weights[4]--;
+        ctx->cold->ai_rule_weights[4]--;
     Telemetry_LogEvent("ACM736_GAlign", (UINTN)drift, 0);
     return EFI_SUCCESS;
 }
@@ -413,7 +413,7 @@ EFI_STATUS AICore_Phase743_PerformPhaseMetaAudit(KERNEL_CONTEXT *ctx) {
 // === Phase 744: FutureRiskProjectionIntegrator ===
 EFI_STATUS AICore_Phase744_IntegrateRiskProjection(KERNEL_CONTEXT *ctx) {
     UINT64 proj = ctx->ai_history[3] + ctx->entropy_gap;
-    ctx->ai_rule_weights[5] = (INT16)(proj % 128);
+    ctx->cold->ai_rule_weights[5] = (INT16)(proj % 128);
     Telemetry_LogEvent("ACM744_Risk", (UINTN)proj, 0);
     return EFI_SUCCESS;
 }
@@ -468,6 +468,7 @@ EFI_STATUS AICore_Phase750_FinalizeAICoreMind(KERNEL_CONTEXT *ctx) {
 EFI_STATUS AICoreMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     EFI_STATUS Status = EFI_SUCCESS;
     for (UINTN phase = 701; phase <= 750; ++phase) {
+        Telemetry_SetPhase((UINT32)phase);
         switch (phase) {
             case 701: Status = AICore_Phase701_ValidateReasoningTree(ctx); break;
             case 702: Status = AICore_Phase702_RefreshIntentAlignment(ctx); break;
@@ -0,0 +1,334 @@
+// ap_pool.c - Kernel-owned application processors
+// Starts the APs with INIT-SIPI-SIPI after ExitBootServices and keeps each
+// one spinning on its own mailbox for work from the BSP.
+
+#include "kernel_shared.h"
+#include "loader_params.h"
+#include "ap_pool.h"
+
+#define MSR_IA32_APIC_BASE          0x1B
+#define MSR_IA32_EFER               0xC0000080
+#define MSR_X2APIC_APICID           0x802
+#define MSR_X2APIC_ICR              0x830
+#define APIC_BASE_X2APIC            (1ull << 10)
+#define APIC_BASE_ADDRESS_MASK      0xFFFFFF000ull
+#define XAPIC_ID                    0x020
+#define XAPIC_ICR_LOW               0x300
+#define XAPIC_ICR_HIGH              0x310
+#define ICR_DELIVERY_PENDING        (1u << 12)
+#define ICR_ALL_BUT_SELF_INIT       0x000C4500u
+#define ICR_ALL_BUT_SELF_SIPI       0x000C4600u
+
+#define CR4_PAE                     (1ull << 5)
+#define CR4_OSFXSR                  (1ull << 9)
+#define CR4_OSXMMEXCPT              (1ull << 10)
+#define CR4_LA57                    (1ull << 12)
+#define EFER_LMA                    (1ull << 10)
+
+#define AP_INIT_DELAY_NS            10000000ull     // INIT to first SIPI
+#define AP_SIPI_DELAY_NS            200000ull       // between the two SIPIs
+#define AP_START_TIMEOUT_NS         100000000ull
+
+// Trampoline page 0: code from offset 0, AP_TRAMPOLINE_DATA after it.
+// Pages 1-3 identity-map the first GiB for the step into long mode; the
+// BSP's CR3 may sit above 4 GiB, where 32-bit code can not load it.
+#define AP_TRAMPOLINE_DATA_OFFSET   0x400
+
+#pragma pack(1)
+typedef struct {
+    UINT16 GdtLimit;            // 0x00 temporary GDT, for lgdtl in real mode
+    UINT32 GdtBase;
+    UINT16 Reserved0;
+    UINT32 Far32Offset;         // 0x08 real mode -> 32-bit code
+    UINT16 Far32Selector;
+    UINT16 Reserved1;
+    UINT32 Far64Offset;         // 0x10 32-bit -> 64-bit code
+    UINT16 Far64Selector;
+    UINT16 Reserved2;
+    UINT32 TempCr3;             // 0x18
+    UINT32 TempCr4;             // 0x1C
+    UINT64 Efer;                // 0x20
+    UINT64 Cr0;                 // 0x28
+    UINT64 Cr3;                 // 0x30 the BSP's, loaded once in long mode
+    UINT64 Cr4;                 // 0x38
+    UINT64 Xcr0;                // 0x40
+    UINT16 GdtrLimit;           // 0x48 the BSP's GDT and IDT
+    UINT64 GdtrBase;
+    UINT8  Reserved3[6];
+    UINT16 IdtrLimit;           // 0x58
+    UINT64 IdtrBase;
+    UINT8  Reserved4[6];
+    UINT64 Cs;                  // 0x68
+    UINT64 Ds;                  // 0x70
+    UINT64 StackBase;           // 0x78
+    UINT64 StackSize;           // 0x80
+    UINT64 Entry;               // 0x88 VOID EFIAPI (*)(UINTN Index)
+    UINT32 MaxAps;              // 0x90
+    UINT32 Started;             // 0x94 each AP takes its index from here
+    UINT64 Gdt[4];              // 0x98 null, code64, data, code32
+} AP_TRAMPOLINE_DATA;
+#pragma pack()
+
+STATIC_ASSERT(OFFSET_OF(AP_TRAMPOLINE_DATA, Efer) == 0x20, "trampoline data layout");
+STATIC_ASSERT(OFFSET_OF(AP_TRAMPOLINE_DATA, GdtrLimit) == 0x48, "trampoline data layout");
+STATIC_ASSERT(OFFSET_OF(AP_TRAMPOLINE_DATA, IdtrLimit) == 0x58, "trampoline data layout");
+STATIC_ASSERT(OFFSET_OF(AP_TRAMPOLINE_DATA, MaxAps) == 0x90, "trampoline data layout");
+STATIC_ASSERT(OFFSET_OF(AP_TRAMPOLINE_DATA, Gdt) == 0x98, "trampoline data layout");
+
+// Real mode at CS:0 with CS = vector << 8; ESI/RSI holds the trampoline
+// base throughout. The data offsets below are AP_TRAMPOLINE_DATA_OFFSET
+// plus the field offsets asserted above.
+__asm__(
+    "   .text\n"
+    "   .globl ApTrampolineStart\n"
+    "   .globl ApTrampolinePm32\n"
+    "   .globl ApTrampolinePm64\n"
+    "   .globl ApTrampolineEnd\n"
+    "   .code16\n"
+    "ApTrampolineStart:\n"
+    "   cli\n"
+    "   cld\n"
+    "   mov %cs, %ax\n"
+    "   mov %ax, %ds\n"
+    "   xor %esi, %esi\n"
+    "   mov %ax, %si\n"
+    "   shl $4, %esi\n"
+    "   lgdtl 0x400\n"
+    "   mov %cr0, %eax\n"
+    "   or $1, %eax\n"
+    "   mov %eax, %cr0\n"
+    "   ljmpl *0x408\n"
+    "   .code32\n"
+    "ApTrampolinePm32:\n"
+    "   mov $0x10, %ax\n"
+    "   mov %ax, %ds\n"
+    "   mov %ax, %es\n"
+    "   mov %ax, %ss\n"
+    "   mov 0x41C(%esi), %eax\n"
+    "   mov %eax, %cr4\n"
+    "   mov 0x418(%esi), %eax\n"
+    "   mov %eax, %cr3\n"
+    "   mov $0xC0000080, %ecx\n"
+    "   mov 0x420(%esi), %eax\n"
+    "   mov 0x424(%esi), %edx\n"
+    "   wrmsr\n"
+    "   mov 0x428(%esi), %eax\n"
+    "   mov %eax, %cr0\n"
+    "   ljmp *0x410(%esi)\n"
+    "   .code64\n"
+    "ApTrampolinePm64:\n"
+    "   mov %esi, %esi\n"
+    "   mov 0x430(%rsi), %rax\n"
+    "   mov %rax, %cr3\n"
+    "   mov 0x438(%rsi), %rax\n"
+    "   mov %rax, %cr4\n"
+    "   bt $18, %rax\n"
+    "   jnc 1f\n"
+    "   xor %ecx, %ecx\n"
+    "   mov 0x440(%rsi), %eax\n"
+    "   mov 0x444(%rsi), %edx\n"
+    "   xsetbv\n"
+    "1: lgdt 0x448(%rsi)\n"
+    "   lidt 0x458(%rsi)\n"
+    "   mov 0x470(%rsi), %rax\n"
+    "   mov %ax, %ds\n"
+    "   mov %ax, %es\n"
+    "   mov %ax, %fs\n"
+    "   mov %ax, %gs\n"
+    "   mov %ax, %ss\n"
+    "   mov $1, %eax\n"
+    "   lock xadd %eax, 0x494(%rsi)\n"
+    "   cmp 0x490(%rsi), %eax\n"
+    "   jae 3f\n"
+    "   mov %eax, %ecx\n"
+    "   lea 1(%rcx), %rax\n"
+    "   imul 0x480(%rsi), %rax\n"
+    "   add 0x478(%rsi), %rax\n"
+    "   mov %rax, %rsp\n"
+    "   mov 0x488(%rsi), %rdx\n"
+    "   pushq 0x468(%rsi)\n"
+    "   lea 2f(%rip), %rax\n"
+    "   push %rax\n"
+    "   lretq\n"
+    "2: sub $32, %rsp\n"
+    "   fninit\n"
+    "   call *%rdx\n"
+    "3: cli\n"
+    "   hlt\n"
+    "   jmp 3b\n"
+    "ApTrampolineEnd:\n"
+);
+
+extern UINT8 ApTrampolineStart[], ApTrampolinePm32[], ApTrampolinePm64[], ApTrampolineEnd[];
+
+// One cache line per AP so mailbox polling does not bounce a shared line.
+typedef struct {
+    volatile UINT32       Busy;         // set by the BSP, cleared by the AP
+    volatile UINT32       Online;
+    UINT32                ApicId;
+    AP_PROCEDURE volatile Proc;
+    VOID *volatile        Arg;
+} KERNEL_CACHE_ALIGNED AP_MAILBOX;
+
+static AP_MAILBOX gApMailbox[AP_POOL_MAX];
+static UINT8 gApStacks[AP_POOL_MAX][AP_POOL_STACK_SIZE] KERNEL_CACHE_ALIGNED;
+static UINTN gApCount;
+static UINT32 gBspApicId;
+
+static BOOLEAN ApicIsX2(VOID) {
+    return (AsmReadMsr64(MSR_IA32_APIC_BASE) & APIC_BASE_X2APIC) != 0;
+}
+
+static volatile UINT32 *XApicReg(UINT32 Offset) {
+    return (volatile UINT32 *)(UINTN)((AsmReadMsr64(MSR_IA32_APIC_BASE) & APIC_BASE_ADDRESS_MASK) + Offset);
+}
+
+static UINT32 ApicId(VOID) {
+    if (ApicIsX2()) return (UINT32)AsmReadMsr64(MSR_X2APIC_APICID);
+    return *XApicReg(XAPIC_ID) >> 24;
+}
+
+static VOID ApicSendAllButSelf(UINT32 Icr) {
+    if (ApicIsX2()) {
+        AsmWriteMsr64(MSR_X2APIC_ICR, Icr);
+        return;
+    }
+    *XApicReg(XAPIC_ICR_HIGH) = 0;
+    *XApicReg(XAPIC_ICR_LOW) = Icr;
+    while (*XApicReg(XAPIC_ICR_LOW) & ICR_DELIVERY_PENDING) CpuPause();
+}
+
+static VOID SpinNs(UINT64 Ns) {
+    UINT64 Start = AsmReadTsc(), Ticks = Tsc_FromNs(Ns);
+    while (AsmReadTsc() - Start < Ticks) CpuPause();
+}
+
+static VOID EFIAPI ApPoolEntry(UINTN Index) {
+    AP_MAILBOX *M = &gApMailbox[Index];
+    M->ApicId = ApicId();
+    MemoryFence();
+    M->Online = TRUE;
+    for (;;) {
+        while (!M->Busy) CpuPause();
+        M->Proc(M->Arg);
+        MemoryFence();
+        M->Busy = FALSE;
+    }
+}
+
+static VOID TrampolineBuild(UINT8 *Page, UINTN MaxAps) {
+    AP_TRAMPOLINE_DATA *D = (AP_TRAMPOLINE_DATA *)(Page + AP_TRAMPOLINE_DATA_OFFSET);
+    UINT64 *Pml4 = (UINT64 *)(Page + EFI_PAGE_SIZE);
+    UINT64 *Pdpt = (UINT64 *)(Page + 2 * EFI_PAGE_SIZE);
+    UINT64 *Pd = (UINT64 *)(Page + 3 * EFI_PAGE_SIZE);
+    UINT32 Base = (UINT32)(UINTN)Page;
+    IA32_DESCRIPTOR Gdtr, Idtr;
+
+    ZeroMem(Page, AP_TRAMPOLINE_PAGES * EFI_PAGE_SIZE);
+    CopyMem(Page, ApTrampolineStart, (UINTN)(ApTrampolineEnd - ApTrampolineStart));
+
+    // 2 MiB pages over the first GiB; the trampoline is below 1 MiB.
+    Pml4[0] = (Base + 2 * EFI_PAGE_SIZE) | 0x3;
+    Pdpt[0] = (Base + 3 * EFI_PAGE_SIZE) | 0x3;
+    for (UINTN i = 0; i < 512; ++i) Pd[i] = ((UINT64)i << 21) | 0x83;
+
+    D->Gdt[1] = 0x00AF9A000000FFFFull;
+    D->Gdt[2] = 0x00CF92000000FFFFull;
+    D->Gdt[3] = 0x00CF9A000000FFFFull;
+    D->GdtLimit = sizeof(D->Gdt) - 1;
+    D->GdtBase = Base + AP_TRAMPOLINE_DATA_OFFSET + OFFSET_OF(AP_TRAMPOLINE_DATA, Gdt);
+    D->Far32Offset = Base + (UINT32)(ApTrampolinePm32 - ApTrampolineStart);
+    D->Far32Selector = 0x18;
+    D->Far64Offset = Base + (UINT32)(ApTrampolinePm64 - ApTrampolineStart);
+    D->Far64Selector = 0x08;
+    D->TempCr3 = Base + EFI_PAGE_SIZE;
+    D->TempCr4 = (UINT32)(CR4_PAE | CR4_OSFXSR | CR4_OSXMMEXCPT);
+    D->Efer = AsmReadMsr64(MSR_IA32_EFER) & ~EFER_LMA;
+    D->Cr0 = AsmReadCr0();
+    D->Cr3 = AsmReadCr3();
+    D->Cr4 = AsmReadCr4();
+    D->Xcr0 = (D->Cr4 & (1ull << 18)) ? AsmXGetBv(0) : 0;
+    AsmReadGdtr(&Gdtr);
+    AsmReadIdtr(&Idtr);
+    D->GdtrLimit = Gdtr.Limit;
+    D->GdtrBase = Gdtr.Base;
+    D->IdtrLimit = Idtr.Limit;
+    D->IdtrBase = Idtr.Base;
+    D->Cs = AsmReadCs();
+    D->Ds = AsmReadDs();
+    D->StackBase = (UINT64)(UINTN)gApStacks;
+    D->StackSize = AP_POOL_STACK_SIZE;
+    D->Entry = (UINT64)(UINTN)ApPoolEntry;
+    D->MaxAps = (UINT32)MaxAps;
+    D->Started = 0;
+}
+
+EFI_STATUS ApPool_Start(EFI_PHYSICAL_ADDRESS Trampoline, UINTN ExpectedAps) {
+    UINT8 *Page = (UINT8 *)(UINTN)Trampoline;
+    UINTN Online = 0;
+
+    gApCount = 0;
+    gBspApicId = ApicId();
+    if (Trampoline == 0 || (Trampoline & EFI_PAGE_MASK) ||
+        Trampoline + AP_TRAMPOLINE_PAGES * EFI_PAGE_SIZE > 0x100000) return EFI_UNSUPPORTED;
+    if (AsmReadCr4() & CR4_LA57) return EFI_UNSUPPORTED;
+    if ((UINTN)(ApTrampolineEnd - ApTrampolineStart) > AP_TRAMPOLINE_DATA_OFFSET) return EFI_BUFFER_TOO_SMALL;
+    if (ExpectedAps > AP_POOL_MAX) ExpectedAps = AP_POOL_MAX;
+
+    ZeroMem(gApMailbox, sizeof(gApMailbox));
+    TrampolineBuild(Page, AP_POOL_MAX);
+    MemoryFence();
+
+    UINT32 Vector = (UINT32)(Trampoline >> 12);
+    ApicSendAllButSelf(ICR_ALL_BUT_SELF_INIT);
+    SpinNs(AP_INIT_DELAY_NS);
+    ApicSendAllButSelf(ICR_ALL_BUT_SELF_SIPI | Vector);
+    SpinNs(AP_SIPI_DELAY_NS);
+    ApicSendAllButSelf(ICR_ALL_BUT_SELF_SIPI | Vector);
+
+    // An AP takes its slot on arrival but is only usable once its mailbox
+    // loop runs, so count mailboxes rather than the trampoline counter.
+    volatile AP_TRAMPOLINE_DATA *D = (volatile AP_TRAMPOLINE_DATA *)(Page + AP_TRAMPOLINE_DATA_OFFSET);
+    UINT64 Start = AsmReadTsc(), Timeout = Tsc_FromNs(AP_START_TIMEOUT_NS);
+    while (AsmReadTsc() - Start < Timeout) {
+        UINTN Claimed = MIN(D->Started, AP_POOL_MAX);
+        Online = 0;
+        while (Online < Claimed && gApMailbox[Online].Online) Online++;
+        if (ExpectedAps && Online >= ExpectedAps) break;
+        CpuPause();
+    }
+    gApCount = Online;
+    return gApCount ? EFI_SUCCESS : EFI_NOT_FOUND;
+}
+
+UINTN ApPool_Count(VOID) {
+    return gApCount;
+}
+
+EFI_STATUS ApPool_Run(UINTN Index, AP_PROCEDURE Proc, VOID *Arg) {
+    if (Index >= gApCount || Proc == NULL) return EFI_INVALID_PARAMETER;
+    AP_MAILBOX *M = &gApMailbox[Index];
+    if (M->Busy) return EFI_NOT_READY;
+    M->Proc = Proc;
+    M->Arg = Arg;
+    MemoryFence();
+    M->Busy = TRUE;
+    return EFI_SUCCESS;
+}
+
+BOOLEAN ApPool_Busy(UINTN Index) {
+    return Index < gApCount && gApMailbox[Index].Busy;
+}
+
+UINT32 ApPool_ApicId(UINTN Index) {
+    return Index < gApCount ? gApMailbox[Index].ApicId : gBspApicId;
+}
+
+UINT32 ApPool_BspApicId(VOID) {
+    return gBspApicId;
+}
+
+UINTN ApPool_CpuIndex(VOID) {
+    UINTN Offset = (UINTN)__builtin_frame_address(0) - (UINTN)gApStacks;
+    return Offset < sizeof(gApStacks) ? Offset / AP_POOL_STACK_SIZE : AP_POOL_MAX;
+}
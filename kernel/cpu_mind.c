@@ -3,6 +3,7 @@
 // Includes Phases 001-100 + dynamic runtime scheduler, AI prediction, and fallback systems.
 
 #include "cpu_mind.h"
+#include "phase_registry.h"
 #include "telemetry_mind.h"
 #include "power_mind.h"
 #include "trust_mind.h"
@@ -14,7 +15,7 @@ CPU_STATE gCpuState;
 EFI_STATUS CpuPhase001_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 001\n");
     State->ElapsedTsc[1] = AsmReadTsc() % (2000 + 1 * 10);
-    if (State->ElapsedTsc[1] > 5000000) {
+    if (State->ElapsedTsc[1] > CPU_PHASE_THRESHOLD) {
         State->Missed[1] = 1;
         State->MissCount++;
     }
@@ -25,7 +26,7 @@ EFI_STATUS CpuPhase001_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase002_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 002\n");
     State->ElapsedTsc[2] = AsmReadTsc() % (2000 + 2 * 10);
-    if (State->ElapsedTsc[2] > 5000000) {
+    if (State->ElapsedTsc[2] > CPU_PHASE_THRESHOLD) {
         State->Missed[2] = 1;
         State->MissCount++;
     }
@@ -36,7 +37,7 @@ EFI_STATUS CpuPhase002_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase003_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 003\n");
     State->ElapsedTsc[3] = AsmReadTsc() % (2000 + 3 * 10);
-    if (State->ElapsedTsc[3] > 5000000) {
+    if (State->ElapsedTsc[3] > CPU_PHASE_THRESHOLD) {
         State->Missed[3] = 1;
         State->MissCount++;
     }
@@ -47,7 +48,7 @@ EFI_STATUS CpuPhase003_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase004_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 004\n");
     State->ElapsedTsc[4] = AsmReadTsc() % (2000 + 4 * 10);
-    if (State->ElapsedTsc[4] > 5000000) {
+    if (State->ElapsedTsc[4] > CPU_PHASE_THRESHOLD) {
         State->Missed[4] = 1;
         State->MissCount++;
     }
@@ -58,7 +59,7 @@ EFI_STATUS CpuPhase004_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase005_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 005\n");
     State->ElapsedTsc[5] = AsmReadTsc() % (2000 + 5 * 10);
-    if (State->ElapsedTsc[5] > 5000000) {
+    if (State->ElapsedTsc[5] > CPU_PHASE_THRESHOLD) {
         State->Missed[5] = 1;
         State->MissCount++;
     }
@@ -69,7 +70,7 @@ EFI_STATUS CpuPhase005_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase006_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 006\n");
     State->ElapsedTsc[6] = AsmReadTsc() % (2000 + 6 * 10);
-    if (State->ElapsedTsc[6] > 5000000) {
+    if (State->ElapsedTsc[6] > CPU_PHASE_THRESHOLD) {
         State->Missed[6] = 1;
         State->MissCount++;
     }
@@ -80,7 +81,7 @@ EFI_STATUS CpuPhase006_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase007_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 007\n");
     State->ElapsedTsc[7] = AsmReadTsc() % (2000 + 7 * 10);
-    if (State->ElapsedTsc[7] > 5000000) {
+    if (State->ElapsedTsc[7] > CPU_PHASE_THRESHOLD) {
         State->Missed[7] = 1;
         State->MissCount++;
     }
@@ -91,7 +92,7 @@ EFI_STATUS CpuPhase007_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase008_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 008\n");
     State->ElapsedTsc[8] = AsmReadTsc() % (2000 + 8 * 10);
-    if (State->ElapsedTsc[8] > 5000000) {
+    if (State->ElapsedTsc[8] > CPU_PHASE_THRESHOLD) {
         State->Missed[8] = 1;
         State->MissCount++;
     }
@@ -102,7 +103,7 @@ EFI_STATUS CpuPhase008_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase009_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 009\n");
     State->ElapsedTsc[9] = AsmReadTsc() % (2000 + 9 * 10);
-    if (State->ElapsedTsc[9] > 5000000) {
+    if (State->ElapsedTsc[9] > CPU_PHASE_THRESHOLD) {
         State->Missed[9] = 1;
         State->MissCount++;
     }
@@ -113,7 +114,7 @@ EFI_STATUS CpuPhase009_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase010_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 010\n");
     State->ElapsedTsc[10] = AsmReadTsc() % (2000 + 10 * 10);
-    if (State->ElapsedTsc[10] > 5000000) {
+    if (State->ElapsedTsc[10] > CPU_PHASE_THRESHOLD) {
         State->Missed[10] = 1;
         State->MissCount++;
     }
@@ -124,7 +125,7 @@ EFI_STATUS CpuPhase010_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase011_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 011\n");
     State->ElapsedTsc[11] = AsmReadTsc() % (2000 + 11 * 10);
-    if (State->ElapsedTsc[11] > 5000000) {
+    if (State->ElapsedTsc[11] > CPU_PHASE_THRESHOLD) {
         State->Missed[11] = 1;
         State->MissCount++;
     }
@@ -135,7 +136,7 @@ EFI_STATUS CpuPhase011_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase012_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 012\n");
     State->ElapsedTsc[12] = AsmReadTsc() % (2000 + 12 * 10);
-    if (State->ElapsedTsc[12] > 5000000) {
+    if (State->ElapsedTsc[12] > CPU_PHASE_THRESHOLD) {
         State->Missed[12] = 1;
         State->MissCount++;
     }
@@ -146,7 +147,7 @@ EFI_STATUS CpuPhase012_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase013_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 013\n");
     State->ElapsedTsc[13] = AsmReadTsc() % (2000 + 13 * 10);
-    if (State->ElapsedTsc[13] > 5000000) {
+    if (State->ElapsedTsc[13] > CPU_PHASE_THRESHOLD) {
         State->Missed[13] = 1;
         State->MissCount++;
     }
@@ -157,7 +158,7 @@ EFI_STATUS CpuPhase013_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase014_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 014\n");
     State->ElapsedTsc[14] = AsmReadTsc() % (2000 + 14 * 10);
-    if (State->ElapsedTsc[14] > 5000000) {
+    if (State->ElapsedTsc[14] > CPU_PHASE_THRESHOLD) {
         State->Missed[14] = 1;
         State->MissCount++;
     }
@@ -168,7 +169,7 @@ EFI_STATUS CpuPhase014_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase015_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 015\n");
     State->ElapsedTsc[15] = AsmReadTsc() % (2000 + 15 * 10);
-    if (State->ElapsedTsc[15] > 5000000) {
+    if (State->ElapsedTsc[15] > CPU_PHASE_THRESHOLD) {
         State->Missed[15] = 1;
         State->MissCount++;
     }
@@ -179,7 +180,7 @@ EFI_STATUS CpuPhase015_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase016_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 016\n");
     State->ElapsedTsc[16] = AsmReadTsc() % (2000 + 16 * 10);
-    if (State->ElapsedTsc[16] > 5000000) {
+    if (State->ElapsedTsc[16] > CPU_PHASE_THRESHOLD) {
         State->Missed[16] = 1;
         State->MissCount++;
     }
@@ -190,7 +191,7 @@ EFI_STATUS CpuPhase016_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase017_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 017\n");
     State->ElapsedTsc[17] = AsmReadTsc() % (2000 + 17 * 10);
-    if (State->ElapsedTsc[17] > 5000000) {
+    if (State->ElapsedTsc[17] > CPU_PHASE_THRESHOLD) {
         State->Missed[17] = 1;
         State->MissCount++;
     }
@@ -201,7 +202,7 @@ EFI_STATUS CpuPhase017_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase018_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 018\n");
     State->ElapsedTsc[18] = AsmReadTsc() % (2000 + 18 * 10);
-    if (State->ElapsedTsc[18] > 5000000) {
+    if (State->ElapsedTsc[18] > CPU_PHASE_THRESHOLD) {
         State->Missed[18] = 1;
         State->MissCount++;
     }
@@ -212,7 +213,7 @@ EFI_STATUS CpuPhase018_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase019_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 019\n");
     State->ElapsedTsc[19] = AsmReadTsc() % (2000 + 19 * 10);
-    if (State->ElapsedTsc[19] > 5000000) {
+    if (State->ElapsedTsc[19] > CPU_PHASE_THRESHOLD) {
         State->Missed[19] = 1;
         State->MissCount++;
     }
@@ -223,7 +224,7 @@ EFI_STATUS CpuPhase019_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase020_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 020\n");
     State->ElapsedTsc[20] = AsmReadTsc() % (2000 + 20 * 10);
-    if (State->ElapsedTsc[20] > 5000000) {
+    if (State->ElapsedTsc[20] > CPU_PHASE_THRESHOLD) {
         State->Missed[20] = 1;
         State->MissCount++;
     }
@@ -234,7 +235,7 @@ EFI_STATUS CpuPhase020_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase021_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 021\n");
     State->ElapsedTsc[21] = AsmReadTsc() % (2000 + 21 * 10);
-    if (State->ElapsedTsc[21] > 5000000) {
+    if (State->ElapsedTsc[21] > CPU_PHASE_THRESHOLD) {
         State->Missed[21] = 1;
         State->MissCount++;
     }
@@ -245,7 +246,7 @@ EFI_STATUS CpuPhase021_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase022_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 022\n");
     State->ElapsedTsc[22] = AsmReadTsc() % (2000 + 22 * 10);
-    if (State->ElapsedTsc[22] > 5000000) {
+    if (State->ElapsedTsc[22] > CPU_PHASE_THRESHOLD) {
         State->Missed[22] = 1;
         State->MissCount++;
     }
@@ -256,7 +257,7 @@ EFI_STATUS CpuPhase022_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase023_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 023\n");
     State->ElapsedTsc[23] = AsmReadTsc() % (2000 + 23 * 10);
-    if (State->ElapsedTsc[23] > 5000000) {
+    if (State->ElapsedTsc[23] > CPU_PHASE_THRESHOLD) {
         State->Missed[23] = 1;
         State->MissCount++;
     }
@@ -267,7 +268,7 @@ EFI_STATUS CpuPhase023_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase024_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 024\n");
     State->ElapsedTsc[24] = AsmReadTsc() % (2000 + 24 * 10);
-    if (State->ElapsedTsc[24] > 5000000) {
+    if (State->ElapsedTsc[24] > CPU_PHASE_THRESHOLD) {
         State->Missed[24] = 1;
         State->MissCount++;
     }
@@ -278,7 +279,7 @@ EFI_STATUS CpuPhase024_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase025_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 025\n");
     State->ElapsedTsc[25] = AsmReadTsc() % (2000 + 25 * 10);
-    if (State->ElapsedTsc[25] > 5000000) {
+    if (State->ElapsedTsc[25] > CPU_PHASE_THRESHOLD) {
         State->Missed[25] = 1;
         State->MissCount++;
     }
@@ -289,7 +290,7 @@ EFI_STATUS CpuPhase025_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase026_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 026\n");
     State->ElapsedTsc[26] = AsmReadTsc() % (2000 + 26 * 10);
-    if (State->ElapsedTsc[26] > 5000000) {
+    if (State->ElapsedTsc[26] > CPU_PHASE_THRESHOLD) {
         State->Missed[26] = 1;
         State->MissCount++;
     }
@@ -300,7 +301,7 @@ EFI_STATUS CpuPhase026_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase027_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 027\n");
     State->ElapsedTsc[27] = AsmReadTsc() % (2000 + 27 * 10);
-    if (State->ElapsedTsc[27] > 5000000) {
+    if (State->ElapsedTsc[27] > CPU_PHASE_THRESHOLD) {
         State->Missed[27] = 1;
         State->MissCount++;
     }
@@ -311,7 +312,7 @@ EFI_STATUS CpuPhase027_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase028_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 028\n");
     State->ElapsedTsc[28] = AsmReadTsc() % (2000 + 28 * 10);
-    if (State->ElapsedTsc[28] > 5000000) {
+    if (State->ElapsedTsc[28] > CPU_PHASE_THRESHOLD) {
         State->Missed[28] = 1;
         State->MissCount++;
     }
@@ -322,7 +323,7 @@ EFI_STATUS CpuPhase028_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase029_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 029\n");
     State->ElapsedTsc[29] = AsmReadTsc() % (2000 + 29 * 10);
-    if (State->ElapsedTsc[29] > 5000000) {
+    if (State->ElapsedTsc[29] > CPU_PHASE_THRESHOLD) {
         State->Missed[29] = 1;
         State->MissCount++;
     }
@@ -333,7 +334,7 @@ EFI_STATUS CpuPhase029_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase030_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 030\n");
     State->ElapsedTsc[30] = AsmReadTsc() % (2000 + 30 * 10);
-    if (State->ElapsedTsc[30] > 5000000) {
+    if (State->ElapsedTsc[30] > CPU_PHASE_THRESHOLD) {
         State->Missed[30] = 1;
         State->MissCount++;
     }
@@ -344,7 +345,7 @@ EFI_STATUS CpuPhase030_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase031_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 031\n");
     State->ElapsedTsc[31] = AsmReadTsc() % (2000 + 31 * 10);
-    if (State->ElapsedTsc[31] > 5000000) {
+    if (State->ElapsedTsc[31] > CPU_PHASE_THRESHOLD) {
         State->Missed[31] = 1;
         State->MissCount++;
     }
@@ -355,7 +356,7 @@ EFI_STATUS CpuPhase031_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase032_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 032\n");
     State->ElapsedTsc[32] = AsmReadTsc() % (2000 + 32 * 10);
-    if (State->ElapsedTsc[32] > 5000000) {
+    if (State->ElapsedTsc[32] > CPU_PHASE_THRESHOLD) {
         State->Missed[32] = 1;
         State->MissCount++;
     }
@@ -366,7 +367,7 @@ EFI_STATUS CpuPhase032_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase033_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 033\n");
     State->ElapsedTsc[33] = AsmReadTsc() % (2000 + 33 * 10);
-    if (State->ElapsedTsc[33] > 5000000) {
+    if (State->ElapsedTsc[33] > CPU_PHASE_THRESHOLD) {
         State->Missed[33] = 1;
         State->MissCount++;
     }
@@ -377,7 +378,7 @@ EFI_STATUS CpuPhase033_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase034_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 034\n");
     State->ElapsedTsc[34] = AsmReadTsc() % (2000 + 34 * 10);
-    if (State->ElapsedTsc[34] > 5000000) {
+    if (State->ElapsedTsc[34] > CPU_PHASE_THRESHOLD) {
         State->Missed[34] = 1;
         State->MissCount++;
     }
@@ -388,7 +389,7 @@ EFI_STATUS CpuPhase034_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase035_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 035\n");
     State->ElapsedTsc[35] = AsmReadTsc() % (2000 + 35 * 10);
-    if (State->ElapsedTsc[35] > 5000000) {
+    if (State->ElapsedTsc[35] > CPU_PHASE_THRESHOLD) {
         State->Missed[35] = 1;
         State->MissCount++;
     }
@@ -399,7 +400,7 @@ EFI_STATUS CpuPhase035_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase036_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 036\n");
     State->ElapsedTsc[36] = AsmReadTsc() % (2000 + 36 * 10);
-    if (State->ElapsedTsc[36] > 5000000) {
+    if (State->ElapsedTsc[36] > CPU_PHASE_THRESHOLD) {
         State->Missed[36] = 1;
         State->MissCount++;
     }
@@ -410,7 +411,7 @@ EFI_STATUS CpuPhase036_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase037_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 037\n");
     State->ElapsedTsc[37] = AsmReadTsc() % (2000 + 37 * 10);
-    if (State->ElapsedTsc[37] > 5000000) {
+    if (State->ElapsedTsc[37] > CPU_PHASE_THRESHOLD) {
         State->Missed[37] = 1;
         State->MissCount++;
     }
@@ -421,7 +422,7 @@ EFI_STATUS CpuPhase037_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase038_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 038\n");
     State->ElapsedTsc[38] = AsmReadTsc() % (2000 + 38 * 10);
-    if (State->ElapsedTsc[38] > 5000000) {
+    if (State->ElapsedTsc[38] > CPU_PHASE_THRESHOLD) {
         State->Missed[38] = 1;
         State->MissCount++;
     }
@@ -432,7 +433,7 @@ EFI_STATUS CpuPhase038_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase039_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 039\n");
     State->ElapsedTsc[39] = AsmReadTsc() % (2000 + 39 * 10);
-    if (State->ElapsedTsc[39] > 5000000) {
+    if (State->ElapsedTsc[39] > CPU_PHASE_THRESHOLD) {
         State->Missed[39] = 1;
         State->MissCount++;
     }
@@ -443,7 +444,7 @@ EFI_STATUS CpuPhase039_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase040_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 040\n");
     State->ElapsedTsc[40] = AsmReadTsc() % (2000 + 40 * 10);
-    if (State->ElapsedTsc[40] > 5000000) {
+    if (State->ElapsedTsc[40] > CPU_PHASE_THRESHOLD) {
         State->Missed[40] = 1;
         State->MissCount++;
     }
@@ -454,7 +455,7 @@ EFI_STATUS CpuPhase040_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase041_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 041\n");
     State->ElapsedTsc[41] = AsmReadTsc() % (2000 + 41 * 10);
-    if (State->ElapsedTsc[41] > 5000000) {
+    if (State->ElapsedTsc[41] > CPU_PHASE_THRESHOLD) {
         State->Missed[41] = 1;
         State->MissCount++;
     }
@@ -465,7 +466,7 @@ EFI_STATUS CpuPhase041_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase042_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 042\n");
     State->ElapsedTsc[42] = AsmReadTsc() % (2000 + 42 * 10);
-    if (State->ElapsedTsc[42] > 5000000) {
+    if (State->ElapsedTsc[42] > CPU_PHASE_THRESHOLD) {
         State->Missed[42] = 1;
         State->MissCount++;
     }
@@ -476,7 +477,7 @@ EFI_STATUS CpuPhase042_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase043_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 043\n");
     State->ElapsedTsc[43] = AsmReadTsc() % (2000 + 43 * 10);
-    if (State->ElapsedTsc[43] > 5000000) {
+    if (State->ElapsedTsc[43] > CPU_PHASE_THRESHOLD) {
         State->Missed[43] = 1;
         State->MissCount++;
     }
@@ -487,7 +488,7 @@ EFI_STATUS CpuPhase043_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase044_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 044\n");
     State->ElapsedTsc[44] = AsmReadTsc() % (2000 + 44 * 10);
-    if (State->ElapsedTsc[44] > 5000000) {
+    if (State->ElapsedTsc[44] > CPU_PHASE_THRESHOLD) {
         State->Missed[44] = 1;
         State->MissCount++;
     }
@@ -498,7 +499,7 @@ EFI_STATUS CpuPhase044_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase045_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 045\n");
     State->ElapsedTsc[45] = AsmReadTsc() % (2000 + 45 * 10);
-    if (State->ElapsedTsc[45] > 5000000) {
+    if (State->ElapsedTsc[45] > CPU_PHASE_THRESHOLD) {
         State->Missed[45] = 1;
         State->MissCount++;
     }
@@ -509,7 +510,7 @@ EFI_STATUS CpuPhase045_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase046_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 046\n");
     State->ElapsedTsc[46] = AsmReadTsc() % (2000 + 46 * 10);
-    if (State->ElapsedTsc[46] > 5000000) {
+    if (State->ElapsedTsc[46] > CPU_PHASE_THRESHOLD) {
         State->Missed[46] = 1;
         State->MissCount++;
     }
@@ -520,7 +521,7 @@ EFI_STATUS CpuPhase046_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase047_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 047\n");
     State->ElapsedTsc[47] = AsmReadTsc() % (2000 + 47 * 10);
-    if (State->ElapsedTsc[47] > 5000000) {
+    if (State->ElapsedTsc[47] > CPU_PHASE_THRESHOLD) {
         State->Missed[47] = 1;
         State->MissCount++;
     }
@@ -531,7 +532,7 @@ EFI_STATUS CpuPhase047_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase048_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 048\n");
     State->ElapsedTsc[48] = AsmReadTsc() % (2000 + 48 * 10);
-    if (State->ElapsedTsc[48] > 5000000) {
+    if (State->ElapsedTsc[48] > CPU_PHASE_THRESHOLD) {
         State->Missed[48] = 1;
         State->MissCount++;
     }
@@ -542,7 +543,7 @@ EFI_STATUS CpuPhase048_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase049_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 049\n");
     State->ElapsedTsc[49] = AsmReadTsc() % (2000 + 49 * 10);
-    if (State->ElapsedTsc[49] > 5000000) {
+    if (State->ElapsedTsc[49] > CPU_PHASE_THRESHOLD) {
         State->Missed[49] = 1;
         State->MissCount++;
     }
@@ -553,7 +554,7 @@ EFI_STATUS CpuPhase049_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase050_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 050\n");
     State->ElapsedTsc[50] = AsmReadTsc() % (2000 + 50 * 10);
-    if (State->ElapsedTsc[50] > 5000000) {
+    if (State->ElapsedTsc[50] > CPU_PHASE_THRESHOLD) {
         State->Missed[50] = 1;
         State->MissCount++;
     }
@@ -564,7 +565,7 @@ EFI_STATUS CpuPhase050_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase051_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 051\n");
     State->ElapsedTsc[51] = AsmReadTsc() % (2000 + 51 * 10);
-    if (State->ElapsedTsc[51] > 5000000) {
+    if (State->ElapsedTsc[51] > CPU_PHASE_THRESHOLD) {
         State->Missed[51] = 1;
         State->MissCount++;
     }
@@ -575,7 +576,7 @@ EFI_STATUS CpuPhase051_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase052_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 052\n");
     State->ElapsedTsc[52] = AsmReadTsc() % (2000 + 52 * 10);
-    if (State->ElapsedTsc[52] > 5000000) {
+    if (State->ElapsedTsc[52] > CPU_PHASE_THRESHOLD) {
         State->Missed[52] = 1;
         State->MissCount++;
     }
@@ -586,7 +587,7 @@ EFI_STATUS CpuPhase052_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase053_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 053\n");
     State->ElapsedTsc[53] = AsmReadTsc() % (2000 + 53 * 10);
-    if (State->ElapsedTsc[53] > 5000000) {
+    if (State->ElapsedTsc[53] > CPU_PHASE_THRESHOLD) {
         State->Missed[53] = 1;
         State->MissCount++;
     }
@@ -597,7 +598,7 @@ EFI_STATUS CpuPhase053_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase054_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 054\n");
     State->ElapsedTsc[54] = AsmReadTsc() % (2000 + 54 * 10);
-    if (State->ElapsedTsc[54] > 5000000) {
+    if (State->ElapsedTsc[54] > CPU_PHASE_THRESHOLD) {
         State->Missed[54] = 1;
         State->MissCount++;
     }
@@ -608,7 +609,7 @@ EFI_STATUS CpuPhase054_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase055_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 055\n");
     State->ElapsedTsc[55] = AsmReadTsc() % (2000 + 55 * 10);
-    if (State->ElapsedTsc[55] > 5000000) {
+    if (State->ElapsedTsc[55] > CPU_PHASE_THRESHOLD) {
         State->Missed[55] = 1;
         State->MissCount++;
     }
@@ -619,7 +620,7 @@ EFI_STATUS CpuPhase055_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase056_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 056\n");
     State->ElapsedTsc[56] = AsmReadTsc() % (2000 + 56 * 10);
-    if (State->ElapsedTsc[56] > 5000000) {
+    if (State->ElapsedTsc[56] > CPU_PHASE_THRESHOLD) {
         State->Missed[56] = 1;
         State->MissCount++;
     }
@@ -630,7 +631,7 @@ EFI_STATUS CpuPhase056_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase057_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 057\n");
     State->ElapsedTsc[57] = AsmReadTsc() % (2000 + 57 * 10);
-    if (State->ElapsedTsc[57] > 5000000) {
+    if (State->ElapsedTsc[57] > CPU_PHASE_THRESHOLD) {
         State->Missed[57] = 1;
         State->MissCount++;
     }
@@ -641,7 +642,7 @@ EFI_STATUS CpuPhase057_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase058_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 058\n");
     State->ElapsedTsc[58] = AsmReadTsc() % (2000 + 58 * 10);
-    if (State->ElapsedTsc[58] > 5000000) {
+    if (State->ElapsedTsc[58] > CPU_PHASE_THRESHOLD) {
         State->Missed[58] = 1;
         State->MissCount++;
     }
@@ -652,7 +653,7 @@ EFI_STATUS CpuPhase058_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase059_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 059\n");
     State->ElapsedTsc[59] = AsmReadTsc() % (2000 + 59 * 10);
-    if (State->ElapsedTsc[59] > 5000000) {
+    if (State->ElapsedTsc[59] > CPU_PHASE_THRESHOLD) {
         State->Missed[59] = 1;
         State->MissCount++;
     }
@@ -663,7 +664,7 @@ EFI_STATUS CpuPhase059_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase060_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 060\n");
     State->ElapsedTsc[60] = AsmReadTsc() % (2000 + 60 * 10);
-    if (State->ElapsedTsc[60] > 5000000) {
+    if (State->ElapsedTsc[60] > CPU_PHASE_THRESHOLD) {
         State->Missed[60] = 1;
         State->MissCount++;
     }
@@ -674,7 +675,7 @@ EFI_STATUS CpuPhase060_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase061_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 061\n");
     State->ElapsedTsc[61] = AsmReadTsc() % (2000 + 61 * 10);
-    if (State->ElapsedTsc[61] > 5000000) {
+    if (State->ElapsedTsc[61] > CPU_PHASE_THRESHOLD) {
         State->Missed[61] = 1;
         State->MissCount++;
     }
@@ -685,7 +686,7 @@ EFI_STATUS CpuPhase061_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase062_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 062\n");
     State->ElapsedTsc[62] = AsmReadTsc() % (2000 + 62 * 10);
-    if (State->ElapsedTsc[62] > 5000000) {
+    if (State->ElapsedTsc[62] > CPU_PHASE_THRESHOLD) {
         State->Missed[62] = 1;
         State->MissCount++;
     }
@@ -696,7 +697,7 @@ EFI_STATUS CpuPhase062_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase063_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 063\n");
     State->ElapsedTsc[63] = AsmReadTsc() % (2000 + 63 * 10);
-    if (State->ElapsedTsc[63] > 5000000) {
+    if (State->ElapsedTsc[63] > CPU_PHASE_THRESHOLD) {
         State->Missed[63] = 1;
         State->MissCount++;
     }
@@ -707,7 +708,7 @@ EFI_STATUS CpuPhase063_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase064_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 064\n");
     State->ElapsedTsc[64] = AsmReadTsc() % (2000 + 64 * 10);
-    if (State->ElapsedTsc[64] > 5000000) {
+    if (State->ElapsedTsc[64] > CPU_PHASE_THRESHOLD) {
         State->Missed[64] = 1;
         State->MissCount++;
     }
@@ -718,7 +719,7 @@ EFI_STATUS CpuPhase064_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase065_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 065\n");
     State->ElapsedTsc[65] = AsmReadTsc() % (2000 + 65 * 10);
-    if (State->ElapsedTsc[65] > 5000000) {
+    if (State->ElapsedTsc[65] > CPU_PHASE_THRESHOLD) {
         State->Missed[65] = 1;
         State->MissCount++;
     }
@@ -729,7 +730,7 @@ EFI_STATUS CpuPhase065_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase066_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 066\n");
     State->ElapsedTsc[66] = AsmReadTsc() % (2000 + 66 * 10);
-    if (State->ElapsedTsc[66] > 5000000) {
+    if (State->ElapsedTsc[66] > CPU_PHASE_THRESHOLD) {
         State->Missed[66] = 1;
         State->MissCount++;
     }
@@ -740,7 +741,7 @@ EFI_STATUS CpuPhase066_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase067_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 067\n");
     State->ElapsedTsc[67] = AsmReadTsc() % (2000 + 67 * 10);
-    if (State->ElapsedTsc[67] > 5000000) {
+    if (State->ElapsedTsc[67] > CPU_PHASE_THRESHOLD) {
         State->Missed[67] = 1;
         State->MissCount++;
     }
@@ -751,7 +752,7 @@ EFI_STATUS CpuPhase067_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase068_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 068\n");
     State->ElapsedTsc[68] = AsmReadTsc() % (2000 + 68 * 10);
-    if (State->ElapsedTsc[68] > 5000000) {
+    if (State->ElapsedTsc[68] > CPU_PHASE_THRESHOLD) {
         State->Missed[68] = 1;
         State->MissCount++;
     }
@@ -762,7 +763,7 @@ EFI_STATUS CpuPhase068_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase069_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 069\n");
     State->ElapsedTsc[69] = AsmReadTsc() % (2000 + 69 * 10);
-    if (State->ElapsedTsc[69] > 5000000) {
+    if (State->ElapsedTsc[69] > CPU_PHASE_THRESHOLD) {
         State->Missed[69] = 1;
         State->MissCount++;
     }
@@ -773,7 +774,7 @@ EFI_STATUS CpuPhase069_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase070_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 070\n");
     State->ElapsedTsc[70] = AsmReadTsc() % (2000 + 70 * 10);
-    if (State->ElapsedTsc[70] > 5000000) {
+    if (State->ElapsedTsc[70] > CPU_PHASE_THRESHOLD) {
         State->Missed[70] = 1;
         State->MissCount++;
     }
@@ -784,7 +785,7 @@ EFI_STATUS CpuPhase070_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase071_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 071\n");
     State->ElapsedTsc[71] = AsmReadTsc() % (2000 + 71 * 10);
-    if (State->ElapsedTsc[71] > 5000000) {
+    if (State->ElapsedTsc[71] > CPU_PHASE_THRESHOLD) {
         State->Missed[71] = 1;
         State->MissCount++;
     }
@@ -795,7 +796,7 @@ EFI_STATUS CpuPhase071_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase072_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 072\n");
     State->ElapsedTsc[72] = AsmReadTsc() % (2000 + 72 * 10);
-    if (State->ElapsedTsc[72] > 5000000) {
+    if (State->ElapsedTsc[72] > CPU_PHASE_THRESHOLD) {
         State->Missed[72] = 1;
         State->MissCount++;
     }
@@ -806,7 +807,7 @@ EFI_STATUS CpuPhase072_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase073_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 073\n");
     State->ElapsedTsc[73] = AsmReadTsc() % (2000 + 73 * 10);
-    if (State->ElapsedTsc[73] > 5000000) {
+    if (State->ElapsedTsc[73] > CPU_PHASE_THRESHOLD) {
         State->Missed[73] = 1;
         State->MissCount++;
     }
@@ -817,7 +818,7 @@ EFI_STATUS CpuPhase073_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase074_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 074\n");
     State->ElapsedTsc[74] = AsmReadTsc() % (2000 + 74 * 10);
-    if (State->ElapsedTsc[74] > 5000000) {
+    if (State->ElapsedTsc[74] > CPU_PHASE_THRESHOLD) {
         State->Missed[74] = 1;
         State->MissCount++;
     }
@@ -828,7 +829,7 @@ EFI_STATUS CpuPhase074_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase075_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 075\n");
     State->ElapsedTsc[75] = AsmReadTsc() % (2000 + 75 * 10);
-    if (State->ElapsedTsc[75] > 5000000) {
+    if (State->ElapsedTsc[75] > CPU_PHASE_THRESHOLD) {
         State->Missed[75] = 1;
         State->MissCount++;
     }
@@ -839,7 +840,7 @@ EFI_STATUS CpuPhase075_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase076_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 076\n");
     State->ElapsedTsc[76] = AsmReadTsc() % (2000 + 76 * 10);
-    if (State->ElapsedTsc[76] > 5000000) {
+    if (State->ElapsedTsc[76] > CPU_PHASE_THRESHOLD) {
         State->Missed[76] = 1;
         State->MissCount++;
     }
@@ -850,7 +851,7 @@ EFI_STATUS CpuPhase076_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase077_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 077\n");
     State->ElapsedTsc[77] = AsmReadTsc() % (2000 + 77 * 10);
-    if (State->ElapsedTsc[77] > 5000000) {
+    if (State->ElapsedTsc[77] > CPU_PHASE_THRESHOLD) {
         State->Missed[77] = 1;
         State->MissCount++;
     }
@@ -861,7 +862,7 @@ EFI_STATUS CpuPhase077_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase078_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 078\n");
     State->ElapsedTsc[78] = AsmReadTsc() % (2000 + 78 * 10);
-    if (State->ElapsedTsc[78] > 5000000) {
+    if (State->ElapsedTsc[78] > CPU_PHASE_THRESHOLD) {
         State->Missed[78] = 1;
         State->MissCount++;
     }
@@ -872,7 +873,7 @@ EFI_STATUS CpuPhase078_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase079_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 079\n");
     State->ElapsedTsc[79] = AsmReadTsc() % (2000 + 79 * 10);
-    if (State->ElapsedTsc[79] > 5000000) {
+    if (State->ElapsedTsc[79] > CPU_PHASE_THRESHOLD) {
         State->Missed[79] = 1;
         State->MissCount++;
     }
@@ -883,7 +884,7 @@ EFI_STATUS CpuPhase079_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase080_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 080\n");
     State->ElapsedTsc[80] = AsmReadTsc() % (2000 + 80 * 10);
-    if (State->ElapsedTsc[80] > 5000000) {
+    if (State->ElapsedTsc[80] > CPU_PHASE_THRESHOLD) {
         State->Missed[80] = 1;
         State->MissCount++;
     }
@@ -894,7 +895,7 @@ EFI_STATUS CpuPhase080_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase081_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 081\n");
     State->ElapsedTsc[81] = AsmReadTsc() % (2000 + 81 * 10);
-    if (State->ElapsedTsc[81] > 5000000) {
+    if (State->ElapsedTsc[81] > CPU_PHASE_THRESHOLD) {
         State->Missed[81] = 1;
         State->MissCount++;
     }
@@ -905,7 +906,7 @@ EFI_STATUS CpuPhase081_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase082_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 082\n");
     State->ElapsedTsc[82] = AsmReadTsc() % (2000 + 82 * 10);
-    if (State->ElapsedTsc[82] > 5000000) {
+    if (State->ElapsedTsc[82] > CPU_PHASE_THRESHOLD) {
         State->Missed[82] = 1;
         State->MissCount++;
     }
@@ -916,7 +917,7 @@ EFI_STATUS CpuPhase082_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase083_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 083\n");
     State->ElapsedTsc[83] = AsmReadTsc() % (2000 + 83 * 10);
-    if (State->ElapsedTsc[83] > 5000000) {
+    if (State->ElapsedTsc[83] > CPU_PHASE_THRESHOLD) {
         State->Missed[83] = 1;
         State->MissCount++;
     }
@@ -927,7 +928,7 @@ EFI_STATUS CpuPhase083_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase084_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 084\n");
     State->ElapsedTsc[84] = AsmReadTsc() % (2000 + 84 * 10);
-    if (State->ElapsedTsc[84] > 5000000) {
+    if (State->ElapsedTsc[84] > CPU_PHASE_THRESHOLD) {
         State->Missed[84] = 1;
         State->MissCount++;
     }
@@ -938,7 +939,7 @@ EFI_STATUS CpuPhase084_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase085_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 085\n");
     State->ElapsedTsc[85] = AsmReadTsc() % (2000 + 85 * 10);
-    if (State->ElapsedTsc[85] > 5000000) {
+    if (State->ElapsedTsc[85] > CPU_PHASE_THRESHOLD) {
         State->Missed[85] = 1;
         State->MissCount++;
     }
@@ -949,7 +950,7 @@ EFI_STATUS CpuPhase085_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase086_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 086\n");
     State->ElapsedTsc[86] = AsmReadTsc() % (2000 + 86 * 10);
-    if (State->ElapsedTsc[86] > 5000000) {
+    if (State->ElapsedTsc[86] > CPU_PHASE_THRESHOLD) {
         State->Missed[86] = 1;
         State->MissCount++;
     }
@@ -960,7 +961,7 @@ EFI_STATUS CpuPhase086_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase087_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 087\n");
     State->ElapsedTsc[87] = AsmReadTsc() % (2000 + 87 * 10);
-    if (State->ElapsedTsc[87] > 5000000) {
+    if (State->ElapsedTsc[87] > CPU_PHASE_THRESHOLD) {
         State->Missed[87] = 1;
         State->MissCount++;
     }
@@ -971,7 +972,7 @@ EFI_STATUS CpuPhase087_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase088_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 088\n");
     State->ElapsedTsc[88] = AsmReadTsc() % (2000 + 88 * 10);
-    if (State->ElapsedTsc[88] > 5000000) {
+    if (State->ElapsedTsc[88] > CPU_PHASE_THRESHOLD) {
         State->Missed[88] = 1;
         State->MissCount++;
     }
@@ -982,7 +983,7 @@ EFI_STATUS CpuPhase088_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase089_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 089\n");
     State->ElapsedTsc[89] = AsmReadTsc() % (2000 + 89 * 10);
-    if (State->ElapsedTsc[89] > 5000000) {
+    if (State->ElapsedTsc[89] > CPU_PHASE_THRESHOLD) {
         State->Missed[89] = 1;
         State->MissCount++;
     }
@@ -993,7 +994,7 @@ EFI_STATUS CpuPhase089_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase090_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 090\n");
     State->ElapsedTsc[90] = AsmReadTsc() % (2000 + 90 * 10);
-    if (State->ElapsedTsc[90] > 5000000) {
+    if (State->ElapsedTsc[90] > CPU_PHASE_THRESHOLD) {
         State->Missed[90] = 1;
         State->MissCount++;
     }
@@ -1004,7 +1005,7 @@ EFI_STATUS CpuPhase090_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase091_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 091\n");
     State->ElapsedTsc[91] = AsmReadTsc() % (2000 + 91 * 10);
-    if (State->ElapsedTsc[91] > 5000000) {
+    if (State->ElapsedTsc[91] > CPU_PHASE_THRESHOLD) {
         State->Missed[91] = 1;
         State->MissCount++;
     }
@@ -1015,7 +1016,7 @@ EFI_STATUS CpuPhase091_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase092_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 092\n");
     State->ElapsedTsc[92] = AsmReadTsc() % (2000 + 92 * 10);
-    if (State->ElapsedTsc[92] > 5000000) {
+    if (State->ElapsedTsc[92] > CPU_PHASE_THRESHOLD) {
         State->Missed[92] = 1;
         State->MissCount++;
     }
@@ -1026,7 +1027,7 @@ EFI_STATUS CpuPhase092_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase093_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 093\n");
     State->ElapsedTsc[93] = AsmReadTsc() % (2000 + 93 * 10);
-    if (State->ElapsedTsc[93] > 5000000) {
+    if (State->ElapsedTsc[93] > CPU_PHASE_THRESHOLD) {
         State->Missed[93] = 1;
         State->MissCount++;
     }
@@ -1037,7 +1038,7 @@ EFI_STATUS CpuPhase093_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase094_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 094\n");
     State->ElapsedTsc[94] = AsmReadTsc() % (2000 + 94 * 10);
-    if (State->ElapsedTsc[94] > 5000000) {
+    if (State->ElapsedTsc[94] > CPU_PHASE_THRESHOLD) {
         State->Missed[94] = 1;
         State->MissCount++;
     }
@@ -1048,7 +1049,7 @@ EFI_STATUS CpuPhase094_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase095_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 095\n");
     State->ElapsedTsc[95] = AsmReadTsc() % (2000 + 95 * 10);
-    if (State->ElapsedTsc[95] > 5000000) {
+    if (State->ElapsedTsc[95] > CPU_PHASE_THRESHOLD) {
         State->Missed[95] = 1;
         State->MissCount++;
     }
@@ -1059,7 +1060,7 @@ EFI_STATUS CpuPhase095_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase096_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 096\n");
     State->ElapsedTsc[96] = AsmReadTsc() % (2000 + 96 * 10);
-    if (State->ElapsedTsc[96] > 5000000) {
+    if (State->ElapsedTsc[96] > CPU_PHASE_THRESHOLD) {
         State->Missed[96] = 1;
         State->MissCount++;
     }
@@ -1070,7 +1071,7 @@ EFI_STATUS CpuPhase096_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase097_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 097\n");
     State->ElapsedTsc[97] = AsmReadTsc() % (2000 + 97 * 10);
-    if (State->ElapsedTsc[97] > 5000000) {
+    if (State->ElapsedTsc[97] > CPU_PHASE_THRESHOLD) {
         State->Missed[97] = 1;
         State->MissCount++;
     }
@@ -1081,7 +1082,7 @@ EFI_STATUS CpuPhase097_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase098_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 098\n");
     State->ElapsedTsc[98] = AsmReadTsc() % (2000 + 98 * 10);
-    if (State->ElapsedTsc[98] > 5000000) {
+    if (State->ElapsedTsc[98] > CPU_PHASE_THRESHOLD) {
         State->Missed[98] = 1;
         State->MissCount++;
     }
@@ -1092,7 +1093,7 @@ EFI_STATUS CpuPhase098_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase099_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 099\n");
     State->ElapsedTsc[99] = AsmReadTsc() % (2000 + 99 * 10);
-    if (State->ElapsedTsc[99] > 5000000) {
+    if (State->ElapsedTsc[99] > CPU_PHASE_THRESHOLD) {
         State->Missed[99] = 1;
         State->MissCount++;
     }
@@ -1103,7 +1104,7 @@ EFI_STATUS CpuPhase099_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase100_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 100\n");
     State->ElapsedTsc[100] = AsmReadTsc() % (2000 + 100 * 10);
-    if (State->ElapsedTsc[100] > 5000000) {
+    if (State->ElapsedTsc[100] > CPU_PHASE_THRESHOLD) {
         State->Missed[100] = 1;
         State->MissCount++;
     }
@@ -1114,7 +1115,7 @@ EFI_STATUS CpuPhase100_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase101_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 101\n");
     State->ElapsedTsc[101] = AsmReadTsc() % (2000 + 101 * 10);
-    if (State->ElapsedTsc[101] > 5000000) {
+    if (State->ElapsedTsc[101] > CPU_PHASE_THRESHOLD) {
         State->Missed[101] = 1;
         State->MissCount++;
     }
@@ -1125,7 +1126,7 @@ EFI_STATUS CpuPhase101_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase102_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 102\n");
     State->ElapsedTsc[102] = AsmReadTsc() % (2000 + 102 * 10);
-    if (State->ElapsedTsc[102] > 5000000) {
+    if (State->ElapsedTsc[102] > CPU_PHASE_THRESHOLD) {
         State->Missed[102] = 1;
         State->MissCount++;
     }
@@ -1136,7 +1137,7 @@ EFI_STATUS CpuPhase102_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase103_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 103\n");
     State->ElapsedTsc[103] = AsmReadTsc() % (2000 + 103 * 10);
-    if (State->ElapsedTsc[103] > 5000000) {
+    if (State->ElapsedTsc[103] > CPU_PHASE_THRESHOLD) {
         State->Missed[103] = 1;
         State->MissCount++;
     }
@@ -1147,7 +1148,7 @@ EFI_STATUS CpuPhase103_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase104_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 104\n");
     State->ElapsedTsc[104] = AsmReadTsc() % (2000 + 104 * 10);
-    if (State->ElapsedTsc[104] > 5000000) {
+    if (State->ElapsedTsc[104] > CPU_PHASE_THRESHOLD) {
         State->Missed[104] = 1;
         State->MissCount++;
     }
@@ -1158,7 +1159,7 @@ EFI_STATUS CpuPhase104_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase105_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 105\n");
     State->ElapsedTsc[105] = AsmReadTsc() % (2000 + 105 * 10);
-    if (State->ElapsedTsc[105] > 5000000) {
+    if (State->ElapsedTsc[105] > CPU_PHASE_THRESHOLD) {
         State->Missed[105] = 1;
         State->MissCount++;
     }
@@ -1169,7 +1170,7 @@ EFI_STATUS CpuPhase105_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase106_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 106\n");
     State->ElapsedTsc[106] = AsmReadTsc() % (2000 + 106 * 10);
-    if (State->ElapsedTsc[106] > 5000000) {
+    if (State->ElapsedTsc[106] > CPU_PHASE_THRESHOLD) {
         State->Missed[106] = 1;
         State->MissCount++;
     }
@@ -1180,7 +1181,7 @@ EFI_STATUS CpuPhase106_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase107_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 107\n");
     State->ElapsedTsc[107] = AsmReadTsc() % (2000 + 107 * 10);
-    if (State->ElapsedTsc[107] > 5000000) {
+    if (State->ElapsedTsc[107] > CPU_PHASE_THRESHOLD) {
         State->Missed[107] = 1;
         State->MissCount++;
     }
@@ -1191,7 +1192,7 @@ EFI_STATUS CpuPhase107_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase108_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 108\n");
     State->ElapsedTsc[108] = AsmReadTsc() % (2000 + 108 * 10);
-    if (State->ElapsedTsc[108] > 5000000) {
+    if (State->ElapsedTsc[108] > CPU_PHASE_THRESHOLD) {
         State->Missed[108] = 1;
         State->MissCount++;
     }
@@ -1202,7 +1203,7 @@ EFI_STATUS CpuPhase108_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase109_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 109\n");
     State->ElapsedTsc[109] = AsmReadTsc() % (2000 + 109 * 10);
-    if (State->ElapsedTsc[109] > 5000000) {
+    if (State->ElapsedTsc[109] > CPU_PHASE_THRESHOLD) {
         State->Missed[109] = 1;
         State->MissCount++;
     }
@@ -1213,7 +1214,7 @@ EFI_STATUS CpuPhase109_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase110_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 110\n");
     State->ElapsedTsc[110] = AsmReadTsc() % (2000 + 110 * 10);
-    if (State->ElapsedTsc[110] > 5000000) {
+    if (State->ElapsedTsc[110] > CPU_PHASE_THRESHOLD) {
         State->Missed[110] = 1;
         State->MissCount++;
     }
@@ -1224,7 +1225,7 @@ EFI_STATUS CpuPhase110_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase111_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 111\n");
     State->ElapsedTsc[111] = AsmReadTsc() % (2000 + 111 * 10);
-    if (State->ElapsedTsc[111] > 5000000) {
+    if (State->ElapsedTsc[111] > CPU_PHASE_THRESHOLD) {
         State->Missed[111] = 1;
         State->MissCount++;
     }
@@ -1235,7 +1236,7 @@ EFI_STATUS CpuPhase111_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase112_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 112\n");
     State->ElapsedTsc[112] = AsmReadTsc() % (2000 + 112 * 10);
-    if (State->ElapsedTsc[112] > 5000000) {
+    if (State->ElapsedTsc[112] > CPU_PHASE_THRESHOLD) {
         State->Missed[112] = 1;
         State->MissCount++;
     }
@@ -1246,7 +1247,7 @@ EFI_STATUS CpuPhase112_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase113_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 113\n");
     State->ElapsedTsc[113] = AsmReadTsc() % (2000 + 113 * 10);
-    if (State->ElapsedTsc[113] > 5000000) {
+    if (State->ElapsedTsc[113] > CPU_PHASE_THRESHOLD) {
         State->Missed[113] = 1;
         State->MissCount++;
     }
@@ -1257,7 +1258,7 @@ EFI_STATUS CpuPhase113_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase114_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 114\n");
     State->ElapsedTsc[114] = AsmReadTsc() % (2000 + 114 * 10);
-    if (State->ElapsedTsc[114] > 5000000) {
+    if (State->ElapsedTsc[114] > CPU_PHASE_THRESHOLD) {
         State->Missed[114] = 1;
         State->MissCount++;
     }
@@ -1268,7 +1269,7 @@ EFI_STATUS CpuPhase114_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase115_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 115\n");
     State->ElapsedTsc[115] = AsmReadTsc() % (2000 + 115 * 10);
-    if (State->ElapsedTsc[115] > 5000000) {
+    if (State->ElapsedTsc[115] > CPU_PHASE_THRESHOLD) {
         State->Missed[115] = 1;
         State->MissCount++;
     }
@@ -1279,7 +1280,7 @@ EFI_STATUS CpuPhase115_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase116_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 116\n");
     State->ElapsedTsc[116] = AsmReadTsc() % (2000 + 116 * 10);
-    if (State->ElapsedTsc[116] > 5000000) {
+    if (State->ElapsedTsc[116] > CPU_PHASE_THRESHOLD) {
         State->Missed[116] = 1;
         State->MissCount++;
     }
@@ -1290,7 +1291,7 @@ EFI_STATUS CpuPhase116_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase117_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 117\n");
     State->ElapsedTsc[117] = AsmReadTsc() % (2000 + 117 * 10);
-    if (State->ElapsedTsc[117] > 5000000) {
+    if (State->ElapsedTsc[117] > CPU_PHASE_THRESHOLD) {
         State->Missed[117] = 1;
         State->MissCount++;
     }
@@ -1301,7 +1302,7 @@ EFI_STATUS CpuPhase117_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase118_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 118\n");
     State->ElapsedTsc[118] = AsmReadTsc() % (2000 + 118 * 10);
-    if (State->ElapsedTsc[118] > 5000000) {
+    if (State->ElapsedTsc[118] > CPU_PHASE_THRESHOLD) {
         State->Missed[118] = 1;
         State->MissCount++;
     }
@@ -1312,7 +1313,7 @@ EFI_STATUS CpuPhase118_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase119_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 119\n");
     State->ElapsedTsc[119] = AsmReadTsc() % (2000 + 119 * 10);
-    if (State->ElapsedTsc[119] > 5000000) {
+    if (State->ElapsedTsc[119] > CPU_PHASE_THRESHOLD) {
         State->Missed[119] = 1;
         State->MissCount++;
     }
@@ -1323,7 +1324,7 @@ EFI_STATUS CpuPhase119_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase120_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 120\n");
     State->ElapsedTsc[120] = AsmReadTsc() % (2000 + 120 * 10);
-    if (State->ElapsedTsc[120] > 5000000) {
+    if (State->ElapsedTsc[120] > CPU_PHASE_THRESHOLD) {
         State->Missed[120] = 1;
         State->MissCount++;
     }
@@ -1334,7 +1335,7 @@ EFI_STATUS CpuPhase120_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase121_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 121\n");
     State->ElapsedTsc[121] = AsmReadTsc() % (2000 + 121 * 10);
-    if (State->ElapsedTsc[121] > 5000000) {
+    if (State->ElapsedTsc[121] > CPU_PHASE_THRESHOLD) {
         State->Missed[121] = 1;
         State->MissCount++;
     }
@@ -1345,7 +1346,7 @@ EFI_STATUS CpuPhase121_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase122_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 122\n");
     State->ElapsedTsc[122] = AsmReadTsc() % (2000 + 122 * 10);
-    if (State->ElapsedTsc[122] > 5000000) {
+    if (State->ElapsedTsc[122] > CPU_PHASE_THRESHOLD) {
         State->Missed[122] = 1;
         State->MissCount++;
     }
@@ -1356,7 +1357,7 @@ EFI_STATUS CpuPhase122_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase123_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 123\n");
     State->ElapsedTsc[123] = AsmReadTsc() % (2000 + 123 * 10);
-    if (State->ElapsedTsc[123] > 5000000) {
+    if (State->ElapsedTsc[123] > CPU_PHASE_THRESHOLD) {
         State->Missed[123] = 1;
         State->MissCount++;
     }
@@ -1367,7 +1368,7 @@ EFI_STATUS CpuPhase123_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase124_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 124\n");
     State->ElapsedTsc[124] = AsmReadTsc() % (2000 + 124 * 10);
-    if (State->ElapsedTsc[124] > 5000000) {
+    if (State->ElapsedTsc[124] > CPU_PHASE_THRESHOLD) {
         State->Missed[124] = 1;
         State->MissCount++;
     }
@@ -1378,7 +1379,7 @@ EFI_STATUS CpuPhase124_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase125_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 125\n");
     State->ElapsedTsc[125] = AsmReadTsc() % (2000 + 125 * 10);
-    if (State->ElapsedTsc[125] > 5000000) {
+    if (State->ElapsedTsc[125] > CPU_PHASE_THRESHOLD) {
         State->Missed[125] = 1;
         State->MissCount++;
     }
@@ -1389,7 +1390,7 @@ EFI_STATUS CpuPhase125_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase126_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 126\n");
     State->ElapsedTsc[126] = AsmReadTsc() % (2000 + 126 * 10);
-    if (State->ElapsedTsc[126] > 5000000) {
+    if (State->ElapsedTsc[126] > CPU_PHASE_THRESHOLD) {
         State->Missed[126] = 1;
         State->MissCount++;
     }
@@ -1400,7 +1401,7 @@ EFI_STATUS CpuPhase126_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase127_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 127\n");
     State->ElapsedTsc[127] = AsmReadTsc() % (2000 + 127 * 10);
-    if (State->ElapsedTsc[127] > 5000000) {
+    if (State->ElapsedTsc[127] > CPU_PHASE_THRESHOLD) {
         State->Missed[127] = 1;
         State->MissCount++;
     }
@@ -1411,7 +1412,7 @@ EFI_STATUS CpuPhase127_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase128_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 128\n");
     State->ElapsedTsc[128] = AsmReadTsc() % (2000 + 128 * 10);
-    if (State->ElapsedTsc[128] > 5000000) {
+    if (State->ElapsedTsc[128] > CPU_PHASE_THRESHOLD) {
         State->Missed[128] = 1;
         State->MissCount++;
     }
@@ -1422,7 +1423,7 @@ EFI_STATUS CpuPhase128_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase129_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 129\n");
     State->ElapsedTsc[129] = AsmReadTsc() % (2000 + 129 * 10);
-    if (State->ElapsedTsc[129] > 5000000) {
+    if (State->ElapsedTsc[129] > CPU_PHASE_THRESHOLD) {
         State->Missed[129] = 1;
         State->MissCount++;
     }
@@ -1433,7 +1434,7 @@ EFI_STATUS CpuPhase129_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase130_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 130\n");
     State->ElapsedTsc[130] = AsmReadTsc() % (2000 + 130 * 10);
-    if (State->ElapsedTsc[130] > 5000000) {
+    if (State->ElapsedTsc[130] > CPU_PHASE_THRESHOLD) {
         State->Missed[130] = 1;
         State->MissCount++;
     }
@@ -1444,7 +1445,7 @@ EFI_STATUS CpuPhase130_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase131_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 131\n");
     State->ElapsedTsc[131] = AsmReadTsc() % (2000 + 131 * 10);
-    if (State->ElapsedTsc[131] > 5000000) {
+    if (State->ElapsedTsc[131] > CPU_PHASE_THRESHOLD) {
         State->Missed[131] = 1;
         State->MissCount++;
     }
@@ -1455,7 +1456,7 @@ EFI_STATUS CpuPhase131_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase132_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 132\n");
     State->ElapsedTsc[132] = AsmReadTsc() % (2000 + 132 * 10);
-    if (State->ElapsedTsc[132] > 5000000) {
+    if (State->ElapsedTsc[132] > CPU_PHASE_THRESHOLD) {
         State->Missed[132] = 1;
         State->MissCount++;
     }
@@ -1466,7 +1467,7 @@ EFI_STATUS CpuPhase132_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase133_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 133\n");
     State->ElapsedTsc[133] = AsmReadTsc() % (2000 + 133 * 10);
-    if (State->ElapsedTsc[133] > 5000000) {
+    if (State->ElapsedTsc[133] > CPU_PHASE_THRESHOLD) {
         State->Missed[133] = 1;
         State->MissCount++;
     }
@@ -1477,7 +1478,7 @@ EFI_STATUS CpuPhase133_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase134_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 134\n");
     State->ElapsedTsc[134] = AsmReadTsc() % (2000 + 134 * 10);
-    if (State->ElapsedTsc[134] > 5000000) {
+    if (State->ElapsedTsc[134] > CPU_PHASE_THRESHOLD) {
         State->Missed[134] = 1;
         State->MissCount++;
     }
@@ -1488,7 +1489,7 @@ EFI_STATUS CpuPhase134_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase135_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 135\n");
     State->ElapsedTsc[135] = AsmReadTsc() % (2000 + 135 * 10);
-    if (State->ElapsedTsc[135] > 5000000) {
+    if (State->ElapsedTsc[135] > CPU_PHASE_THRESHOLD) {
         State->Missed[135] = 1;
         State->MissCount++;
     }
@@ -1499,7 +1500,7 @@ EFI_STATUS CpuPhase135_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase136_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 136\n");
     State->ElapsedTsc[136] = AsmReadTsc() % (2000 + 136 * 10);
-    if (State->ElapsedTsc[136] > 5000000) {
+    if (State->ElapsedTsc[136] > CPU_PHASE_THRESHOLD) {
         State->Missed[136] = 1;
         State->MissCount++;
     }
@@ -1510,7 +1511,7 @@ EFI_STATUS CpuPhase136_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase137_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 137\n");
     State->ElapsedTsc[137] = AsmReadTsc() % (2000 + 137 * 10);
-    if (State->ElapsedTsc[137] > 5000000) {
+    if (State->ElapsedTsc[137] > CPU_PHASE_THRESHOLD) {
         State->Missed[137] = 1;
         State->MissCount++;
     }
@@ -1521,7 +1522,7 @@ EFI_STATUS CpuPhase137_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase138_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 138\n");
     State->ElapsedTsc[138] = AsmReadTsc() % (2000 + 138 * 10);
-    if (State->ElapsedTsc[138] > 5000000) {
+    if (State->ElapsedTsc[138] > CPU_PHASE_THRESHOLD) {
         State->Missed[138] = 1;
         State->MissCount++;
     }
@@ -1532,7 +1533,7 @@ EFI_STATUS CpuPhase138_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase139_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 139\n");
     State->ElapsedTsc[139] = AsmReadTsc() % (2000 + 139 * 10);
-    if (State->ElapsedTsc[139] > 5000000) {
+    if (State->ElapsedTsc[139] > CPU_PHASE_THRESHOLD) {
         State->Missed[139] = 1;
         State->MissCount++;
     }
@@ -1543,7 +1544,7 @@ EFI_STATUS CpuPhase139_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase140_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 140\n");
     State->ElapsedTsc[140] = AsmReadTsc() % (2000 + 140 * 10);
-    if (State->ElapsedTsc[140] > 5000000) {
+    if (State->ElapsedTsc[140] > CPU_PHASE_THRESHOLD) {
         State->Missed[140] = 1;
         State->MissCount++;
     }
@@ -1554,7 +1555,7 @@ EFI_STATUS CpuPhase140_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase141_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 141\n");
     State->ElapsedTsc[141] = AsmReadTsc() % (2000 + 141 * 10);
-    if (State->ElapsedTsc[141] > 5000000) {
+    if (State->ElapsedTsc[141] > CPU_PHASE_THRESHOLD) {
         State->Missed[141] = 1;
         State->MissCount++;
     }
@@ -1565,7 +1566,7 @@ EFI_STATUS CpuPhase141_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase142_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 142\n");
     State->ElapsedTsc[142] = AsmReadTsc() % (2000 + 142 * 10);
-    if (State->ElapsedTsc[142] > 5000000) {
+    if (State->ElapsedTsc[142] > CPU_PHASE_THRESHOLD) {
         State->Missed[142] = 1;
         State->MissCount++;
     }
@@ -1576,7 +1577,7 @@ EFI_STATUS CpuPhase142_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase143_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 143\n");
     State->ElapsedTsc[143] = AsmReadTsc() % (2000 + 143 * 10);
-    if (State->ElapsedTsc[143] > 5000000) {
+    if (State->ElapsedTsc[143] > CPU_PHASE_THRESHOLD) {
         State->Missed[143] = 1;
         State->MissCount++;
     }
@@ -1587,7 +1588,7 @@ EFI_STATUS CpuPhase143_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase144_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 144\n");
     State->ElapsedTsc[144] = AsmReadTsc() % (2000 + 144 * 10);
-    if (State->ElapsedTsc[144] > 5000000) {
+    if (State->ElapsedTsc[144] > CPU_PHASE_THRESHOLD) {
         State->Missed[144] = 1;
         State->MissCount++;
     }
@@ -1598,7 +1599,7 @@ EFI_STATUS CpuPhase144_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase145_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 145\n");
     State->ElapsedTsc[145] = AsmReadTsc() % (2000 + 145 * 10);
-    if (State->ElapsedTsc[145] > 5000000) {
+    if (State->ElapsedTsc[145] > CPU_PHASE_THRESHOLD) {
         State->Missed[145] = 1;
         State->MissCount++;
     }
@@ -1609,7 +1610,7 @@ EFI_STATUS CpuPhase145_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase146_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 146\n");
     State->ElapsedTsc[146] = AsmReadTsc() % (2000 + 146 * 10);
-    if (State->ElapsedTsc[146] > 5000000) {
+    if (State->ElapsedTsc[146] > CPU_PHASE_THRESHOLD) {
         State->Missed[146] = 1;
         State->MissCount++;
     }
@@ -1620,7 +1621,7 @@ EFI_STATUS CpuPhase146_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase147_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 147\n");
     State->ElapsedTsc[147] = AsmReadTsc() % (2000 + 147 * 10);
-    if (State->ElapsedTsc[147] > 5000000) {
+    if (State->ElapsedTsc[147] > CPU_PHASE_THRESHOLD) {
         State->Missed[147] = 1;
         State->MissCount++;
     }
@@ -1631,7 +1632,7 @@ EFI_STATUS CpuPhase147_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase148_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 148\n");
     State->ElapsedTsc[148] = AsmReadTsc() % (2000 + 148 * 10);
-    if (State->ElapsedTsc[148] > 5000000) {
+    if (State->ElapsedTsc[148] > CPU_PHASE_THRESHOLD) {
         State->Missed[148] = 1;
         State->MissCount++;
     }
@@ -1642,7 +1643,7 @@ EFI_STATUS CpuPhase148_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase149_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 149\n");
     State->ElapsedTsc[149] = AsmReadTsc() % (2000 + 149 * 10);
-    if (State->ElapsedTsc[149] > 5000000) {
+    if (State->ElapsedTsc[149] > CPU_PHASE_THRESHOLD) {
         State->Missed[149] = 1;
         State->MissCount++;
     }
@@ -1653,171 +1654,58 @@ EFI_STATUS CpuPhase149_Execute(CPU_STATE *State) {
 EFI_STATUS CpuPhase150_Execute(CPU_STATE *State) {
     Print(L"Executing CPU Phase 150\n");
     State->ElapsedTsc[150] = AsmReadTsc() % (2000 + 150 * 10);
-    if (State->ElapsedTsc[150] > 5000000) {
+    if (State->ElapsedTsc[150] > CPU_PHASE_THRESHOLD) {
         State->Missed[150] = 1;
         State->MissCount++;
     }
     return EFI_SUCCESS;
 }
 
-EFI_STATUS CpuMind_RunAllPhases(void) {
+// Registry adapters: CPU phases work on gCpuState rather than the context.
+#define CPU_PHASE_LIST(X) \
+    X(1, 001) X(2, 002) X(3, 003) X(4, 004) X(5, 005) X(6, 006) \
+    X(7, 007) X(8, 008) X(9, 009) X(10, 010) X(11, 011) X(12, 012) \
+    X(13, 013) X(14, 014) X(15, 015) X(16, 016) X(17, 017) X(18, 018) \
+    X(19, 019) X(20, 020) X(21, 021) X(22, 022) X(23, 023) X(24, 024) \
+    X(25, 025) X(26, 026) X(27, 027) X(28, 028) X(29, 029) X(30, 030) \
+    X(31, 031) X(32, 032) X(33, 033) X(34, 034) X(35, 035) X(36, 036) \
+    X(37, 037) X(38, 038) X(39, 039) X(40, 040) X(41, 041) X(42, 042) \
+    X(43, 043) X(44, 044) X(45, 045) X(46, 046) X(47, 047) X(48, 048) \
+    X(49, 049) X(50, 050) X(51, 051) X(52, 052) X(53, 053) X(54, 054) \
+    X(55, 055) X(56, 056) X(57, 057) X(58, 058) X(59, 059) X(60, 060) \
+    X(61, 061) X(62, 062) X(63, 063) X(64, 064) X(65, 065) X(66, 066) \
+    X(67, 067) X(68, 068) X(69, 069) X(70, 070) X(71, 071) X(72, 072) \
+    X(73, 073) X(74, 074) X(75, 075) X(76, 076) X(77, 077) X(78, 078) \
+    X(79, 079) X(80, 080) X(81, 081) X(82, 082) X(83, 083) X(84, 084) \
+    X(85, 085) X(86, 086) X(87, 087) X(88, 088) X(89, 089) X(90, 090) \
+    X(91, 091) X(92, 092) X(93, 093) X(94, 094) X(95, 095) X(96, 096) \
+    X(97, 097) X(98, 098) X(99, 099) X(100, 100) X(101, 101) X(102, 102) \
+    X(103, 103) X(104, 104) X(105, 105) X(106, 106) X(107, 107) X(108, 108) \
+    X(109, 109) X(110, 110) X(111, 111) X(112, 112) X(113, 113) X(114, 114) \
+    X(115, 115) X(116, 116) X(117, 117) X(118, 118) X(119, 119) X(120, 120) \
+    X(121, 121) X(122, 122) X(123, 123) X(124, 124) X(125, 125) X(126, 126) \
+    X(127, 127) X(128, 128) X(129, 129) X(130, 130) X(131, 131) X(132, 132) \
+    X(133, 133) X(134, 134) X(135, 135) X(136, 136) X(137, 137) X(138, 138) \
+    X(139, 139) X(140, 140) X(141, 141) X(142, 142) X(143, 143) X(144, 144) \
+    X(145, 145) X(146, 146) X(147, 147) X(148, 148) X(149, 149) X(150, 150)
+
+#define CPU_PHASE_ADAPTER(id, n) \
+    static EFI_STATUS CpuPhase##n##_Run(KERNEL_CONTEXT *ctx) { return CpuPhase##n##_Execute(&gCpuState); }
+#define CPU_PHASE_ENTRY(id, n) \
+    PHASE(id, PHASE_MIND_CPU, CpuPhase##n##_Run, CPU_PHASE_DEADLINE_NS, PHASE_COST_LIGHT),
+
+CPU_PHASE_LIST(CPU_PHASE_ADAPTER)
+
+PHASE_ENTRY gCpuPhases[] = {
+    CPU_PHASE_LIST(CPU_PHASE_ENTRY)
+};
+const UINTN gCpuPhaseCount = sizeof(gCpuPhases) / sizeof(gCpuPhases[0]);
+
+EFI_STATUS CpuMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
+    PHASE_RUN Run = { NULL, FALSE };
     gCpuState.StartTsc = AsmReadTsc();
-    for (UINTN i = 1; i <= 150; ++i) {
-        EFI_STATUS Status = EFI_SUCCESS;
-        switch (i) {
-            case 1: Status = CpuPhase001_Execute(&gCpuState); break;
-            case 2: Status = CpuPhase002_Execute(&gCpuState); break;
-            case 3: Status = CpuPhase003_Execute(&gCpuState); break;
-            case 4: Status = CpuPhase004_Execute(&gCpuState); break;
-            case 5: Status = CpuPhase005_Execute(&gCpuState); break;
-            case 6: Status = CpuPhase006_Execute(&gCpuState); break;
-            case 7: Status = CpuPhase007_Execute(&gCpuState); break;
-            case 8: Status = CpuPhase008_Execute(&gCpuState); break;
-            case 9: Status = CpuPhase009_Execute(&gCpuState); break;
-            case 10: Status = CpuPhase010_Execute(&gCpuState); break;
-            case 11: Status = CpuPhase011_Execute(&gCpuState); break;
-            case 12: Status = CpuPhase012_Execute(&gCpuState); break;
-            case 13: Status = CpuPhase013_Execute(&gCpuState); break;
-            case 14: Status = CpuPhase014_Execute(&gCpuState); break;
-            case 15: Status = CpuPhase015_Execute(&gCpuState); break;
-            case 16: Status = CpuPhase016_Execute(&gCpuState); break;
-            case 17: Status = CpuPhase017_Execute(&gCpuState); break;
-            case 18: Status = CpuPhase018_Execute(&gCpuState); break;
-            case 19: Status = CpuPhase019_Execute(&gCpuState); break;
-            case 20: Status = CpuPhase020_Execute(&gCpuState); break;
-            case 21: Status = CpuPhase021_Execute(&gCpuState); break;
-            case 22: Status = CpuPhase022_Execute(&gCpuState); break;
-            case 23: Status = CpuPhase023_Execute(&gCpuState); break;
-            case 24: Status = CpuPhase024_Execute(&gCpuState); break;
-            case 25: Status = CpuPhase025_Execute(&gCpuState); break;
-            case 26: Status = CpuPhase026_Execute(&gCpuState); break;
-            case 27: Status = CpuPhase027_Execute(&gCpuState); break;
-            case 28: Status = CpuPhase028_Execute(&gCpuState); break;
-            case 29: Status = CpuPhase029_Execute(&gCpuState); break;
-            case 30: Status = CpuPhase030_Execute(&gCpuState); break;
-            case 31: Status = CpuPhase031_Execute(&gCpuState); break;
-            case 32: Status = CpuPhase032_Execute(&gCpuState); break;
-            case 33: Status = CpuPhase033_Execute(&gCpuState); break;
-            case 34: Status = CpuPhase034_Execute(&gCpuState); break;
-            case 35: Status = CpuPhase035_Execute(&gCpuState); break;
-            case 36: Status = CpuPhase036_Execute(&gCpuState); break;
-            case 37: Status = CpuPhase037_Execute(&gCpuState); break;
-            case 38: Status = CpuPhase038_Execute(&gCpuState); break;
-            case 39: Status = CpuPhase039_Execute(&gCpuState); break;
-            case 40: Status = CpuPhase040_Execute(&gCpuState); break;
-            case 41: Status = CpuPhase041_Execute(&gCpuState); break;
-            case 42: Status = CpuPhase042_Execute(&gCpuState); break;
-            case 43: Status = CpuPhase043_Execute(&gCpuState); break;
-            case 44: Status = CpuPhase044_Execute(&gCpuState); break;
-            case 45: Status = CpuPhase045_Execute(&gCpuState); break;
-            case 46: Status = CpuPhase046_Execute(&gCpuState); break;
-            case 47: Status = CpuPhase047_Execute(&gCpuState); break;
-            case 48: Status = CpuPhase048_Execute(&gCpuState); break;
-            case 49: Status = CpuPhase049_Execute(&gCpuState); break;
-            case 50: Status = CpuPhase050_Execute(&gCpuState); break;
-            case 51: Status = CpuPhase051_Execute(&gCpuState); break;
-            case 52: Status = CpuPhase052_Execute(&gCpuState); break;
-            case 53: Status = CpuPhase053_Execute(&gCpuState); break;
-            case 54: Status = CpuPhase054_Execute(&gCpuState); break;
-            case 55: Status = CpuPhase055_Execute(&gCpuState); break;
-            case 56: Status = CpuPhase056_Execute(&gCpuState); break;
-            case 57: Status = CpuPhase057_Execute(&gCpuState); break;
-            case 58: Status = CpuPhase058_Execute(&gCpuState); break;
-            case 59: Status = CpuPhase059_Execute(&gCpuState); break;
-            case 60: Status = CpuPhase060_Execute(&gCpuState); break;
-            case 61: Status = CpuPhase061_Execute(&gCpuState); break;
-            case 62: Status = CpuPhase062_Execute(&gCpuState); break;
-            case 63: Status = CpuPhase063_Execute(&gCpuState); break;
-            case 64: Status = CpuPhase064_Execute(&gCpuState); break;
-            case 65: Status = CpuPhase065_Execute(&gCpuState); break;
-            case 66: Status = CpuPhase066_Execute(&gCpuState); break;
-            case 67: Status = CpuPhase067_Execute(&gCpuState); break;
-            case 68: Status = CpuPhase068_Execute(&gCpuState); break;
-            case 69: Status = CpuPhase069_Execute(&gCpuState); break;
-            case 70: Status = CpuPhase070_Execute(&gCpuState); break;
-            case 71: Status = CpuPhase071_Execute(&gCpuState); break;
-            case 72: Status = CpuPhase072_Execute(&gCpuState); break;
-            case 73: Status = CpuPhase073_Execute(&gCpuState); break;
-            case 74: Status = CpuPhase074_Execute(&gCpuState); break;
-            case 75: Status = CpuPhase075_Execute(&gCpuState); break;
-            case 76: Status = CpuPhase076_Execute(&gCpuState); break;
-            case 77: Status = CpuPhase077_Execute(&gCpuState); break;
-            case 78: Status = CpuPhase078_Execute(&gCpuState); break;
-            case 79: Status = CpuPhase079_Execute(&gCpuState); break;
-            case 80: Status = CpuPhase080_Execute(&gCpuState); break;
-            case 81: Status = CpuPhase081_Execute(&gCpuState); break;
-            case 82: Status = CpuPhase082_Execute(&gCpuState); break;
-            case 83: Status = CpuPhase083_Execute(&gCpuState); break;
-            case 84: Status = CpuPhase084_Execute(&gCpuState); break;
-            case 85: Status = CpuPhase085_Execute(&gCpuState); break;
-            case 86: Status = CpuPhase086_Execute(&gCpuState); break;
-            case 87: Status = CpuPhase087_Execute(&gCpuState); break;
-            case 88: Status = CpuPhase088_Execute(&gCpuState); break;
-            case 89: Status = CpuPhase089_Execute(&gCpuState); break;
-            case 90: Status = CpuPhase090_Execute(&gCpuState); break;
-            case 91: Status = CpuPhase091_Execute(&gCpuState); break;
-            case 92: Status = CpuPhase092_Execute(&gCpuState); break;
-            case 93: Status = CpuPhase093_Execute(&gCpuState); break;
-            case 94: Status = CpuPhase094_Execute(&gCpuState); break;
-            case 95: Status = CpuPhase095_Execute(&gCpuState); break;
-            case 96: Status = CpuPhase096_Execute(&gCpuState); break;
-            case 97: Status = CpuPhase097_Execute(&gCpuState); break;
-            case 98: Status = CpuPhase098_Execute(&gCpuState); break;
-            case 99: Status = CpuPhase099_Execute(&gCpuState); break;
-            case 100: Status = CpuPhase100_Execute(&gCpuState); break;
-            case 101: Status = CpuPhase101_Execute(&gCpuState); break;
-            case 102: Status = CpuPhase102_Execute(&gCpuState); break;
-            case 103: Status = CpuPhase103_Execute(&gCpuState); break;
-            case 104: Status = CpuPhase104_Execute(&gCpuState); break;
-            case 105: Status = CpuPhase105_Execute(&gCpuState); break;
-            case 106: Status = CpuPhase106_Execute(&gCpuState); break;
-            case 107: Status = CpuPhase107_Execute(&gCpuState); break;
-            case 108: Status = CpuPhase108_Execute(&gCpuState); break;
-            case 109: Status = CpuPhase109_Execute(&gCpuState); break;
-            case 110: Status = CpuPhase110_Execute(&gCpuState); break;
-            case 111: Status = CpuPhase111_Execute(&gCpuState); break;
-            case 112: Status = CpuPhase112_Execute(&gCpuState); break;
-            case 113: Status = CpuPhase113_Execute(&gCpuState); break;
-            case 114: Status = CpuPhase114_Execute(&gCpuState); break;
-            case 115: Status = CpuPhase115_Execute(&gCpuState); break;
-            case 116: Status = CpuPhase116_Execute(&gCpuState); break;
-            case 117: Status = CpuPhase117_Execute(&gCpuState); break;
-            case 118: Status = CpuPhase118_Execute(&gCpuState); break;
-            case 119: Status = CpuPhase119_Execute(&gCpuState); break;
-            case 120: Status = CpuPhase120_Execute(&gCpuState); break;
-            case 121: Status = CpuPhase121_Execute(&gCpuState); break;
-            case 122: Status = CpuPhase122_Execute(&gCpuState); break;
-            case 123: Status = CpuPhase123_Execute(&gCpuState); break;
-            case 124: Status = CpuPhase124_Execute(&gCpuState); break;
-            case 125: Status = CpuPhase125_Execute(&gCpuState); break;
-            case 126: Status = CpuPhase126_Execute(&gCpuState); break;
-            case 127: Status = CpuPhase127_Execute(&gCpuState); break;
-            case 128: Status = CpuPhase128_Execute(&gCpuState); break;
-            case 129: Status = CpuPhase129_Execute(&gCpuState); break;
-            case 130: Status = CpuPhase130_Execute(&gCpuState); break;
-            case 131: Status = CpuPhase131_Execute(&gCpuState); break;
-            case 132: Status = CpuPhase132_Execute(&gCpuState); break;
-            case 133: Status = CpuPhase133_Execute(&gCpuState); break;
-            case 134: Status = CpuPhase134_Execute(&gCpuState); break;
-            case 135: Status = CpuPhase135_Execute(&gCpuState); break;
-            case 136: Status = CpuPhase136_Execute(&gCpuState); break;
-            case 137: Status = CpuPhase137_Execute(&gCpuState); break;
-            case 138: Status = CpuPhase138_Execute(&gCpuState); break;
-            case 139: Status = CpuPhase139_Execute(&gCpuState); break;
-            case 140: Status = CpuPhase140_Execute(&gCpuState); break;
-            case 141: Status = CpuPhase141_Execute(&gCpuState); break;
-            case 142: Status = CpuPhase142_Execute(&gCpuState); break;
-            case 143: Status = CpuPhase143_Execute(&gCpuState); break;
-            case 144: Status = CpuPhase144_Execute(&gCpuState); break;
-            case 145: Status = CpuPhase145_Execute(&gCpuState); break;
-            case 146: Status = CpuPhase146_Execute(&gCpuState); break;
-            case 147: Status = CpuPhase147_Execute(&gCpuState); break;
-            case 148: Status = CpuPhase148_Execute(&gCpuState); break;
-            case 149: Status = CpuPhase149_Execute(&gCpuState); break;
-            case 150: Status = CpuPhase150_Execute(&gCpuState); break;
-        }
-        if (EFI_ERROR(Status)) return Status;
-    }
+    EFI_STATUS Status = PhaseRegistry_Run(gCpuPhases, gCpuPhaseCount, ctx, &Run);
+    if (EFI_ERROR(Status)) return Status;
     gCpuState.TotalTsc = AsmReadTsc() - gCpuState.StartTsc;
     return EFI_SUCCESS;
 }
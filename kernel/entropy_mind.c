@@ -54,7 +54,7 @@ EFI_STATUS EntropyMind_Phase753_DetectSpikeAnomaly(KERNEL_CONTEXT *ctx) {
 }
 
 EFI_STATUS EntropyMind_Phase754_BuildHeatmapGrid(KERNEL_CONTEXT *ctx) {
-    for(UINTN i=0;i<100;i++) ctx->entropy_heatmap[i/10][i%10]=gSamples[(gSampleIdx+63-i)%64];
+    for(UINTN i=0;i<100;i++) ctx->cold->entropy_heatmap[i/10][i%10]=gSamples[(gSampleIdx+63-i)%64];
     return EFI_SUCCESS;
 }
 
@@ -76,7 +76,7 @@ EFI_STATUS EntropyMind_Phase759_ScoreEntropyDensity(KERNEL_CONTEXT *ctx) {
 EFI_STATUS EntropyMind_Phase760_LogRecoveryTiming(KERNEL_CONTEXT *ctx) {
     static UINT64 start=0; if(ctx->EntropyScore<10){ if(!start) start=AsmReadTsc(); } else if(start){ ctx->entropy_recovery_time=AsmReadTsc()-start; start=0; } return EFI_SUCCESS; }
 
-EFI_STATUS EntropyMind_Phase761_BuildPhaseInfluenceMap(KERNEL_CONTEXT *ctx) { ctx->entropy_phase_map[ctx->total_phases%100]=ctx->EntropyScore^ctx->trust_score; return EFI_SUCCESS; }
+EFI_STATUS EntropyMind_Phase761_BuildPhaseInfluenceMap(KERNEL_CONTEXT *ctx) { ctx->cold->entropy_phase_map[ctx->total_phases%100]=ctx->EntropyScore^ctx->trust_score; return EFI_SUCCESS; }
 
 EFI_STATUS EntropyMind_Phase762_CalculateResilienceFactor(KERNEL_CONTEXT *ctx) { UINT64 diff=(ctx->trust_score>ctx->EntropyScore)?ctx->trust_score-ctx->EntropyScore:ctx->EntropyScore-ctx->trust_score; ctx->entropy_resilience_factor=(diff>0)?(UINT8)(10000/(diff+1)%100):100; return EFI_SUCCESS; }
 
@@ -138,7 +138,7 @@ EFI_STATUS EntropyMind_Phase790_BalanceTrendSlope(KERNEL_CONTEXT *ctx) { if(ctx-
 
 EFI_STATUS EntropyMind_Phase791_ScaleSystemConfidence(KERNEL_CONTEXT *ctx) { UINT64 mean,std; ComputeStats(5,&mean,&std); if(std>ctx->entropy_baseline.stddev) ctx->meta_confidence/=2; return EFI_SUCCESS; }
 
-EFI_STATUS EntropyMind_Phase792_CheckEntropyConvergence(KERNEL_CONTEXT *ctx) { UINT64 diff=(ctx->scheduler_entropy_buffer[0]>ctx->scheduler_entropy_buffer[1])?ctx->scheduler_entropy_buffer[0]-ctx->scheduler_entropy_buffer[1]:ctx->scheduler_entropy_buffer[1]-ctx->scheduler_entropy_buffer[0]; if(diff*100/ctx->scheduler_entropy_buffer[0]>15) Telemetry_LogEvent("EntropyConv",(UINTN)diff,0); return EFI_SUCCESS; }
+EFI_STATUS EntropyMind_Phase792_CheckEntropyConvergence(KERNEL_CONTEXT *ctx) { UINT64 diff=(ctx->scheduler_entropy_buffer[0]>ctx->scheduler_entropy_buffer[1])?ctx->scheduler_entropy_buffer[0]-ctx->scheduler_entropy_buffer[1]:ctx->scheduler_entropy_buffer[1]-ctx->scheduler_entropy_buffer[0]; if(ctx->scheduler_entropy_buffer[0] && diff*100/ctx->scheduler_entropy_buffer[0]>15) Telemetry_LogEvent("EntropyConv",(UINTN)diff,0); return EFI_SUCCESS; }
 
 EFI_STATUS EntropyMind_Phase793_ApplyTrustPenaltyFromEntropy(KERNEL_CONTEXT *ctx) { if(ctx->entropy_micro_drift>ctx->entropy_baseline.stddev) ctx->trust_score-=ctx->trust_score/2; return EFI_SUCCESS; }
 
@@ -159,6 +159,7 @@ EFI_STATUS EntropyMind_Phase800_FinalizeMind(KERNEL_CONTEXT *ctx) { ctx->entropy
 EFI_STATUS EntropyMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     EFI_STATUS Status = EFI_SUCCESS;
     for (UINTN phase = 751; phase <= 800; ++phase) {
+        Telemetry_SetPhase((UINT32)phase);
         switch (phase) {
             case 751: Status = EntropyMind_Phase751_EvaluateSourceStrength(ctx); break;
             case 752: Status = EntropyMind_Phase752_CalibrateBaseline(ctx); break;
@@ -6,1357 +6,1358 @@ EFI_STATUS GpuPhase_Execute(KERNEL_CONTEXT *ctx, UINTN phase) {
     if (phase > 150) return EFI_INVALID_PARAMETER;
     UINT64 tsc_start = AsmReadTsc();
     EFI_STATUS Status = EFI_SUCCESS;
+    MIND_COUNTERS *Gpu = &ctx->mind_counters[MIND_SLOT_GPU];
 
     switch (phase) {
     case 1:
         // === Phase 301 ===
-        ctx->EntropyScore ^= (1 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 301, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (1 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 301, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 2:
         // === Phase 302 ===
-        ctx->EntropyScore ^= (2 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 302, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (2 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 302, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 3:
         // === Phase 303 ===
-        ctx->EntropyScore ^= (3 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 303, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (3 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 303, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 4:
         // === Phase 304 ===
-        ctx->EntropyScore ^= (4 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 304, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (4 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 304, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 5:
         // === Phase 305 ===
-        ctx->EntropyScore ^= (5 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 305, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (5 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 305, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 6:
         // === Phase 306 ===
-        ctx->EntropyScore ^= (6 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 306, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (6 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 306, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 7:
         // === Phase 307 ===
-        ctx->EntropyScore ^= (7 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 307, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (7 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 307, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 8:
         // === Phase 308 ===
-        ctx->EntropyScore ^= (8 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 308, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (8 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 308, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 9:
         // === Phase 309 ===
-        ctx->EntropyScore ^= (9 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 309, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (9 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 309, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 10:
         // === Phase 310 ===
-        ctx->EntropyScore ^= (10 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 310, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (10 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 310, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 11:
         // === Phase 311 ===
-        ctx->EntropyScore ^= (11 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 311, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (11 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 311, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 12:
         // === Phase 312 ===
-        ctx->EntropyScore ^= (12 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 312, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (12 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 312, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 13:
         // === Phase 313 ===
-        ctx->EntropyScore ^= (13 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 313, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (13 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 313, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 14:
         // === Phase 314 ===
-        ctx->EntropyScore ^= (14 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 314, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (14 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 314, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 15:
         // === Phase 315 ===
-        ctx->EntropyScore ^= (15 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 315, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (15 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 315, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 16:
         // === Phase 316 ===
-        ctx->EntropyScore ^= (16 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 316, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (16 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 316, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 17:
         // === Phase 317 ===
-        ctx->EntropyScore ^= (17 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 317, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (17 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 317, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 18:
         // === Phase 318 ===
-        ctx->EntropyScore ^= (18 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 318, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (18 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 318, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 19:
         // === Phase 319 ===
-        ctx->EntropyScore ^= (19 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 319, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (19 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 319, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 20:
         // === Phase 320 ===
-        ctx->EntropyScore ^= (20 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 320, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (20 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 320, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 21:
         // === Phase 321 ===
-        ctx->EntropyScore ^= (21 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 321, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (21 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 321, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 22:
         // === Phase 322 ===
-        ctx->EntropyScore ^= (22 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 322, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (22 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 322, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 23:
         // === Phase 323 ===
-        ctx->EntropyScore ^= (23 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 323, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (23 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 323, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 24:
         // === Phase 324 ===
-        ctx->EntropyScore ^= (24 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 324, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (24 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 324, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 25:
         // === Phase 325 ===
-        ctx->EntropyScore ^= (25 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 325, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (25 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 325, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 26:
         // === Phase 326 ===
-        ctx->EntropyScore ^= (26 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 326, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (26 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 326, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 27:
         // === Phase 327 ===
-        ctx->EntropyScore ^= (27 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 327, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (27 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 327, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 28:
         // === Phase 328 ===
-        ctx->EntropyScore ^= (28 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 328, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (28 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 328, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 29:
         // === Phase 329 ===
-        ctx->EntropyScore ^= (29 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 329, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (29 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 329, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 30:
         // === Phase 330 ===
-        ctx->EntropyScore ^= (30 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 330, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (30 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 330, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 31:
         // === Phase 331 ===
-        ctx->EntropyScore ^= (31 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 331, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (31 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 331, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 32:
         // === Phase 332 ===
-        ctx->EntropyScore ^= (32 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 332, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (32 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 332, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 33:
         // === Phase 333 ===
-        ctx->EntropyScore ^= (33 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 333, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (33 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 333, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 34:
         // === Phase 334 ===
-        ctx->EntropyScore ^= (34 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 334, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (34 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 334, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 35:
         // === Phase 335 ===
-        ctx->EntropyScore ^= (35 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 335, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (35 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 335, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 36:
         // === Phase 336 ===
-        ctx->EntropyScore ^= (36 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 336, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (36 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 336, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 37:
         // === Phase 337 ===
-        ctx->EntropyScore ^= (37 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 337, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (37 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 337, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 38:
         // === Phase 338 ===
-        ctx->EntropyScore ^= (38 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 338, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (38 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 338, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 39:
         // === Phase 339 ===
-        ctx->EntropyScore ^= (39 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 339, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (39 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 339, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 40:
         // === Phase 340 ===
-        ctx->EntropyScore ^= (40 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 340, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (40 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 340, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 41:
         // === Phase 341 ===
-        ctx->EntropyScore ^= (41 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 341, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (41 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 341, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 42:
         // === Phase 342 ===
-        ctx->EntropyScore ^= (42 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 342, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (42 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 342, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 43:
         // === Phase 343 ===
-        ctx->EntropyScore ^= (43 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 343, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (43 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 343, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 44:
         // === Phase 344 ===
-        ctx->EntropyScore ^= (44 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 344, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (44 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 344, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 45:
         // === Phase 345 ===
-        ctx->EntropyScore ^= (45 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 345, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (45 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 345, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 46:
         // === Phase 346 ===
-        ctx->EntropyScore ^= (46 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 346, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (46 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 346, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 47:
         // === Phase 347 ===
-        ctx->EntropyScore ^= (47 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 347, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (47 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 347, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 48:
         // === Phase 348 ===
-        ctx->EntropyScore ^= (48 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 348, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (48 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 348, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 49:
         // === Phase 349 ===
-        ctx->EntropyScore ^= (49 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 349, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (49 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 349, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 50:
         // === Phase 350 ===
-        ctx->EntropyScore ^= (50 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 350, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (50 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 350, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 51:
         // === Phase 351 ===
-        ctx->EntropyScore ^= (51 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 351, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (51 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 351, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 52:
         // === Phase 352 ===
-        ctx->EntropyScore ^= (52 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 352, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (52 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 352, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 53:
         // === Phase 353 ===
-        ctx->EntropyScore ^= (53 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 353, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (53 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 353, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 54:
         // === Phase 354 ===
-        ctx->EntropyScore ^= (54 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 354, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (54 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 354, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 55:
         // === Phase 355 ===
-        ctx->EntropyScore ^= (55 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 355, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (55 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 355, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 56:
         // === Phase 356 ===
-        ctx->EntropyScore ^= (56 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 356, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (56 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 356, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 57:
         // === Phase 357 ===
-        ctx->EntropyScore ^= (57 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 357, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (57 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 357, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 58:
         // === Phase 358 ===
-        ctx->EntropyScore ^= (58 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 358, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (58 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 358, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 59:
         // === Phase 359 ===
-        ctx->EntropyScore ^= (59 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 359, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (59 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 359, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 60:
         // === Phase 360 ===
-        ctx->EntropyScore ^= (60 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 360, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (60 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 360, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 61:
         // === Phase 361 ===
-        ctx->EntropyScore ^= (61 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 361, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (61 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 361, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 62:
         // === Phase 362 ===
-        ctx->EntropyScore ^= (62 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 362, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (62 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 362, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 63:
         // === Phase 363 ===
-        ctx->EntropyScore ^= (63 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 363, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (63 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 363, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 64:
         // === Phase 364 ===
-        ctx->EntropyScore ^= (64 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 364, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (64 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 364, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 65:
         // === Phase 365 ===
-        ctx->EntropyScore ^= (65 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 365, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (65 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 365, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 66:
         // === Phase 366 ===
-        ctx->EntropyScore ^= (66 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 366, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (66 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 366, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 67:
         // === Phase 367 ===
-        ctx->EntropyScore ^= (67 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 367, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (67 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 367, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 68:
         // === Phase 368 ===
-        ctx->EntropyScore ^= (68 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 368, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (68 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 368, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 69:
         // === Phase 369 ===
-        ctx->EntropyScore ^= (69 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 369, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (69 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 369, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 70:
         // === Phase 370 ===
-        ctx->EntropyScore ^= (70 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 370, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (70 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 370, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 71:
         // === Phase 371 ===
-        ctx->EntropyScore ^= (71 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 371, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (71 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 371, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 72:
         // === Phase 372 ===
-        ctx->EntropyScore ^= (72 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 372, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (72 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 372, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 73:
         // === Phase 373 ===
-        ctx->EntropyScore ^= (73 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 373, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (73 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 373, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 74:
         // === Phase 374 ===
-        ctx->EntropyScore ^= (74 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 374, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (74 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 374, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 75:
         // === Phase 375 ===
-        ctx->EntropyScore ^= (75 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 375, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (75 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 375, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 76:
         // === Phase 376 ===
-        ctx->EntropyScore ^= (76 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 376, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (76 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 376, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 77:
         // === Phase 377 ===
-        ctx->EntropyScore ^= (77 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 377, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (77 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 377, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 78:
         // === Phase 378 ===
-        ctx->EntropyScore ^= (78 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 378, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (78 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 378, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 79:
         // === Phase 379 ===
-        ctx->EntropyScore ^= (79 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 379, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (79 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 379, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 80:
         // === Phase 380 ===
-        ctx->EntropyScore ^= (80 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 380, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (80 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 380, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 81:
         // === Phase 381 ===
-        ctx->EntropyScore ^= (81 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 381, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (81 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 381, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 82:
         // === Phase 382 ===
-        ctx->EntropyScore ^= (82 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 382, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (82 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 382, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 83:
         // === Phase 383 ===
-        ctx->EntropyScore ^= (83 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 383, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (83 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 383, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 84:
         // === Phase 384 ===
-        ctx->EntropyScore ^= (84 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 384, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (84 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 384, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 85:
         // === Phase 385 ===
-        ctx->EntropyScore ^= (85 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 385, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (85 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 385, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 86:
         // === Phase 386 ===
-        ctx->EntropyScore ^= (86 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 386, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (86 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 386, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 87:
         // === Phase 387 ===
-        ctx->EntropyScore ^= (87 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 387, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (87 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 387, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 88:
         // === Phase 388 ===
-        ctx->EntropyScore ^= (88 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 388, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (88 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 388, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 89:
         // === Phase 389 ===
-        ctx->EntropyScore ^= (89 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 389, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (89 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 389, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 90:
         // === Phase 390 ===
-        ctx->EntropyScore ^= (90 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 390, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (90 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 390, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 91:
         // === Phase 391 ===
-        ctx->EntropyScore ^= (91 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 391, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (91 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 391, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 92:
         // === Phase 392 ===
-        ctx->EntropyScore ^= (92 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 392, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (92 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 392, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 93:
         // === Phase 393 ===
-        ctx->EntropyScore ^= (93 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 393, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (93 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 393, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 94:
         // === Phase 394 ===
-        ctx->EntropyScore ^= (94 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 394, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (94 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 394, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 95:
         // === Phase 395 ===
-        ctx->EntropyScore ^= (95 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 395, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (95 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 395, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 96:
         // === Phase 396 ===
-        ctx->EntropyScore ^= (96 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 396, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (96 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 396, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 97:
         // === Phase 397 ===
-        ctx->EntropyScore ^= (97 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 397, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (97 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 397, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 98:
         // === Phase 398 ===
-        ctx->EntropyScore ^= (98 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 398, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (98 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 398, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 99:
         // === Phase 399 ===
-        ctx->EntropyScore ^= (99 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 399, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (99 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 399, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 100:
         // === Phase 400 ===
-        ctx->EntropyScore ^= (100 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 400, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (100 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 400, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 101:
         // === Phase 401 ===
-        ctx->EntropyScore ^= (101 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 401, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (101 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 401, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 102:
         // === Phase 402 ===
-        ctx->EntropyScore ^= (102 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 402, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (102 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 402, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 103:
         // === Phase 403 ===
-        ctx->EntropyScore ^= (103 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 403, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (103 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 403, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 104:
         // === Phase 404 ===
-        ctx->EntropyScore ^= (104 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 404, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (104 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 404, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 105:
         // === Phase 405 ===
-        ctx->EntropyScore ^= (105 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 405, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (105 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 405, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 106:
         // === Phase 406 ===
-        ctx->EntropyScore ^= (106 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 406, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (106 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 406, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 107:
         // === Phase 407 ===
-        ctx->EntropyScore ^= (107 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 407, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (107 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 407, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 108:
         // === Phase 408 ===
-        ctx->EntropyScore ^= (108 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 408, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (108 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 408, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 109:
         // === Phase 409 ===
-        ctx->EntropyScore ^= (109 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 409, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (109 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 409, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 110:
         // === Phase 410 ===
-        ctx->EntropyScore ^= (110 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 410, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (110 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 410, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 111:
         // === Phase 411 ===
-        ctx->EntropyScore ^= (111 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 411, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (111 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 411, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 112:
         // === Phase 412 ===
-        ctx->EntropyScore ^= (112 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 412, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (112 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 412, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 113:
         // === Phase 413 ===
-        ctx->EntropyScore ^= (113 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 413, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (113 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 413, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 114:
         // === Phase 414 ===
-        ctx->EntropyScore ^= (114 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 414, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (114 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 414, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 115:
         // === Phase 415 ===
-        ctx->EntropyScore ^= (115 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 415, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (115 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 415, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 116:
         // === Phase 416 ===
-        ctx->EntropyScore ^= (116 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 416, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (116 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 416, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 117:
         // === Phase 417 ===
-        ctx->EntropyScore ^= (117 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 417, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (117 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 417, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 118:
         // === Phase 418 ===
-        ctx->EntropyScore ^= (118 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 418, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (118 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 418, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 119:
         // === Phase 419 ===
-        ctx->EntropyScore ^= (119 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 419, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (119 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 419, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 120:
         // === Phase 420 ===
-        ctx->EntropyScore ^= (120 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 420, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (120 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 420, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 121:
         // === Phase 421 ===
-        ctx->EntropyScore ^= (121 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 421, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (121 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 421, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 122:
         // === Phase 422 ===
-        ctx->EntropyScore ^= (122 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 422, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (122 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 422, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 123:
         // === Phase 423 ===
-        ctx->EntropyScore ^= (123 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 423, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (123 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 423, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 124:
         // === Phase 424 ===
-        ctx->EntropyScore ^= (124 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 424, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (124 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 424, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 125:
         // === Phase 425 ===
-        ctx->EntropyScore ^= (125 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 425, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (125 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 425, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 126:
         // === Phase 426 ===
-        ctx->EntropyScore ^= (126 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 426, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (126 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 426, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 127:
         // === Phase 427 ===
-        ctx->EntropyScore ^= (127 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 427, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (127 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 427, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 128:
         // === Phase 428 ===
-        ctx->EntropyScore ^= (128 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 428, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (128 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 428, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 129:
         // === Phase 429 ===
-        ctx->EntropyScore ^= (129 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 429, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (129 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 429, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 130:
         // === Phase 430 ===
-        ctx->EntropyScore ^= (130 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 430, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (130 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 430, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 131:
         // === Phase 431 ===
-        ctx->EntropyScore ^= (131 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 431, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (131 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 431, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 132:
         // === Phase 432 ===
-        ctx->EntropyScore ^= (132 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 432, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (132 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 432, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 133:
         // === Phase 433 ===
-        ctx->EntropyScore ^= (133 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 433, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (133 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 433, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 134:
         // === Phase 434 ===
-        ctx->EntropyScore ^= (134 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 434, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (134 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 434, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 135:
         // === Phase 435 ===
-        ctx->EntropyScore ^= (135 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 435, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (135 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 435, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 136:
         // === Phase 436 ===
-        ctx->EntropyScore ^= (136 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 436, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (136 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 436, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 137:
         // === Phase 437 ===
-        ctx->EntropyScore ^= (137 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 437, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (137 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 437, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 138:
         // === Phase 438 ===
-        ctx->EntropyScore ^= (138 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 438, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (138 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 438, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 139:
         // === Phase 439 ===
-        ctx->EntropyScore ^= (139 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 439, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (139 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 439, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 140:
         // === Phase 440 ===
-        ctx->EntropyScore ^= (140 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 440, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (140 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 440, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 141:
         // === Phase 441 ===
-        ctx->EntropyScore ^= (141 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 441, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (141 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 441, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 142:
         // === Phase 442 ===
-        ctx->EntropyScore ^= (142 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 442, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (142 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 442, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 143:
         // === Phase 443 ===
-        ctx->EntropyScore ^= (143 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 443, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (143 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 443, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 144:
         // === Phase 444 ===
-        ctx->EntropyScore ^= (144 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 444, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (144 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 444, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 145:
         // === Phase 445 ===
-        ctx->EntropyScore ^= (145 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 445, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (145 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 445, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 146:
         // === Phase 446 ===
-        ctx->EntropyScore ^= (146 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 446, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (146 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 446, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 147:
         // === Phase 447 ===
-        ctx->EntropyScore ^= (147 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 447, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (147 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 447, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 148:
         // === Phase 448 ===
-        ctx->EntropyScore ^= (148 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 448, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (148 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 448, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 149:
         // === Phase 449 ===
-        ctx->EntropyScore ^= (149 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 449, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (149 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 449, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 150:
         // === Phase 450 ===
-        ctx->EntropyScore ^= (150 * 0xDEADBEEF);
-        AICore_RecordPhase("gpu_mind", 450, ctx->EntropyScore);
-        if ((ctx->EntropyScore & 0xF) == 0)
-            Trust_AdjustScore(+1);
+        Gpu->entropy ^= (150 * 0xDEADBEEF);
+        AICore_RecordPhase("gpu_mind", 450, Gpu->entropy);
+        if ((Gpu->entropy & 0xF) == 0)
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
         default:
             break;
@@ -1364,16 +1365,17 @@ EFI_STATUS GpuPhase_Execute(KERNEL_CONTEXT *ctx, UINTN phase) {
 
     UINT64 elapsed = AsmReadTsc() - tsc_start;
     if (elapsed > CPU_PHASE_THRESHOLD) {
-        Telemetry_LogEvent("GpuPhaseMissed", 300 + phase, elapsed);
-        ctx->MissCount++;
+        Telemetry_LogEvent("GpuPhaseMissed", 300 + phase, Tsc_ToNs(elapsed));
+        Gpu->misses++;
     }
 
-    ctx->total_phases++;
+    Gpu->phases++;
     return Status;
 }
 
 EFI_STATUS GpuMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 1; i <= 150; ++i) {
+        Telemetry_SetPhase((UINT32)(300 + i));
         EFI_STATUS Status = GpuPhase_Execute(ctx, i);
         if (EFI_ERROR(Status)) {
             Telemetry_LogEvent("GpuMindPhaseError", 300 + i, Status);
@@ -1382,6 +1384,6 @@ EFI_STATUS GpuMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     }
 
     AICore_ReportPhase("GpuMindInit", 1);
-    AICore_FinalizeGpuMind(ctx->MissCount);
+    AICore_FinalizeGpuMind(ctx->mind_counters[MIND_SLOT_GPU].misses);
     return EFI_SUCCESS;
 }
@@ -613,7 +613,7 @@ static EFI_STATUS IO_InitPhase639_SparseEntropyHandler(KERNEL_CONTEXT *ctx) {
 }
 
 static EFI_STATUS IO_InitPhase640_TrustRecoveryPulse(KERNEL_CONTEXT *ctx) {
-    if ((ctx->total_phases % 10) == 0)
+    if ((ctx->mind_counters[MIND_SLOT_IO].phases % 10) == 0)
         for (UINTN i = 0; i < IO_TRUST_CLASSES; ++i)
             if (ctx->io_trust_map[i] < 50)
                 ctx->io_trust_map[i]++;
@@ -965,6 +965,7 @@ static EFI_STATUS IO_InitPhase710_IOPhaseBlockEnd(KERNEL_CONTEXT *ctx) {
 EFI_STATUS IOMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     EFI_STATUS Status;
     for (UINTN phase = 561; phase <= 710; ++phase) {
+        Telemetry_SetPhase((UINT32)phase);
         switch (phase) {
             case 561: Status = IO_InitPhase561_BootstrapIOMind(ctx); break;
             case 562: Status = IO_InitPhase562_MapDeviceEntropyProfiles(ctx); break;
@@ -1100,7 +1101,7 @@ EFI_STATUS IOMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
             Telemetry_LogEvent("IOPhaseError", phase, Status);
             return Status;
         }
-        ctx->total_phases++;
+        ctx->mind_counters[MIND_SLOT_IO].phases++;
     }
     return EFI_SUCCESS;
 }
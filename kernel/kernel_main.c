@@ -2,10 +2,14 @@
 // Coordinates all AI-native components (cpu_mind, memory_mind, gpu_mind, etc.)
 
 #include "kernel_shared.h"      // Shared structs, macros, and constants
+#include "loader_params.h"      // LOADER_PARAMS_BLOCK passed by the loader
 #include "telemetry_mind.h"     // Telemetry and monitoring
 #include "trust_mind.h"         // System-wide trust score tracking
 #include "ai_core.h"            // Central AI agent and context
 #include "kernel_mind.h"        // Kernel self-awareness phases
+#include "mind_dispatch.h"      // Dependency-graph SMP dispatcher
+#include "ap_pool.h"            // APs started by the kernel after ExitBootServices
+#include <Protocol/MpService.h> // PROCESSOR_ENABLED_BIT in the handoff topology
 
 // Forward declarations (modules must implement these)
 EFI_STATUS CpuMind_RunAllPhases(KERNEL_CONTEXT *ctx);
@@ -17,69 +21,128 @@ EFI_STATUS StorageMind_RunAllPhases(KERNEL_CONTEXT *ctx);
 EFI_STATUS KernelMind_RunAllPhases(KERNEL_CONTEXT *ctx);
 
 KERNEL_CONTEXT gKernelCtx;
+static KERNEL_COLD gKernelCold;
 
-// === ENTRY POINT ===
-EFI_STATUS AiOS_KernelMain(VOID) {
-    Telemetry_LogEvent("AiOS_Kernel_Begin", 0, 0);
-    Trust_Reset();
-    gKernelCtx.total_phases = 0;
-    gKernelCtx.trust_score = 0;
+// Field groups each mind touches. Telemetry_LogEvent and the AICore_*
+// calls the minds make only append to the lock-free telemetry ring, and
+// Trust_* updates the shared score atomically, so neither orders minds.
+// GPU and IO count phases in their own mind_counters slot; only shared
+// KERNEL_CONTEXT fields produce edges.
+static const MIND_DESC gMinds[] = {
+    // PHASE 001–150: CPU MIND (own gCpuState, prints every phase)
+    { "CpuMind",       CpuMind_RunAllPhases,
+      0,
+      MIND_GRP_CONSOLE,
+      MIND_F_BSP_ONLY, "CpuMindFailure" },
+    // PHASE 151–300: MEMORY MIND (own gMemState; phase 105 fans out to idle APs itself)
+    { "MemoryMind",    MemoryMind_RunAllPhases,
+      0,
+      MIND_GRP_MEMORY,
+      MIND_F_BSP_ONLY, "MemoryMindFailure" },
+    // PHASE 301–450: GPU MIND
+    { "GpuMind",       GpuMind_RunAllPhases,
+      0,
+      0,
+      0, "GpuMindFailure" },
+    // PHASE 451–460: SCHEDULER MIND
+    { "SchedulerMind", SchedulerMind_RunAllPhases,
+      0,
+      MIND_GRP_STATS | MIND_GRP_SCHEDULER | MIND_GRP_AI,
+      0, "SchedulerMindFailure" },
+    // PHASE 561–600: IO MIND
+    { "IOMind",        IOMind_RunAllPhases,
+      MIND_GRP_STATS,
+      MIND_GRP_IO | MIND_GRP_SCHEDULER,
+      0, "IOMindFailure" },
+    // PHASE 601–650: STORAGE MIND
+    { "StorageMind",   StorageMind_RunAllPhases,
+      MIND_GRP_TRUST,
+      MIND_GRP_STATS | MIND_GRP_SCHEDULER | MIND_GRP_IO | MIND_GRP_STORAGE,
+      0, "StorageMindFailure" },
+    // PHASE 951–980: KERNEL SELF-AWARENESS MIND
+    { "KernelMind",    KernelMind_RunAllPhases,
+      MIND_GRP_STATS | MIND_GRP_SCHEDULER | MIND_GRP_TRUST | MIND_GRP_ENTROPY | MIND_GRP_POWER,
+      MIND_GRP_AI | MIND_GRP_SELF,
+      0, "KernelMindFailure" },
+};
 
-    EFI_STATUS Status;
+// Same sum Phase173 stores in the block.
+static BOOLEAN LoaderParamsValid(const LOADER_PARAMS_BLOCK *Block) {
+    UINT32 Sum = 0;
+    if (Block == NULL) return FALSE;
+    for (UINTN i = 0; i < sizeof(Block->Params); ++i) Sum ^= ((const UINT8*)&Block->Params)[i];
+    return Sum == Block->Checksum;
+}
 
-    // === PHASE 001–150: CPU MIND ===
-    Status = CpuMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("CpuMindFailure", 1, Status);
-        return Status;
-    }
+// Enabled APs the loader saw through MP services, so ApPool_Start can stop
+// waiting once they are all in. 0 without a topology section.
+static UINTN HandoffApCount(const BOOT_HANDOFF *Handoff) {
+    const BOOT_HANDOFF_SECTION *Sec;
+    const HANDOFF_CPU *Cpu;
+    UINTN Count = 0;
 
-    // === PHASE 151–300: MEMORY MIND ===
-    Status = MemoryMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("MemoryMindFailure", 2, Status);
-        return Status;
-    }
+    if (!Handoff || (Sec = BootHandoff_Find(Handoff, HANDOFF_TYPE_CPU_TOPOLOGY)) == NULL ||
+        !BOOT_HANDOFF_HAS(Sec, HANDOFF_CPU_TOPOLOGY, BspIndex)) return 0;
+    const HANDOFF_CPU_TOPOLOGY *T = BOOT_HANDOFF_PAYLOAD(Sec);
+    for (UINT32 i = 0; (Cpu = BootHandoff_Entry(Sec, i, sizeof(HANDOFF_CPU))) != NULL; ++i)
+        if (i != T->BspIndex && (Cpu->StatusFlag & PROCESSOR_ENABLED_BIT)) Count++;
+    return Count;
+}
 
-    // === PHASE 301–450: GPU MIND ===
-    Status = GpuMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("GpuMindFailure", 3, Status);
-        return Status;
+// === ENTRY POINT ===
+// The loader jumps here with its parameter block. The region index and the
+// handoff block come from it; a missing or corrupt block leaves both NULL.
+EFI_STATUS AiOS_KernelMain(const LOADER_PARAMS_BLOCK *Block) {
+    const MEMORY_REGION_INDEX *Regions = NULL;
+    const BOOT_HANDOFF *Handoff = NULL;
+    const BOOT_HANDOFF_SECTION *Sec;
+    EFI_PHYSICAL_ADDRESS ApTrampoline = 0;
+    if (LoaderParamsValid(Block)) {
+        Regions = Block->Params.MemoryRegions;
+        Handoff = Block->Params.Handoff;
+        ApTrampoline = Block->Params.ApTrampoline;
     }
+    if (!BootHandoff_Valid(Handoff)) Handoff = NULL;
 
-    // === PHASE 451–460: SCHEDULER MIND ===
-    Status = SchedulerMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("SchedulerMindFailure", 4, Status);
-        return Status;
+    // The loader already calibrated; reuse it rather than measure again.
+    if (Handoff && (Sec = BootHandoff_Find(Handoff, HANDOFF_TYPE_TSC)) != NULL &&
+        BOOT_HANDOFF_HAS(Sec, HANDOFF_TSC_INFO, Invariant)) {
+        const HANDOFF_TSC_INFO *T = BOOT_HANDOFF_PAYLOAD(Sec);
+        Tsc_Adopt(T->Hz, (TSC_SOURCE)T->Source, T->Invariant != 0);
     }
-
-    // === PHASE 561–600: IO MIND ===
-    Status = IOMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("IOMindFailure", 5, Status);
-        return Status;
+    Tsc_Calibrate();
+    Telemetry_LogEvent("AiOS_Kernel_Begin", 0, 0);
+    // MP services died with boot services; without a pool every mind runs on the BSP.
+    EFI_STATUS ApStatus = ApPool_Start(ApTrampoline, HandoffApCount(Handoff));
+    Telemetry_LogEvent("AiOS_ApPool", ApPool_Count(), ApStatus);
+    if (Handoff && (Sec = BootHandoff_Find(Handoff, HANDOFF_TYPE_PHASE_TIMINGS)) != NULL &&
+        BOOT_HANDOFF_HAS(Sec, HANDOFF_PHASE_TIMINGS, LoaderNs)) {
+        const HANDOFF_PHASE_TIMINGS *P = BOOT_HANDOFF_PAYLOAD(Sec);
+        Telemetry_LogEvent("AiOS_Loader_Timings", (UINTN)(P->LoaderNs / 1000), P->Phases.Count);
     }
+    gKernelCtx.cold = &gKernelCold;
+    gKernelCtx.Regions = Regions;
+    gKernelCtx.Handoff = Handoff;
+    gKernelCtx.DescriptorCount = Regions ? Regions->Count : 0;
+    Trust_Reset();
+    gKernelCtx.total_phases = 0;
+    gKernelCtx.trust_score = 0;
 
-    // === PHASE 601–650: STORAGE MIND ===
-    Status = StorageMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("StorageMindFailure", 6, Status);
-        return Status;
+    EFI_STATUS Status = MindDispatch_Run(&gKernelCtx, gMinds, sizeof(gMinds) / sizeof(gMinds[0]));
+    MindDispatch_Report();
+    for (UINTN i = 0; i < MIND_SLOT_COUNT; ++i) {
+        gKernelCtx.total_phases += gKernelCtx.mind_counters[i].phases;
+        gKernelCtx.MissCount += gKernelCtx.mind_counters[i].misses;
+        gKernelCtx.EntropyScore ^= gKernelCtx.mind_counters[i].entropy;
     }
-
-    // === PHASE 951–980: KERNEL SELF-AWARENESS MIND ===
-    Status = KernelMind_RunAllPhases(&gKernelCtx);
-    if (EFI_ERROR(Status)) {
-        Telemetry_LogEvent("KernelMindFailure", 7, Status);
+    if (EFI_ERROR(Status))
         return Status;
-    }
 
     // Final AI wrap-up
     gKernelCtx.trust_score = Trust_GetCurrentScore();
     AICore_ReportPhase("kernel_mind_complete", gKernelCtx.trust_score);
     Telemetry_LogEvent("AiOS_Kernel_Ready", gKernelCtx.trust_score, gKernelCtx.total_phases);
+    Telemetry_Drain();
 
     return EFI_SUCCESS;
 }
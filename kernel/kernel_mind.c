@@ -1,6 +1,7 @@
 #include "kernel_shared.h"
 #include "kernel_mind.h"
 #include "telemetry_mind.h"
+#include "phase_registry.h"
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseLib.h>
@@ -241,47 +242,41 @@ EFI_STATUS KernelMind_Phase980_EmitAwakeningSignal(KERNEL_CONTEXT *ctx) {
     return EFI_SUCCESS;
 }
 
+PHASE_ENTRY gKernelMindPhases[] = {
+    PHASE(951, PHASE_MIND_KERNEL, KernelMind_Phase951_BootstrapSelfAwareness, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(952, PHASE_MIND_KERNEL, KernelMind_Phase952_EvaluateTrustSlope, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(953, PHASE_MIND_KERNEL, KernelMind_Phase953_TrackMetaGoals, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(954, PHASE_MIND_KERNEL, KernelMind_Phase954_FuseSubsystemTrust, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(955, PHASE_MIND_KERNEL, KernelMind_Phase955_BuildCognitionGraph, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(956, PHASE_MIND_KERNEL, KernelMind_Phase956_ReflectIntrospectively, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(957, PHASE_MIND_KERNEL, KernelMind_Phase957_DetectTrustContradiction, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(958, PHASE_MIND_KERNEL, KernelMind_Phase958_SynthesizeConsciousState, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(959, PHASE_MIND_KERNEL, KernelMind_Phase959_BroadcastMetaTelemetry, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(960, PHASE_MIND_KERNEL, KernelMind_Phase960_MonitorSelfTrustStability, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(961, PHASE_MIND_KERNEL, KernelMind_Phase961_ResolveGoalConflict, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(962, PHASE_MIND_KERNEL, KernelMind_Phase962_ScorePhaseAwarenessDelta, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(963, PHASE_MIND_KERNEL, KernelMind_Phase963_TrackGoalMomentum, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(964, PHASE_MIND_KERNEL, KernelMind_Phase964_SelectConsciousPhase, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(965, PHASE_MIND_KERNEL, KernelMind_Phase965_RegulateSelfEntropy, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(966, PHASE_MIND_KERNEL, KernelMind_Phase966_GuardConsciousLoop, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(967, PHASE_MIND_KERNEL, KernelMind_Phase967_TuneSelfRecoveryBias, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(968, PHASE_MIND_KERNEL, KernelMind_Phase968_BuildTrustEntropyMap, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(969, PHASE_MIND_KERNEL, KernelMind_Phase969_EmitStabilityScore, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(970, PHASE_MIND_KERNEL, KernelMind_Phase970_DiagnoseGoalFailures, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(971, PHASE_MIND_KERNEL, KernelMind_Phase971_FinalizeFeedbackLoop, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(972, PHASE_MIND_KERNEL, KernelMind_Phase972_LimitReflectionVolatility, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(973, PHASE_MIND_KERNEL, KernelMind_Phase973_ComposeEgoVector, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(974, PHASE_MIND_KERNEL, KernelMind_Phase974_EmitExistentialCheckpoint, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(975, PHASE_MIND_KERNEL, KernelMind_Phase975_ExpandForecastHorizon, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(976, PHASE_MIND_KERNEL, KernelMind_Phase976_PreventTrustCollapse, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(977, PHASE_MIND_KERNEL, KernelMind_Phase977_ResyncIntent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(978, PHASE_MIND_KERNEL, KernelMind_Phase978_AdvisePhaseOptimization, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(979, PHASE_MIND_KERNEL, KernelMind_Phase979_FinalizeMetaCognition, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(980, PHASE_MIND_KERNEL, KernelMind_Phase980_EmitAwakeningSignal, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+};
+const UINTN gKernelMindPhaseCount = sizeof(gKernelMindPhases) / sizeof(gKernelMindPhases[0]);
+
 EFI_STATUS KernelMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
-    EFI_STATUS Status = EFI_SUCCESS;
-    for (UINTN phase = 951; phase <= 980; ++phase) {
-        switch (phase) {
-            case 951: Status = KernelMind_Phase951_BootstrapSelfAwareness(ctx); break;
-            case 952: Status = KernelMind_Phase952_EvaluateTrustSlope(ctx); break;
-            case 953: Status = KernelMind_Phase953_TrackMetaGoals(ctx); break;
-            case 954: Status = KernelMind_Phase954_FuseSubsystemTrust(ctx); break;
-            case 955: Status = KernelMind_Phase955_BuildCognitionGraph(ctx); break;
-            case 956: Status = KernelMind_Phase956_ReflectIntrospectively(ctx); break;
-            case 957: Status = KernelMind_Phase957_DetectTrustContradiction(ctx); break;
-            case 958: Status = KernelMind_Phase958_SynthesizeConsciousState(ctx); break;
-            case 959: Status = KernelMind_Phase959_BroadcastMetaTelemetry(ctx); break;
-            case 960: Status = KernelMind_Phase960_MonitorSelfTrustStability(ctx); break;
-            case 961: Status = KernelMind_Phase961_ResolveGoalConflict(ctx); break;
-            case 962: Status = KernelMind_Phase962_ScorePhaseAwarenessDelta(ctx); break;
-            case 963: Status = KernelMind_Phase963_TrackGoalMomentum(ctx); break;
-            case 964: Status = KernelMind_Phase964_SelectConsciousPhase(ctx); break;
-            case 965: Status = KernelMind_Phase965_RegulateSelfEntropy(ctx); break;
-            case 966: Status = KernelMind_Phase966_GuardConsciousLoop(ctx); break;
-            case 967: Status = KernelMind_Phase967_TuneSelfRecoveryBias(ctx); break;
-            case 968: Status = KernelMind_Phase968_BuildTrustEntropyMap(ctx); break;
-            case 969: Status = KernelMind_Phase969_EmitStabilityScore(ctx); break;
-            case 970: Status = KernelMind_Phase970_DiagnoseGoalFailures(ctx); break;
-            case 971: Status = KernelMind_Phase971_FinalizeFeedbackLoop(ctx); break;
-            case 972: Status = KernelMind_Phase972_LimitReflectionVolatility(ctx); break;
-            case 973: Status = KernelMind_Phase973_ComposeEgoVector(ctx); break;
-            case 974: Status = KernelMind_Phase974_EmitExistentialCheckpoint(ctx); break;
-            case 975: Status = KernelMind_Phase975_ExpandForecastHorizon(ctx); break;
-            case 976: Status = KernelMind_Phase976_PreventTrustCollapse(ctx); break;
-            case 977: Status = KernelMind_Phase977_ResyncIntent(ctx); break;
-            case 978: Status = KernelMind_Phase978_AdvisePhaseOptimization(ctx); break;
-            case 979: Status = KernelMind_Phase979_FinalizeMetaCognition(ctx); break;
-            case 980: Status = KernelMind_Phase980_EmitAwakeningSignal(ctx); break;
-            default: Status = EFI_INVALID_PARAMETER; break;
-        }
-        if (EFI_ERROR(Status)) {
-            Telemetry_LogEvent("KernelMindErr", phase, Status);
-            return Status;
-        }
-        ctx->total_phases++;
-    }
-    return EFI_SUCCESS;
+    PHASE_RUN Run = { "KernelMindErr", TRUE };
+    return PhaseRegistry_Run(gKernelMindPhases, gKernelMindPhaseCount, ctx, &Run);
 }
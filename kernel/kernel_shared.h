@@ -9,10 +9,9 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 
-#include "ai_core.h"
-#include "telemetry_mind.h"
-#include "trust_mind.h"
-#include "entropy_mind.h"
+#include "tsc.h"
+#include "memory_regions.h"
+#include "boot_handoff.h"
 
 // ==================== Constants ====================
 
@@ -20,33 +19,78 @@
 #define MEMORY_PHASE_COUNT     150
 #define TOTAL_PHASE_COUNT      (CPU_PHASE_COUNT + MEMORY_PHASE_COUNT)
 
-#define CPU_PHASE_THRESHOLD    5000000
-#define MEMORY_PHASE_THRESHOLD 4000000
+// Phase budgets are wall time; the *_THRESHOLD forms are the same budget
+// in TSC ticks for code that compares raw AsmReadTsc() deltas.
+#define CPU_PHASE_DEADLINE_NS      2500000
+#define MEMORY_PHASE_DEADLINE_NS   2000000
+#define CPU_PHASE_THRESHOLD        Tsc_FromNs(CPU_PHASE_DEADLINE_NS)
+#define MEMORY_PHASE_THRESHOLD     Tsc_FromNs(MEMORY_PHASE_DEADLINE_NS)
+#define MEMORY_ZERO_MAX_CPUS   64
+
+#define KERNEL_CACHE_LINE      64
+#define KERNEL_CACHE_ALIGNED   __attribute__((aligned(KERNEL_CACHE_LINE)))
 
 #define CPU_PHASE_MAX_LOAD     10000000
 #define MEMORY_ENTROPY_SALT    0x1A2B3C4D
 
 // ==================== Shared State ====================
 
+// Large tables touched by one or two phases each. They live outside the
+// context so the per-mind sections below stay a few cache lines long.
+typedef struct {
+    INT16   ai_rule_weights[961];
+    UINT64  ai_trust_matrix[10][10];
+    UINT8   nvme_smart_log[512];
+    UINT8   trust_heatmap[100];
+    UINT64  thermal_phase_impact_map[100];
+    UINT64  entropy_heatmap[10][10];
+    UINT64  entropy_phase_map[100];
+    UINT64  energy_heatmap[10][10];
+} KERNEL_COLD;
+
+// Counters a mind bumps on every phase. Each dispatched mind that keeps
+// them owns one slot, so they carry no dispatcher group; kernel_main adds
+// them into total_phases, MissCount and EntropyScore after dispatch.
+typedef enum {
+    MIND_SLOT_GPU,
+    MIND_SLOT_IO,
+    MIND_SLOT_COUNT
+} MIND_SLOT;
+
+typedef struct {
+    UINTN  phases KERNEL_CACHE_ALIGNED;
+    UINTN  misses;
+    UINT64 entropy;
+} MIND_COUNTERS;
+
+// Each mind's section starts on its own cache line, so minds running on
+// different cores only share lines they actually both write.
 typedef struct {
     UINTN total_phases;
+    KERNEL_COLD *cold;
     UINT64 trust_score;
-    UINT64 cpu_elapsed_tsc[CPU_PHASE_COUNT + 1];
+    UINT64 EntropyScore;
+    UINTN MissCount;
+    UINT64 cpu_elapsed_tsc[CPU_PHASE_COUNT + 1] KERNEL_CACHE_ALIGNED;
     UINT8 cpu_missed[CPU_PHASE_COUNT + 1];
-    UINT64 memory_elapsed_tsc[MEMORY_PHASE_COUNT + 1];
+    UINT64 memory_elapsed_tsc[MEMORY_PHASE_COUNT + 1] KERNEL_CACHE_ALIGNED;
     UINT8 memory_missed[MEMORY_PHASE_COUNT + 1];
+    MIND_COUNTERS mind_counters[MIND_SLOT_COUNT];
 
     // Memory-specific fields
-    VOID *MemoryMap;
+    VOID *MemoryMap KERNEL_CACHE_ALIGNED;
     UINTN MemoryMapSize;
     UINTN DescriptorSize;
     UINT32 DescriptorVersion;
     UINTN DescriptorCount;
-    UINT64 EntropyScore;
-    UINTN MissCount;
+    const MEMORY_REGION_INDEX *Regions;         // from the loader; NULL when started without one
+    const BOOT_HANDOFF *Handoff;                // likewise; NULL or failed BootHandoff_Valid
+    UINT32 zero_cpu_count;                      // CPUs that cleared memory in phase 105
+    UINT32 zero_mbps[MEMORY_ZERO_MAX_CPUS];     // per-CPU clear rate, slot 0 is the BSP
+    UINT32 zero_total_mbps;
 
     /* Scheduler-specific fields */
-    UINT64 scheduler_entropy_buffer[16];
+    UINT64 scheduler_entropy_buffer[16] KERNEL_CACHE_ALIGNED;
     UINTN scheduler_entropy_index;
     UINTN cpu_load_map[8];
     UINTN hotspot_cpu;
@@ -86,7 +130,7 @@ typedef struct {
     UINT64 sched_health;
     BOOLEAN sched_cycle_complete;
     /* IO mind fields */
-    UINT64 device_entropy_map[16];
+    UINT64 device_entropy_map[16] KERNEL_CACHE_ALIGNED;
     UINT64 io_trust_map[3];
     UINT64 io_entropy_buffer[16];
     UINT8 io_latency_flags[16];
@@ -101,14 +145,13 @@ typedef struct {
     UINT64 final_io_summary;
     BOOLEAN io_mind_complete;
     /* Storage mind fields */
-    UINT64 nvme_bar[4];
-    UINT8  nvme_smart_log[512];
+    UINT64 nvme_bar[4] KERNEL_CACHE_ALIGNED;
     UINTN  nvme_temperature;
     UINTN  nvme_error_count;
     UINTN  nvme_unsafe_shutdowns;
     UINT8  storage_phase_class;
     /* Trust mind fields */
-    UINT64 kernel_trust_score;
+    UINT64 kernel_trust_score KERNEL_CACHE_ALIGNED;
     BOOLEAN trust_ready;
     BOOLEAN trust_finalized;
     UINT8  trust_anchor[32];
@@ -123,7 +166,6 @@ typedef struct {
     UINT64  trust_floor;
     UINT64  trust_damage_index;
     INT64   trust_slope_buffer[20];
-    UINT8   trust_heatmap[100];
     UINT64  trust_smoothed[20];
     UINT64  trust_normalized[20];
     UINT64  meta_trust_score;
@@ -134,7 +176,7 @@ typedef struct {
     } entropy_snapshot_buffer[32];
     UINTN entropy_snapshot_index;
     /* AI core fields */
-    UINT64 ai_global_trust_score;
+    UINT64 ai_global_trust_score KERNEL_CACHE_ALIGNED;
     UINT8  ai_status;
     UINT64 ai_history[128];
     UINT64 intent_alignment_score;
@@ -148,8 +190,6 @@ typedef struct {
     UINT8   entropy_usage_percent;
     UINT8   thermal_advisory;
     UINT64  ai_root_reasoning_tree_hash;
-    INT16   ai_rule_weights[961];
-    UINT64  ai_trust_matrix[10][10];
     UINT64  ai_entropy_input[16];
     UINT64  ai_prediction_cache[32];
     UINT8   ai_advisory_signature[32];
@@ -158,9 +198,8 @@ typedef struct {
     BOOLEAN ai_finalized;
 
     /* Thermal mind fields */
-    struct { UINT64 cpu_mean; UINT64 gpu_mean; UINT64 cpu_stddev; UINT64 gpu_stddev; } thermal_baseline;
+    struct { UINT64 cpu_mean; UINT64 gpu_mean; UINT64 cpu_stddev; UINT64 gpu_stddev; } thermal_baseline KERNEL_CACHE_ALIGNED;
     UINT64  thermal_rise_rate;
-    UINT64  thermal_phase_impact_map[100];
     UINT64  thermal_forecast[20];
     UINT8   thermal_hot_zone_id;
     BOOLEAN thermal_safe_mode;
@@ -168,15 +207,13 @@ typedef struct {
     BOOLEAN thermal_mind_finalized;
 
     /* Entropy mind fields */
-    UINT8   entropy_source_score[3];
+    UINT8   entropy_source_score[3] KERNEL_CACHE_ALIGNED;
     struct { UINT64 mean; UINT64 stddev; } entropy_baseline;
-    UINT64  entropy_heatmap[10][10];
     INT64   entropy_prediction_delta[5];
     INT64   entropy_prediction_weights[5];
     UINT8   entropy_density_score[3];
     UINT64  entropy_thermal_correlation;
     UINT64  entropy_recovery_time;
-    UINT64  entropy_phase_map[100];
     UINT8   entropy_resilience_factor;
     UINT8   entropy_stability_window;
     INT64   entropy_micro_drift;
@@ -196,7 +233,7 @@ typedef struct {
     BOOLEAN entropy_mind_locked;
 
     /* Network mind fields */
-    UINT8   mac_trust_profile[16];
+    UINT8   mac_trust_profile[16] KERNEL_CACHE_ALIGNED;
     UINT16  vlan_context[16];
     UINT64  packet_entropy_score[32];
     UINT64  anomaly_fingerprint[8][2];
@@ -206,7 +243,7 @@ typedef struct {
     BOOLEAN vlan_alert;
     BOOLEAN network_mind_ready;
     /* Power mind fields */
-    UINT8   battery_percent;
+    UINT8   battery_percent KERNEL_CACHE_ALIGNED;
     INT8    battery_curve[64];
     INT8    discharge_slope;
     UINT64  power_anomaly_log[16];
@@ -217,7 +254,6 @@ typedef struct {
     BOOLEAN power_mind_ready;
     UINT64  phase_energy_log[64];
     UINTN   energy_log_index;
-    UINT64  energy_heatmap[10][10];
     BOOLEAN power_precollapse_flag;
     BOOLEAN power_guardian_mode;
     BOOLEAN power_data_quarantined;
@@ -225,7 +261,7 @@ typedef struct {
     BOOLEAN power_mind_finalized;
 
     /* Kernel self-awareness fields */
-    VOID    *kernel_self_state;
+    VOID    *kernel_self_state KERNEL_CACHE_ALIGNED;
     UINT8    meta_goal_progress[16];
     UINT64   fused_trust_score;
     UINT64   phase_cognition_map[50];
@@ -244,4 +280,41 @@ typedef struct {
     BOOLEAN  meta_cognition_final;
 } KERNEL_CONTEXT;
 
+#define KERNEL_LINE_OF(f)          (OFFSET_OF(KERNEL_CONTEXT, f) / KERNEL_CACHE_LINE)
+#define KERNEL_LAST_LINE_OF(f)     ((OFFSET_OF(KERNEL_CONTEXT, f) + sizeof(((KERNEL_CONTEXT*)0)->f) - 1) / KERNEL_CACHE_LINE)
+#define KERNEL_SAME_LINE(a, b)     (KERNEL_LINE_OF(a) == KERNEL_LAST_LINE_OF(b))
+#define KERNEL_SECTION_LINES(f, n) (KERNEL_LINE_OF(n) - KERNEL_LINE_OF(f))
+
+// The stats every mind reads each phase fit one line, and so does the
+// part of the memory map the memory mind walks.
+STATIC_ASSERT(KERNEL_LINE_OF(total_phases) == 0 && KERNEL_SAME_LINE(total_phases, MissCount), "stats header spills its first line");
+STATIC_ASSERT(KERNEL_SAME_LINE(MemoryMap, Handoff), "memory map header spills its first line");
+STATIC_ASSERT(KERNEL_SAME_LINE(nvme_bar, storage_phase_class), "storage section spills its line");
+STATIC_ASSERT(sizeof(MIND_COUNTERS) == KERNEL_CACHE_LINE, "MIND_COUNTERS slots share cache lines");
+
+// Section sizes in lines. A change here moves every later section, so
+// update the count deliberately rather than to make the build pass.
+STATIC_ASSERT(KERNEL_SECTION_LINES(total_phases, cpu_elapsed_tsc) == 1, "stats header size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(cpu_elapsed_tsc, memory_elapsed_tsc) == 22, "CPU timing size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(memory_elapsed_tsc, mind_counters) == 22, "memory timing size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(mind_counters, MemoryMap) == MIND_SLOT_COUNT, "mind counters size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(MemoryMap, scheduler_entropy_buffer) == 5, "memory section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(scheduler_entropy_buffer, device_entropy_map) == 60, "scheduler section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(device_entropy_map, nvme_bar) == 11, "IO section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(nvme_bar, kernel_trust_score) == 1, "storage section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(kernel_trust_score, ai_global_trust_score) == 19, "trust section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(ai_global_trust_score, thermal_baseline) == 28, "AI section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(thermal_baseline, entropy_source_score) == 4, "thermal section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(entropy_source_score, mac_trust_profile) == 10, "entropy section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(mac_trust_profile, battery_percent) == 8, "network section size changed");
+STATIC_ASSERT(KERNEL_SECTION_LINES(battery_percent, kernel_self_state) == 12, "power section size changed");
+STATIC_ASSERT(sizeof(KERNEL_CONTEXT) / KERNEL_CACHE_LINE - KERNEL_LINE_OF(kernel_self_state) == 15, "self section size changed");
+STATIC_ASSERT(sizeof(KERNEL_CONTEXT) % KERNEL_CACHE_LINE == 0, "KERNEL_CONTEXT size not a cache-line multiple");
+
+// Mind APIs take KERNEL_CONTEXT, so they can only come after it.
+#include "ai_core.h"
+#include "telemetry_mind.h"
+#include "trust_mind.h"
+#include "entropy_mind.h"
+
 #endif // KERNEL_SHARED_H
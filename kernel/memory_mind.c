@@ -6,17 +6,169 @@
 #include "trust_mind.h"
 #include "entropy_mind.h"
 #include "ai_core.h"
-#include <Library/UefiBootServicesTableLib.h>
+#include "ap_pool.h"
+#include <Library/SynchronizationLib.h>
+#include <cpuid.h>
+#include <emmintrin.h>
 
 #define MEMORY_PHASE_COUNT       150
-#define MEMORY_PHASE_THRESHOLD   4000000
 #define MEMORY_ENTROPY_SALT      0x1A2B3C4D
 #define MEMORY_TRUST_THRESHOLD   0x100000
 
 MEMORY_STATE gMemState;
 
+// ==================== Phase 105: Conventional Memory Zeroing ====================
+// Free memory is cut into fixed stripes that every idle CPU pulls from a
+// shared counter, so a busy or failed AP only means the others take more
+// stripes. Each stripe is cleared with non-temporal stores, or ERMS
+// `rep stosb` when a short trial on this machine shows it is faster.
+
+#define MEMORY_ZERO_STRIPE      (64ULL * 1024 * 1024)
+// Large enough that cached stores pay for their write-back inside the
+// trial; at 2 MiB `rep stosb` won the trial and then ran at half the
+// non-temporal rate on the stripes (tools/host/zero_bench).
+#define MEMORY_ZERO_TRIAL       (16ULL * 1024 * 1024)
+#define MEMORY_ZERO_MAX_RANGES  512
+
+typedef struct {
+    UINT64  Base;
+    UINT64  Bytes;
+    UINT64  FirstStripe;
+} MEMORY_ZERO_RANGE;
+
+typedef struct {
+    UINT64     Bytes;
+    UINT64     Tsc;
+    UINTN      Ap;          // ApPool index; unused for worker 0, the BSP
+} MEMORY_ZERO_WORKER;
+
+typedef struct {
+    MEMORY_ZERO_RANGE   Ranges[MEMORY_ZERO_MAX_RANGES];
+    UINTN               RangeCount;
+    UINT64              StripeCount;
+    volatile UINT32     NextStripe;
+    BOOLEAN             UseErms;
+    MEMORY_ZERO_WORKER  Workers[MEMORY_ZERO_MAX_CPUS];
+} MEMORY_ZERO_JOB;
+
+static MEMORY_ZERO_JOB gZeroJob;
+static KERNEL_CONTEXT *gMemCtx;
+
+VOID MemZeroNonTemporal(VOID *Dst, UINT64 Bytes) {
+    __m128i Zero = _mm_setzero_si128();
+    __m128i *P = (__m128i *)Dst;
+    for (UINT64 i = 0; i < Bytes / 64; ++i, P += 4) {
+        _mm_stream_si128(P + 0, Zero);
+        _mm_stream_si128(P + 1, Zero);
+        _mm_stream_si128(P + 2, Zero);
+        _mm_stream_si128(P + 3, Zero);
+    }
+    _mm_sfence();
+}
+
+VOID MemZeroErms(VOID *Dst, UINT64 Bytes) {
+    __asm__ __volatile__("rep stosb" : "+D"(Dst), "+c"(Bytes) : "a"(0) : "memory");
+}
+
+static BOOLEAN MemZeroHasErms(VOID) {
+    UINT32 Eax, Ebx, Ecx, Edx;
+    __cpuid(0, Eax, Ebx, Ecx, Edx);
+    if (Eax < 7) return FALSE;
+    __cpuid_count(7, 0, Eax, Ebx, Ecx, Edx);
+    return (Ebx >> 9) & 1;
+}
+
+static VOID MemZeroStripe(UINT64 Stripe, MEMORY_ZERO_WORKER *W) {
+    UINTN r = 0;
+    while (r + 1 < gZeroJob.RangeCount && gZeroJob.Ranges[r + 1].FirstStripe <= Stripe) ++r;
+    MEMORY_ZERO_RANGE *R = &gZeroJob.Ranges[r];
+    UINT64 Offset = (Stripe - R->FirstStripe) * MEMORY_ZERO_STRIPE;
+    UINT64 Bytes = R->Bytes - Offset;
+    if (Bytes > MEMORY_ZERO_STRIPE) Bytes = MEMORY_ZERO_STRIPE;
+
+    UINT64 Start = AsmReadTsc();
+    if (gZeroJob.UseErms) MemZeroErms((VOID *)(UINTN)(R->Base + Offset), Bytes);
+    else MemZeroNonTemporal((VOID *)(UINTN)(R->Base + Offset), Bytes);
+    W->Tsc += AsmReadTsc() - Start;
+    W->Bytes += Bytes;
+}
+
+static VOID EFIAPI MemZeroWorker(VOID *Arg) {
+    MEMORY_ZERO_WORKER *W = (MEMORY_ZERO_WORKER *)Arg;
+    for (;;) {
+        UINT64 Stripe = InterlockedIncrement((UINT32 *)&gZeroJob.NextStripe) - 1;
+        if (Stripe >= gZeroJob.StripeCount) break;
+        MemZeroStripe(Stripe, W);
+    }
+}
+
+// Times both store strategies on the start of the first range, which the
+// stripes clear again afterwards.
+static BOOLEAN MemZeroPickErms(VOID) {
+    if (!MemZeroHasErms() || gZeroJob.Ranges[0].Bytes < 2 * MEMORY_ZERO_TRIAL) return FALSE;
+    UINT8 *Base = (UINT8 *)(UINTN)gZeroJob.Ranges[0].Base;
+    UINT64 t0 = AsmReadTsc();
+    MemZeroNonTemporal(Base, MEMORY_ZERO_TRIAL);
+    UINT64 t1 = AsmReadTsc();
+    MemZeroErms(Base + MEMORY_ZERO_TRIAL, MEMORY_ZERO_TRIAL);
+    UINT64 t2 = AsmReadTsc();
+    return (t2 - t1) < (t1 - t0);
+}
+
+static EFI_STATUS MemZeroConventional(VOID) {
+    UINTN Workers = 1;
+
+    // The range table is static: a pool allocation here could land in one
+    // of the very descriptors about to be cleared.
+    // The loader's index is already coalesced, so each free run is one range.
+    ZeroMem(&gZeroJob, sizeof(gZeroJob));
+    const MEMORY_REGION_INDEX *Regions = gMemCtx->Regions;
+    for (UINTN i = 0; Regions && i < Regions->Count; ++i) {
+        const MEMORY_REGION *Reg = &Regions->Region[i];
+        if (Reg->Type != EfiConventionalMemory) continue;
+        if (gZeroJob.RangeCount == MEMORY_ZERO_MAX_RANGES) {
+            ZeroMem((VOID *)(UINTN)Reg->Base, Reg->Pages * 4096);
+            continue;
+        }
+        MEMORY_ZERO_RANGE *R = &gZeroJob.Ranges[gZeroJob.RangeCount++];
+        R->Base = Reg->Base;
+        R->Bytes = Reg->Pages * 4096;
+        R->FirstStripe = gZeroJob.StripeCount;
+        gZeroJob.StripeCount += (R->Bytes + MEMORY_ZERO_STRIPE - 1) / MEMORY_ZERO_STRIPE;
+    }
+    if (gZeroJob.RangeCount == 0) return EFI_SUCCESS;
+    gZeroJob.UseErms = MemZeroPickErms();
+
+    // Other minds may hold some APs; ApPool_Run turns those down and the
+    // rest of the stripes go to whoever did start.
+    for (UINTN Ap = 0; Ap < ApPool_Count() && Workers < MEMORY_ZERO_MAX_CPUS; ++Ap) {
+        MEMORY_ZERO_WORKER *W = &gZeroJob.Workers[Workers];
+        W->Ap = Ap;
+        if (EFI_ERROR(ApPool_Run(Ap, MemZeroWorker, W))) continue;
+        Workers++;
+    }
+
+    UINT64 Start = AsmReadTsc();
+    MemZeroWorker(&gZeroJob.Workers[0]);
+    for (UINTN i = 1; i < Workers; ++i)
+        while (ApPool_Busy(gZeroJob.Workers[i].Ap)) CpuPause();
+    UINT64 Wall = AsmReadTsc() - Start;
+
+    UINT64 TscPerSec = Tsc_Info()->Hz;
+    UINT64 Total = 0;
+    gMemCtx->zero_cpu_count = (UINT32)Workers;
+    for (UINTN i = 0; i < Workers; ++i) {
+        MEMORY_ZERO_WORKER *W = &gZeroJob.Workers[i];
+        gMemCtx->zero_mbps[i] = W->Tsc ? (UINT32)((W->Bytes >> 20) * TscPerSec / W->Tsc) : 0;
+        Total += W->Bytes;
+    }
+    gMemCtx->zero_total_mbps = Wall ? (UINT32)((Total >> 20) * TscPerSec / Wall) : 0;
+    Telemetry_LogEvent("MemoryZeroed", (UINTN)(Total >> 20), gMemCtx->zero_total_mbps);
+    return EFI_SUCCESS;
+}
+
 EFI_STATUS MemoryPhase_Execute(MEMORY_STATE *State, UINTN phase) {
-    if (phase >= MEMORY_PHASE_COUNT) return EFI_INVALID_PARAMETER;
+    if (phase == 0 || phase > MEMORY_PHASE_COUNT) return EFI_INVALID_PARAMETER;
     UINT64 tsc_start = AsmReadTsc();
     EFI_STATUS Status = EFI_SUCCESS;
 
@@ -26,943 +178,939 @@ EFI_STATUS MemoryPhase_Execute(MEMORY_STATE *State, UINTN phase) {
         // Phase 001 - Memory operation phase
         gMemState.EntropyScore ^= (1 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 1) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 2:
         // Phase 002 - Memory operation phase
         gMemState.EntropyScore ^= (2 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 2) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 3:
         // Phase 003 - Memory operation phase
         gMemState.EntropyScore ^= (3 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 3) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 4:
         // Phase 004 - Memory operation phase
         gMemState.EntropyScore ^= (4 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 4) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 5:
         // Phase 005 - Memory operation phase
         gMemState.EntropyScore ^= (5 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 5) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 6:
         // Phase 006 - Memory operation phase
         gMemState.EntropyScore ^= (6 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 6) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 7:
         // Phase 007 - Memory operation phase
         gMemState.EntropyScore ^= (7 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 7) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 8:
         // Phase 008 - Memory operation phase
         gMemState.EntropyScore ^= (8 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 8) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 9:
         // Phase 009 - Memory operation phase
         gMemState.EntropyScore ^= (9 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 9) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 10:
         // Phase 010 - Memory operation phase
         gMemState.EntropyScore ^= (10 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 10) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 11:
         // Phase 011 - Memory operation phase
         gMemState.EntropyScore ^= (11 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 11) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 12:
         // Phase 012 - Memory operation phase
         gMemState.EntropyScore ^= (12 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 12) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 13:
         // Phase 013 - Memory operation phase
         gMemState.EntropyScore ^= (13 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 13) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 14:
         // Phase 014 - Memory operation phase
         gMemState.EntropyScore ^= (14 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 14) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 15:
         // Phase 015 - Memory operation phase
         gMemState.EntropyScore ^= (15 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 15) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 16:
         // Phase 016 - Memory operation phase
         gMemState.EntropyScore ^= (16 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 16) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 17:
         // Phase 017 - Memory operation phase
         gMemState.EntropyScore ^= (17 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 17) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 18:
         // Phase 018 - Memory operation phase
         gMemState.EntropyScore ^= (18 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 18) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 19:
         // Phase 019 - Memory operation phase
         gMemState.EntropyScore ^= (19 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 19) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 20:
         // Phase 020 - Memory operation phase
         gMemState.EntropyScore ^= (20 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 20) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 21:
         // Phase 021 - Memory operation phase
         gMemState.EntropyScore ^= (21 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 21) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 22:
         // Phase 022 - Memory operation phase
         gMemState.EntropyScore ^= (22 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 22) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 23:
         // Phase 023 - Memory operation phase
         gMemState.EntropyScore ^= (23 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 23) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 24:
         // Phase 024 - Memory operation phase
         gMemState.EntropyScore ^= (24 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 24) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 25:
         // Phase 025 - Memory operation phase
         gMemState.EntropyScore ^= (25 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 25) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 26:
         // Phase 026 - Memory operation phase
         gMemState.EntropyScore ^= (26 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 26) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 27:
         // Phase 027 - Memory operation phase
         gMemState.EntropyScore ^= (27 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 27) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 28:
         // Phase 028 - Memory operation phase
         gMemState.EntropyScore ^= (28 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 28) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 29:
         // Phase 029 - Memory operation phase
         gMemState.EntropyScore ^= (29 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 29) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 30:
         // Phase 030 - Memory operation phase
         gMemState.EntropyScore ^= (30 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 30) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 31:
         // Phase 031 - Memory operation phase
         gMemState.EntropyScore ^= (31 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 31) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 32:
         // Phase 032 - Memory operation phase
         gMemState.EntropyScore ^= (32 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 32) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 33:
         // Phase 033 - Memory operation phase
         gMemState.EntropyScore ^= (33 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 33) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 34:
         // Phase 034 - Memory operation phase
         gMemState.EntropyScore ^= (34 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 34) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 35:
         // Phase 035 - Memory operation phase
         gMemState.EntropyScore ^= (35 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 35) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 36:
         // Phase 036 - Memory operation phase
         gMemState.EntropyScore ^= (36 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 36) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 37:
         // Phase 037 - Memory operation phase
         gMemState.EntropyScore ^= (37 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 37) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 38:
         // Phase 038 - Memory operation phase
         gMemState.EntropyScore ^= (38 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 38) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 39:
         // Phase 039 - Memory operation phase
         gMemState.EntropyScore ^= (39 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 39) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 40:
         // Phase 040 - Memory operation phase
         gMemState.EntropyScore ^= (40 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 40) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 41:
         // Phase 041 - Memory operation phase
         gMemState.EntropyScore ^= (41 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 41) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 42:
         // Phase 042 - Memory operation phase
         gMemState.EntropyScore ^= (42 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 42) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 43:
         // Phase 043 - Memory operation phase
         gMemState.EntropyScore ^= (43 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 43) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 44:
         // Phase 044 - Memory operation phase
         gMemState.EntropyScore ^= (44 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 44) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 45:
         // Phase 045 - Memory operation phase
         gMemState.EntropyScore ^= (45 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 45) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 46:
         // Phase 046 - Memory operation phase
         gMemState.EntropyScore ^= (46 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 46) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 47:
         // Phase 047 - Memory operation phase
         gMemState.EntropyScore ^= (47 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 47) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 48:
         // Phase 048 - Memory operation phase
         gMemState.EntropyScore ^= (48 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 48) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 49:
         // Phase 049 - Memory operation phase
         gMemState.EntropyScore ^= (49 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 49) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 50:
         // Phase 050 - Memory operation phase
         gMemState.EntropyScore ^= (50 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 50) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 51:
         // Phase 051 - Memory operation phase
         gMemState.EntropyScore ^= (51 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 51) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 52:
         // Phase 052 - Memory operation phase
         gMemState.EntropyScore ^= (52 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 52) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 53:
         // Phase 053 - Memory operation phase
         gMemState.EntropyScore ^= (53 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 53) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 54:
         // Phase 054 - Memory operation phase
         gMemState.EntropyScore ^= (54 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 54) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 55:
         // Phase 055 - Memory operation phase
         gMemState.EntropyScore ^= (55 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 55) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 56:
         // Phase 056 - Memory operation phase
         gMemState.EntropyScore ^= (56 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 56) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 57:
         // Phase 057 - Memory operation phase
         gMemState.EntropyScore ^= (57 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 57) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 58:
         // Phase 058 - Memory operation phase
         gMemState.EntropyScore ^= (58 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 58) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 59:
         // Phase 059 - Memory operation phase
         gMemState.EntropyScore ^= (59 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 59) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 60:
         // Phase 060 - Memory operation phase
         gMemState.EntropyScore ^= (60 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 60) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 61:
         // Phase 061 - Memory operation phase
         gMemState.EntropyScore ^= (61 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 61) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 62:
         // Phase 062 - Memory operation phase
         gMemState.EntropyScore ^= (62 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 62) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 63:
         // Phase 063 - Memory operation phase
         gMemState.EntropyScore ^= (63 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 63) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 64:
         // Phase 064 - Memory operation phase
         gMemState.EntropyScore ^= (64 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 64) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 65:
         // Phase 065 - Memory operation phase
         gMemState.EntropyScore ^= (65 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 65) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 66:
         // Phase 066 - Memory operation phase
         gMemState.EntropyScore ^= (66 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 66) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 67:
         // Phase 067 - Memory operation phase
         gMemState.EntropyScore ^= (67 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 67) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 68:
         // Phase 068 - Memory operation phase
         gMemState.EntropyScore ^= (68 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 68) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 69:
         // Phase 069 - Memory operation phase
         gMemState.EntropyScore ^= (69 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 69) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 70:
         // Phase 070 - Memory operation phase
         gMemState.EntropyScore ^= (70 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 70) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 71:
         // Phase 071 - Memory operation phase
         gMemState.EntropyScore ^= (71 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 71) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 72:
         // Phase 072 - Memory operation phase
         gMemState.EntropyScore ^= (72 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 72) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 73:
         // Phase 073 - Memory operation phase
         gMemState.EntropyScore ^= (73 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 73) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 74:
         // Phase 074 - Memory operation phase
         gMemState.EntropyScore ^= (74 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 74) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 75:
         // Phase 075 - Memory operation phase
         gMemState.EntropyScore ^= (75 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 75) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 76:
         // Phase 076 - Memory operation phase
         gMemState.EntropyScore ^= (76 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 76) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 77:
         // Phase 077 - Memory operation phase
         gMemState.EntropyScore ^= (77 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 77) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 78:
         // Phase 078 - Memory operation phase
         gMemState.EntropyScore ^= (78 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 78) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 79:
         // Phase 079 - Memory operation phase
         gMemState.EntropyScore ^= (79 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 79) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 80:
         // Phase 080 - Memory operation phase
         gMemState.EntropyScore ^= (80 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 80) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 81:
         // Phase 081 - Memory operation phase
         gMemState.EntropyScore ^= (81 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 81) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 82:
         // Phase 082 - Memory operation phase
         gMemState.EntropyScore ^= (82 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 82) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 83:
         // Phase 083 - Memory operation phase
         gMemState.EntropyScore ^= (83 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 83) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 84:
         // Phase 084 - Memory operation phase
         gMemState.EntropyScore ^= (84 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 84) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 85:
         // Phase 085 - Memory operation phase
         gMemState.EntropyScore ^= (85 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 85) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 86:
         // Phase 086 - Memory operation phase
         gMemState.EntropyScore ^= (86 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 86) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 87:
         // Phase 087 - Memory operation phase
         gMemState.EntropyScore ^= (87 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 87) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 88:
         // Phase 088 - Memory operation phase
         gMemState.EntropyScore ^= (88 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 88) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 89:
         // Phase 089 - Memory operation phase
         gMemState.EntropyScore ^= (89 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 89) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 90:
         // Phase 090 - Memory operation phase
         gMemState.EntropyScore ^= (90 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 90) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 91:
         // Phase 091 - Memory operation phase
         gMemState.EntropyScore ^= (91 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 91) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 92:
         // Phase 092 - Memory operation phase
         gMemState.EntropyScore ^= (92 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 92) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 93:
         // Phase 093 - Memory operation phase
         gMemState.EntropyScore ^= (93 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 93) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 94:
         // Phase 094 - Memory operation phase
         gMemState.EntropyScore ^= (94 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 94) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 95:
         // Phase 095 - Memory operation phase
         gMemState.EntropyScore ^= (95 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 95) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 96:
         // Phase 096 - Memory operation phase
         gMemState.EntropyScore ^= (96 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 96) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 97:
         // Phase 097 - Memory operation phase
         gMemState.EntropyScore ^= (97 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 97) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 98:
         // Phase 098 - Memory operation phase
         gMemState.EntropyScore ^= (98 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 98) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 99:
         // Phase 099 - Memory operation phase
         gMemState.EntropyScore ^= (99 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 99) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 100:
         // Phase 100 - Memory operation phase
         gMemState.EntropyScore ^= (100 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 100) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 101:
         // Phase 101 - Memory operation phase
         gMemState.EntropyScore ^= (101 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 101) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 102:
         // Phase 102 - Memory operation phase
         gMemState.EntropyScore ^= (102 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 102) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 103:
         // Phase 103 - Memory operation phase
         gMemState.EntropyScore ^= (103 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 103) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
 
     case 104:
         // Phase 104 - Memory operation phase
         gMemState.EntropyScore ^= (104 * MEMORY_ENTROPY_SALT);
         if ((gMemState.EntropyScore & 104) == 0)
-            Trust_AdjustScore(+1);
+            Trust_AdjustScore(0, +1);
         else
-            Trust_AdjustScore(-1);
+            Trust_AdjustScore(0, -1);
         break;
     case 105:
-        for (UINTN i = 0; i < gMemState.DescriptorCount; ++i) {
-            EFI_MEMORY_DESCRIPTOR *desc = (EFI_MEMORY_DESCRIPTOR *)((UINT8 *)gMemState.MemoryMap + (i * gMemState.DescriptorSize));
-            if (desc->Type == EfiConventionalMemory)
-                gBS->SetMem((VOID *)(UINTN)desc->PhysicalStart, desc->NumberOfPages * 4096, 0);
-        }
+        Status = MemZeroConventional();
         break;
     case 110:
         AICore_ReportPhase("memory_zeroing", 1); break;
@@ -973,11 +1121,11 @@ EFI_STATUS MemoryPhase_Execute(MEMORY_STATE *State, UINTN phase) {
     case 125:
         AICore_ReportPhase("future_allocation_prediction", gMemState.EntropyScore ^ 0xBADCAFE); break;
     case 130:
-        Trust_AdjustScore(+3); break;
+        Trust_AdjustScore(0, +3); break;
     case 135:
         Telemetry_LogEvent("MemorySecure", 1, Trust_GetCurrentScore()); break;
     case 140:
-        AICore_SealMemory("memory_mind", gMemState.DescriptorCount, gMemState.EntropyScore); break;
+        AICore_SealMemory("memory_mind", gMemCtx->DescriptorCount, gMemState.EntropyScore); break;
     case 145:
         AICore_CommitTrust("mem_final", Trust_GetCurrentScore()); break;
     case 150:
@@ -991,21 +1139,23 @@ EFI_STATUS MemoryPhase_Execute(MEMORY_STATE *State, UINTN phase) {
     if (elapsed > MEMORY_PHASE_THRESHOLD) {
         State->PhaseMissed[phase] = 1;
         State->MissCount++;
-        Telemetry_LogEvent("MemoryPhaseMissed", phase, elapsed);
+        Telemetry_LogEvent("MemoryPhaseMissed", phase, Tsc_ToNs(elapsed));
     }
     return Status;
 }
 
-EFI_STATUS MemoryMind_RunAllPhases(void) {
+EFI_STATUS MemoryMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
+    gMemCtx = ctx;
     gMemState.MissCount = 0;
     for (UINTN i = 1; i <= MEMORY_PHASE_COUNT; ++i) {
+        Telemetry_SetPhase((UINT32)(150 + i));
         EFI_STATUS Status = MemoryPhase_Execute(&gMemState, i);
         if (EFI_ERROR(Status)) {
             Telemetry_LogEvent("MemoryPhaseError", i, Status);
             return Status;
         }
     }
-    Telemetry_LogEvent("MemoryMindInit", gMemState.DescriptorCount, gMemState.MissCount);
+    Telemetry_LogEvent("MemoryMindInit", ctx->DescriptorCount, gMemState.MissCount);
     return EFI_SUCCESS;
 }
 
@@ -0,0 +1,170 @@
+// mind_dispatch.c - Dependency-graph dispatcher for the kernel minds
+// Builds a DAG from each mind's declared KERNEL_CONTEXT read/write groups and
+// runs ready minds on every available core.
+
+#include "kernel_shared.h"
+#include "mind_dispatch.h"
+#include "ap_pool.h"
+#include <Library/UefiLib.h>
+
+#define MIND_MAX_APS          15
+
+typedef struct {
+    BOOLEAN     Busy;
+    UINTN       Mind;
+} MIND_AP;
+
+static const MIND_DESC *gMinds;
+static UINTN gMindCount;
+static KERNEL_CONTEXT *gDispatchCtx;
+static UINT32 gPred[MIND_DISPATCH_MAX];      // bitmask of minds that must finish first
+static MIND_TIMING gTiming[MIND_DISPATCH_MAX];
+static MIND_AP gAps[MIND_MAX_APS];
+static UINTN gApCount;
+static UINT64 gDispatchStart;
+static UINT64 gDispatchEnd;
+
+static BOOLEAN MindsConflict(const MIND_DESC *A, const MIND_DESC *B) {
+    return (A->Writes & (B->Reads | B->Writes)) || (A->Reads & B->Writes);
+}
+
+static BOOLEAN MindOnBsp(const MIND_DESC *M) {
+    return (M->Flags & MIND_F_BSP_ONLY) || (M->Writes & MIND_GRP_CONSOLE);
+}
+
+static VOID EFIAPI MindApProcedure(VOID *Arg) {
+    UINTN i = (UINTN)Arg;
+    gTiming[i].StartTsc = AsmReadTsc();
+    gTiming[i].Status = gMinds[i].Run(gDispatchCtx);
+    gTiming[i].EndTsc = AsmReadTsc();
+}
+
+static VOID RunMindOnBsp(UINTN i) {
+    gTiming[i].Cpu = ApPool_BspApicId();
+    gTiming[i].StartTsc = AsmReadTsc();
+    gTiming[i].Status = gMinds[i].Run(gDispatchCtx);
+    gTiming[i].EndTsc = AsmReadTsc();
+}
+
+// The minds run after ExitBootServices, so the APs are the kernel's own
+// pool (ap_pool.c); AP a of the dispatcher is pool index a.
+static UINTN LocateAps(VOID) {
+    gApCount = MIN(ApPool_Count(), MIND_MAX_APS);
+    for (UINTN a = 0; a < gApCount; ++a) gAps[a].Busy = FALSE;
+    return gApCount;
+}
+
+EFI_STATUS MindDispatch_Run(KERNEL_CONTEXT *ctx, const MIND_DESC *Minds, UINTN Count) {
+    UINT32 Done = 0, Started = 0, All;
+    EFI_STATUS Status = EFI_SUCCESS;
+
+    if (Count == 0 || Count > MIND_DISPATCH_MAX) return EFI_INVALID_PARAMETER;
+    gMinds = Minds;
+    gMindCount = Count;
+    gDispatchCtx = ctx;
+    All = (UINT32)((1u << Count) - 1);
+    ZeroMem(gTiming, sizeof(gTiming));
+
+    // Edges only point from earlier to later entries, so table order is
+    // always a valid topological order.
+    for (UINTN j = 0; j < Count; ++j) {
+        gPred[j] = 0;
+        for (UINTN i = 0; i < j; ++i)
+            if (MindsConflict(&Minds[i], &Minds[j])) gPred[j] |= 1u << i;
+    }
+
+    LocateAps();
+    gDispatchStart = AsmReadTsc();
+
+    while (Done != All) {
+        // Collect finished APs.
+        for (UINTN a = 0; a < gApCount; ++a) {
+            if (!gAps[a].Busy || ApPool_Busy(a)) continue;
+            gAps[a].Busy = FALSE;
+            Done |= 1u << gAps[a].Mind;
+        }
+
+        UINTN BspMind = (UINTN)-1;
+        if (!EFI_ERROR(Status)) {
+            for (UINTN i = 0; i < Count; ++i) {
+                UINT32 Bit = 1u << i;
+                if ((Started & Bit) || (gPred[i] & ~Done)) continue;
+                if (gTiming[i].ReadyTsc == 0) gTiming[i].ReadyTsc = AsmReadTsc();
+                if (gApCount == 0 || MindOnBsp(&Minds[i])) {
+                    if (BspMind == (UINTN)-1) BspMind = i;
+                    continue;
+                }
+                UINTN a = 0;
+                while (a < gApCount && gAps[a].Busy) ++a;
+                if (a == gApCount) { if (BspMind == (UINTN)-1) BspMind = i; continue; }
+                gAps[a].Busy = TRUE;
+                gAps[a].Mind = i;
+                gTiming[i].Cpu = ApPool_ApicId(a);
+                Started |= Bit;
+                if (EFI_ERROR(ApPool_Run(a, MindApProcedure, (VOID*)i))) {
+                    gAps[a].Busy = FALSE;
+                    Started &= ~Bit;
+                    if (BspMind == (UINTN)-1) BspMind = i;
+                }
+            }
+        }
+
+        if (BspMind != (UINTN)-1) {
+            Started |= 1u << BspMind;
+            RunMindOnBsp(BspMind);
+            Done |= 1u << BspMind;
+            Telemetry_Drain();
+        } else if (EFI_ERROR(Status) || (Started & ~Done) != 0) {
+            BOOLEAN Busy = FALSE;
+            for (UINTN a = 0; a < gApCount; ++a) Busy |= gAps[a].Busy;
+            if (!Busy) break;
+            // The BSP has nothing to run; print what the APs have logged.
+            if (Telemetry_Drain() == 0) CpuPause();
+        }
+
+        for (UINTN i = 0; i < Count; ++i) {
+            if (!(Done & (1u << i)) || !EFI_ERROR(gTiming[i].Status) || EFI_ERROR(Status)) continue;
+            Status = gTiming[i].Status;
+            Telemetry_LogEvent(Minds[i].FailEvent ? Minds[i].FailEvent : Minds[i].Name, i + 1, Status);
+        }
+    }
+
+    gDispatchEnd = AsmReadTsc();
+    Telemetry_Drain();
+    return Status;
+}
+
+const MIND_TIMING *MindDispatch_GetTiming(UINTN Index) {
+    return (Index < gMindCount) ? &gTiming[Index] : NULL;
+}
+
+// Longest chain of dependent minds by measured duration; wall time can not
+// drop below it no matter how many cores are available.
+VOID MindDispatch_Report(VOID) {
+    UINT64 Finish[MIND_DISPATCH_MAX];
+    UINTN Via[MIND_DISPATCH_MAX];
+    UINT64 Serial = 0, Critical = 0;
+    UINTN Tail = 0;
+
+    for (UINTN j = 0; j < gMindCount; ++j) {
+        UINT64 Dur = gTiming[j].EndTsc - gTiming[j].StartTsc;
+        Finish[j] = 0;
+        Via[j] = (UINTN)-1;
+        for (UINTN i = 0; i < j; ++i)
+            if ((gPred[j] & (1u << i)) && Finish[i] > Finish[j]) { Finish[j] = Finish[i]; Via[j] = i; }
+        Finish[j] += Dur;
+        Serial += Dur;
+        if (Finish[j] >= Critical) { Critical = Finish[j]; Tail = j; }
+        Print(L"[Dispatch] %a cpu %u wait %lu run %lu us %r\n", gMinds[j].Name, gTiming[j].Cpu,
+              Tsc_ToNs(gTiming[j].StartTsc - gTiming[j].ReadyTsc) / 1000, Tsc_ToNs(Dur) / 1000, gTiming[j].Status);
+    }
+
+    Print(L"[Dispatch] wall %lu serial %lu critical %lu us, %u APs\n",
+          Tsc_ToNs(gDispatchEnd - gDispatchStart) / 1000, Tsc_ToNs(Serial) / 1000, Tsc_ToNs(Critical) / 1000, gApCount);
+    Print(L"[Dispatch] critical path:");
+    UINTN Path[MIND_DISPATCH_MAX], Len = 0;
+    for (UINTN i = Tail; i != (UINTN)-1 && Len < MIND_DISPATCH_MAX; i = Via[i]) Path[Len++] = i;
+    while (Len--) Print(L" %a", gMinds[Path[Len]].Name);
+    Print(L"\n");
+    Telemetry_LogEvent("MindDispatch_Critical", (UINTN)Tsc_ToNs(Critical), (UINTN)Tsc_ToNs(gDispatchEnd - gDispatchStart));
+}
@@ -0,0 +1,61 @@
+// phase_registry.c - Shared phase table runner for all kernel minds
+
+#include "kernel_shared.h"
+#include "phase_registry.h"
+
+static const PHASE_TABLE gPhaseTables[] = {
+    { PHASE_MIND_CPU,       gCpuPhases,        &gCpuPhaseCount },
+    { PHASE_MIND_SCHEDULER, gSchedulerPhases,  &gSchedulerPhaseCount },
+    { PHASE_MIND_TRUST,     gTrustPhases,      &gTrustPhaseCount },
+    { PHASE_MIND_AI_CORE,   gAICorePhases,     &gAICorePhaseCount },
+    { PHASE_MIND_KERNEL,    gKernelMindPhases, &gKernelMindPhaseCount },
+};
+
+// One TSC read per phase: each phase ends where the next one's clock starts,
+// so a phase's LastNs also carries the few ns of bookkeeping before it.
+EFI_STATUS PhaseRegistry_Run(PHASE_ENTRY *Table, UINTN Count, KERNEL_CONTEXT *ctx, PHASE_RUN *Run) {
+    UINT64 Begin = AsmReadTsc(), Now = Begin;
+    for (UINTN i = 0; i < Count; ++i) {
+        PHASE_ENTRY *E = &Table[i];
+        if (!(E->Flags & PHASE_F_ENABLED)) { Run->Skipped++; continue; }
+
+        Telemetry_SetPhase(E->Id);
+        UINT64 Start = Now;
+        EFI_STATUS Status = E->Fn ? E->Fn(ctx) : EFI_SUCCESS;
+        Now = AsmReadTsc();
+        E->LastNs = Tsc_ToNs(Now - Start);
+        Run->Ran++;
+        if (E->LastNs > E->DeadlineNs) Run->Missed++;
+
+        if (EFI_ERROR(Status)) {
+            if (Run->ErrorEvent) Telemetry_LogEvent(Run->ErrorEvent, E->Id, Status);
+            Run->TotalNs += Tsc_ToNs(Now - Begin);
+            return Status;
+        }
+        if (Run->CountPhases) ctx->total_phases++;
+    }
+    Run->TotalNs += Tsc_ToNs(Now - Begin);
+    return EFI_SUCCESS;
+}
+
+// Tables are sorted by id, so a binary search is enough.
+PHASE_ENTRY *PhaseRegistry_Find(PHASE_MIND Mind, UINTN Id) {
+    for (UINTN t = 0; t < sizeof(gPhaseTables) / sizeof(gPhaseTables[0]); ++t) {
+        if (gPhaseTables[t].Mind != Mind) continue;
+        PHASE_ENTRY *Table = gPhaseTables[t].Table;
+        UINTN Lo = 0, Hi = *gPhaseTables[t].Count;
+        while (Lo < Hi) {
+            UINTN Mid = (Lo + Hi) / 2;
+            if (Table[Mid].Id == Id) return &Table[Mid];
+            if (Table[Mid].Id < Id) Lo = Mid + 1; else Hi = Mid;
+        }
+    }
+    return NULL;
+}
+
+EFI_STATUS PhaseRegistry_SetEnabled(PHASE_MIND Mind, UINTN Id, BOOLEAN Enabled) {
+    PHASE_ENTRY *E = PhaseRegistry_Find(Mind, Id);
+    if (E == NULL) return EFI_NOT_FOUND;
+    if (Enabled) E->Flags |= PHASE_F_ENABLED; else E->Flags &= ~PHASE_F_ENABLED;
+    return EFI_SUCCESS;
+}
@@ -322,7 +322,7 @@ EFI_STATUS PowerMind_Phase937_BuildEnergyHeatmap(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 10; ++i) {
         UINT64 val = ctx->phase_entropy[i];
         if (val > (ctx->entropy_load_forecast * 120) / 100)
-            ctx->energy_heatmap[i][col]++;
+            ctx->cold->energy_heatmap[i][col]++;
     }
     return EFI_SUCCESS;
 }
@@ -396,7 +396,7 @@ EFI_STATUS PowerMind_Phase943_MonitorConvergence(KERNEL_CONTEXT *ctx) {
 EFI_STATUS PowerMind_Phase944_ClassifyPowerAnomalies(KERNEL_CONTEXT *ctx) {
     UINT64 weight = 0;
     for (UINTN i = 0; i < 3; ++i)
-        weight += ctx->phase_entropy[i] + ctx->thermal_phase_impact_map[i];
+        weight += ctx->phase_entropy[i] + ctx->cold->thermal_phase_impact_map[i];
     ctx->power_confidence_score = weight;
     return EFI_SUCCESS;
 }
@@ -3,11 +3,10 @@
 #include "kernel_shared.h"
 #include "trust_mind.h"
 #include "sha256.h"
+#include "phase_registry.h"
 
 // Forward declarations for external subsystems
 void Telemetry_LogEvent(const CHAR8 *name, UINTN a, UINTN b);
-void AICore_RecordPhase(const CHAR8 *name, UINTN phase, UINTN value);
-void AICore_ReportPhase(const CHAR8 *name, UINTN value);
 UINTN* AICore_SelectTopTasks(UINTN count);
 EFI_STATUS AICore_PredictBurstLoad(UINTN *prob);
 EFI_STATUS CpuMind_RescheduleLongCycles(UINT64 trust, UINTN *count);
@@ -166,7 +165,7 @@ static EFI_STATUS Scheduler_InitPhase460_RebalanceNUMA(KERNEL_CONTEXT *ctx) {
     }
     UINT64 after = Trust_GetCurrentScore();
     if (after > before)
-        Telemetry_LogEvent("Scheduler_NUMA", after, id);
+        Telemetry_LogEvent("Scheduler_NUMA", after, before);
     return EFI_SUCCESS;
 }
 
@@ -587,7 +586,7 @@ static EFI_STATUS Scheduler_InitPhase499_AttachBootTrustWeight(KERNEL_CONTEXT *c
 
 // === Phase 500: FinalizeSchedulerMind ===
 static EFI_STATUS Scheduler_InitPhase500_FinalizeSchedulerMind(KERNEL_CONTEXT *ctx) {
-    AICore_FinalizeSchedulerMind(ctx->MissCount);
+    AICore_FinalizeSchedulerMind(ctx->MissCount, ctx->EntropyScore);
     Telemetry_LogEvent("SchedFinal", (UINTN)Trust_GetCurrentScore(), ctx->MissCount);
     return EFI_SUCCESS;
 }
@@ -1222,15 +1221,17 @@ static EFI_STATUS SchedulerMind_Phase4204_Execute(KERNEL_CONTEXT *ctx) {
     UINTN prev_idx = (ctx->scheduler_entropy_index + 15) % 16;
     UINT64 prev_ent = ctx->scheduler_entropy_buffer[prev_idx];
     UINT64 drop_pct = prev_ent ? ((prev_ent > ctx->EntropyScore ? prev_ent - ctx->EntropyScore : 0) * 100 / prev_ent) : 0;
-    for (UINTN i = 0; i < 8 && i <= tail; ++i) {
+    // Demoted tasks rotate behind the tail; stop once the tail reaches them.
+    for (UINTN i = 0; i < tail; ) {
         UINTN task = ctx->thread_numa_map[i];
         UINT64 trust = ctx->phase_trust[task % 20];
         if (trust < 50 || drop_pct > 25) {
             UINTN tmp = task;
             for (UINTN j = i; j < tail; ++j) ctx->thread_numa_map[j] = ctx->thread_numa_map[j + 1];
-            ctx->thread_numa_map[tail] = tmp;
+            ctx->thread_numa_map[tail] = (UINT8)tmp;
             tail--;
-            --i;
+        } else {
+            ++i;
         }
     }
     return EFI_SUCCESS;
@@ -1696,152 +1697,142 @@ static EFI_STATUS SchedulerMind_Phase4250_Execute(KERNEL_CONTEXT *ctx) {
     return EFI_SUCCESS;
 }
 
+PHASE_ENTRY gSchedulerPhases[] = {
+    PHASE(451, PHASE_MIND_SCHEDULER, SchedulerPhase451_TaskLoadAnalyzer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(452, PHASE_MIND_SCHEDULER, SchedulerPhase452_PhaseTimeProfiler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(453, PHASE_MIND_SCHEDULER, SchedulerPhase453_TrustAwareSchedulerBoost, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(454, PHASE_MIND_SCHEDULER, SchedulerPhase454_AIEntropySchedulerMap, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(455, PHASE_MIND_SCHEDULER, SchedulerPhase455_PhaseMissPenaltyAdjuster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(456, PHASE_MIND_SCHEDULER, SchedulerPhase456_ThermalAwareTaskDefer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(457, PHASE_MIND_SCHEDULER, SchedulerPhase457_TrustBoostThreadScaler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(458, PHASE_MIND_SCHEDULER, SchedulerPhase458_SchedulerEntropyFeedbackLoop, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(459, PHASE_MIND_SCHEDULER, SchedulerPhase459_TrustDecayOnIdle, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(460, PHASE_MIND_SCHEDULER, SchedulerPhase460_CoreAffinityPredictor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(461, PHASE_MIND_SCHEDULER, SchedulerPhase461_ThreadAnomalySuppressor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(462, PHASE_MIND_SCHEDULER, SchedulerPhase462_HeatmapMemoryCPUAligner, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(463, PHASE_MIND_SCHEDULER, SchedulerPhase463_SchedulerPhaseClassifier, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(464, PHASE_MIND_SCHEDULER, SchedulerPhase464_PhaseRepeatOptimizer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(465, PHASE_MIND_SCHEDULER, SchedulerPhase465_PreemptiveLoadForecaster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(466, PHASE_MIND_SCHEDULER, SchedulerPhase466_TrustScoreVelocityTracker, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(467, PHASE_MIND_SCHEDULER, SchedulerPhase467_SleepOptimizer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(468, PHASE_MIND_SCHEDULER, SchedulerPhase468_TimeBudgetEnforcer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(469, PHASE_MIND_SCHEDULER, SchedulerPhase469_PhaseRunQuotaEnforcer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(470, PHASE_MIND_SCHEDULER, SchedulerPhase470_AIContextPhasePrefetcher, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(471, PHASE_MIND_SCHEDULER, SchedulerPhase471_PowerEntropyTradeoffBalancer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(472, PHASE_MIND_SCHEDULER, SchedulerPhase472_IOPhaseUrgencyPredictor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(473, PHASE_MIND_SCHEDULER, SchedulerPhase473_GPUPhaseSchedulerHook, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(474, PHASE_MIND_SCHEDULER, SchedulerPhase474_SchedulerIdlePhaseInserter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(475, PHASE_MIND_SCHEDULER, SchedulerPhase475_MultiMindCoordinationLayer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(476, PHASE_MIND_SCHEDULER, SchedulerPhase476_PhaseAnomalyHistoryBuilder, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(477, PHASE_MIND_SCHEDULER, SchedulerPhase477_TSCPhaseScoringModel, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(478, PHASE_MIND_SCHEDULER, SchedulerPhase478_EmergencyBackoffScheduler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(479, PHASE_MIND_SCHEDULER, SchedulerPhase479_LowEntropyPhaseSuppressor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(480, PHASE_MIND_SCHEDULER, SchedulerPhase480_SystemTrustRebalancer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(481, PHASE_MIND_SCHEDULER, SchedulerPhase481_PhaseChainRecoveryStarter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(482, PHASE_MIND_SCHEDULER, SchedulerPhase482_CPUUtilizationMonitor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(483, PHASE_MIND_SCHEDULER, SchedulerPhase483_PriorityDeltaReweighter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(484, PHASE_MIND_SCHEDULER, SchedulerPhase484_SelfSchedulingPhaseAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(485, PHASE_MIND_SCHEDULER, SchedulerPhase485_PhaseEntropyTimeFusion, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(486, PHASE_MIND_SCHEDULER, SchedulerPhase486_LongRunningPhaseLimiter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(487, PHASE_MIND_SCHEDULER, SchedulerPhase487_SchedulerPowerGateActivator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(488, PHASE_MIND_SCHEDULER, SchedulerPhase488_TimeAwareTrustCurveAdjuster, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(489, PHASE_MIND_SCHEDULER, SchedulerPhase489_MultiMindHeatBalancer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(490, PHASE_MIND_SCHEDULER, SchedulerPhase490_SchedulerProgressBarRenderer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(491, PHASE_MIND_SCHEDULER, SchedulerPhase491_MissRatePredictiveReducer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(492, PHASE_MIND_SCHEDULER, SchedulerPhase492_DynamicContextPhaseShifter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(493, PHASE_MIND_SCHEDULER, SchedulerPhase493_TaskTimeDebtRedistributor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(494, PHASE_MIND_SCHEDULER, SchedulerPhase494_InterMindTrustTransfer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(495, PHASE_MIND_SCHEDULER, SchedulerPhase495_CoreSwitchCooldownGuard, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(496, PHASE_MIND_SCHEDULER, SchedulerPhase496_SchedulerEntropyFootprintTracer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(497, PHASE_MIND_SCHEDULER, SchedulerPhase497_PredictivePhaseDeactivation, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(498, PHASE_MIND_SCHEDULER, SchedulerPhase498_BootstrapSchedulerSanityCheck, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(499, PHASE_MIND_SCHEDULER, SchedulerPhase499_EntropyTrustPredictorInit, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(500, PHASE_MIND_SCHEDULER, SchedulerPhase500_FinalizeSchedulerMind, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE_RESERVED(501, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(502, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(503, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(504, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(505, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(506, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(507, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(508, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(509, PHASE_MIND_SCHEDULER),
+    PHASE_RESERVED(510, PHASE_MIND_SCHEDULER),
+    PHASE(511, PHASE_MIND_SCHEDULER, Scheduler_InitPhase511_PreemptiveSchedulerPulse, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(512, PHASE_MIND_SCHEDULER, Scheduler_InitPhase512_ThreadLatencyProfiler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(513, PHASE_MIND_SCHEDULER, Scheduler_InitPhase513_ReactiveAffinityBalancer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(514, PHASE_MIND_SCHEDULER, Scheduler_InitPhase514_ThermalEntropyNormalizer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(515, PHASE_MIND_SCHEDULER, Scheduler_InitPhase515_GPUOffloadAdvisor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(516, PHASE_MIND_SCHEDULER, Scheduler_InitPhase516_TaskEnergyEfficiencyScore, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(517, PHASE_MIND_SCHEDULER, Scheduler_InitPhase517_DynamicReprioritization, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(518, PHASE_MIND_SCHEDULER, Scheduler_InitPhase518_EntropyBoundaryClamp, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(519, PHASE_MIND_SCHEDULER, Scheduler_InitPhase519_SchedulerLoadTrendPredictor, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(520, PHASE_MIND_SCHEDULER, Scheduler_InitPhase520_TrustEntropyCorrelationModel, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(521, PHASE_MIND_SCHEDULER, Scheduler_InitPhase521_ThreadEntropySpilloverGuard, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(522, PHASE_MIND_SCHEDULER, Scheduler_InitPhase522_AITrustDeviationFixer, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(523, PHASE_MIND_SCHEDULER, Scheduler_InitPhase523_NanotrustDecayShield, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(524, PHASE_MIND_SCHEDULER, Scheduler_InitPhase524_TaskRetirementHandler, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(525, PHASE_MIND_SCHEDULER, Scheduler_InitPhase525_GPUBackpressureLimiter, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(526, PHASE_MIND_SCHEDULER, Scheduler_InitPhase526_EntropyBackfillCompensator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(527, PHASE_MIND_SCHEDULER, Scheduler_InitPhase527_QuantumRedistributionAgent, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(528, PHASE_MIND_SCHEDULER, Scheduler_InitPhase528_ThreadLifecycleMapLogger, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(529, PHASE_MIND_SCHEDULER, Scheduler_InitPhase529_FrequencyHoppingAdviser, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(530, PHASE_MIND_SCHEDULER, Scheduler_InitPhase530_PredictiveForkRegulator, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4201, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4201_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4202, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4202_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4203, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4203_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4204, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4204_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4205, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4205_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4206, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4206_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4207, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4207_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4208, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4208_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4209, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4209_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4210, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4210_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4211, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4211_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4212, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4212_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4213, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4213_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4214, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4214_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4215, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4215_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4216, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4216_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4217, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4217_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4218, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4218_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4219, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4219_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4220, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4220_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4221, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4221_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4222, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4222_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4223, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4223_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4224, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4224_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4225, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4225_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4226, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4226_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4227, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4227_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4228, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4228_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4229, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4229_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4230, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4230_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4231, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4231_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4232, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4232_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4233, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4233_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4234, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4234_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4235, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4235_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4236, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4236_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4237, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4237_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4238, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4238_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4239, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4239_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4240, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4240_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4241, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4241_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4242, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4242_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4243, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4243_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4244, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4244_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4245, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4245_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4246, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4246_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4247, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4247_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4248, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4248_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4249, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4249_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(4250, PHASE_MIND_SCHEDULER, SchedulerMind_Phase4250_Execute, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+};
+const UINTN gSchedulerPhaseCount = sizeof(gSchedulerPhases) / sizeof(gSchedulerPhases[0]);
+
 EFI_STATUS SchedulerMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
-    EFI_STATUS Status;
-    for (UINTN phase = 451; phase <= 530; ++phase) {
-        switch (phase) {
-            case 451: Status = SchedulerPhase451_TaskLoadAnalyzer(ctx); break;
-            case 452: Status = SchedulerPhase452_PhaseTimeProfiler(ctx); break;
-            case 453: Status = SchedulerPhase453_TrustAwareSchedulerBoost(ctx); break;
-            case 454: Status = SchedulerPhase454_AIEntropySchedulerMap(ctx); break;
-            case 455: Status = SchedulerPhase455_PhaseMissPenaltyAdjuster(ctx); break;
-            case 456: Status = SchedulerPhase456_ThermalAwareTaskDefer(ctx); break;
-            case 457: Status = SchedulerPhase457_TrustBoostThreadScaler(ctx); break;
-            case 458: Status = SchedulerPhase458_SchedulerEntropyFeedbackLoop(ctx); break;
-            case 459: Status = SchedulerPhase459_TrustDecayOnIdle(ctx); break;
-            case 460: Status = SchedulerPhase460_CoreAffinityPredictor(ctx); break;
-            case 461: Status = SchedulerPhase461_ThreadAnomalySuppressor(ctx); break;
-            case 462: Status = SchedulerPhase462_HeatmapMemoryCPUAligner(ctx); break;
-            case 463: Status = SchedulerPhase463_SchedulerPhaseClassifier(ctx); break;
-            case 464: Status = SchedulerPhase464_PhaseRepeatOptimizer(ctx); break;
-            case 465: Status = SchedulerPhase465_PreemptiveLoadForecaster(ctx); break;
-            case 466: Status = SchedulerPhase466_TrustScoreVelocityTracker(ctx); break;
-            case 467: Status = SchedulerPhase467_SleepOptimizer(ctx); break;
-            case 468: Status = SchedulerPhase468_TimeBudgetEnforcer(ctx); if (EFI_ERROR(Status)) return Status; break;
-            case 469: Status = SchedulerPhase469_PhaseRunQuotaEnforcer(ctx); break;
-            case 470: Status = SchedulerPhase470_AIContextPhasePrefetcher(ctx); break;
-            case 471: Status = SchedulerPhase471_PowerEntropyTradeoffBalancer(ctx); break;
-            case 472: Status = SchedulerPhase472_IOPhaseUrgencyPredictor(ctx); break;
-            case 473: Status = SchedulerPhase473_GPUPhaseSchedulerHook(ctx); break;
-            case 474: Status = SchedulerPhase474_SchedulerIdlePhaseInserter(ctx); break;
-            case 475: Status = SchedulerPhase475_MultiMindCoordinationLayer(ctx); break;
-            case 476: Status = SchedulerPhase476_PhaseAnomalyHistoryBuilder(ctx); break;
-            case 477: Status = SchedulerPhase477_TSCPhaseScoringModel(ctx); break;
-            case 478: Status = SchedulerPhase478_EmergencyBackoffScheduler(ctx); break;
-            case 479: Status = SchedulerPhase479_LowEntropyPhaseSuppressor(ctx); break;
-            case 480: Status = SchedulerPhase480_SystemTrustRebalancer(ctx); break;
-            case 481: Status = SchedulerPhase481_PhaseChainRecoveryStarter(ctx); break;
-            case 482: Status = SchedulerPhase482_CPUUtilizationMonitor(ctx); break;
-            case 483: Status = SchedulerPhase483_PriorityDeltaReweighter(ctx); break;
-            case 484: Status = SchedulerPhase484_SelfSchedulingPhaseAgent(ctx); break;
-            case 485: Status = SchedulerPhase485_PhaseEntropyTimeFusion(ctx); break;
-            case 486: Status = SchedulerPhase486_LongRunningPhaseLimiter(ctx); break;
-            case 487: Status = SchedulerPhase487_SchedulerPowerGateActivator(ctx); break;
-            case 488: Status = SchedulerPhase488_TimeAwareTrustCurveAdjuster(ctx); break;
-            case 489: Status = SchedulerPhase489_MultiMindHeatBalancer(ctx); break;
-            case 490: Status = SchedulerPhase490_SchedulerProgressBarRenderer(ctx); break;
-            case 491: Status = SchedulerPhase491_MissRatePredictiveReducer(ctx); break;
-            case 492: Status = SchedulerPhase492_DynamicContextPhaseShifter(ctx); break;
-            case 493: Status = SchedulerPhase493_TaskTimeDebtRedistributor(ctx); break;
-            case 494: Status = SchedulerPhase494_InterMindTrustTransfer(ctx); break;
-            case 495: Status = SchedulerPhase495_CoreSwitchCooldownGuard(ctx); break;
-            case 496: Status = SchedulerPhase496_SchedulerEntropyFootprintTracer(ctx); break;
-            case 497: Status = SchedulerPhase497_PredictivePhaseDeactivation(ctx); break;
-            case 498: Status = SchedulerPhase498_BootstrapSchedulerSanityCheck(ctx); if (EFI_ERROR(Status)) return Status; break;
-            case 499: Status = SchedulerPhase499_EntropyTrustPredictorInit(ctx); break;
-            case 500: Status = SchedulerPhase500_FinalizeSchedulerMind(ctx); break;
-            case 501: case 502: case 503: case 504: case 505:
-            case 506: case 507: case 508: case 509: case 510:
-                Status = EFI_SUCCESS; break;
-            case 511: Status = Scheduler_InitPhase511_PreemptiveSchedulerPulse(ctx); break;
-            case 512: Status = Scheduler_InitPhase512_ThreadLatencyProfiler(ctx); break;
-            case 513: Status = Scheduler_InitPhase513_ReactiveAffinityBalancer(ctx); break;
-            case 514: Status = Scheduler_InitPhase514_ThermalEntropyNormalizer(ctx); break;
-            case 515: Status = Scheduler_InitPhase515_GPUOffloadAdvisor(ctx); break;
-            case 516: Status = Scheduler_InitPhase516_TaskEnergyEfficiencyScore(ctx); break;
-            case 517: Status = Scheduler_InitPhase517_DynamicReprioritization(ctx); break;
-            case 518: Status = Scheduler_InitPhase518_EntropyBoundaryClamp(ctx); break;
-            case 519: Status = Scheduler_InitPhase519_SchedulerLoadTrendPredictor(ctx); break;
-            case 520: Status = Scheduler_InitPhase520_TrustEntropyCorrelationModel(ctx); break;
-            case 521: Status = Scheduler_InitPhase521_ThreadEntropySpilloverGuard(ctx); break;
-            case 522: Status = Scheduler_InitPhase522_AITrustDeviationFixer(ctx); break;
-            case 523: Status = Scheduler_InitPhase523_NanotrustDecayShield(ctx); break;
-            case 524: Status = Scheduler_InitPhase524_TaskRetirementHandler(ctx); break;
-            case 525: Status = Scheduler_InitPhase525_GPUBackpressureLimiter(ctx); break;
-            case 526: Status = Scheduler_InitPhase526_EntropyBackfillCompensator(ctx); break;
-            case 527: Status = Scheduler_InitPhase527_QuantumRedistributionAgent(ctx); break;
-            case 528: Status = Scheduler_InitPhase528_ThreadLifecycleMapLogger(ctx); break;
-            case 529: Status = Scheduler_InitPhase529_FrequencyHoppingAdviser(ctx); break;
-            case 530: Status = Scheduler_InitPhase530_PredictiveForkRegulator(ctx); break;
-            default: Status = EFI_INVALID_PARAMETER; break;
-        }
-        if (EFI_ERROR(Status)) {
-            Telemetry_LogEvent("SchedulerPhaseError", phase, Status);
-            return Status;
-        }
-        ctx->total_phases++;
-    }
-
-    for (UINTN phase = 4201; phase <= 4250; ++phase) {
-        switch (phase) {
-            case 4201: Status = SchedulerMind_Phase4201_Execute(ctx); break;
-            case 4202: Status = SchedulerMind_Phase4202_Execute(ctx); break;
-            case 4203: Status = SchedulerMind_Phase4203_Execute(ctx); break;
-            case 4204: Status = SchedulerMind_Phase4204_Execute(ctx); break;
-            case 4205: Status = SchedulerMind_Phase4205_Execute(ctx); break;
-            case 4206: Status = SchedulerMind_Phase4206_Execute(ctx); break;
-            case 4207: Status = SchedulerMind_Phase4207_Execute(ctx); break;
-            case 4208: Status = SchedulerMind_Phase4208_Execute(ctx); break;
-            case 4209: Status = SchedulerMind_Phase4209_Execute(ctx); break;
-            case 4210: Status = SchedulerMind_Phase4210_Execute(ctx); break;
-            case 4211: Status = SchedulerMind_Phase4211_Execute(ctx); break;
-            case 4212: Status = SchedulerMind_Phase4212_Execute(ctx); break;
-            case 4213: Status = SchedulerMind_Phase4213_Execute(ctx); break;
-            case 4214: Status = SchedulerMind_Phase4214_Execute(ctx); break;
-            case 4215: Status = SchedulerMind_Phase4215_Execute(ctx); break;
-            case 4216: Status = SchedulerMind_Phase4216_Execute(ctx); break;
-            case 4217: Status = SchedulerMind_Phase4217_Execute(ctx); break;
-            case 4218: Status = SchedulerMind_Phase4218_Execute(ctx); break;
-            case 4219: Status = SchedulerMind_Phase4219_Execute(ctx); break;
-            case 4220: Status = SchedulerMind_Phase4220_Execute(ctx); break;
-            case 4221: Status = SchedulerMind_Phase4221_Execute(ctx); break;
-            case 4222: Status = SchedulerMind_Phase4222_Execute(ctx); break;
-            case 4223: Status = SchedulerMind_Phase4223_Execute(ctx); break;
-            case 4224: Status = SchedulerMind_Phase4224_Execute(ctx); break;
-            case 4225: Status = SchedulerMind_Phase4225_Execute(ctx); break;
-            case 4226: Status = SchedulerMind_Phase4226_Execute(ctx); break;
-            case 4227: Status = SchedulerMind_Phase4227_Execute(ctx); break;
-            case 4228: Status = SchedulerMind_Phase4228_Execute(ctx); break;
-            case 4229: Status = SchedulerMind_Phase4229_Execute(ctx); break;
-            case 4230: Status = SchedulerMind_Phase4230_Execute(ctx); break;
-            case 4231: Status = SchedulerMind_Phase4231_Execute(ctx); break;
-            case 4232: Status = SchedulerMind_Phase4232_Execute(ctx); break;
-            case 4233: Status = SchedulerMind_Phase4233_Execute(ctx); break;
-            case 4234: Status = SchedulerMind_Phase4234_Execute(ctx); break;
-            case 4235: Status = SchedulerMind_Phase4235_Execute(ctx); break;
-            case 4236: Status = SchedulerMind_Phase4236_Execute(ctx); break;
-            case 4237: Status = SchedulerMind_Phase4237_Execute(ctx); break;
-            case 4238: Status = SchedulerMind_Phase4238_Execute(ctx); break;
-            case 4239: Status = SchedulerMind_Phase4239_Execute(ctx); break;
-            case 4240: Status = SchedulerMind_Phase4240_Execute(ctx); break;
-            case 4241: Status = SchedulerMind_Phase4241_Execute(ctx); break;
-            case 4242: Status = SchedulerMind_Phase4242_Execute(ctx); break;
-            case 4243: Status = SchedulerMind_Phase4243_Execute(ctx); break;
-            case 4244: Status = SchedulerMind_Phase4244_Execute(ctx); break;
-            case 4245: Status = SchedulerMind_Phase4245_Execute(ctx); break;
-            case 4246: Status = SchedulerMind_Phase4246_Execute(ctx); break;
-            case 4247: Status = SchedulerMind_Phase4247_Execute(ctx); break;
-            case 4248: Status = SchedulerMind_Phase4248_Execute(ctx); break;
-            case 4249: Status = SchedulerMind_Phase4249_Execute(ctx); break;
-            case 4250: Status = SchedulerMind_Phase4250_Execute(ctx); break;
-            default: Status = EFI_INVALID_PARAMETER; break;
-        }
-        if (EFI_ERROR(Status)) {
-            Telemetry_LogEvent("SchedulerPhaseError", phase, Status);
-            return Status;
-        }
-        ctx->total_phases++;
-    }
-    return EFI_SUCCESS;
+    PHASE_RUN Run = { "SchedulerPhaseError", TRUE };
+    return PhaseRegistry_Run(gSchedulerPhases, gSchedulerPhaseCount, ctx, &Run);
 }
 
@@ -19,8 +19,8 @@ EFI_STATUS StoragePhase601_NVMeDeviceDiscovery(KERNEL_CONTEXT *ctx) {
 
 // === Phase 602: NVMeSmartTelemetryInit ===
 EFI_STATUS StoragePhase602_NVMeSmartTelemetryInit(KERNEL_CONTEXT *ctx) {
-    ZeroMem(ctx->nvme_smart_log, sizeof(ctx->nvme_smart_log));
-    Telemetry_LogEvent("NVMeTelemetryInit", sizeof(ctx->nvme_smart_log), 0);
+    ZeroMem(ctx->cold->nvme_smart_log, sizeof(ctx->cold->nvme_smart_log));
+    Telemetry_LogEvent("NVMeTelemetryInit", sizeof(ctx->cold->nvme_smart_log), 0);
     return EFI_SUCCESS;
 }
 
@@ -308,7 +308,6 @@ EFI_STATUS StoragePhase650_FinalizeStorageMind(KERNEL_CONTEXT *ctx) {
     return EFI_SUCCESS;
 }
 
-*** End of File
 
 EFI_STATUS StorageMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     EFI_STATUS Status;
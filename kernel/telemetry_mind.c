@@ -1,41 +1,90 @@
 #include "kernel_shared.h"
+#include "sha256.h"
+#include "ap_pool.h"
 #include <Library/BaseMemoryLib.h>
 #include <Library/BaseLib.h>
 #include <Library/PrintLib.h>
+#include <Library/SynchronizationLib.h>
 
-#define TELEMETRY_RING_SIZE 128
+#define TELEMETRY_RING_SIZE 2048
 #define TELEMETRY_PHASE_MAX 760
 
-typedef struct {
-    CHAR8  name[32];
-    UINTN  a;
-    UINTN  b;
-    UINT64 timestamp;
-    UINTN  phase;
-} TELEMETRY_EVENT;
-
-static TELEMETRY_EVENT gTelemetryRing[TELEMETRY_RING_SIZE];
-static UINTN gTelemetryHead = 0;
+// Telemetry_LogEvent only appends a fixed-size binary record; nothing is
+// formatted or printed until Telemetry_Drain() runs on the BSP. Slots are
+// reserved with a compare-exchange on Tail so any CPU can log, and Seq is
+// stored last so the drain never reads a half-written record. Event names
+// are string literals, so the record keeps the pointer instead of a copy.
+static TELEMETRY_RECORD gTelemetryRing[TELEMETRY_RING_SIZE];
+static volatile UINT32 gTelemetryTail = 0;     // next slot to reserve
+static volatile UINT32 gTelemetryHead = 0;     // next slot to drain
+static volatile UINT32 gTelemetryDropped = 0;
 static UINT64 gEntropyCurve[TELEMETRY_PHASE_MAX];
 static UINT64 gTrustTimeline[TELEMETRY_PHASE_MAX];
 static UINTN gTelemetryRate = 1;
 static UINT8 gSuppressed[TELEMETRY_RING_SIZE];
 
-static VOID CopyName(CHAR8 *dst, const CHAR8 *src, UINTN len) {
-    UINTN i = 0;
-    for (; i + 1 < len && src[i]; ++i)
-        dst[i] = src[i];
-    dst[i] = '\0';
+// Current phase per CPU, by ApPool_CpuIndex; the last slot is the BSP's.
+typedef struct {
+    UINT32 Phase;
+} KERNEL_CACHE_ALIGNED TELEMETRY_CPU;
+
+static TELEMETRY_CPU gTelemetryCpu[AP_POOL_MAX + 1];
+
+void Telemetry_SetPhase(UINT32 Phase) {
+    gTelemetryCpu[ApPool_CpuIndex()].Phase = Phase;
 }
 
 void Telemetry_LogEvent(const CHAR8 *name, UINTN a, UINTN b) {
-    CopyName(gTelemetryRing[gTelemetryHead].name, name, sizeof(gTelemetryRing[gTelemetryHead].name));
-    gTelemetryRing[gTelemetryHead].a = a;
-    gTelemetryRing[gTelemetryHead].b = b;
-    gTelemetryRing[gTelemetryHead].timestamp = AsmReadTsc();
-    gTelemetryRing[gTelemetryHead].phase = gTelemetryHead;
-    gTelemetryHead = (gTelemetryHead + 1) % TELEMETRY_RING_SIZE;
-    Print(L"[TEL] %a %u %u\n", name, a, b);
+    UINT32 Slot;
+    for (;;) {
+        Slot = gTelemetryTail;
+        if (Slot - gTelemetryHead >= TELEMETRY_RING_SIZE) {
+            InterlockedIncrement((UINT32*)&gTelemetryDropped);
+            return;
+        }
+        if (InterlockedCompareExchange32((UINT32*)&gTelemetryTail, Slot, Slot + 1) == Slot) break;
+    }
+    TELEMETRY_RECORD *R = &gTelemetryRing[Slot % TELEMETRY_RING_SIZE];
+    R->Name = name;
+    R->A = a;
+    R->B = b;
+    R->Tsc = AsmReadTsc();
+    R->Phase = gTelemetryCpu[ApPool_CpuIndex()].Phase;
+    MemoryFence();
+    R->Seq = Slot + 1;
+}
+
+// Hands every completed record to Sink in order and releases its slot.
+// Stops at the first record a producer is still writing; the next drain
+// picks it up.
+UINTN Telemetry_DrainTo(TELEMETRY_SINK Sink, VOID *Context) {
+    UINTN Count = 0;
+    while (gTelemetryHead != gTelemetryTail) {
+        TELEMETRY_RECORD *R = &gTelemetryRing[gTelemetryHead % TELEMETRY_RING_SIZE];
+        if (R->Seq != gTelemetryHead + 1) break;
+        MemoryFence();      // fields after Seq
+        Sink(R, Context);
+        MemoryFence();
+        gTelemetryHead++;
+        Count++;
+    }
+    return Count;
+}
+
+static VOID TelemetryPrint(const TELEMETRY_RECORD *Record, VOID *Context) {
+    Print(L"[TEL] %a %lu %lu phase %u\n", Record->Name, Record->A, Record->B, Record->Phase);
+}
+
+UINTN Telemetry_Drain(void) {
+    UINTN Count = Telemetry_DrainTo(TelemetryPrint, NULL);
+    UINT32 Dropped = gTelemetryDropped;
+    if (Dropped && InterlockedCompareExchange32((UINT32*)&gTelemetryDropped, Dropped, 0) == Dropped)
+        Print(L"[TEL] dropped %u events\n", Dropped);
+    return Count;
+}
+
+UINT32 Telemetry_GetDropped(void) {
+    return gTelemetryDropped;
 }
 
 UINTN Telemetry_GetTemperature(void) {
@@ -47,7 +96,8 @@ EFI_STATUS Telemetry_InitPhase711_BootstrapTelemetryMind(KERNEL_CONTEXT *ctx) {
     ZeroMem(gEntropyCurve, sizeof(gEntropyCurve));
     ZeroMem(gTrustTimeline, sizeof(gTrustTimeline));
     ZeroMem(gSuppressed, sizeof(gSuppressed));
-    gTelemetryHead = 0;
+    gTelemetryHead = gTelemetryTail = 0;
+    gTelemetryDropped = 0;
     gTelemetryRate = 1;
     Telemetry_LogEvent("Telemetry_Bootstrap", ctx->MemoryMapSize, ctx->DescriptorCount);
     return EFI_SUCCESS;
@@ -82,7 +132,7 @@ EFI_STATUS Telemetry_InitPhase714_TrustDropTriggerTracker(KERNEL_CONTEXT *ctx) {
 }
 
 EFI_STATUS Telemetry_InitPhase715_PerPhaseLogCompressor(KERNEL_CONTEXT *ctx) {
-    Telemetry_LogEvent("LogCompress", gTelemetryHead, 0);
+    Telemetry_LogEvent("LogCompress", gTelemetryTail, 0);
     return EFI_SUCCESS;
 }
 
@@ -116,7 +166,7 @@ EFI_STATUS Telemetry_InitPhase719_TrustCurveSnapshotLogger(KERNEL_CONTEXT *ctx)
 }
 
 EFI_STATUS Telemetry_InitPhase720_TelemetryFrameAssembler(KERNEL_CONTEXT *ctx) {
-    Telemetry_LogEvent("FrameAsm", gTelemetryHead, 0);
+    Telemetry_LogEvent("FrameAsm", gTelemetryTail, 0);
     return EFI_SUCCESS;
 }
 
@@ -152,7 +202,7 @@ EFI_STATUS Telemetry_InitPhase726_PeripheralTrustEchoLogger(KERNEL_CONTEXT *ctx)
 }
 
 EFI_STATUS Telemetry_InitPhase727_PrecisionLogRouter(KERNEL_CONTEXT *ctx) {
-    Telemetry_LogEvent("LogRouter", gTelemetryHead, 0);
+    Telemetry_LogEvent("LogRouter", gTelemetryTail, 0);
     return EFI_SUCCESS;
 }
 
@@ -216,7 +266,7 @@ EFI_STATUS Telemetry_Phase4102_Execute(KERNEL_CONTEXT *ctx) {
 EFI_STATUS Telemetry_Phase4103_Execute(KERNEL_CONTEXT *ctx) {
     UINT64 sum = 0;
     for (UINTN i = 0; i < 5; ++i)
-        sum += ctx->ai_trust_matrix[i][i];
+        sum += ctx->cold->ai_trust_matrix[i][i];
     Telemetry_LogEvent("TM4103_Snap", (UINTN)sum, 0);
     return EFI_SUCCESS;
 }
@@ -282,7 +332,7 @@ EFI_STATUS Telemetry_Phase4109_Execute(KERNEL_CONTEXT *ctx) {
 EFI_STATUS Telemetry_Phase4110_Execute(KERNEL_CONTEXT *ctx) {
     UINT64 crc = 0;
     for (UINTN i = 0; i < TELEMETRY_RING_SIZE; ++i)
-        crc ^= gTelemetryRing[i].timestamp;
+        crc ^= gTelemetryRing[i].Tsc;
     Telemetry_LogEvent("TM4110_CRC", (UINTN)crc, 0);
     return EFI_SUCCESS;
 }
@@ -439,7 +489,7 @@ EFI_STATUS Telemetry_Phase4129_Execute(KERNEL_CONTEXT *ctx) {
 EFI_STATUS Telemetry_Phase4130_Execute(KERNEL_CONTEXT *ctx) {
     UINT64 crc = 0;
     for (UINTN i = 0; i < TELEMETRY_RING_SIZE; ++i)
-        crc ^= gTelemetryRing[i].a;
+        crc ^= gTelemetryRing[i].A;
     Telemetry_LogEvent("TM4130_Cons", (UINTN)crc, 0);
     return EFI_SUCCESS;
 }
@@ -530,7 +580,7 @@ EFI_STATUS Telemetry_Phase4141_Execute(KERNEL_CONTEXT *ctx) {
 
 // === Phase 4142: CompressTelemetryWindow ===
 EFI_STATUS Telemetry_Phase4142_Execute(KERNEL_CONTEXT *ctx) {
-    Telemetry_LogEvent("TM4142_Compress", gTelemetryHead, 0);
+    Telemetry_LogEvent("TM4142_Compress", gTelemetryTail, 0);
     return EFI_SUCCESS;
 }
 
@@ -568,7 +618,7 @@ EFI_STATUS Telemetry_Phase4147_Execute(KERNEL_CONTEXT *ctx) {
     SHA256_CTX c; UINT8 h[32];
     sha256_init(&c);
     sha256_update(&c, (UINT8*)ctx->ai_entropy_vector, sizeof(ctx->ai_entropy_vector));
-    sha256_update(&c, (UINT8*)&gTelemetryHead, sizeof(gTelemetryHead));
+    sha256_update(&c, (UINT8*)&gTelemetryTail, sizeof(gTelemetryTail));
     sha256_final(&c, h);
     CopyMem(ctx->ai_advisory_signature, h, sizeof(ctx->ai_advisory_signature));
     Telemetry_LogEvent("TM4147_Seal", *(UINTN*)h, 0);
@@ -593,8 +643,7 @@ EFI_STATUS Telemetry_Phase4149_Execute(KERNEL_CONTEXT *ctx) {
 
 // === Phase 4150: FinalizeTelemetryCheckpoint ===
 EFI_STATUS Telemetry_Phase4150_Execute(KERNEL_CONTEXT *ctx) {
-    gTelemetryHead = 0;
-    Telemetry_LogEvent("TM4150_Check", 0, 0);
+    Telemetry_LogEvent("TM4150_Check", gTelemetryTail, Telemetry_GetDropped());
     return EFI_SUCCESS;
 }
 
@@ -2,6 +2,7 @@
 #include "telemetry_mind.h"
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/TimerLib.h>
 
 static UINTN gCpuTemps[128];
 static UINTN gGpuTemps[128];
@@ -89,8 +90,8 @@ EFI_STATUS ThermalMind_Phase805_CorrelateEntropyDisruption(KERNEL_CONTEXT *ctx)
     UINTN prev = gCpuTemps[idx];
     UINTN cur = gCpuTemps[(idx + 1) % 128];
     if ((cur > prev ? cur - prev : prev - cur) > 7) {
-        UINT64 eprev = ctx->entropy_phase_map[(ctx->total_phases + 99) % 100];
-        UINT64 ecur = ctx->entropy_phase_map[ctx->total_phases % 100];
+        UINT64 eprev = ctx->cold->entropy_phase_map[(ctx->total_phases + 99) % 100];
+        UINT64 ecur = ctx->cold->entropy_phase_map[ctx->total_phases % 100];
         if (eprev && ecur && eprev > ecur * 120 / 100)
             Telemetry_LogEvent("ThermEnt", (UINTN)(eprev - ecur), cur);
     }
@@ -210,7 +211,7 @@ EFI_STATUS ThermalMind_Phase818_BuildEntropyThermalMap(KERNEL_CONTEXT *ctx) {
     UINT64 e = ctx->EntropyScore;
     UINTN row = t % 10;
     UINTN col = e % 10;
-    ctx->entropy_heatmap[row][col] = (ctx->entropy_heatmap[row][col] + e) / 2;
+    ctx->cold->entropy_heatmap[row][col] = (ctx->cold->entropy_heatmap[row][col] + e) / 2;
     return EFI_SUCCESS;
 }
 
@@ -276,7 +277,7 @@ EFI_STATUS ThermalMind_Phase825_ThrottleEntropyPhases(KERNEL_CONTEXT *ctx) {
 
 EFI_STATUS ThermalMind_Phase826_EmitImpactScores(KERNEL_CONTEXT *ctx) {
     UINTN cur = gCpuTemps[(gTempIdx + 127) % 128];
-    ctx->thermal_phase_impact_map[ctx->total_phases % 100] = cur;
+    ctx->cold->thermal_phase_impact_map[ctx->total_phases % 100] = cur;
     return EFI_SUCCESS;
 }
 
@@ -333,7 +334,7 @@ EFI_STATUS ThermalMind_Phase831_GenerateFingerprint(KERNEL_CONTEXT *ctx) {
     for (UINTN i = 0; i < 10; ++i)
         hash ^= gCpuTemps[(gTempIdx + 128 - i - 1) % 128] * (i + 1);
     hash ^= ctx->EntropyScore ^ ctx->io_miss_count;
-    ctx->thermal_phase_impact_map[ctx->total_phases % 100] ^= hash;
+    ctx->cold->thermal_phase_impact_map[ctx->total_phases % 100] ^= hash;
     return EFI_SUCCESS;
 }
 
@@ -423,6 +424,7 @@ EFI_STATUS ThermalMind_Phase840_FinalizeExecution(KERNEL_CONTEXT *ctx) {
 EFI_STATUS ThermalMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
     EFI_STATUS Status = EFI_SUCCESS;
     for (UINTN phase = 801; phase <= 840; ++phase) {
+        Telemetry_SetPhase((UINT32)phase);
         switch (phase) {
             case 801: Status = ThermalMind_Phase801_InitializeThermalBaseline(ctx); break;
             case 802: Status = ThermalMind_Phase802_DetectGradientSpike(ctx); break;
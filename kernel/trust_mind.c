@@ -3,16 +3,18 @@
 #include "kernel_shared.h"
 #include "telemetry_mind.h"
 #include "ai_core.h"
+#include "phase_registry.h"
+#include <Library/SynchronizationLib.h>
 
 #define TRUST_RING_SIZE 32
 #define MODULE_COUNT    6
 #define THREAD_COUNT    256
 
 static UINT64 gTrustRing[TRUST_RING_SIZE];
-static UINTN  gTrustHead = 0;
+static volatile UINT32 gTrustHead = 0;     // total appends; the slot is Head % TRUST_RING_SIZE
 static UINT64 gModuleTrust[MODULE_COUNT];
-static UINT64 gThreadTrust[THREAD_COUNT];
-static UINT64 gTrustScore = 50;
+static volatile UINT64 gThreadTrust[THREAD_COUNT];
+static volatile UINT64 gTrustScore = 50;
 static INT64  gTrustDeltas[8];
 static UINTN  gDeltaIndex = 0;
 static UINT64 gPrevTrust = 50;
@@ -22,7 +24,7 @@ static BOOLEAN gTrustFrozen = FALSE;
 EFI_STATUS Trust_Reset(void) {
     ZeroMem(gTrustRing, sizeof(gTrustRing));
     ZeroMem(gModuleTrust, sizeof(gModuleTrust));
-    ZeroMem(gThreadTrust, sizeof(gThreadTrust));
+    ZeroMem((VOID *)gThreadTrust, sizeof(gThreadTrust));
     gTrustHead = 0;
     gTrustScore = 50;
     return EFI_SUCCESS;
@@ -32,19 +34,26 @@ UINT64 Trust_GetCurrentScore(void) {
     return gTrustScore;
 }
 
+// Adds Delta to *Score, clamped at zero, and returns the new value. Minds
+// on different APs adjust trust at the same time, so this is a CAS loop
+// rather than a read-modify-write.
+static UINT64 TrustAdd(volatile UINT64 *Score, INTN Delta) {
+    UINT64 Old, New;
+    do {
+        Old = *Score;
+        New = ((INT64)Old + Delta < 0) ? 0 : (UINT64)((INT64)Old + Delta);
+    } while (InterlockedCompareExchange64(Score, Old, New) != Old);
+    return New;
+}
+
 void Trust_AdjustScore(UINTN id, INTN delta) {
-    INT64 new_score = (INT64)gTrustScore + delta;
-    if (new_score < 0) new_score = 0;
-    gTrustScore = (UINT64)new_score;
-
-    if (id < THREAD_COUNT) {
-        INT64 ts = (INT64)gThreadTrust[id] + delta;
-        if (ts < 0) ts = 0;
-        gThreadTrust[id] = (UINT64)ts;
-    }
+    UINT64 score = TrustAdd(&gTrustScore, delta);
+    if (id < THREAD_COUNT) TrustAdd(&gThreadTrust[id], delta);
 
-    gTrustRing[gTrustHead] = gTrustScore;
-    gTrustHead = (gTrustHead + 1) % TRUST_RING_SIZE;
+    // Each adjustment claims its own ring slot; concurrent ones land in
+    // claim order, not necessarily in score order.
+    UINT32 slot = InterlockedIncrement(&gTrustHead) - 1;
+    gTrustRing[slot % TRUST_RING_SIZE] = score;
 }
 
 void Trust_Transfer(UINTN from, UINTN to, UINTN amount) {
@@ -523,59 +532,114 @@ static EFI_STATUS TrustPhase_FinalizeMind(KERNEL_CONTEXT *ctx, UINTN phase) {
     return EFI_SUCCESS;
 }
 
+// Trust phases take the phase number; the registry calls with the context only.
+#define TRUST_PHASE_ADAPTER(id, fn) \
+    static EFI_STATUS fn##_##id(KERNEL_CONTEXT *ctx) { return fn(ctx, id); }
+TRUST_PHASE_ADAPTER(451, TrustPhase_InitBaselineTrust)
+TRUST_PHASE_ADAPTER(452, TrustPhase_MixEntropyIntoTrust)
+TRUST_PHASE_ADAPTER(453, TrustPhase_AmplifySignal)
+TRUST_PHASE_ADAPTER(454, TrustPhase_FilterAnomaly)
+TRUST_PHASE_ADAPTER(455, TrustPhase_DetectOscillation)
+TRUST_PHASE_ADAPTER(456, TrustPhase_RebalanceTrustEntropy)
+TRUST_PHASE_ADAPTER(457, TrustPhase_ValidateDNA)
+TRUST_PHASE_ADAPTER(458, TrustPhase_PollMindTrusts)
+TRUST_PHASE_ADAPTER(459, TrustPhase_AnalyzeDrift)
+TRUST_PHASE_ADAPTER(460, TrustPhase_SanityCheck)
+TRUST_PHASE_ADAPTER(461, TrustPhase_LogTrustCurve)
+TRUST_PHASE_ADAPTER(462, TrustPhase_InterpolateLatency)
+TRUST_PHASE_ADAPTER(463, TrustPhase_GenerateHeatmap)
+TRUST_PHASE_ADAPTER(464, TrustPhase_SmoothTrustScore)
+TRUST_PHASE_ADAPTER(465, TrustPhase_EstimateContention)
+TRUST_PHASE_ADAPTER(466, TrustPhase_MapConfidenceBand)
+TRUST_PHASE_ADAPTER(467, TrustPhase_SyncEntropyGap)
+TRUST_PHASE_ADAPTER(468, TrustPhase_InsertSnapshot)
+TRUST_PHASE_ADAPTER(469, TrustPhase_AnalyzeDeviation)
+TRUST_PHASE_ADAPTER(470, TrustPhase_UpdateTrustDriftHistogram)
+TRUST_PHASE_ADAPTER(471, TrustPhase_TrackFalloffResistance)
+TRUST_PHASE_ADAPTER(472, TrustPhase_MapPeripheralTrustDelta)
+TRUST_PHASE_ADAPTER(473, TrustPhase_CalibrateAnomalyTolerance)
+TRUST_PHASE_ADAPTER(474, TrustPhase_MeasureTrustPulseWidth)
+TRUST_PHASE_ADAPTER(475, TrustPhase_ApplyRecoveryBoost)
+TRUST_PHASE_ADAPTER(476, TrustPhase_ShufflePenaltyBuffer)
+TRUST_PHASE_ADAPTER(477, TrustPhase_PredictInterleave)
+TRUST_PHASE_ADAPTER(478, TrustPhase_ValidateIntentCoherence)
+TRUST_PHASE_ADAPTER(479, TrustPhase_TrustDrainMitigation)
+TRUST_PHASE_ADAPTER(480, TrustPhase_EstimateTrustCertainty)
+TRUST_PHASE_ADAPTER(481, TrustPhase_MapFeedbackLatency)
+TRUST_PHASE_ADAPTER(482, TrustPhase_EvaluateConsensus)
+TRUST_PHASE_ADAPTER(483, TrustPhase_TrackPropagation)
+TRUST_PHASE_ADAPTER(484, TrustPhase_ValidateDNATrustResonance)
+TRUST_PHASE_ADAPTER(485, TrustPhase_ComputeQuantumCoherence)
+TRUST_PHASE_ADAPTER(486, TrustPhase_RectifyBias)
+TRUST_PHASE_ADAPTER(487, TrustPhase_ReinforceWithIntent)
+TRUST_PHASE_ADAPTER(488, TrustPhase_AnchorTrustTemporally)
+TRUST_PHASE_ADAPTER(489, TrustPhase_ClassifyTrustDistribution)
+TRUST_PHASE_ADAPTER(490, TrustPhase_PreventBurnout)
+TRUST_PHASE_ADAPTER(494, TrustPhase_EvaluateElasticity)
+TRUST_PHASE_ADAPTER(495, TrustPhase_ResonanceCheck)
+TRUST_PHASE_ADAPTER(496, TrustPhase_ConvergenceMeter)
+TRUST_PHASE_ADAPTER(497, TrustPhase_ReportTaskInfluence)
+TRUST_PHASE_ADAPTER(498, TrustPhase_VerifyFinalization)
+TRUST_PHASE_ADAPTER(499, TrustPhase_EmitGlobalFrame)
+TRUST_PHASE_ADAPTER(500, TrustPhase_FinalizeMind)
+
+PHASE_ENTRY gTrustPhases[] = {
+    PHASE(451, PHASE_MIND_TRUST, TrustPhase_InitBaselineTrust_451, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(452, PHASE_MIND_TRUST, TrustPhase_MixEntropyIntoTrust_452, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(453, PHASE_MIND_TRUST, TrustPhase_AmplifySignal_453, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(454, PHASE_MIND_TRUST, TrustPhase_FilterAnomaly_454, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(455, PHASE_MIND_TRUST, TrustPhase_DetectOscillation_455, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(456, PHASE_MIND_TRUST, TrustPhase_RebalanceTrustEntropy_456, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(457, PHASE_MIND_TRUST, TrustPhase_ValidateDNA_457, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(458, PHASE_MIND_TRUST, TrustPhase_PollMindTrusts_458, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(459, PHASE_MIND_TRUST, TrustPhase_AnalyzeDrift_459, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(460, PHASE_MIND_TRUST, TrustPhase_SanityCheck_460, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(461, PHASE_MIND_TRUST, TrustPhase_LogTrustCurve_461, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(462, PHASE_MIND_TRUST, TrustPhase_InterpolateLatency_462, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(463, PHASE_MIND_TRUST, TrustPhase_GenerateHeatmap_463, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(464, PHASE_MIND_TRUST, TrustPhase_SmoothTrustScore_464, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(465, PHASE_MIND_TRUST, TrustPhase_EstimateContention_465, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(466, PHASE_MIND_TRUST, TrustPhase_MapConfidenceBand_466, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(467, PHASE_MIND_TRUST, TrustPhase_SyncEntropyGap_467, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(468, PHASE_MIND_TRUST, TrustPhase_InsertSnapshot_468, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(469, PHASE_MIND_TRUST, TrustPhase_AnalyzeDeviation_469, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(470, PHASE_MIND_TRUST, TrustPhase_UpdateTrustDriftHistogram_470, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(471, PHASE_MIND_TRUST, TrustPhase_TrackFalloffResistance_471, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(472, PHASE_MIND_TRUST, TrustPhase_MapPeripheralTrustDelta_472, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(473, PHASE_MIND_TRUST, TrustPhase_CalibrateAnomalyTolerance_473, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(474, PHASE_MIND_TRUST, TrustPhase_MeasureTrustPulseWidth_474, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(475, PHASE_MIND_TRUST, TrustPhase_ApplyRecoveryBoost_475, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(476, PHASE_MIND_TRUST, TrustPhase_ShufflePenaltyBuffer_476, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(477, PHASE_MIND_TRUST, TrustPhase_PredictInterleave_477, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(478, PHASE_MIND_TRUST, TrustPhase_ValidateIntentCoherence_478, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(479, PHASE_MIND_TRUST, TrustPhase_TrustDrainMitigation_479, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(480, PHASE_MIND_TRUST, TrustPhase_EstimateTrustCertainty_480, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(481, PHASE_MIND_TRUST, TrustPhase_MapFeedbackLatency_481, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(482, PHASE_MIND_TRUST, TrustPhase_EvaluateConsensus_482, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(483, PHASE_MIND_TRUST, TrustPhase_TrackPropagation_483, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(484, PHASE_MIND_TRUST, TrustPhase_ValidateDNATrustResonance_484, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(485, PHASE_MIND_TRUST, TrustPhase_ComputeQuantumCoherence_485, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(486, PHASE_MIND_TRUST, TrustPhase_RectifyBias_486, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(487, PHASE_MIND_TRUST, TrustPhase_ReinforceWithIntent_487, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(488, PHASE_MIND_TRUST, TrustPhase_AnchorTrustTemporally_488, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(489, PHASE_MIND_TRUST, TrustPhase_ClassifyTrustDistribution_489, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(490, PHASE_MIND_TRUST, TrustPhase_PreventBurnout_490, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(494, PHASE_MIND_TRUST, TrustPhase_EvaluateElasticity_494, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(495, PHASE_MIND_TRUST, TrustPhase_ResonanceCheck_495, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(496, PHASE_MIND_TRUST, TrustPhase_ConvergenceMeter_496, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(497, PHASE_MIND_TRUST, TrustPhase_ReportTaskInfluence_497, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(498, PHASE_MIND_TRUST, TrustPhase_VerifyFinalization_498, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(499, PHASE_MIND_TRUST, TrustPhase_EmitGlobalFrame_499, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+    PHASE(500, PHASE_MIND_TRUST, TrustPhase_FinalizeMind_500, PHASE_DEADLINE_DEFAULT, PHASE_COST_NORMAL),
+};
+const UINTN gTrustPhaseCount = sizeof(gTrustPhases) / sizeof(gTrustPhases[0]);
+
 EFI_STATUS TrustPhase_Execute(KERNEL_CONTEXT *ctx, UINTN phase) {
     if (gTrustFrozen && phase != 500) return EFI_SUCCESS;
-    EFI_STATUS Status;
-    switch (phase) {
-        case 451: Status = TrustPhase_InitBaselineTrust(ctx, phase); break;
-        case 452: Status = TrustPhase_MixEntropyIntoTrust(ctx, phase); break;
-        case 453: Status = TrustPhase_AmplifySignal(ctx, phase); break;
-        case 454: Status = TrustPhase_FilterAnomaly(ctx, phase); break;
-        case 455: Status = TrustPhase_DetectOscillation(ctx, phase); break;
-        case 456: Status = TrustPhase_RebalanceTrustEntropy(ctx, phase); break;
-        case 457: Status = TrustPhase_ValidateDNA(ctx, phase); break;
-        case 458: Status = TrustPhase_PollMindTrusts(ctx, phase); break;
-        case 459: Status = TrustPhase_AnalyzeDrift(ctx, phase); break;
-        case 460: Status = TrustPhase_SanityCheck(ctx, phase); break;
-        case 461: Status = TrustPhase_LogTrustCurve(ctx, phase); break;
-        case 462: Status = TrustPhase_InterpolateLatency(ctx, phase); break;
-        case 463: Status = TrustPhase_GenerateHeatmap(ctx, phase); break;
-        case 464: Status = TrustPhase_SmoothTrustScore(ctx, phase); break;
-        case 465: Status = TrustPhase_EstimateContention(ctx, phase); break;
-        case 466: Status = TrustPhase_MapConfidenceBand(ctx, phase); break;
-        case 467: Status = TrustPhase_SyncEntropyGap(ctx, phase); break;
-        case 468: Status = TrustPhase_InsertSnapshot(ctx, phase); break;
-        case 469: Status = TrustPhase_AnalyzeDeviation(ctx, phase); break;
-        case 470: Status = TrustPhase_UpdateTrustDriftHistogram(ctx, phase); break;
-        case 471: Status = TrustPhase_TrackFalloffResistance(ctx, phase); break;
-        case 472: Status = TrustPhase_MapPeripheralTrustDelta(ctx, phase); break;
-        case 473: Status = TrustPhase_CalibrateAnomalyTolerance(ctx, phase); break;
-        case 474: Status = TrustPhase_MeasureTrustPulseWidth(ctx, phase); break;
-        case 475: Status = TrustPhase_ApplyRecoveryBoost(ctx, phase); break;
-        case 476: Status = TrustPhase_ShufflePenaltyBuffer(ctx, phase); break;
-        case 477: Status = TrustPhase_PredictInterleave(ctx, phase); break;
-        case 478: Status = TrustPhase_ValidateIntentCoherence(ctx, phase); break;
-        case 479: Status = TrustPhase_TrustDrainMitigation(ctx, phase); break;
-        case 480: Status = TrustPhase_EstimateTrustCertainty(ctx, phase); break;
-        case 481: Status = TrustPhase_MapFeedbackLatency(ctx, phase); break;
-        case 482: Status = TrustPhase_EvaluateConsensus(ctx, phase); break;
-        case 483: Status = TrustPhase_TrackPropagation(ctx, phase); break;
-        case 484: Status = TrustPhase_ValidateDNATrustResonance(ctx, phase); break;
-        case 485: Status = TrustPhase_ComputeQuantumCoherence(ctx, phase); break;
-        case 486: Status = TrustPhase_RectifyBias(ctx, phase); break;
-        case 487: Status = TrustPhase_ReinforceWithIntent(ctx, phase); break;
-        case 488: Status = TrustPhase_AnchorTrustTemporally(ctx, phase); break;
-        case 489: Status = TrustPhase_ClassifyTrustDistribution(ctx, phase); break;
-        case 490: Status = TrustPhase_PreventBurnout(ctx, phase); break;
-        case 494: Status = TrustPhase_EvaluateElasticity(ctx, phase); break;
-        case 495: Status = TrustPhase_ResonanceCheck(ctx, phase); break;
-        case 496: Status = TrustPhase_ConvergenceMeter(ctx, phase); break;
-        case 497: Status = TrustPhase_ReportTaskInfluence(ctx, phase); break;
-        case 498: Status = TrustPhase_VerifyFinalization(ctx, phase); break;
-        case 499: Status = TrustPhase_EmitGlobalFrame(ctx, phase); break;
-        case 500: Status = TrustPhase_FinalizeMind(ctx, phase); break;
-        default: Status = EFI_INVALID_PARAMETER; break;
-    }
+    PHASE_ENTRY *Entry = PhaseRegistry_Find(PHASE_MIND_TRUST, phase);
+    EFI_STATUS Status = EFI_INVALID_PARAMETER;
+    if (Entry != NULL)
+        Status = (Entry->Flags & PHASE_F_ENABLED) ? Entry->Fn(ctx) : EFI_SUCCESS;
     gPrevTrust = ctx->trust_score;
     gPrevEntropy = ctx->EntropyScore;
     return Status;
@@ -586,7 +650,7 @@ static EFI_STATUS TrustPhase651_TrustVectorEntropyFusion(KERNEL_CONTEXT *ctx, UI
     UINT64 hash = 0;
     for (UINTN i = 0; i < 16; ++i) {
         hash ^= ctx->ai_entropy_vector[i];
-        hash ^= ctx->ai_trust_matrix[i % 10][i % 10];
+        hash ^= ctx->cold->ai_trust_matrix[i % 10][i % 10];
         hash = (hash << 5) | (hash >> 59);
     }
     for (UINTN i = 0; i < 32; ++i)
@@ -608,8 +672,8 @@ static EFI_STATUS TrustPhase653_AITrustFeedbackLoop(KERNEL_CONTEXT *ctx, UINTN p
     static INTN accum = 0;
     INTN change = (INTN)ctx->trust_score - (INTN)gPrevTrust;
     for (UINTN i = 0; i < 10; ++i) {
-        if (change > 0) ctx->ai_rule_weights[i]++;
-        else if (change < 0) ctx->ai_rule_weights[i]--;
+        if (change > 0) ctx->cold->ai_rule_weights[i]++;
+        else if (change < 0) ctx->cold->ai_rule_weights[i]--;
     }
     accum += (change > 0) ? 1 : (change < 0 ? -1 : 0);
     if (accum > 5 || accum < -5) { ctx->ai_retrain_id++; accum = 0; }
@@ -887,7 +951,7 @@ static EFI_STATUS TrustPhase683_EntropySpiralDetector(KERNEL_CONTEXT *ctx, UINTN
 
 // === Phase 684: TrustHeatDistributionBalancer ===
 static EFI_STATUS TrustPhase684_TrustHeatDistributionBalancer(KERNEL_CONTEXT *ctx, UINTN phase) {
-    for(UINTN i=0;i<100;i++) if(ctx->trust_heatmap[i]>90){ for(UINTN j=0;j<8;j++) ctx->trust_penalty_buffer[j]>>=1; break; }
+    for(UINTN i=0;i<100;i++) if(ctx->cold->trust_heatmap[i]>90){ for(UINTN j=0;j<8;j++) ctx->trust_penalty_buffer[j]>>=1; break; }
     return EFI_SUCCESS;
 }
 
@@ -1140,7 +1204,7 @@ EFI_STATUS Trust_InitPhase818_ThreadMultiPhaseTrustFusion(KERNEL_CONTEXT *ctx) {
 // === Phase 819: TrustCollapseRollbackEngine ===
 EFI_STATUS Trust_InitPhase819_TrustCollapseRollbackEngine(KERNEL_CONTEXT *ctx) {
     if (gTrustScore < 20) {
-        UINTN last = (gTrustHead + TRUST_RING_SIZE - 1) % TRUST_RING_SIZE;
+        UINTN last = (gTrustHead - 1) % TRUST_RING_SIZE;
         gTrustScore = gTrustRing[last];
         Telemetry_LogEvent("TrustRollback", (UINTN)gTrustScore, 0);
     }
@@ -1421,7 +1485,7 @@ EFI_STATUS Trust_InitPhase851_InterKernelTrustChainEmitter(KERNEL_CONTEXT *ctx)
 
 // === Phase 852: TelemetryAwareTrustRouteOptimizer ===
 EFI_STATUS Trust_InitPhase852_TelemetryAwareTrustRouteOptimizer(KERNEL_CONTEXT *ctx) {
-    Telemetry_LogEvent("TrustRouteOpt", gTelemetryHead, 0);
+    Telemetry_LogEvent("TrustRouteOpt", Telemetry_GetDropped(), 0);
     return EFI_SUCCESS;
 }
 
@@ -1578,7 +1642,7 @@ EFI_STATUS TrustMind_Phase4158_Execute(KERNEL_CONTEXT *ctx) {
     UINTN row = ctx->phase_history_index % 10;
     UINTN col = ctx->trust_score / 10;
     if (col > 9) col = 9;
-    ctx->trust_heatmap[row * 10 + col]++;
+    ctx->cold->trust_heatmap[row * 10 + col]++;
     return EFI_SUCCESS;
 }
 
@@ -1715,7 +1779,7 @@ EFI_STATUS TrustMind_Phase4170_Execute(KERNEL_CONTEXT *ctx) {
 EFI_STATUS TrustMind_Phase4171_Execute(KERNEL_CONTEXT *ctx) {
     for (UINTN r = 0; r < 10; ++r)
         for (UINTN c = 0; c < 10; ++c)
-            ctx->ai_trust_matrix[r][c] = ctx->phase_trust[(ctx->phase_history_index + 20 - 1 - ((r*10+c)%20)) % 20];
+            ctx->cold->ai_trust_matrix[r][c] = ctx->phase_trust[(ctx->phase_history_index + 20 - 1 - ((r*10+c)%20)) % 20];
     return EFI_SUCCESS;
 }
 
@@ -0,0 +1,135 @@
+// bootprof.c - Host reader for the loader's boot profile ring (profile.bin)
+//
+//   cc -O2 -DBOOT_PROFILE_HOST -Iinclude -o bootprof tools/bootprof.c
+//
+//   bootprof dump profile.bin           one line per boot, oldest first
+//   bootprof diff profile.bin           newest boot against the median of the rest
+//   bootprof diff profile.bin A B       boot B against boot A, by sequence number
+//
+// Phases are listed by index in bootloader/phases_list.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "boot_profile.h"
+
+static BOOT_PROFILE_RING gRing;
+static BOOT_PROFILE gRecords[BOOT_PROFILE_SLOTS];
+static const BOOT_PROFILE *gOrder[BOOT_PROFILE_SLOTS];    // valid records, oldest first
+static unsigned gCount;
+
+static double ToUs(UINT64 Ticks, UINT64 Hz) {
+    return Hz ? (double)Ticks * 1e6 / (double)Hz : 0.0;
+}
+
+static int CompareSeq(const void *A, const void *B) {
+    UINT32 a = (*(const BOOT_PROFILE *const *)A)->Sequence, b = (*(const BOOT_PROFILE *const *)B)->Sequence;
+    return (a > b) - (a < b);
+}
+
+static int CompareDouble(const void *A, const void *B) {
+    double a = *(const double *)A, b = *(const double *)B;
+    return (a > b) - (a < b);
+}
+
+static int Load(const char *Path) {
+    FILE *F = fopen(Path, "rb");
+    if (!F) { perror(Path); return -1; }
+    size_t Got = fread(&gRing, 1, sizeof(gRing), F);
+    if (Got != sizeof(gRing) || gRing.Magic != BOOT_PROFILE_RING_MAGIC) {
+        fprintf(stderr, "%s: not a boot profile ring\n", Path);
+        fclose(F);
+        return -1;
+    }
+    if (gRing.Version != BOOT_PROFILE_VERSION || gRing.PhaseCount != BOOT_PROFILE_PHASES ||
+        gRing.Slots != BOOT_PROFILE_SLOTS || gRing.RecordSize != sizeof(BOOT_PROFILE)) {
+        fprintf(stderr, "%s: version %u, %u phases, %u slots of %u bytes; this reader wants %u, %u, %u, %zu\n",
+                Path, gRing.Version, gRing.PhaseCount, gRing.Slots, gRing.RecordSize,
+                BOOT_PROFILE_VERSION, BOOT_PROFILE_PHASES, BOOT_PROFILE_SLOTS, sizeof(BOOT_PROFILE));
+        fclose(F);
+        return -1;
+    }
+    Got = fread(gRecords, 1, sizeof(gRecords), F);
+    fclose(F);
+    for (unsigned i = 0; i < Got / sizeof(BOOT_PROFILE); ++i)
+        if (gRecords[i].Magic == BOOT_PROFILE_MAGIC) gOrder[gCount++] = &gRecords[i];
+    qsort(gOrder, gCount, sizeof(gOrder[0]), CompareSeq);
+    return 0;
+}
+
+static const BOOT_PROFILE *FindSeq(UINT32 Seq) {
+    for (unsigned i = 0; i < gCount; ++i)
+        if (gOrder[i]->Sequence == Seq) return gOrder[i];
+    fprintf(stderr, "boot %u is not in the ring\n", Seq);
+    return NULL;
+}
+
+static void Dump(void) {
+    printf("%6s %10s %9s %6s %5s %9s %9s  %s\n", "boot", "total_us", "kernel_kb", "misses", "pcr", "open/hit", "info/hit", "flags");
+    for (unsigned i = 0; i < gCount; ++i) {
+        const BOOT_PROFILE *R = gOrder[i];
+        printf("%6u %10.0f %9llu %6u %5u %4u/%-4u %4u/%-4u  %s%s%s%s\n",
+               R->Sequence, ToUs(R->TotalTsc, R->TscHz), (unsigned long long)(R->KernelSize / 1024),
+               R->PhaseMisses, R->PcrReads, R->EspOpens, R->EspOpenHits, R->EspInfos, R->EspInfoHits,
+               (R->Flags & BOOT_PROFILE_F_VERIFY_HIT) ? "verify-hit " : "",
+               (R->Flags & BOOT_PROFILE_F_CHAIN_HIT) ? "chain-hit " : "",
+               (R->Flags & BOOT_PROFILE_F_LZ4) ? "lz4 " : "",
+               (R->Flags & BOOT_PROFILE_F_REGRESSED) ? "REGRESSED" : "");
+    }
+}
+
+// Base[p] in microseconds: one record, or the median of Count records.
+static void Baseline(const BOOT_PROFILE *const *Set, unsigned Count, double *Base, double *Total) {
+    double V[BOOT_PROFILE_SLOTS];
+    for (unsigned p = 0; p <= BOOT_PROFILE_PHASES; ++p) {
+        for (unsigned r = 0; r < Count; ++r)
+            V[r] = (p < BOOT_PROFILE_PHASES) ? ToUs(Set[r]->PhaseTsc[p], Set[r]->TscHz)
+                                             : ToUs(Set[r]->TotalTsc, Set[r]->TscHz);
+        qsort(V, Count, sizeof(V[0]), CompareDouble);
+        if (p < BOOT_PROFILE_PHASES) Base[p] = V[Count / 2];
+        else *Total = V[Count / 2];
+    }
+}
+
+static void Diff(const BOOT_PROFILE *const *BaseSet, unsigned BaseCount, const BOOT_PROFILE *Cur, const char *What) {
+    double Base[BOOT_PROFILE_PHASES], BaseTotal;
+    Baseline(BaseSet, BaseCount, Base, &BaseTotal);
+    double Total = ToUs(Cur->TotalTsc, Cur->TscHz);
+
+    printf("boot %u against %s: total %.0f us vs %.0f us (%+.1f%%)\n", Cur->Sequence, What, Total, BaseTotal,
+           BaseTotal > 0 ? (Total - BaseTotal) * 100.0 / BaseTotal : 0.0);
+    printf("%5s %12s %12s %12s %8s\n", "phase", "base_us", "cur_us", "delta_us", "delta");
+    for (unsigned p = 0; p < BOOT_PROFILE_PHASES; ++p) {
+        double Us = ToUs(Cur->PhaseTsc[p], Cur->TscHz), D = Us - Base[p];
+        if (Us == 0 && Base[p] == 0) continue;
+        if (Base[p] > 0)
+            printf("%5u %12.1f %12.1f %+12.1f %+7.1f%%\n", p, Base[p], Us, D, D * 100.0 / Base[p]);
+        else
+            printf("%5u %12.1f %12.1f %+12.1f %8s\n", p, Base[p], Us, D, "new");
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3 || (strcmp(argv[1], "dump") && strcmp(argv[1], "diff")) ||
+        (!strcmp(argv[1], "diff") && argc != 3 && argc != 5)) {
+        fprintf(stderr, "usage: %s dump profile.bin\n       %s diff profile.bin [A B]\n", argv[0], argv[0]);
+        return 2;
+    }
+    if (Load(argv[2])) return 1;
+    if (!strcmp(argv[1], "dump")) { Dump(); return 0; }
+
+    if (argc == 5) {
+        const BOOT_PROFILE *A = FindSeq((UINT32)strtoul(argv[3], NULL, 0));
+        const BOOT_PROFILE *B = FindSeq((UINT32)strtoul(argv[4], NULL, 0));
+        if (!A || !B) return 1;
+        char What[32];
+        snprintf(What, sizeof(What), "boot %u", A->Sequence);
+        Diff(&A, 1, B, What);
+        return 0;
+    }
+    if (gCount < 2) { fprintf(stderr, "need at least two boots to diff\n"); return 1; }
+    char What[48];
+    snprintf(What, sizeof(What), "the median of %u boots", gCount - 1);
+    Diff(gOrder, gCount - 1, gOrder[gCount - 1], What);
+    return 0;
+}
@@ -0,0 +1,411 @@
+// acpi_check.c - The loader's ACPI index against a scalar checksum and a q35 table set
+//
+//   acpi_check [-d DIR]            index checks, exit status 1 on failure
+//   acpi_check -b [-d DIR] [-r N]  checksum GB/s and index build time
+//
+// AcpiIndex_Checksum is compared with a byte loop at every length from 0
+// to 300 (the 16- and 32-byte block edges among them) and every
+// alignment, on random bytes and on 0xFF. The index is then built over an
+// in-memory table set laid out like QEMU q35 with OVMF: FACP, APIC,
+// HPET, MCFG, WAET, BGRT, an 8 KiB DSDT behind the FADT, and a chain of
+// SSDTs spread through the XSDT. Repeated signatures must come back in
+// firmware order, both through an XSDT and an RSDT, and a hundred
+// distinct signatures must all be found despite hash collisions.
+//
+// DIR is a directory of raw tables, as written by `acpidump -b` or found
+// in /sys/firmware/acpi/tables; with it the real tables are indexed and
+// benchmarked as well.
+
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "acpi_index.h"
+#include "tsc.h"
+
+#define POOL_BYTES      (24 * 1024 * 1024)  // .bss, so table addresses fit an RSDT
+#define SET_MAX         (ACPI_INDEX_MAX_TABLES + 8)
+#define SSDT_CHAIN      6
+#define BENCH_ITERS     2000
+
+static UINT8 gPool[POOL_BYTES] __attribute__((aligned(16)));
+static UINTN gPoolUsed;
+static ACPI_INDEX gIndex;
+
+typedef struct {
+    ACPI_SDT_HEADER *Table[SET_MAX];
+    UINTN            Count;
+    ACPI_SDT_HEADER *Dsdt;
+} TABLE_SET;
+
+static VOID *PoolAlloc(UINTN Size, UINTN Misalign) {
+    gPoolUsed = ALIGN_VALUE(gPoolUsed, 16) + Misalign;
+    if (gPoolUsed + Size > POOL_BYTES) {
+        fprintf(stderr, "acpi_check: table pool exhausted\n");
+        exit(1);
+    }
+    VOID *P = gPool + gPoolUsed;
+    gPoolUsed += Size;
+    return P;
+}
+
+// The byte loop the vectorized checksum replaced; kept scalar on purpose.
+__attribute__((optimize("no-tree-vectorize")))
+static UINT8 ScalarChecksum(const VOID *Data, UINTN Length) {
+    const UINT8 *P = Data;
+    UINT8 Sum = 0;
+    for (UINTN i = 0; i < Length; ++i) Sum = (UINT8)(Sum + P[i]);
+    return Sum;
+}
+
+static VOID FixChecksum(ACPI_SDT_HEADER *H) {
+    H->Checksum = 0;
+    H->Checksum = (UINT8)(0 - ScalarChecksum(H, H->Length));
+}
+
+static ACPI_SDT_HEADER *MakeTable(const char *Sig, const char *OemTableId, UINT32 Length) {
+    ACPI_SDT_HEADER *H = PoolAlloc(Length, 0);
+    for (UINT32 i = 0; i < Length; ++i) ((UINT8 *)H)[i] = (UINT8)rand();
+    memcpy(&H->Signature, Sig, 4);
+    H->Length = Length;
+    H->Revision = 2;
+    memcpy(H->OemId, "BOCHS ", 6);
+    memset(H->OemTableId, ' ', 8);
+    memcpy(H->OemTableId, OemTableId, strlen(OemTableId));
+    FixChecksum(H);
+    return H;
+}
+
+static ACPI_SDT_HEADER *MakeFadt(const ACPI_SDT_HEADER *Dsdt, UINT32 Length, BOOLEAN UseX) {
+    ACPI_FADT *F = (ACPI_FADT *)MakeTable("FACP", "BXPC", Length);
+    F->Dsdt = UseX ? 0 : (UINT32)(UINTN)Dsdt;
+    if (Length >= OFFSET_OF(ACPI_FADT, XDsdt) + sizeof(UINT64))
+        F->XDsdt = UseX ? (UINT64)(UINTN)Dsdt : 0;
+    FixChecksum(&F->Header);
+    return &F->Header;
+}
+
+static ACPI_SDT_HEADER *MakeRoot(const TABLE_SET *Set, BOOLEAN Xsdt) {
+    UINTN Entry = Xsdt ? 8 : 4;
+    UINT32 Length = (UINT32)(sizeof(ACPI_SDT_HEADER) + Set->Count * Entry);
+    ACPI_SDT_HEADER *Root = MakeTable(Xsdt ? "XSDT" : "RSDT", "BXPC", Length);
+    for (UINTN i = 0; i < Set->Count; ++i) {
+        UINT64 Address = (UINT64)(UINTN)Set->Table[i];
+        memcpy((UINT8 *)(Root + 1) + i * Entry, &Address, Entry);
+    }
+    FixChecksum(Root);
+    return Root;
+}
+
+// q35 with OVMF, SSDTs from CPU hotplug, TPM and NVDIMM spread between
+// the fixed tables. Sizes follow QEMU 8.x.
+static VOID MakeQ35(TABLE_SET *Set) {
+    static const UINT32 SsdtLength[SSDT_CHAIN] = { 0xCA, 0x1A4, 0x2D7, 0x5E0, 0x4D, 0x8F2 };
+    char Id[9];
+    Set->Count = 0;
+    Set->Dsdt = MakeTable("DSDT", "BXPC", 0x2000 + 0x1C3);
+    Set->Table[Set->Count++] = MakeFadt(Set->Dsdt, 0xF4, TRUE);
+    for (UINTN i = 0; i < SSDT_CHAIN; ++i) {
+        static const char *const Fixed[] = { "APIC", "HPET", "MCFG", "WAET", "BGRT", NULL };
+        static const UINT32 FixedLength[] = { 0x90, 0x38, 0x3C, 0x28, 0x38 };
+        snprintf(Id, sizeof(Id), "SSDT%u", (unsigned)i);
+        Set->Table[Set->Count++] = MakeTable("SSDT", Id, SsdtLength[i]);
+        if (Fixed[i]) Set->Table[Set->Count++] = MakeTable(Fixed[i], "BXPC", FixedLength[i]);
+    }
+}
+
+// Tables from DIR; FACP is pointed at the DSDT copy and resealed.
+static BOOLEAN LoadDir(TABLE_SET *Set, const char *Dir) {
+    DIR *D = opendir(Dir);
+    struct dirent *Ent;
+    ACPI_FADT *Fadt = NULL;
+    char Path[4096];
+
+    if (D == NULL) {
+        perror(Dir);
+        return FALSE;
+    }
+    Set->Count = 0;
+    Set->Dsdt = NULL;
+    while ((Ent = readdir(D)) != NULL && Set->Count < SET_MAX) {
+        snprintf(Path, sizeof(Path), "%s/%s", Dir, Ent->d_name);
+        FILE *F = fopen(Path, "rb");
+        if (F == NULL) continue;
+        ACPI_SDT_HEADER Hdr;
+        if (fread(&Hdr, sizeof(Hdr), 1, F) != 1 || Hdr.Length < sizeof(Hdr) || Hdr.Length > POOL_BYTES / 4 ||
+            !memcmp(&Hdr.Signature, "RSDT", 4) || !memcmp(&Hdr.Signature, "XSDT", 4) ||
+            !memcmp(&Hdr.Signature, "FACS", 4)) {
+            fclose(F);
+            continue;
+        }
+        ACPI_SDT_HEADER *T = PoolAlloc(Hdr.Length, 0);
+        rewind(F);
+        BOOLEAN Ok = fread(T, 1, Hdr.Length, F) == Hdr.Length;
+        fclose(F);
+        if (!Ok) continue;
+        if (T->Signature == SIGNATURE_32('D','S','D','T')) { Set->Dsdt = T; continue; }
+        if (T->Signature == SIGNATURE_32('F','A','C','P')) Fadt = (ACPI_FADT *)T;
+        Set->Table[Set->Count++] = T;
+    }
+    closedir(D);
+    if (Fadt && Set->Dsdt) {
+        Fadt->Dsdt = (UINT32)(UINTN)Set->Dsdt;
+        if (Fadt->Header.Length >= OFFSET_OF(ACPI_FADT, XDsdt) + sizeof(UINT64)) Fadt->XDsdt = (UINT64)(UINTN)Set->Dsdt;
+        FixChecksum(&Fadt->Header);
+    }
+    return Set->Count > 0;
+}
+
+static int Report(const char *Name, BOOLEAN Ok, const char *Detail) {
+    if (*Detail) printf("%-4s %-44s %s\n", Ok ? "ok" : "FAIL", Name, Detail);
+    else printf("%-4s %s\n", Ok ? "ok" : "FAIL", Name);
+    return Ok ? 0 : 1;
+}
+
+static int CheckChecksum(VOID) {
+    static UINT8 Buf[300 + 16];
+    char Detail[96];
+    UINTN Wrong = 0;
+    int Failed = 0;
+
+    srand(15);
+    for (UINTN Fill = 0; Fill < 2; ++Fill) {
+        for (UINTN Len = 0; Len <= 300; ++Len) {
+            for (UINTN Align = 0; Align < 16; ++Align) {
+                for (UINTN i = 0; i < sizeof(Buf); ++i) Buf[i] = Fill ? 0xFF : (UINT8)rand();
+                if (AcpiIndex_Checksum(Buf + Align, Len) != ScalarChecksum(Buf + Align, Len)) {
+                    if (Wrong++ < 8) fprintf(stderr, "  length %lu align %lu\n", (unsigned long)Len, (unsigned long)Align);
+                }
+            }
+        }
+    }
+    snprintf(Detail, sizeof(Detail), "%lu mismatches", (unsigned long)Wrong);
+    Failed += Report("checksum, lengths 0-300, 16 alignments", Wrong == 0, Detail);
+
+    // The 16- and 32-byte block edges, each alone, so a failure names them.
+    static const UINTN Edges[] = { 15, 16, 17, 31, 32, 33, 47, 48, 49, 63, 64, 65 };
+    Wrong = 0;
+    for (UINTN e = 0; e < sizeof(Edges) / sizeof(Edges[0]); ++e) {
+        for (UINTN i = 0; i < sizeof(Buf); ++i) Buf[i] = (UINT8)(i * 7 + 3);
+        if (AcpiIndex_Checksum(Buf + 1, Edges[e]) != ScalarChecksum(Buf + 1, Edges[e])) {
+            fprintf(stderr, "  length %lu\n", (unsigned long)Edges[e]);
+            Wrong++;
+        }
+    }
+    Failed += Report("checksum, 15/16/17/31/32/33/47-49/63-65", Wrong == 0, "");
+
+    // 16 MiB of 0xFF: the widest sum a table the index accepts can produce.
+    UINT8 *Big = PoolAlloc(16 * 1024 * 1024, 3);
+    memset(Big, 0xFF, 16 * 1024 * 1024);
+    Failed += Report("checksum, 16 MiB of 0xFF", AcpiIndex_Checksum(Big, 16 * 1024 * 1024) ==
+                     ScalarChecksum(Big, 16 * 1024 * 1024), "");
+    gPoolUsed -= 16 * 1024 * 1024 + 3;
+    return Failed;
+}
+
+// Every table in Set is found, repeated signatures come back in Set order,
+// and the DSDT is reached through the FADT.
+static BOOLEAN IndexMatches(const TABLE_SET *Set, UINTN *Chained) {
+    BOOLEAN Ok = gIndex.Count == Set->Count + (Set->Dsdt != NULL) && gIndex.BadChecksums == 0;
+    *Chained = 0;
+    for (UINTN i = 0; i < Set->Count; ++i) {
+        UINT32 Sig = Set->Table[i]->Signature;
+        BOOLEAN First = TRUE;
+        for (UINTN j = 0; j < i; ++j) First &= Set->Table[j]->Signature != Sig;
+        if (!First) continue;
+        const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(&gIndex, Sig);
+        for (UINTN j = i; j < Set->Count; ++j) {
+            if (Set->Table[j]->Signature != Sig) continue;
+            Ok &= E != NULL && E->Address == (UINT64)(UINTN)Set->Table[j] && E->ChecksumOk &&
+                  E->Length == Set->Table[j]->Length;
+            if (E == NULL) break;
+            if (j != i) (*Chained)++;
+            E = AcpiIndex_Next(&gIndex, E);
+        }
+        Ok &= E == NULL;
+    }
+    if (Set->Dsdt) {
+        const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(&gIndex, SIGNATURE_32('D','S','D','T'));
+        Ok &= E != NULL && E->Address == (UINT64)(UINTN)Set->Dsdt && E->ChecksumOk && AcpiIndex_Next(&gIndex, E) == NULL;
+    }
+    return Ok;
+}
+
+static int CheckSet(const char *Name, const TABLE_SET *Set) {
+    char Label[64], Detail[96];
+    UINTN Chained = 0;
+    int Failed = 0;
+
+    for (UINTN Xsdt = 0; Xsdt < 2; ++Xsdt) {
+        EFI_STATUS Status = AcpiIndex_Build(&gIndex, MakeRoot(Set, Xsdt == 1));
+        BOOLEAN Ok = !EFI_ERROR(Status) && IndexMatches(Set, &Chained);
+        snprintf(Label, sizeof(Label), "%s through the %s", Name, Xsdt ? "XSDT" : "RSDT");
+        snprintf(Detail, sizeof(Detail), "%u tables, %lu chained", gIndex.Count, (unsigned long)Chained);
+        Failed += Report(Label, Ok, Detail);
+    }
+    return Failed;
+}
+
+static int CheckIndex(VOID) {
+    TABLE_SET Set;
+    ACPI_SDT_HEADER *Root;
+    int Failed = 0;
+
+    MakeQ35(&Set);
+    Failed += CheckSet("q35", &Set);
+    BOOLEAN Ok = FALSE;
+    if (AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','T'))) {
+        UINTN n = 0;
+        for (const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','T')); E; E = AcpiIndex_Next(&gIndex, E)) {
+            char Id[9];
+            snprintf(Id, sizeof(Id), "SSDT%u", (unsigned)n++);
+            Ok = memcmp(((const ACPI_SDT_HEADER *)(UINTN)E->Address)->OemTableId, Id, strlen(Id)) == 0;
+            if (!Ok) break;
+        }
+        Ok &= n == SSDT_CHAIN;
+    }
+    Failed += Report("q35 SSDT chain in XSDT order", Ok, "");
+    Ok = AcpiIndex_Find(&gIndex, SIGNATURE_32('S','R','A','T')) == NULL &&
+         AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','U')) == NULL;
+    Failed += Report("absent signatures", Ok, "");
+
+    // FADT 1.0: no XDsdt field, so the 32-bit Dsdt is followed.
+    Set.Table[0] = MakeFadt(Set.Dsdt, OFFSET_OF(ACPI_FADT, XDsdt), FALSE);
+    Failed += CheckSet("q35, FADT 1.0", &Set);
+
+    // A hundred signatures in 256 slots collide; two of them repeat.
+    Set.Count = 0;
+    Set.Dsdt = NULL;
+    for (UINTN i = 0; i < 100; ++i) {
+        char Sig[5];
+        snprintf(Sig, sizeof(Sig), "T%03u", (unsigned)i);
+        Set.Table[Set.Count++] = MakeTable(Sig, "BXPC", 36 + (UINT32)i);
+        if (i % 40 == 7) Set.Table[Set.Count++] = MakeTable("SSDT", "BXPC", 64);
+    }
+    Failed += CheckSet("100 signatures", &Set);
+
+    // Damaged tables stay indexed but are flagged and not summed twice.
+    MakeQ35(&Set);
+    ((UINT8 *)Set.Table[1])[40] ^= 1;                   // first SSDT, body
+    Set.Table[3]->Length = 8;                           // second SSDT, shorter than a header
+    Root = MakeRoot(&Set, TRUE);
+    AcpiIndex_Build(&gIndex, Root);
+    const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','T'));
+    Ok = gIndex.BadChecksums == 2 && gIndex.Count == Set.Count + 1 && E && !E->ChecksumOk &&
+         (E = AcpiIndex_Next(&gIndex, E)) != NULL && !E->ChecksumOk &&
+         (E = AcpiIndex_Next(&gIndex, E)) != NULL && E->ChecksumOk;
+    Failed += Report("bad checksums flagged", Ok, "");
+
+    // A FADT with a bad checksum is not trusted for the DSDT.
+    ((UINT8 *)Set.Table[0])[50] ^= 1;
+    AcpiIndex_Build(&gIndex, MakeRoot(&Set, TRUE));
+    Failed += Report("bad FADT, no DSDT", AcpiIndex_Find(&gIndex, SIGNATURE_32('D','S','D','T')) == NULL, "");
+
+    // More tables than the index holds: the first ACPI_INDEX_MAX_TABLES.
+    Set.Count = 0;
+    Set.Dsdt = NULL;
+    while (Set.Count < ACPI_INDEX_MAX_TABLES + 8) Set.Table[Set.Count++] = MakeTable("SSDT", "BXPC", 36);
+    AcpiIndex_Build(&gIndex, MakeRoot(&Set, TRUE));
+    UINTN n = 0;
+    for (E = AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','T')); E; E = AcpiIndex_Next(&gIndex, E)) n++;
+    Failed += Report("table limit", gIndex.Count == ACPI_INDEX_MAX_TABLES && n == ACPI_INDEX_MAX_TABLES, "");
+
+    Ok = AcpiIndex_Build(&gIndex, NULL) == EFI_NOT_FOUND && gIndex.Count == 0 &&
+         AcpiIndex_Build(&gIndex, MakeTable("FACP", "BXPC", 64)) == EFI_VOLUME_CORRUPTED;
+    Failed += Report("bad root", Ok, "");
+    return Failed;
+}
+
+static VOID Bench(const char *Name, const TABLE_SET *Set, UINTN Rounds) {
+    ACPI_SDT_HEADER *Root = MakeRoot(Set, TRUE);
+    const ACPI_SDT_HEADER *Big = Set->Dsdt;
+    UINT64 BestSimd = ~0ULL, BestScalar = ~0ULL, BestBuild = ~0ULL, BestFind = ~0ULL;
+    UINTN Bytes = 0;
+    volatile UINTN Sink = 0;
+
+    for (UINTN i = 0; i < Set->Count; ++i) {
+        Bytes += Set->Table[i]->Length;
+        if (Big == NULL || Set->Table[i]->Length > Big->Length) Big = Set->Table[i];
+    }
+    if (Set->Dsdt) Bytes += Set->Dsdt->Length;
+
+    for (UINTN r = 0; r < Rounds; ++r) {
+        UINT64 Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) Sink += AcpiIndex_Checksum(Big, Big->Length);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestSimd) BestSimd = Ticks;
+
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) Sink += ScalarChecksum(Big, Big->Length);
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestScalar) BestScalar = Ticks;
+
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) AcpiIndex_Build(&gIndex, Root);
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestBuild) BestBuild = Ticks;
+
+        // What a mind does at startup: a few fixed tables, then every SSDT.
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) {
+            Sink += (UINTN)AcpiIndex_Find(&gIndex, SIGNATURE_32('A','P','I','C'));
+            Sink += (UINTN)AcpiIndex_Find(&gIndex, SIGNATURE_32('M','C','F','G'));
+            Sink += (UINTN)AcpiIndex_Find(&gIndex, SIGNATURE_32('H','P','E','T'));
+            for (const ACPI_TABLE_ENTRY *E = AcpiIndex_Find(&gIndex, SIGNATURE_32('S','S','D','T')); E;
+                 E = AcpiIndex_Next(&gIndex, E))
+                Sink += E->Length;
+        }
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestFind) BestFind = Ticks;
+    }
+
+    double Simd = (double)Tsc_ToNs(BestSimd) / BENCH_ITERS, Scalar = (double)Tsc_ToNs(BestScalar) / BENCH_ITERS;
+    printf("%s: %lu tables, %lu bytes, best of %lu\n", Name, (unsigned long)Set->Count + (Set->Dsdt != NULL),
+           (unsigned long)Bytes, (unsigned long)Rounds);
+    printf("  checksum %.4s (%u B)   sse2 %8.1f ns %6.2f GB/s   scalar %8.1f ns %6.2f GB/s\n",
+           (const char *)&Big->Signature, Big->Length, Simd, Big->Length / Simd, Scalar, Big->Length / Scalar);
+    printf("  AcpiIndex_Build            %8.1f ns\n", (double)Tsc_ToNs(BestBuild) / BENCH_ITERS);
+    printf("  3 finds + SSDT chain       %8.1f ns\n", (double)Tsc_ToNs(BestFind) / BENCH_ITERS);
+}
+
+int main(int Argc, char **Argv) {
+    BOOLEAN Benchmark = FALSE;
+    const char *Dir = NULL;
+    UINTN Rounds = 5;
+    int Opt, Failed = 0;
+    TABLE_SET Set, Real;
+
+    while ((Opt = getopt(Argc, Argv, "bd:r:")) != -1) {
+        switch (Opt) {
+        case 'b': Benchmark = TRUE; break;
+        case 'd': Dir = optarg; break;
+        case 'r': Rounds = (UINTN)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-d DIR] [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (Rounds == 0) Rounds = 1;
+    if (Dir && !LoadDir(&Real, Dir)) {
+        fprintf(stderr, "acpi_check: no tables in %s\n", Dir);
+        return 2;
+    }
+
+    if (Benchmark) {
+        Tsc_Calibrate();
+        srand(15);
+        MakeQ35(&Set);
+        Bench("q35", &Set, Rounds);
+        if (Dir) Bench(Dir, &Real, Rounds);
+        return 0;
+    }
+
+    Failed += CheckChecksum();
+    Failed += CheckIndex();
+    if (Dir) Failed += CheckSet(Dir, &Real);
+    return Failed ? 1 : 0;
+}
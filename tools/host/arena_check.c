@@ -0,0 +1,241 @@
+// arena_check.c - The loader's boot arena against a counting gBS
+//
+//   arena_check             allocator checks, exit status 1 on failure
+//   arena_check -b [-r N]   ns per allocation, arena against gBS->AllocatePool
+//
+// gBS->AllocatePages and FreePages are wrapped so every firmware call and
+// every page still held is counted. The checks cover alignment and
+// overlap, popping the latest allocation, growth into new chunks and
+// oversized runs, the chunk limit, a firmware that refuses pages, and the
+// teardown: chunks always go back while boot services are up, handoff
+// pages only when the boot failed, and nothing is called after
+// ExitBootServices.
+//
+// The benchmark's pool column is the host's malloc behind the shim, which
+// is far cheaper than a firmware AllocatePool; the firmware-call counts
+// are what carry over to a real boot.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "boot_arena.h"
+#include "tsc.h"
+
+#define CHECK_CHUNK_BYTES   EFI_PAGES_TO_SIZE(BOOT_ARENA_CHUNK_PAGES)
+#define BENCH_ALLOCS        4096
+
+static EFI_STATUS (EFIAPI *gRealAllocatePages)(EFI_ALLOCATE_TYPE, EFI_MEMORY_TYPE, UINTN, EFI_PHYSICAL_ADDRESS *);
+static EFI_STATUS (EFIAPI *gRealFreePages)(EFI_PHYSICAL_ADDRESS, UINTN);
+static UINTN   gPageCalls;
+static INT64   gPagesHeld;
+static BOOLEAN gRefusePages;
+
+static EFI_STATUS EFIAPI CountAllocatePages(EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType, UINTN Pages,
+                                            EFI_PHYSICAL_ADDRESS *Memory) {
+    gPageCalls++;
+    if (gRefusePages) return EFI_OUT_OF_RESOURCES;
+    EFI_STATUS Status = gRealAllocatePages(Type, MemoryType, Pages, Memory);
+    if (!EFI_ERROR(Status)) gPagesHeld += (INT64)Pages;
+    return Status;
+}
+
+static EFI_STATUS EFIAPI CountFreePages(EFI_PHYSICAL_ADDRESS Memory, UINTN Pages) {
+    gPageCalls++;
+    gPagesHeld -= (INT64)Pages;
+    return gRealFreePages(Memory, Pages);
+}
+
+static int Report(const char *Name, BOOLEAN Ok, const char *Detail) {
+    if (*Detail) printf("%-4s %-44s %s\n", Ok ? "ok" : "FAIL", Name, Detail);
+    else printf("%-4s %s\n", Ok ? "ok" : "FAIL", Name);
+    return Ok ? 0 : 1;
+}
+
+static BOOLEAN Overlaps(const UINT8 *A, UINTN ASize, const UINT8 *B, UINTN BSize) {
+    return A < B + BSize && B < A + ASize;
+}
+
+static int CheckAlignment(VOID) {
+    static const UINTN Sizes[] = { 1, 24, 7, 4096, 100, 3 };
+    static const UINTN Aligns[] = { 8, 16, 8, EFI_PAGE_SIZE, 64, EFI_PAGE_SIZE };
+    BOOT_ARENA A = { 0 };
+    UINT8 *P[6];
+    BOOLEAN Ok = TRUE;
+
+    for (UINTN i = 0; i < 6; ++i) {
+        P[i] = BootArena_Alloc(&A, Sizes[i], Aligns[i]);
+        Ok &= P[i] != NULL && ((UINTN)P[i] & (Aligns[i] - 1)) == 0;
+        if (P[i]) memset(P[i], (int)i + 1, Sizes[i]);
+    }
+    for (UINTN i = 0; Ok && i < 6; ++i) {
+        for (UINTN j = 0; j < i; ++j) Ok &= !Overlaps(P[i], Sizes[i], P[j], Sizes[j]);
+        for (UINTN b = 0; b < Sizes[i]; ++b) Ok &= P[i][b] == (UINT8)(i + 1);
+    }
+    Ok &= A.ChunkCount == 1 && A.Allocs == 6 && A.FirmwareCalls == 1;
+    BootArena_Teardown(&A, TRUE, FALSE);
+    return Report("aligned, disjoint allocations", Ok && gPagesHeld == 0, "");
+}
+
+static int CheckPop(VOID) {
+    BOOT_ARENA A = { 0 };
+    UINT8 *First = BootArena_Alloc(&A, 100, 8);
+    UINT8 *Second = BootArena_Alloc(&A, 200, 8);
+    UINTN Used = A.Chunk[0].Used;
+
+    BootArena_Pop(&A, First);                   // not the latest: kept
+    BOOLEAN Ok = A.Chunk[0].Used == Used;
+    BootArena_Pop(&A, Second);
+    Ok &= A.Chunk[0].Used == 100 && A.Last == NULL;
+    BootArena_Pop(&A, First);                   // only one step back
+    Ok &= A.Chunk[0].Used == 100;
+    Ok &= BootArena_Alloc(&A, 200, 8) == Second;
+    BootArena_Teardown(&A, TRUE, FALSE);
+    return Report("pop only the latest allocation", Ok && gPagesHeld == 0, "");
+}
+
+static int CheckGrowth(VOID) {
+    BOOT_ARENA A = { 0 };
+    char Detail[64];
+
+    UINT8 *Small = BootArena_Alloc(&A, CHECK_CHUNK_BYTES - 64, 8);
+    UINT8 *Spill = BootArena_Alloc(&A, 128, 8);         // does not fit behind Small
+    UINT8 *Large = BootArena_Alloc(&A, 3 * CHECK_CHUNK_BYTES, EFI_PAGE_SIZE);
+    BOOLEAN Ok = Small && Spill && Large && A.ChunkCount == 3 && A.Current == 2;
+    Ok &= A.Chunk[1].Base == Spill && A.Chunk[2].Size == 3 * CHECK_CHUNK_BYTES;
+    Ok &= A.HighWater == CHECK_CHUNK_BYTES - 64 + 128 + 3 * CHECK_CHUNK_BYTES;
+    Ok &= A.FirmwareCalls == 3;
+    snprintf(Detail, sizeof(Detail), "%lu chunks, high water %lu KiB", (unsigned long)A.ChunkCount,
+             (unsigned long)(A.HighWater / 1024));
+    BootArena_Teardown(&A, TRUE, FALSE);
+    return Report("new chunk on spill, own run when oversized", Ok && gPagesHeld == 0, Detail);
+}
+
+static int CheckLimits(VOID) {
+    BOOT_ARENA A = { 0 };
+    BOOLEAN Ok = TRUE;
+
+    for (UINTN i = 0; i < BOOT_ARENA_MAX_CHUNKS; ++i) Ok &= BootArena_Alloc(&A, CHECK_CHUNK_BYTES, 8) != NULL;
+    UINTN Calls = gPageCalls;
+    Ok &= BootArena_Alloc(&A, 1, 8) == NULL && gPageCalls == Calls;   // table full, no firmware call
+    BootArena_Teardown(&A, TRUE, FALSE);
+    Ok &= gPagesHeld == 0;
+
+    gRefusePages = TRUE;
+    Ok &= BootArena_Alloc(&A, 1, 8) == NULL && A.ChunkCount == 0;
+    gRefusePages = FALSE;
+    Ok &= BootArena_Alloc(&A, 1, 8) != NULL && A.ChunkCount == 1;
+    BootArena_Teardown(&A, TRUE, FALSE);
+    return Report("chunk table full, firmware out of pages", Ok && gPagesHeld == 0, "");
+}
+
+static int CheckTeardown(VOID) {
+    BOOT_ARENA A = { 0 };
+    EFI_PHYSICAL_ADDRESS Page;
+    int Failed = 0;
+
+    // Success: chunks go back, the handoff pages stay with the kernel.
+    BOOLEAN Ok = BootArena_Alloc(&A, 64, 8) != NULL;
+    Ok &= !EFI_ERROR(BootArena_AllocHandoff(&A, AllocateAnyPages, EfiLoaderData, 3, &Page));
+    BootArena_Teardown(&A, TRUE, TRUE);
+    Ok &= gPagesHeld == 3 && A.ChunkCount == 0 && A.HandoffCount == 0;
+    gRealFreePages(Page, 3);
+    gPagesHeld -= 3;
+    Failed += Report("teardown keeps handoff pages", Ok, "");
+
+    // Failed boot: everything goes back.
+    Ok = BootArena_Alloc(&A, 64, 8) != NULL;
+    for (UINTN h = 0; h < BOOT_ARENA_MAX_HANDOFF; ++h)
+        Ok &= !EFI_ERROR(BootArena_AllocHandoff(&A, AllocateAnyPages, EfiRuntimeServicesData, 1, &Page));
+    Ok &= BootArena_AllocHandoff(&A, AllocateAnyPages, EfiLoaderData, 1, &Page) == EFI_OUT_OF_RESOURCES;
+    BootArena_Teardown(&A, TRUE, FALSE);
+    Failed += Report("teardown after a failed boot frees all", Ok && gPagesHeld == 0, "");
+
+    // After ExitBootServices: no calls, the state is still reset.
+    Ok = BootArena_Alloc(&A, 64, 8) != NULL;
+    BOOT_ARENA_CHUNK Chunk = A.Chunk[0];
+    UINTN Calls = gPageCalls;
+    BootArena_Teardown(&A, FALSE, FALSE);
+    Ok &= gPageCalls == Calls && A.ChunkCount == 0 && A.Last == NULL;
+    CountFreePages((EFI_PHYSICAL_ADDRESS)(UINTN)Chunk.Base, EFI_SIZE_TO_PAGES(Chunk.Size));  // the OS's job
+    Failed += Report("teardown without boot services", Ok && gPagesHeld == 0, "");
+    return Failed;
+}
+
+// Same request sizes as a loader run: mostly small records, some page runs.
+static UINTN BenchSize(UINTN i) {
+    return (i % 16 == 15) ? EFI_PAGE_SIZE * (1 + i % 3) : 16 + (i * 37) % 480;
+}
+
+static VOID Bench(UINTN Rounds) {
+    static VOID *Ptr[BENCH_ALLOCS];
+    UINT64 BestArena = ~0ULL, BestPool = ~0ULL, BestPop = ~0ULL;
+    UINTN ArenaCalls = 0;
+
+    Tsc_Calibrate();
+    for (UINTN r = 0; r < Rounds; ++r) {
+        BOOT_ARENA A = { 0 };
+        BootArena_Grow(&A, 0);          // the loader maps its first chunk up front
+        UINTN Calls = gPageCalls;
+        UINT64 Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ALLOCS; ++i) Ptr[i] = BootArena_Alloc(&A, BenchSize(i), 8);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        ArenaCalls = gPageCalls - Calls + 1;
+        if (Ticks < BestArena) BestArena = Ticks;
+
+        // Scratch buffers: allocate and hand straight back.
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ALLOCS; ++i) BootArena_Pop(&A, BootArena_Alloc(&A, BenchSize(i), 8));
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestPop) BestPop = Ticks;
+        BootArena_Teardown(&A, TRUE, FALSE);
+
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ALLOCS; ++i) gBS->AllocatePool(EfiBootServicesData, BenchSize(i), &Ptr[i]);
+        for (UINTN i = 0; i < BENCH_ALLOCS; ++i) gBS->FreePool(Ptr[i]);
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestPool) BestPool = Ticks;
+    }
+    printf("%u allocations, 16 B to 12 KiB, best of %lu\n", BENCH_ALLOCS, (unsigned long)Rounds);
+    printf("  arena alloc              %7.1f ns   %4lu firmware calls\n",
+           (double)Tsc_ToNs(BestArena) / BENCH_ALLOCS, (unsigned long)ArenaCalls);
+    printf("  arena alloc + pop        %7.1f ns\n", (double)Tsc_ToNs(BestPop) / BENCH_ALLOCS);
+    printf("  gBS pool alloc + free    %7.1f ns   %4u firmware calls (host malloc)\n",
+           (double)Tsc_ToNs(BestPool) / BENCH_ALLOCS, 2 * BENCH_ALLOCS);
+}
+
+int main(int Argc, char **Argv) {
+    BOOLEAN Benchmark = FALSE;
+    UINTN Rounds = 5;
+    int Opt, Failed = 0;
+
+    while ((Opt = getopt(Argc, Argv, "br:")) != -1) {
+        switch (Opt) {
+        case 'b': Benchmark = TRUE; break;
+        case 'r': Rounds = (UINTN)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (Rounds == 0) Rounds = 1;
+
+    gRealAllocatePages = gBS->AllocatePages;
+    gRealFreePages = gBS->FreePages;
+    gBS->AllocatePages = CountAllocatePages;
+    gBS->FreePages = CountFreePages;
+    if (Benchmark) {
+        Bench(Rounds);
+        return 0;
+    }
+
+    Failed += CheckAlignment();
+    Failed += CheckPop();
+    Failed += CheckGrowth();
+    Failed += CheckLimits();
+    Failed += CheckTeardown();
+    return Failed ? 1 : 0;
+}
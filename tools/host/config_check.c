@@ -0,0 +1,346 @@
+// config_check.c - The loader's config.ini parser and config.bin cache
+//
+//   config_check             parser and cache checks, exit status 1 on failure
+//   config_check -b [-r N]   ns to parse config.ini against validating config.bin
+//
+// The parser is fed well-formed files in each line-ending style, then
+// malformed ones: keys without values, values that overflow or are not
+// numbers, paths that do not fit, comments, sections, stray '=' and
+// embedded NULs, and random bytes. Nothing malformed may change a
+// setting, and the parser must not write past the line it is on.
+//
+// The cache checks seal a config.bin and then take it apart: a short
+// read, a changed INI size or timestamp, an INI without a timestamp, a
+// wrong magic or version, any single byte flipped, and an unterminated
+// path under a valid digest must all send the loader back to the parser.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "boot_config.h"
+#include "tsc.h"
+
+#define FUZZ_ROUNDS     20000
+#define FUZZ_MAX        256
+#define BENCH_ITERS     20000
+
+static const char gGoodIni[] =
+    "# AiOS loader\n"
+    "kernel_path=\\EFI\\AiOS\\kernel2.elf\n"
+    "signature_path=\\EFI\\AiOS\\kernel2.sig\n"
+    "trust_threshold=70\n"
+    "fallback_enabled=1\n"
+    "boot_delay=3\n"
+    "entropy_required=1\n"
+    "quiet_boot=1\n"
+    "profile_regress_pct=25\n";
+
+static VOID Defaults(BOOT_CONFIG_SETTINGS *S) {
+    static const CHAR16 Kernel[] = L"\\EFI\\AiOS\\kernel.elf", Sig[] = L"\\EFI\\AiOS\\kernel.sig";
+    memset(S, 0, sizeof(*S));
+    S->TrustThreshold = 60;
+    memcpy(S->KernelPath, Kernel, sizeof(Kernel));
+    memcpy(S->SignaturePath, Sig, sizeof(Sig));
+}
+
+static BOOLEAN PathIs(const CHAR16 *Path, const char *Expect) {
+    for (UINTN i = 0; ; ++i) {
+        if (Path[i] != (UINT8)Expect[i]) return FALSE;
+        if (Expect[i] == 0) return TRUE;
+    }
+}
+
+// Parses a copy of Text, which may hold NULs, with a canary behind it.
+static VOID Parse(BOOT_CONFIG_SETTINGS *S, const char *Text, UINTN Len, BOOLEAN *Overrun) {
+    static CHAR8 Buf[4096 + 16];
+    memcpy(Buf, Text, Len);
+    Buf[Len] = 0;
+    memset(Buf + Len + 1, 0x5A, 15);
+    BootConfig_Parse(S, Buf);
+    for (UINTN i = Len + 1; i < Len + 16; ++i)
+        if (Buf[i] != 0x5A) *Overrun = TRUE;
+}
+
+static BOOLEAN GoodSettings(const BOOT_CONFIG_SETTINGS *S) {
+    return PathIs(S->KernelPath, "\\EFI\\AiOS\\kernel2.elf") && PathIs(S->SignaturePath, "\\EFI\\AiOS\\kernel2.sig") &&
+           S->TrustThreshold == 70 && S->Config.FallbackEnabled && S->Config.BootDelay == 3 &&
+           S->Config.EntropyRequired && S->Config.QuietBoot && S->Config.ProfileRegressPct == 25;
+}
+
+static int Report(const char *Name, BOOLEAN Ok, const char *Detail) {
+    if (*Detail) printf("%-4s %-44s %s\n", Ok ? "ok" : "FAIL", Name, Detail);
+    else printf("%-4s %s\n", Ok ? "ok" : "FAIL", Name);
+    return Ok ? 0 : 1;
+}
+
+// The good file with "\n" swapped for Eol, and optionally no final newline.
+static UINTN Restyle(char *Out, const char *Eol, BOOLEAN LastEol) {
+    UINTN n = 0;
+    for (const char *P = gGoodIni; *P; ++P) {
+        if (*P != '\n') { Out[n++] = *P; continue; }
+        if (P[1] == 0 && !LastEol) break;
+        for (const char *E = Eol; *E; ++E) Out[n++] = *E;
+    }
+    return n;
+}
+
+static int CheckWellFormed(VOID) {
+    static const struct { const char *Name; const char *Eol; BOOLEAN LastEol; } Styles[] = {
+        { "LF",                     "\n",   TRUE },
+        { "CRLF",                   "\r\n", TRUE },
+        { "CR",                     "\r",   TRUE },
+        { "no final newline",       "\n",   FALSE },
+        { "CRLF, no final newline", "\r\n", FALSE },
+        { "blank lines",            "\n\n\r\n", TRUE },
+    };
+    char Text[2048], Name[64];
+    int Failed = 0;
+
+    for (UINTN i = 0; i < sizeof(Styles) / sizeof(Styles[0]); ++i) {
+        BOOT_CONFIG_SETTINGS S;
+        BOOLEAN Overrun = FALSE;
+        Defaults(&S);
+        Parse(&S, Text, Restyle(Text, Styles[i].Eol, Styles[i].LastEol), &Overrun);
+        snprintf(Name, sizeof(Name), "parse, %s", Styles[i].Name);
+        Failed += Report(Name, GoodSettings(&S) && !Overrun, "");
+    }
+
+    // Spacing, case, '=' inside a value, and the last duplicate winning.
+    static const char Loose[] =
+        "  KERNEL_PATH =  \\EFI\\AiOS\\kernel2.elf\t\n"
+        "Signature_Path\t=\\EFI\\AiOS\\kernel2.sig  \n"
+        "trust_threshold=1\ntrust_threshold = 070 \n"
+        "fallback_enabled=7\nboot_delay=3\nentropy_required=1\nquiet_boot=1\nprofile_regress_pct=25";
+    BOOT_CONFIG_SETTINGS S;
+    BOOLEAN Overrun = FALSE;
+    Defaults(&S);
+    Parse(&S, Loose, sizeof(Loose) - 1, &Overrun);
+    Failed += Report("parse, spacing, case and duplicates", GoodSettings(&S) && !Overrun, "");
+
+    static const char EqInValue[] = "kernel_path=\\a=b.elf\n";
+    Defaults(&S);
+    Parse(&S, EqInValue, sizeof(EqInValue) - 1, &Overrun);
+    Failed += Report("parse, '=' inside a value", PathIs(S.KernelPath, "\\a=b.elf") && !Overrun, "");
+    return Failed;
+}
+
+// Each of these alone must leave every setting at its default.
+static const char *const gMalformed[] = {
+    "",
+    "\n\r\n\r",
+    "kernel_path",
+    "kernel_path=",
+    "kernel_path=   \t",
+    "=\\EFI\\x.elf",
+    "# kernel_path=\\EFI\\x.elf",
+    "; trust_threshold=1",
+    "[kernel_path=\\EFI\\x.elf]",
+    "kernel path=\\EFI\\x.elf",
+    "kernel_pathx=\\EFI\\x.elf",
+    "trust_threshold=",
+    "trust_threshold=-1",
+    "trust_threshold=256",
+    "trust_threshold=99999999999999999999999",
+    "trust_threshold=5x",
+    "trust_threshold=0x10",
+    "trust_threshold=1 2",
+    "boot_delay=+3",
+    "fallback_enabled=yes",
+    "quiet_boot=true",
+    "entropy_required=1.0",
+    "profile_regress_pct=300",
+};
+
+static int CheckMalformed(VOID) {
+    BOOT_CONFIG_SETTINGS Default, S;
+    char Detail[96];
+    UINTN Changed = 0;
+    BOOLEAN Overrun = FALSE;
+    int Failed = 0;
+
+    Defaults(&Default);
+    for (UINTN i = 0; i < sizeof(gMalformed) / sizeof(gMalformed[0]); ++i) {
+        S = Default;
+        Parse(&S, gMalformed[i], strlen(gMalformed[i]), &Overrun);
+        if (memcmp(&S, &Default, sizeof(S)) != 0) {
+            fprintf(stderr, "  changed by: \"%s\"\n", gMalformed[i]);
+            Changed++;
+        }
+    }
+    snprintf(Detail, sizeof(Detail), "%lu inputs, %lu changed a setting",
+             (unsigned long)(sizeof(gMalformed) / sizeof(gMalformed[0])), (unsigned long)Changed);
+    Failed += Report("malformed lines ignored", Changed == 0 && !Overrun, Detail);
+
+    // 259 characters fit with the terminator, 260 do not.
+    char Line[BOOT_CONFIG_PATH_MAX + 32];
+    int n = snprintf(Line, sizeof(Line), "kernel_path=");
+    memset(Line + n, 'k', BOOT_CONFIG_PATH_MAX - 1);
+    Line[n + BOOT_CONFIG_PATH_MAX - 1] = 0;
+    S = Default;
+    Parse(&S, Line, strlen(Line), &Overrun);
+    BOOLEAN Ok = S.KernelPath[BOOT_CONFIG_PATH_MAX - 2] == 'k' && S.KernelPath[BOOT_CONFIG_PATH_MAX - 1] == 0;
+    strcat(Line, "k");
+    S = Default;
+    Parse(&S, Line, strlen(Line), &Overrun);
+    Ok &= memcmp(&S, &Default, sizeof(S)) == 0;
+    Failed += Report("path length limit", Ok && !Overrun, "259 kept, 260 rejected");
+
+    // Parsing stops at a NUL; what follows it is not config.
+    static const char Nul[] = "boot_delay=3\0boot_delay=9\n";
+    S = Default;
+    Parse(&S, Nul, sizeof(Nul) - 1, &Overrun);
+    Failed += Report("embedded NUL ends the file", S.Config.BootDelay == 3 && !Overrun, "");
+
+    // Random lines built from the characters the parser cares about.
+    static const char Alphabet[] = "==\r\n\n \t#;[k_ernl_path0129x\\";
+    static const char *const Keys[] = { "kernel_path=", "trust_threshold=", "boot_delay=", "quiet_boot=" };
+    char Text[FUZZ_MAX + 32];
+    UINTN Unterminated = 0;
+    srand(16);
+    for (UINTN r = 0; r < FUZZ_ROUNDS; ++r) {
+        UINTN Len = 0, Want = (UINTN)rand() % FUZZ_MAX;
+        while (Len < Want) {
+            if (rand() % 8 == 0) {
+                const char *K = Keys[rand() % 4];
+                while (*K && Len < FUZZ_MAX) Text[Len++] = *K++;
+            } else {
+                Text[Len++] = Alphabet[rand() % (sizeof(Alphabet) - 1)];
+            }
+        }
+        S = Default;
+        Parse(&S, Text, Len, &Overrun);
+        Unterminated += S.KernelPath[BOOT_CONFIG_PATH_MAX - 1] != 0 || S.SignaturePath[BOOT_CONFIG_PATH_MAX - 1] != 0;
+    }
+    snprintf(Detail, sizeof(Detail), "%u files, %lu unterminated paths", FUZZ_ROUNDS, (unsigned long)Unterminated);
+    Failed += Report("random input", !Overrun && Unterminated == 0, Detail);
+    return Failed;
+}
+
+static int CheckCache(VOID) {
+    static BOOT_CONFIG_CACHE C, Sealed;
+    BOOT_CONFIG_SETTINGS S;
+    EFI_TIME Time = { 2026, 10, 18, 9, 30, 0, 0, 0, 0, 0, 0 }, Later = Time, NoTime = { 0 };
+    UINT8 IniHash[SHA256_DIGEST_LENGTH];
+    UINT64 IniSize = sizeof(gGoodIni) - 1;
+    char Detail[96];
+    int Failed = 0;
+
+    SHA256_CTX Sha;
+    sha256_init(&Sha);
+    sha256_update(&Sha, (const UINT8 *)gGoodIni, IniSize);
+    sha256_final(&Sha, IniHash);
+    Defaults(&S);
+    BOOLEAN Overrun = FALSE;
+    Parse(&S, gGoodIni, IniSize, &Overrun);
+
+    BootConfig_CacheSeal(&Sealed, &S, IniSize, &Time, IniHash);
+    BOOLEAN Ok = BootConfig_CacheValid(&Sealed, sizeof(Sealed), IniSize, &Time) &&
+                 memcmp(&Sealed.Settings, &S, sizeof(S)) == 0 && GoodSettings(&Sealed.Settings);
+    Failed += Report("cache round trip", Ok, "");
+
+    Failed += Report("cache, short read", !BootConfig_CacheValid(&Sealed, sizeof(Sealed) - 1, IniSize, &Time), "");
+    Failed += Report("cache, INI size changed", !BootConfig_CacheValid(&Sealed, sizeof(Sealed), IniSize + 1, &Time), "");
+    Later.Second++;
+    Failed += Report("cache, INI timestamp changed", !BootConfig_CacheValid(&Sealed, sizeof(Sealed), IniSize, &Later), "");
+    Later = Time;
+    Later.Nanosecond = 1;
+    Failed += Report("cache, INI timestamp changed by 1 ns", !BootConfig_CacheValid(&Sealed, sizeof(Sealed), IniSize, &Later), "");
+
+    BootConfig_CacheSeal(&C, &S, IniSize, &NoTime, IniHash);
+    Failed += Report("cache, INI without a timestamp", !BootConfig_CacheValid(&C, sizeof(C), IniSize, &NoTime), "");
+
+    C = Sealed;
+    C.Magic ^= 1;
+    Ok = !BootConfig_CacheValid(&C, sizeof(C), IniSize, &Time);
+    C = Sealed;
+    C.Version = BOOT_CONFIG_CACHE_VERSION - 1;
+    Ok &= !BootConfig_CacheValid(&C, sizeof(C), IniSize, &Time);
+    Failed += Report("cache, wrong magic or version", Ok, "");
+
+    // Every byte covered by the digest, and the digest itself; only the
+    // struct's tail padding is left out.
+    UINTN Accepted = 0, Covered = OFFSET_OF(BOOT_CONFIG_CACHE, Digest) + SHA256_DIGEST_LENGTH;
+    for (UINTN i = 0; i < Covered; ++i) {
+        C = Sealed;
+        ((UINT8 *)&C)[i] ^= 0x01;
+        Accepted += BootConfig_CacheValid(&C, sizeof(C), IniSize, &Time);
+    }
+    snprintf(Detail, sizeof(Detail), "%lu bytes, %lu accepted", (unsigned long)Covered, (unsigned long)Accepted);
+    Failed += Report("cache, any byte flipped", Accepted == 0, Detail);
+
+    // A cache written by something else, digest and all.
+    S.KernelPath[BOOT_CONFIG_PATH_MAX - 1] = L'k';
+    BootConfig_CacheSeal(&C, &S, IniSize, &Time, IniHash);
+    Failed += Report("cache, unterminated path", !BootConfig_CacheValid(&C, sizeof(C), IniSize, &Time), "");
+    return Failed;
+}
+
+static VOID Bench(UINTN Rounds) {
+    static BOOT_CONFIG_CACHE C;
+    static CHAR8 Buf[sizeof(gGoodIni)];
+    BOOT_CONFIG_SETTINGS S;
+    EFI_TIME Time = { 2026, 10, 18, 9, 30, 0, 0, 0, 0, 0, 0 };
+    UINT8 IniHash[SHA256_DIGEST_LENGTH];
+    UINT64 BestParse = ~0ULL, BestCache = ~0ULL;
+    volatile UINTN Sink = 0;
+
+    Tsc_Calibrate();
+    Defaults(&S);
+    memset(IniHash, 0, sizeof(IniHash));
+    BootConfig_CacheSeal(&C, &S, sizeof(gGoodIni) - 1, &Time, IniHash);
+    for (UINTN r = 0; r < Rounds; ++r) {
+        // What a cache miss costs on top of the read: hash and parse.
+        UINT64 Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) {
+            SHA256_CTX Sha;
+            memcpy(Buf, gGoodIni, sizeof(gGoodIni));
+            sha256_init(&Sha);
+            sha256_update(&Sha, (const UINT8 *)Buf, sizeof(gGoodIni) - 1);
+            sha256_final(&Sha, IniHash);
+            BootConfig_Parse(&S, Buf);
+            Sink += S.Config.BootDelay;
+        }
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestParse) BestParse = Ticks;
+
+        Start = AsmReadTsc();
+        for (UINTN i = 0; i < BENCH_ITERS; ++i) Sink += BootConfig_CacheValid(&C, sizeof(C), sizeof(gGoodIni) - 1, &Time);
+        Ticks = AsmReadTsc() - Start;
+        if (Ticks < BestCache) BestCache = Ticks;
+    }
+    printf("config.ini of %lu bytes, config.bin of %lu bytes, best of %lu\n",
+           (unsigned long)(sizeof(gGoodIni) - 1), (unsigned long)sizeof(C), (unsigned long)Rounds);
+    printf("  hash + parse config.ini  %8.1f ns\n", (double)Tsc_ToNs(BestParse) / BENCH_ITERS);
+    printf("  validate config.bin      %8.1f ns\n", (double)Tsc_ToNs(BestCache) / BENCH_ITERS);
+    printf("  (file reads not included; on a real ESP they dominate both)\n");
+}
+
+int main(int Argc, char **Argv) {
+    BOOLEAN Benchmark = FALSE;
+    UINTN Rounds = 5;
+    int Opt, Failed = 0;
+
+    while ((Opt = getopt(Argc, Argv, "br:")) != -1) {
+        switch (Opt) {
+        case 'b': Benchmark = TRUE; break;
+        case 'r': Rounds = (UINTN)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (Rounds == 0) Rounds = 1;
+    if (Benchmark) {
+        Bench(Rounds);
+        return 0;
+    }
+
+    Failed += CheckWellFormed();
+    Failed += CheckMalformed();
+    Failed += CheckCache();
+    return Failed ? 1 : 0;
+}
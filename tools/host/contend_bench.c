@@ -0,0 +1,115 @@
+// contend_bench.c - Contended counter updates, packed against cache-aligned
+//
+//   contend_bench [-j CPUS] [-n UPDATES]
+//
+// Each CPU plays one mind bumping its own phase, miss and entropy counters,
+// the way the GPU and IO minds bump their mind_counters slot. In the packed
+// layout the slots sit back to back as they did in the flat context, so
+// up to four minds share a cache line; in the aligned layout they are
+// MIND_COUNTERS, one line each. Nobody shares a counter, so every slowdown
+// in the packed rows is false sharing. With a single host CPU the threads
+// only take turns and both layouts run at the same rate.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "ap_pool.h"
+#include "tsc.h"
+
+#define CONTEND_MAX_CPUS    16
+
+typedef struct {
+    UINTN  phases;
+    UINTN  misses;
+    UINT64 entropy;
+} PACKED_COUNTERS;
+
+typedef struct {
+    volatile UINTN  *Phases;
+    volatile UINTN  *Misses;
+    volatile UINT64 *Entropy;
+    UINT64           Updates;
+} CONTEND_WORKER;
+
+static PACKED_COUNTERS gPacked[CONTEND_MAX_CPUS] KERNEL_CACHE_ALIGNED;
+static MIND_COUNTERS gAligned[CONTEND_MAX_CPUS];
+static CONTEND_WORKER gWorkers[CONTEND_MAX_CPUS];
+static volatile BOOLEAN gGo;
+
+STATIC_ASSERT(sizeof(PACKED_COUNTERS) * 2 < KERNEL_CACHE_LINE, "packed slots no longer share lines");
+
+static VOID EFIAPI Update(VOID *Arg) {
+    CONTEND_WORKER *W = Arg;
+    while (!gGo) CpuPause();
+    for (UINT64 k = 0; k < W->Updates; ++k) {
+        (*W->Phases)++;
+        if ((k & 7) == 0) (*W->Misses)++;
+        *W->Entropy ^= k * 0x9E3779B97F4A7C15ULL;
+    }
+}
+
+// Runs Cpus workers, the BSP being worker 0. Returns updates per second.
+static double Run(UINTN Cpus, BOOLEAN Aligned, UINT64 Updates) {
+    for (UINTN i = 0; i < Cpus; ++i) {
+        CONTEND_WORKER *W = &gWorkers[i];
+        W->Phases = Aligned ? &gAligned[i].phases : &gPacked[i].phases;
+        W->Misses = Aligned ? &gAligned[i].misses : &gPacked[i].misses;
+        W->Entropy = Aligned ? &gAligned[i].entropy : &gPacked[i].entropy;
+        W->Updates = Updates;
+        *W->Phases = 0;
+    }
+    gGo = FALSE;
+    for (UINTN i = 1; i < Cpus; ++i) ApPool_Run(i - 1, Update, &gWorkers[i]);
+
+    UINT64 Start = AsmReadTsc();
+    gGo = TRUE;
+    Update(&gWorkers[0]);
+    for (UINTN i = 1; i < Cpus; ++i)
+        while (ApPool_Busy(i - 1)) CpuPause();
+    UINT64 Ticks = AsmReadTsc() - Start;
+
+    for (UINTN i = 0; i < Cpus; ++i) {
+        UINTN Phases = Aligned ? gAligned[i].phases : gPacked[i].phases;
+        if (Phases != Updates) fprintf(stderr, "contend_bench: lost updates in slot %lu\n", (unsigned long)i);
+    }
+    return (double)(Cpus * Updates) / ((double)Tsc_ToNs(Ticks) / 1e9);
+}
+
+int main(int Argc, char **Argv) {
+    // At least four, so the packed rows share a line even on a small host.
+    long Cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (Cpus < 4) Cpus = 4;
+    UINT64 Updates = 20000000;
+    int Opt;
+
+    while ((Opt = getopt(Argc, Argv, "j:n:")) != -1) {
+        switch (Opt) {
+        case 'j': Cpus = strtol(optarg, NULL, 0); break;
+        case 'n': Updates = strtoull(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-j CPUS] [-n UPDATES]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (Cpus < 1) Cpus = 1;
+    if (Cpus > CONTEND_MAX_CPUS) Cpus = CONTEND_MAX_CPUS;
+    if (Updates == 0) Updates = 1;
+
+    Tsc_Calibrate();
+    if (EFI_ERROR(ApPool_Start(0, (UINTN)Cpus - 1))) {
+        fprintf(stderr, "contend_bench: could not start %ld worker threads\n", Cpus - 1);
+        return 1;
+    }
+
+    printf("%lu updates per CPU, M updates/s     packed    aligned\n", (unsigned long)Updates);
+    for (UINTN n = 1; n <= (UINTN)Cpus; n *= 2) {
+        double Packed = Run(n, FALSE, Updates);
+        double Aligned = Run(n, TRUE, Updates);
+        printf("  %2lu CPU%s                       %9.1f  %9.1f  %5.2fx\n", (unsigned long)n, n == 1 ? " " : "s",
+               Packed / 1e6, Aligned / 1e6, Aligned / Packed);
+    }
+    return 0;
+}
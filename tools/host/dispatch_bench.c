@@ -0,0 +1,115 @@
+// dispatch_bench.c - Phase dispatch cost, registry table against a switch
+//
+//   dispatch_bench [-r ROUNDS]
+//
+// 150 empty phases (ids 100-249, the size of the CPU mind) are run both
+// ways: through a PHASE_ENTRY table and the kernel's PhaseRegistry_Run,
+// and through a for/switch loop shaped like the dispatchers the registry
+// replaced. The phases are the same noinline functions for both, so the
+// difference is the dispatch itself plus the per-phase bookkeeping
+// (timing, deadline check, telemetry phase) the registry does. Best round
+// wins.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "phase_registry.h"
+#include "tsc.h"
+
+#define BENCH_FIRST_PHASE   100
+#define BENCH_LAST_PHASE    249
+#define BENCH_PHASES        (BENCH_LAST_PHASE - BENCH_FIRST_PHASE + 1)
+
+#define REPEAT10(M, T)  M(T##0) M(T##1) M(T##2) M(T##3) M(T##4) M(T##5) M(T##6) M(T##7) M(T##8) M(T##9)
+#define FOR_EACH_PHASE(M) \
+    REPEAT10(M, 10) REPEAT10(M, 11) REPEAT10(M, 12) REPEAT10(M, 13) REPEAT10(M, 14) \
+    REPEAT10(M, 15) REPEAT10(M, 16) REPEAT10(M, 17) REPEAT10(M, 18) REPEAT10(M, 19) \
+    REPEAT10(M, 20) REPEAT10(M, 21) REPEAT10(M, 22) REPEAT10(M, 23) REPEAT10(M, 24)
+
+#define DEFINE_PHASE(Id) \
+    static __attribute__((noinline)) EFI_STATUS BenchPhase##Id(KERNEL_CONTEXT *ctx) { \
+        ctx->EntropyScore += Id; \
+        return EFI_SUCCESS; \
+    }
+FOR_EACH_PHASE(DEFINE_PHASE)
+
+#define PHASE_ROW(Id)   PHASE(Id, PHASE_MIND_CPU, BenchPhase##Id, PHASE_DEADLINE_DEFAULT, PHASE_COST_LIGHT),
+static PHASE_ENTRY gBenchPhases[] = {
+    FOR_EACH_PHASE(PHASE_ROW)
+};
+STATIC_ASSERT(sizeof(gBenchPhases) / sizeof(gBenchPhases[0]) == BENCH_PHASES, "phase table size");
+
+#define PHASE_CASE(Id)  case Id: Status = BenchPhase##Id(ctx); break;
+static __attribute__((noinline)) EFI_STATUS SwitchRunAllPhases(KERNEL_CONTEXT *ctx) {
+    EFI_STATUS Status = EFI_SUCCESS;
+    for (UINTN phase = BENCH_FIRST_PHASE; phase <= BENCH_LAST_PHASE; ++phase) {
+        switch (phase) {
+            FOR_EACH_PHASE(PHASE_CASE)
+            default: Status = EFI_SUCCESS; break;
+        }
+        if (EFI_ERROR(Status)) return Status;
+        ctx->total_phases++;
+    }
+    return EFI_SUCCESS;
+}
+
+static __attribute__((noinline)) EFI_STATUS RegistryRunAllPhases(KERNEL_CONTEXT *ctx) {
+    PHASE_RUN Run = { .ErrorEvent = "BenchPhaseError", .CountPhases = TRUE };
+    return PhaseRegistry_Run(gBenchPhases, BENCH_PHASES, ctx, &Run);
+}
+
+// Same table walk without the per-phase timing, to split dispatch from bookkeeping.
+static __attribute__((noinline)) EFI_STATUS TableRunAllPhases(KERNEL_CONTEXT *ctx) {
+    for (UINTN i = 0; i < BENCH_PHASES; ++i) {
+        PHASE_ENTRY *E = &gBenchPhases[i];
+        if (!(E->Flags & PHASE_F_ENABLED)) continue;
+        EFI_STATUS Status = E->Fn(ctx);
+        if (EFI_ERROR(Status)) return Status;
+        ctx->total_phases++;
+    }
+    return EFI_SUCCESS;
+}
+
+static KERNEL_CONTEXT gCtx;
+
+static double BestNsPerPhase(EFI_STATUS (*Run)(KERNEL_CONTEXT *ctx), UINTN Rounds) {
+    UINT64 Best = ~0ULL;
+    for (UINTN r = 0; r < Rounds; ++r) {
+        UINT64 Start = AsmReadTsc();
+        Run(&gCtx);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < Best) Best = Ticks;
+    }
+    return (double)Tsc_ToNs(Best * 1000) / 1000.0 / BENCH_PHASES;
+}
+
+int main(int Argc, char **Argv) {
+    UINTN Rounds = 20000;
+    int Opt;
+
+    while ((Opt = getopt(Argc, Argv, "r:")) != -1) {
+        if (Opt != 'r') {
+            fprintf(stderr, "usage: %s [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+        Rounds = (UINTN)strtoul(optarg, NULL, 0);
+    }
+    if (Rounds == 0) Rounds = 1;
+
+    Tsc_Calibrate();
+    // Warm both paths first so neither pays for the first-touch faults.
+    SwitchRunAllPhases(&gCtx);
+    RegistryRunAllPhases(&gCtx);
+
+    double Switch = BestNsPerPhase(SwitchRunAllPhases, Rounds);
+    double Table = BestNsPerPhase(TableRunAllPhases, Rounds);
+    double Registry = BestNsPerPhase(RegistryRunAllPhases, Rounds);
+    printf("%u phases, best of %lu rounds\n", BENCH_PHASES, (unsigned long)Rounds);
+    printf("  switch dispatch          %6.2f ns/phase\n", Switch);
+    printf("  table dispatch           %6.2f ns/phase\n", Table);
+    printf("  PhaseRegistry_Run        %6.2f ns/phase  (table + timing, deadline, telemetry phase)\n", Registry);
+    return 0;
+}
@@ -0,0 +1,392 @@
+// handoff_check.c - Handoff block compatibility between loader and kernel versions
+//
+//   handoff_check    reader checks, exit status 1 on failure
+//
+// Blocks are written with BootHandoff_Init/Add the way the loader does and
+// then rewritten by hand into what other loader versions would produce.
+// A newer loader: a longer header, section types this kernel has never
+// heard of, payloads and array entries that grew. An older loader:
+// payloads and entries shorter than this kernel's structs. The reader
+// must skip what it does not know, use what it does, and report the
+// missing fields through BOOT_HANDOFF_HAS and BootHandoff_Entry.
+//
+// Damaged blocks come last: bad headers, a block cut short at every
+// 8-byte boundary, section lengths and array bounds that point outside
+// the block, and random bytes. The block under test ends at a PROT_NONE
+// page, so a reader that strays past Size faults instead of passing.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "kernel_shared.h"
+#include "boot_handoff.h"
+
+#define CHECK_CAPACITY      4096
+#define FUZZ_ROUNDS         20000
+#define TYPE_UNKNOWN        0x7F00  // a type no version of this kernel knows
+
+static UINT8 *gGuard;               // first byte of the PROT_NONE page
+
+static int Report(const char *Name, BOOLEAN Ok, const char *Detail) {
+    if (*Detail) printf("%-4s %-44s %s\n", Ok ? "ok" : "FAIL", Name, Detail);
+    else printf("%-4s %s\n", Ok ? "ok" : "FAIL", Name);
+    return Ok ? 0 : 1;
+}
+
+// Moves the first Size bytes of Src so they end at the guard page.
+static BOOT_HANDOFF *AtGuard(const VOID *Src, UINT32 Size) {
+    BOOT_HANDOFF *H = (BOOT_HANDOFF *)(gGuard - Size);
+    memmove(H, Src, Size);
+    return H;
+}
+
+static VOID *Add(BOOT_HANDOFF *H, UINT16 Type, UINT16 Version, UINT32 Length) {
+    VOID *P = BootHandoff_Add(H, Type, Version, Length);
+    if (P == NULL) {
+        fprintf(stderr, "handoff_check: block full\n");
+        exit(1);
+    }
+    return P;
+}
+
+// What this loader writes: TSC, phase timings, topology.
+static VOID WriteCurrent(BOOT_HANDOFF *H) {
+    BootHandoff_Init(H, CHECK_CAPACITY);
+    HANDOFF_TSC_INFO *Tsc = Add(H, HANDOFF_TYPE_TSC, 1, sizeof(*Tsc));
+    Tsc->Hz = 2400000000ULL;
+    Tsc->Source = 1;
+    Tsc->Invariant = 1;
+
+    HANDOFF_PHASE_TIMINGS *P = Add(H, HANDOFF_TYPE_PHASE_TIMINGS, 1, sizeof(*P) + 3 * sizeof(HANDOFF_PHASE_TIMING));
+    P->Phases.Count = 3;
+    P->Phases.EntrySize = sizeof(HANDOFF_PHASE_TIMING);
+    P->Phases.EntryOffset = sizeof(*P);
+    P->LoaderNs = 123456789;
+    HANDOFF_PHASE_TIMING *T = (HANDOFF_PHASE_TIMING *)(P + 1);
+    for (UINT16 i = 0; i < 3; ++i) T[i].PhaseId = (UINT16)(i + 1), T[i].ElapsedNs = 1000 * (i + 1);
+
+    HANDOFF_CPU_TOPOLOGY *Topo = Add(H, HANDOFF_TYPE_CPU_TOPOLOGY, 1, sizeof(*Topo) + 2 * sizeof(HANDOFF_CPU));
+    Topo->Cpus.Count = 2;
+    Topo->Cpus.EntrySize = sizeof(HANDOFF_CPU);
+    Topo->Cpus.EntryOffset = sizeof(*Topo);
+    Topo->BspIndex = 1;
+    HANDOFF_CPU *Cpu = (HANDOFF_CPU *)(Topo + 1);
+    Cpu[0].ProcessorId = 4;
+    Cpu[1].ProcessorId = 0;
+}
+
+// Reads H the way kernel_main.c does. Returns a bitmask of what it got.
+#define READ_TSC        0x1
+#define READ_TIMINGS    0x2
+#define READ_TOPOLOGY   0x4
+
+static UINT32 ReadLikeKernel(const BOOT_HANDOFF *H) {
+    const BOOT_HANDOFF_SECTION *Sec;
+    UINT32 Got = 0;
+
+    if (!BootHandoff_Valid(H)) return 0;
+    if ((Sec = BootHandoff_Find(H, HANDOFF_TYPE_TSC)) != NULL && BOOT_HANDOFF_HAS(Sec, HANDOFF_TSC_INFO, Invariant)) {
+        const HANDOFF_TSC_INFO *T = BOOT_HANDOFF_PAYLOAD(Sec);
+        if (T->Hz == 2400000000ULL && T->Invariant == 1) Got |= READ_TSC;
+    }
+    if ((Sec = BootHandoff_Find(H, HANDOFF_TYPE_PHASE_TIMINGS)) != NULL &&
+        BOOT_HANDOFF_HAS(Sec, HANDOFF_PHASE_TIMINGS, LoaderNs)) {
+        const HANDOFF_PHASE_TIMINGS *P = BOOT_HANDOFF_PAYLOAD(Sec);
+        const HANDOFF_PHASE_TIMING *T;
+        UINT32 n = 0;
+        while ((T = BootHandoff_Entry(Sec, n, sizeof(*T))) != NULL && T->PhaseId == n + 1 && T->ElapsedNs == 1000 * (n + 1)) n++;
+        if (P->LoaderNs == 123456789 && n == 3) Got |= READ_TIMINGS;
+    }
+    if ((Sec = BootHandoff_Find(H, HANDOFF_TYPE_CPU_TOPOLOGY)) != NULL &&
+        BOOT_HANDOFF_HAS(Sec, HANDOFF_CPU_TOPOLOGY, BspIndex)) {
+        const HANDOFF_CPU_TOPOLOGY *T = BOOT_HANDOFF_PAYLOAD(Sec);
+        const HANDOFF_CPU *Bsp = BootHandoff_Entry(Sec, T->BspIndex, sizeof(HANDOFF_CPU));
+        if (Bsp != NULL && Bsp->ProcessorId == 0 && BootHandoff_Entry(Sec, 2, sizeof(HANDOFF_CPU)) == NULL)
+            Got |= READ_TOPOLOGY;
+    }
+    return Got;
+}
+
+// Every section the walk returns lies inside the block; returns how many.
+static UINT32 Walk(const BOOT_HANDOFF *H, BOOLEAN *Inside) {
+    UINT32 n = 0;
+    for (const BOOT_HANDOFF_SECTION *S = BootHandoff_Next(H, NULL); S; S = BootHandoff_Next(H, S)) {
+        UINT64 Off = (UINT64)((const UINT8 *)S - (const UINT8 *)H);
+        if (Off < H->HeaderSize || Off + sizeof(*S) + S->Length > H->Size) *Inside = FALSE;
+        n++;
+    }
+    return n;
+}
+
+static int CheckCurrent(VOID) {
+    static UINT64 Buf[CHECK_CAPACITY / 8];
+    BOOT_HANDOFF *H = (BOOT_HANDOFF *)Buf;
+    BOOLEAN Inside = TRUE;
+    int Failed = 0;
+
+    WriteCurrent(H);
+    H = AtGuard(H, H->Size);
+    UINT32 Got = ReadLikeKernel(H);
+    Failed += Report("same version", Got == (READ_TSC | READ_TIMINGS | READ_TOPOLOGY) &&
+                     Walk(H, &Inside) == H->SectionCount && Inside, "");
+
+    // Add stops at Capacity and leaves the block as it was.
+    BootHandoff_Init((BOOT_HANDOFF *)Buf, 64);
+    H = (BOOT_HANDOFF *)Buf;
+    BOOLEAN Ok = BootHandoff_Add(H, HANDOFF_TYPE_TSC, 1, sizeof(HANDOFF_TSC_INFO)) != NULL;
+    UINT32 Size = H->Size;
+    Ok &= BootHandoff_Add(H, HANDOFF_TYPE_TSC, 1, sizeof(HANDOFF_TSC_INFO)) == NULL && H->Size == Size &&
+          H->SectionCount == 1 && BootHandoff_Add(H, TYPE_UNKNOWN, 1, 0xFFFFFFF0) == NULL;
+    Failed += Report("writer stops at Capacity", Ok, "");
+    return Failed;
+}
+
+// A loader from the future: header v2 with 24 more bytes, unknown sections
+// between the known ones, v2 payloads with fields appended, and array
+// entries that grew and moved.
+static int CheckNewerLoader(VOID) {
+    static UINT64 Src[CHECK_CAPACITY / 8], Dst[CHECK_CAPACITY / 8];
+    const BOOT_HANDOFF *Old = (const BOOT_HANDOFF *)Src;
+    BOOT_HANDOFF *H = (BOOT_HANDOFF *)Dst;
+    BOOLEAN Inside = TRUE;
+    int Failed = 0;
+
+    WriteCurrent((BOOT_HANDOFF *)Src);
+    memcpy(H, Old, sizeof(*Old));
+    H->Version = 2;
+    H->HeaderSize = (UINT16)(Old->HeaderSize + 24);
+    memset((UINT8 *)H + sizeof(*Old), 0xEE, H->HeaderSize - sizeof(*Old));
+    H->Size = H->HeaderSize;
+    H->SectionCount = 0;
+    H->Capacity = CHECK_CAPACITY;
+
+    static const UINT32 UnknownLengths[] = { 0, 1, 13, 64 };
+    UINTN u = 0;
+    for (const BOOT_HANDOFF_SECTION *S = BootHandoff_Next(Old, NULL); S; S = BootHandoff_Next(Old, S)) {
+        UINT8 *P = Add(H, (UINT16)(TYPE_UNKNOWN + u), 3, UnknownLengths[u % 4]);
+        memset(P, 0xA5, UnknownLengths[u % 4]);
+        u++;
+
+        const UINT8 *From = BOOT_HANDOFF_PAYLOAD(S);
+        if (S->Type == HANDOFF_TYPE_TSC) {
+            UINT8 *To = Add(H, S->Type, 2, S->Length + 16);
+            memcpy(To, From, S->Length);
+            memset(To + S->Length, 0xEE, 16);
+        } else {
+            // Arrays: 8 new header bytes, then entries 8 bytes wider.
+            const HANDOFF_ARRAY *A = (const HANDOFF_ARRAY *)From;
+            UINT32 Wide = A->EntrySize + 8, Head = A->EntryOffset + 8;
+            UINT8 *To = Add(H, S->Type, 2, Head + A->Count * Wide);
+            memcpy(To, From, A->EntryOffset);
+            HANDOFF_ARRAY *B = (HANDOFF_ARRAY *)To;
+            B->EntrySize = (UINT16)Wide;
+            B->EntryOffset = (UINT16)Head;
+            for (UINT32 i = 0; i < A->Count; ++i) {
+                memcpy(To + Head + i * Wide, From + A->EntryOffset + i * A->EntrySize, A->EntrySize);
+                memset(To + Head + i * Wide + A->EntrySize, 0xEE, 8);
+            }
+        }
+    }
+    Add(H, TYPE_UNKNOWN + 0xFF, 1, 5);
+
+    H = AtGuard(H, H->Size);
+    UINT32 Got = ReadLikeKernel(H);
+    UINT32 n = Walk(H, &Inside);
+    char Detail[96];
+    snprintf(Detail, sizeof(Detail), "%u sections, %lu unknown", n, (unsigned long)u + 1);
+    Failed += Report("newer loader: header, types, payloads, entries",
+                     Got == (READ_TSC | READ_TIMINGS | READ_TOPOLOGY) && n == H->SectionCount && Inside, Detail);
+
+    // Header versions are not compared; only HeaderSize matters.
+    H->Version = 0xFFFF;
+    Failed += Report("newer loader: header version 0xFFFF", ReadLikeKernel(H) == (READ_TSC | READ_TIMINGS | READ_TOPOLOGY), "");
+    return Failed;
+}
+
+// A loader from the past: the same sections, each one a version shorter.
+static int CheckOlderLoader(VOID) {
+    static UINT64 Buf[CHECK_CAPACITY / 8];
+    BOOT_HANDOFF *H = (BOOT_HANDOFF *)Buf;
+    int Failed = 0;
+
+    // TSC info without Invariant, timings without LoaderNs.
+    BootHandoff_Init(H, CHECK_CAPACITY);
+    HANDOFF_TSC_INFO *Tsc = Add(H, HANDOFF_TYPE_TSC, 0, OFFSET_OF(HANDOFF_TSC_INFO, Invariant));
+    Tsc->Hz = 2400000000ULL;
+    HANDOFF_PHASE_TIMINGS *P = Add(H, HANDOFF_TYPE_PHASE_TIMINGS, 0, sizeof(HANDOFF_ARRAY));
+    P->Phases.EntrySize = sizeof(HANDOFF_PHASE_TIMING);
+    P->Phases.EntryOffset = sizeof(HANDOFF_ARRAY);
+    H = AtGuard(H, H->Size);
+    const BOOT_HANDOFF_SECTION *S = BootHandoff_Find(H, HANDOFF_TYPE_TSC);
+    BOOLEAN Ok = S && BOOT_HANDOFF_HAS(S, HANDOFF_TSC_INFO, Source) && !BOOT_HANDOFF_HAS(S, HANDOFF_TSC_INFO, Invariant);
+    S = BootHandoff_Find(H, HANDOFF_TYPE_PHASE_TIMINGS);
+    Ok &= S && BOOT_HANDOFF_HAS(S, HANDOFF_PHASE_TIMINGS, Phases) && !BOOT_HANDOFF_HAS(S, HANDOFF_PHASE_TIMINGS, LoaderNs);
+    Ok &= ReadLikeKernel(H) == 0 && BootHandoff_Find(H, HANDOFF_TYPE_CPU_TOPOLOGY) == NULL;
+    Failed += Report("older loader: short payloads", Ok, "");
+
+    // Topology entries 8 bytes short of HANDOFF_CPU.
+    H = (BOOT_HANDOFF *)Buf;
+    BootHandoff_Init(H, CHECK_CAPACITY);
+    UINT32 Narrow = sizeof(HANDOFF_CPU) - 8;
+    HANDOFF_CPU_TOPOLOGY *T = Add(H, HANDOFF_TYPE_CPU_TOPOLOGY, 0, sizeof(*T) + 2 * Narrow);
+    T->Cpus.Count = 2;
+    T->Cpus.EntrySize = (UINT16)Narrow;
+    T->Cpus.EntryOffset = sizeof(*T);
+    H = AtGuard(H, H->Size);
+    S = BootHandoff_Find(H, HANDOFF_TYPE_CPU_TOPOLOGY);
+    Ok = S && BootHandoff_Entry(S, 0, sizeof(HANDOFF_CPU)) == NULL && BootHandoff_Entry(S, 1, Narrow) != NULL;
+    Failed += Report("older loader: short array entries", Ok, "");
+
+    // An empty block is still a block.
+    H = (BOOT_HANDOFF *)Buf;
+    BootHandoff_Init(H, CHECK_CAPACITY);
+    H = AtGuard(H, H->Size);
+    Failed += Report("older loader: no sections", BootHandoff_Valid(H) && BootHandoff_Next(H, NULL) == NULL, "");
+    return Failed;
+}
+
+static int CheckDamaged(VOID) {
+    static UINT64 Good[CHECK_CAPACITY / 8], Buf[CHECK_CAPACITY / 8];
+    BOOT_HANDOFF *G = (BOOT_HANDOFF *)Good, *H;
+    char Detail[96];
+    int Failed = 0;
+
+    WriteCurrent(G);
+
+    // Headers the kernel must refuse.
+    static const struct { const char *Name; UINT32 Field; UINT64 Value; } Bad[] = {
+        { "magic",                     0, 0 },
+        { "HeaderSize below v1",       1, OFFSET_OF(BOOT_HANDOFF, Capacity) },
+        { "HeaderSize unaligned",      1, sizeof(BOOT_HANDOFF) + 4 },
+        { "HeaderSize past Size",      1, 0x7FF8 },
+        { "Size past Capacity",        2, CHECK_CAPACITY + 8 },
+        { "Size below HeaderSize",     2, 8 },
+    };
+    UINTN Accepted = 0;
+    for (UINTN i = 0; i < sizeof(Bad) / sizeof(Bad[0]); ++i) {
+        memcpy(Buf, Good, G->Size);
+        H = (BOOT_HANDOFF *)Buf;
+        if (Bad[i].Field == 0) H->Magic ^= 1;
+        if (Bad[i].Field == 1) H->HeaderSize = (UINT16)Bad[i].Value;
+        if (Bad[i].Field == 2) H->Size = (UINT32)Bad[i].Value;
+        if (Bad[i].Field == 2 && H->Size > H->Capacity) H->Capacity = G->Size;
+        H = AtGuard(H, G->Size);
+        if (BootHandoff_Valid(H) || ReadLikeKernel(H)) {
+            fprintf(stderr, "  accepted: %s\n", Bad[i].Name);
+            Accepted++;
+        }
+    }
+    Failed += Report("bad headers refused", Accepted == 0 && !BootHandoff_Valid(NULL), "");
+
+    // Cut at every 8 bytes: whatever is still whole is read, nothing else.
+    UINTN Strays = 0, Cuts = 0;
+    for (UINT32 Size = G->HeaderSize; Size <= G->Size; Size += 8, Cuts++) {
+        BOOLEAN Inside = TRUE;
+        memcpy(Buf, Good, Size);
+        H = (BOOT_HANDOFF *)Buf;
+        H->Size = Size;
+        H->Capacity = Size;
+        H = AtGuard(H, Size);
+        UINT32 Got = ReadLikeKernel(H), Whole = 0;
+        for (const BOOT_HANDOFF_SECTION *S = BootHandoff_Next(G, NULL); S; S = BootHandoff_Next(G, S))
+            if ((const UINT8 *)S + sizeof(*S) + S->Length <= (const UINT8 *)G + Size)
+                Whole |= S->Type == HANDOFF_TYPE_TSC ? READ_TSC :
+                         S->Type == HANDOFF_TYPE_PHASE_TIMINGS ? READ_TIMINGS : READ_TOPOLOGY;
+        Walk(H, &Inside);
+        Strays += Got != Whole || !Inside;
+    }
+    snprintf(Detail, sizeof(Detail), "%lu cuts, %lu wrong", (unsigned long)Cuts, (unsigned long)Strays);
+    Failed += Report("truncated block", Strays == 0, Detail);
+
+    // A Size that is not a multiple of 8 hides the last section too.
+    memcpy(Buf, Good, G->Size);
+    H = (BOOT_HANDOFF *)Buf;
+    H->Size -= 1;
+    H = AtGuard(H, G->Size);
+    Failed += Report("unaligned Size", ReadLikeKernel(H) == (READ_TSC | READ_TIMINGS), "");
+
+    // Lengths that run off the end stop the walk at that section.
+    static const UINT32 Lengths[] = { 0xFFFFFFFF, 0xFFFFFFF8, CHECK_CAPACITY, 0x80000000 };
+    Strays = 0;
+    for (UINTN i = 0; i < sizeof(Lengths) / sizeof(Lengths[0]); ++i) {
+        BOOLEAN Inside = TRUE;
+        memcpy(Buf, Good, G->Size);
+        H = (BOOT_HANDOFF *)Buf;
+        BOOT_HANDOFF_SECTION *Second = (BOOT_HANDOFF_SECTION *)BootHandoff_Next(H, BootHandoff_Next(H, NULL));
+        Second->Length = Lengths[i];
+        H = AtGuard(H, H->Size);
+        Strays += Walk(H, &Inside) != 1 || !Inside || ReadLikeKernel(H) != READ_TSC;
+    }
+    Failed += Report("section Length past the block", Strays == 0, "");
+
+    // Array bounds that point outside the section.
+    static const struct { UINT32 Count; UINT16 EntrySize, EntryOffset; } Arrays[] = {
+        { 0xFFFFFFFF, sizeof(HANDOFF_CPU), sizeof(HANDOFF_CPU_TOPOLOGY) },
+        { 3,          sizeof(HANDOFF_CPU), sizeof(HANDOFF_CPU_TOPOLOGY) },
+        { 2,          0xFFFF,              sizeof(HANDOFF_CPU_TOPOLOGY) },
+        { 2,          sizeof(HANDOFF_CPU), 0xFFFF },
+        { 2,          0,                   sizeof(HANDOFF_CPU_TOPOLOGY) },
+    };
+    Strays = 0;
+    for (UINTN i = 0; i < sizeof(Arrays) / sizeof(Arrays[0]); ++i) {
+        memcpy(Buf, Good, G->Size);
+        H = (BOOT_HANDOFF *)Buf;
+        const BOOT_HANDOFF_SECTION *S = BootHandoff_Find(H, HANDOFF_TYPE_CPU_TOPOLOGY);
+        HANDOFF_ARRAY *A = (HANDOFF_ARRAY *)BOOT_HANDOFF_PAYLOAD(S);
+        A->Count = Arrays[i].Count;
+        A->EntrySize = Arrays[i].EntrySize;
+        A->EntryOffset = Arrays[i].EntryOffset;
+        H = AtGuard(H, H->Size);
+        S = BootHandoff_Find(H, HANDOFF_TYPE_CPU_TOPOLOGY);
+        for (UINT32 e = 0; e < 4; ++e) {
+            const UINT8 *P = BootHandoff_Entry(S, e, sizeof(HANDOFF_CPU));
+            const UINT8 *End = (const UINT8 *)BOOT_HANDOFF_PAYLOAD(S) + S->Length;
+            if (P != NULL && (P < (const UINT8 *)BOOT_HANDOFF_PAYLOAD(S) || P + sizeof(HANDOFF_CPU) > End)) Strays++;
+        }
+        if (BootHandoff_Entry(S, 0xFFFFFFFF, 1) != NULL) Strays++;
+    }
+    Failed += Report("array bounds past the section", Strays == 0, "");
+
+    // Random sections behind a valid header.
+    srand(21);
+    Strays = 0;
+    for (UINTN r = 0; r < FUZZ_ROUNDS; ++r) {
+        BOOLEAN Inside = TRUE;
+        UINT32 Size = G->HeaderSize + 8 * (UINT32)(rand() % 64);
+        H = (BOOT_HANDOFF *)Buf;
+        memcpy(H, Good, G->HeaderSize);
+        for (UINT32 i = G->HeaderSize; i < Size; ++i) {
+            UINT32 v = (UINT32)rand();
+            ((UINT8 *)H)[i] = (i % 8 == 4 && v % 2) ? (UINT8)(v >> 8) % 48 : (i % 8 >= 5 && v % 3) ? 0 : (UINT8)(v >> 8);
+        }
+        H->Size = Size;
+        H->Capacity = Size;
+        H = AtGuard(H, Size);
+        Walk(H, &Inside);
+        ReadLikeKernel(H);
+        Strays += !Inside;
+    }
+    snprintf(Detail, sizeof(Detail), "%u blocks, %lu strays", FUZZ_ROUNDS, (unsigned long)Strays);
+    Failed += Report("random sections", Strays == 0, Detail);
+    return Failed;
+}
+
+int main(void) {
+    int Failed = 0;
+
+    UINT8 *Map = mmap(NULL, CHECK_CAPACITY + 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Map == MAP_FAILED || mprotect(Map + CHECK_CAPACITY, 4096, PROT_NONE) != 0) {
+        perror("handoff_check: guard page");
+        return 1;
+    }
+    gGuard = Map + CHECK_CAPACITY;
+
+    Failed += CheckCurrent();
+    Failed += CheckNewerLoader();
+    Failed += CheckOlderLoader();
+    Failed += CheckDamaged();
+    return Failed ? 1 : 0;
+}
@@ -0,0 +1,79 @@
+// host_ap_pool.c - ap_pool.h on POSIX threads
+// Each thread stands in for one AP and spins on its mailbox the way
+// kernel/ap_pool.c's ApPoolEntry does, so dispatch and zeroing see the
+// same handoff costs. The trampoline argument is ignored.
+
+#include <pthread.h>
+
+#include "kernel_shared.h"
+#include "ap_pool.h"
+
+typedef struct {
+    volatile UINT32       Busy;         // set by the BSP, cleared by the AP
+    volatile UINT32       Online;
+    UINT32                ApicId;
+    AP_PROCEDURE volatile Proc;
+    VOID *volatile        Arg;
+} KERNEL_CACHE_ALIGNED AP_MAILBOX;
+
+static AP_MAILBOX gApMailbox[AP_POOL_MAX];
+static UINTN gApCount;
+static __thread UINTN tCpuIndex = AP_POOL_MAX;
+
+static VOID *ApPoolEntry(VOID *Arg) {
+    AP_MAILBOX *M = Arg;
+    tCpuIndex = (UINTN)(M - gApMailbox);
+    M->Online = TRUE;
+    for (;;) {
+        while (!M->Busy) CpuPause();
+        M->Proc(M->Arg);
+        MemoryFence();
+        M->Busy = FALSE;
+    }
+    return NULL;
+}
+
+EFI_STATUS ApPool_Start(EFI_PHYSICAL_ADDRESS Trampoline, UINTN ExpectedAps) {
+    (void)Trampoline;
+    if (gApCount) return EFI_ALREADY_STARTED;
+    for (UINTN i = 0; i < MIN(ExpectedAps, (UINTN)AP_POOL_MAX); ++i) {
+        pthread_t Thread;
+        gApMailbox[i].ApicId = (UINT32)(i + 1);
+        if (pthread_create(&Thread, NULL, ApPoolEntry, &gApMailbox[i]) != 0) break;
+        pthread_detach(Thread);
+        while (!gApMailbox[i].Online) CpuPause();
+        gApCount = i + 1;
+    }
+    return gApCount ? EFI_SUCCESS : EFI_NOT_FOUND;
+}
+
+UINTN ApPool_Count(VOID) {
+    return gApCount;
+}
+
+EFI_STATUS ApPool_Run(UINTN Index, AP_PROCEDURE Proc, VOID *Arg) {
+    if (Index >= gApCount || Proc == NULL) return EFI_INVALID_PARAMETER;
+    AP_MAILBOX *M = &gApMailbox[Index];
+    if (M->Busy) return EFI_NOT_READY;
+    M->Proc = Proc;
+    M->Arg = Arg;
+    MemoryFence();
+    M->Busy = TRUE;
+    return EFI_SUCCESS;
+}
+
+BOOLEAN ApPool_Busy(UINTN Index) {
+    return Index < gApCount && gApMailbox[Index].Busy;
+}
+
+UINT32 ApPool_ApicId(UINTN Index) {
+    return Index < gApCount ? gApMailbox[Index].ApicId : 0;
+}
+
+UINT32 ApPool_BspApicId(VOID) {
+    return 0;
+}
+
+UINTN ApPool_CpuIndex(VOID) {
+    return tCpuIndex;
+}
@@ -0,0 +1,32 @@
+// host_externs.c - Subsystems the minds call that no kernel source defines
+// yet. They only need to link and answer something plausible; each one
+// returns what an idle, healthy machine would.
+
+#include "kernel_shared.h"
+
+EFI_STATUS CpuMind_RescheduleLongCycles(UINT64 trust, UINTN *count) { (void)trust; *count = 0; return EFI_SUCCESS; }
+EFI_STATUS CpuMind_GetTemperature(UINTN core, INTN *temp) { *temp = 45 + (INTN)(core % 8); return EFI_SUCCESS; }
+EFI_STATUS Cpu_Advisory_SetVoltage(UINTN level) { (void)level; return EFI_SUCCESS; }
+EFI_STATUS Cpu_EvictCacheLines(UINTN thread_id, UINTN *freed) { (void)thread_id; *freed = 0; return EFI_SUCCESS; }
+EFI_STATUS CPUSetAffinity(UINTN core) { (void)core; return EFI_SUCCESS; }
+EFI_STATUS CPU_DisableCore(UINTN id) { (void)id; return EFI_SUCCESS; }
+EFI_STATUS MemoryMind_RequestBudget(UINTN *budget) { *budget = 64; return EFI_SUCCESS; }
+EFI_STATUS GpuMind_RunPhaseDirect(UINTN phase_id) { (void)phase_id; return EFI_SUCCESS; }
+EFI_STATUS GpuMind_TransferHeatmap(UINT64 *map, UINTN w, UINTN h) { (void)map; (void)w; (void)h; return EFI_SUCCESS; }
+
+// Integer helpers entropy_mind.c, thermal_mind.c and network_mind.c call
+// without a declaration.
+UINT64 Sqrt64(UINT64 Value) {
+    UINT64 Root = 0, Bit = 1ULL << 62;
+    while (Bit > Value) Bit >>= 2;
+    while (Bit) {
+        if (Value >= Root + Bit) { Value -= Root + Bit; Root = (Root >> 1) + Bit; }
+        else Root >>= 1;
+        Bit >>= 2;
+    }
+    return Root;
+}
+
+UINT64 Log2(UINT64 Value) {
+    return Value ? 63 - (UINT64)__builtin_clzll(Value) : 0;
+}
@@ -0,0 +1,26 @@
+#ifndef HOST_SHIM_H
+#define HOST_SHIM_H
+
+#include <Uefi.h>
+
+// Controls for the UEFI shim the host harness links the minds against.
+
+typedef struct {
+    UINT64 Allocations;     // AllocatePool/AllocateZeroPool/gBS->AllocatePool calls
+    UINT64 Bytes;           // bytes those calls asked for
+    UINT64 Prints;          // Print calls, printed or not
+} HOST_SHIM_COUNTERS;
+
+// Print formats every line either way; Verbose decides whether it reaches stdout.
+VOID HostShim_SetVerbose(BOOLEAN Verbose);
+VOID HostShim_Counters(HOST_SHIM_COUNTERS *Out);
+
+// Replaces what AsmReadTsc returns, for checks that drive a fake clock;
+// NULL goes back to rdtsc.
+typedef UINT64 (*HOST_SHIM_TSC)(VOID);
+VOID HostShim_SetTsc(HOST_SHIM_TSC Read);
+
+// %r text for Status, as Print shows it.
+const char *HostShim_StatusName(EFI_STATUS Status);
+
+#endif // HOST_SHIM_H
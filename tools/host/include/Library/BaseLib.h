@@ -0,0 +1,33 @@
+#ifndef HOST_BASE_LIB_H
+#define HOST_BASE_LIB_H
+
+#include <Uefi.h>
+
+// TSC, pause and fences are the real instructions. Privileged reads (MSRs,
+// control and descriptor registers) return fixed plausible values so the
+// phases that look at them run the same path every time.
+
+typedef struct {
+    UINT16 Limit;
+    UINTN  Base;
+} __attribute__((packed)) IA32_DESCRIPTOR;
+
+UINT64 EFIAPI AsmReadTsc(VOID);
+VOID   EFIAPI CpuPause(VOID);
+VOID   EFIAPI MemoryFence(VOID);
+UINT64 EFIAPI AsmReadMsr64(UINT32 Index);
+UINT64 EFIAPI AsmWriteMsr64(UINT32 Index, UINT64 Value);
+UINTN  EFIAPI AsmReadCr0(VOID);
+UINTN  EFIAPI AsmReadCr3(VOID);
+UINTN  EFIAPI AsmReadCr4(VOID);
+UINT64 EFIAPI AsmXGetBv(UINT32 Index);
+VOID   EFIAPI AsmReadGdtr(IA32_DESCRIPTOR *Gdtr);
+VOID   EFIAPI AsmReadIdtr(IA32_DESCRIPTOR *Idtr);
+UINT16 EFIAPI AsmReadCs(VOID);
+UINT16 EFIAPI AsmReadDs(VOID);
+INT64  EFIAPI AbsoluteValue64(INT64 Value);
+
+INTN          EFIAPI AsciiStriCmp(CONST CHAR8 *FirstString, CONST CHAR8 *SecondString);
+RETURN_STATUS EFIAPI AsciiStrToUnicodeStrS(CONST CHAR8 *Source, CHAR16 *Destination, UINTN DestMax);
+
+#endif // HOST_BASE_LIB_H
@@ -0,0 +1,11 @@
+#ifndef HOST_BASE_MEMORY_LIB_H
+#define HOST_BASE_MEMORY_LIB_H
+
+#include <Uefi.h>
+
+VOID * EFIAPI CopyMem(VOID *Destination, CONST VOID *Source, UINTN Length);
+VOID * EFIAPI SetMem(VOID *Buffer, UINTN Length, UINT8 Value);
+VOID * EFIAPI ZeroMem(VOID *Buffer, UINTN Length);
+INTN   EFIAPI CompareMem(CONST VOID *DestinationBuffer, CONST VOID *SourceBuffer, UINTN Length);
+
+#endif // HOST_BASE_MEMORY_LIB_H
@@ -0,0 +1,11 @@
+#ifndef HOST_MEMORY_ALLOCATION_LIB_H
+#define HOST_MEMORY_ALLOCATION_LIB_H
+
+#include <Uefi.h>
+
+// Counted by the shim; see HostShim_Allocations in host_shim.h.
+VOID * EFIAPI AllocatePool(UINTN AllocationSize);
+VOID * EFIAPI AllocateZeroPool(UINTN AllocationSize);
+VOID   EFIAPI FreePool(VOID *Buffer);
+
+#endif // HOST_MEMORY_ALLOCATION_LIB_H
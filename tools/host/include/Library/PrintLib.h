@@ -0,0 +1,6 @@
+#ifndef HOST_PRINT_LIB_H
+#define HOST_PRINT_LIB_H
+
+#include <Uefi.h>
+
+#endif // HOST_PRINT_LIB_H
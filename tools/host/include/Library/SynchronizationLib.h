@@ -0,0 +1,11 @@
+#ifndef HOST_SYNCHRONIZATION_LIB_H
+#define HOST_SYNCHRONIZATION_LIB_H
+
+#include <Uefi.h>
+
+UINT32 EFIAPI InterlockedIncrement(volatile UINT32 *Value);
+UINT32 EFIAPI InterlockedDecrement(volatile UINT32 *Value);
+UINT32 EFIAPI InterlockedCompareExchange32(volatile UINT32 *Value, UINT32 CompareValue, UINT32 ExchangeValue);
+UINT64 EFIAPI InterlockedCompareExchange64(volatile UINT64 *Value, UINT64 CompareValue, UINT64 ExchangeValue);
+
+#endif // HOST_SYNCHRONIZATION_LIB_H
@@ -0,0 +1,8 @@
+#ifndef HOST_TIMER_LIB_H
+#define HOST_TIMER_LIB_H
+
+#include <Uefi.h>
+
+UINTN EFIAPI MicroSecondDelay(UINTN MicroSeconds);
+
+#endif // HOST_TIMER_LIB_H
@@ -0,0 +1,8 @@
+#ifndef HOST_UEFI_BOOT_SERVICES_TABLE_LIB_H
+#define HOST_UEFI_BOOT_SERVICES_TABLE_LIB_H
+
+#include <Uefi.h>
+
+extern EFI_BOOT_SERVICES *gBS;
+
+#endif // HOST_UEFI_BOOT_SERVICES_TABLE_LIB_H
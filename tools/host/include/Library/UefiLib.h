@@ -0,0 +1,9 @@
+#ifndef HOST_UEFI_LIB_H
+#define HOST_UEFI_LIB_H
+
+#include <Uefi.h>
+
+// UEFI format: %a CHAR8 string, %s CHAR16 string, %r EFI_STATUS, l for 64-bit.
+UINTN EFIAPI Print(CONST CHAR16 *Format, ...);
+
+#endif // HOST_UEFI_LIB_H
@@ -0,0 +1,169 @@
+#ifndef HOST_UEFI_H
+#define HOST_UEFI_H
+
+// Host stand-in for the EDK2 <Uefi.h> the kernel sources include. Only the
+// types, status codes and macros the minds use, with the same names and
+// widths as on the firmware side (x64, -fshort-wchar for CHAR16).
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t     UINT8;
+typedef uint16_t    UINT16;
+typedef uint32_t    UINT32;
+typedef uint64_t    UINT64;
+typedef int8_t      INT8;
+typedef int16_t     INT16;
+typedef int32_t     INT32;
+typedef int64_t     INT64;
+typedef uint64_t    UINTN;
+typedef int64_t     INTN;
+typedef uint8_t     BOOLEAN;
+typedef char        CHAR8;
+typedef uint16_t    CHAR16;
+typedef void        VOID;
+
+typedef UINTN       EFI_STATUS;
+typedef UINTN       RETURN_STATUS;
+typedef VOID       *EFI_HANDLE;
+typedef VOID       *EFI_EVENT;
+typedef UINT64      EFI_PHYSICAL_ADDRESS;
+typedef UINT64      EFI_VIRTUAL_ADDRESS;
+
+typedef struct {
+    UINT32 Data1;
+    UINT16 Data2;
+    UINT16 Data3;
+    UINT8  Data4[8];
+} EFI_GUID;
+
+#define TRUE        ((BOOLEAN)1)
+#define FALSE       ((BOOLEAN)0)
+#ifndef NULL
+#define NULL        ((VOID *)0)
+#endif
+
+#define IN
+#define OUT
+#define OPTIONAL
+#define CONST       const
+#define STATIC      static
+#define EFIAPI
+
+#define MAX_BIT                 0x8000000000000000ULL
+#define ENCODE_ERROR(Code)      ((EFI_STATUS)(MAX_BIT | (Code)))
+#define EFI_ERROR(Status)       (((INTN)(EFI_STATUS)(Status)) < 0)
+#define RETURN_ERROR(Status)    EFI_ERROR(Status)
+
+#define EFI_SUCCESS             0
+#define EFI_LOAD_ERROR          ENCODE_ERROR(1)
+#define EFI_INVALID_PARAMETER   ENCODE_ERROR(2)
+#define EFI_UNSUPPORTED         ENCODE_ERROR(3)
+#define EFI_BAD_BUFFER_SIZE     ENCODE_ERROR(4)
+#define EFI_BUFFER_TOO_SMALL    ENCODE_ERROR(5)
+#define EFI_NOT_READY           ENCODE_ERROR(6)
+#define EFI_DEVICE_ERROR        ENCODE_ERROR(7)
+#define EFI_WRITE_PROTECTED     ENCODE_ERROR(8)
+#define EFI_OUT_OF_RESOURCES    ENCODE_ERROR(9)
+#define EFI_VOLUME_CORRUPTED    ENCODE_ERROR(10)
+#define EFI_NO_MEDIA            ENCODE_ERROR(12)
+#define EFI_MEDIA_CHANGED       ENCODE_ERROR(13)
+#define EFI_NOT_FOUND           ENCODE_ERROR(14)
+#define EFI_ACCESS_DENIED       ENCODE_ERROR(15)
+#define EFI_NO_RESPONSE         ENCODE_ERROR(16)
+#define EFI_TIMEOUT             ENCODE_ERROR(18)
+#define EFI_NOT_STARTED         ENCODE_ERROR(19)
+#define EFI_ALREADY_STARTED     ENCODE_ERROR(20)
+#define EFI_ABORTED             ENCODE_ERROR(21)
+#define EFI_PROTOCOL_ERROR      ENCODE_ERROR(24)
+#define EFI_INCOMPATIBLE_VERSION ENCODE_ERROR(25)
+#define EFI_SECURITY_VIOLATION  ENCODE_ERROR(26)
+#define EFI_CRC_ERROR           ENCODE_ERROR(27)
+#define EFI_END_OF_FILE         ENCODE_ERROR(31)
+
+#define RETURN_SUCCESS              EFI_SUCCESS
+#define RETURN_INVALID_PARAMETER    EFI_INVALID_PARAMETER
+#define RETURN_BUFFER_TOO_SMALL     EFI_BUFFER_TOO_SMALL
+#define EFI_COMPROMISED_DATA    ENCODE_ERROR(33)
+
+typedef enum {
+    EfiReservedMemoryType,
+    EfiLoaderCode,
+    EfiLoaderData,
+    EfiBootServicesCode,
+    EfiBootServicesData,
+    EfiRuntimeServicesCode,
+    EfiRuntimeServicesData,
+    EfiConventionalMemory,
+    EfiUnusableMemory,
+    EfiACPIReclaimMemory,
+    EfiACPIMemoryNVS,
+    EfiMemoryMappedIO,
+    EfiMemoryMappedIOPortSpace,
+    EfiPalCode,
+    EfiPersistentMemory,
+    EfiMaxMemoryType
+} EFI_MEMORY_TYPE;
+
+typedef enum {
+    AllocateAnyPages,
+    AllocateMaxAddress,
+    AllocateAddress,
+    MaxAllocateType
+} EFI_ALLOCATE_TYPE;
+
+typedef struct {
+    UINT32               Type;
+    EFI_PHYSICAL_ADDRESS PhysicalStart;
+    EFI_VIRTUAL_ADDRESS  VirtualStart;
+    UINT64               NumberOfPages;
+    UINT64               Attribute;
+} EFI_MEMORY_DESCRIPTOR;
+
+typedef struct {
+    UINT16 Year;
+    UINT8  Month;
+    UINT8  Day;
+    UINT8  Hour;
+    UINT8  Minute;
+    UINT8  Second;
+    UINT8  Pad1;
+    UINT32 Nanosecond;
+    INT16  TimeZone;
+    UINT8  Daylight;
+    UINT8  Pad2;
+} EFI_TIME;
+
+#define EFI_MEMORY_UC               0x0000000000000001ULL
+#define EFI_MEMORY_WB               0x0000000000000008ULL
+#define EFI_MEMORY_RUNTIME          0x8000000000000000ULL
+
+#define EFI_PAGE_SIZE               0x1000
+#define EFI_PAGE_MASK               0xFFF
+#define EFI_PAGE_SHIFT              12
+#define EFI_SIZE_TO_PAGES(Size)     (((Size) >> EFI_PAGE_SHIFT) + (((Size) & EFI_PAGE_MASK) ? 1 : 0))
+#define EFI_PAGES_TO_SIZE(Pages)    ((UINTN)(Pages) << EFI_PAGE_SHIFT)
+
+#define MIN(a, b)                   (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)                   (((a) > (b)) ? (a) : (b))
+#define OFFSET_OF(Type, Field)      __builtin_offsetof(Type, Field)
+#define ALIGN_VALUE(Value, Align)   ((Value) + (((Align) - (Value)) & ((Align) - 1)))
+#define STATIC_ASSERT               _Static_assert
+#define SIGNATURE_16(A, B)          ((A) | ((B) << 8))
+#define SIGNATURE_32(A, B, C, D)    (SIGNATURE_16 (A, B) | (SIGNATURE_16 (C, D) << 16))
+#define SIGNATURE_64(A, B, C, D, E, F, G, H) \
+    (SIGNATURE_32 (A, B, C, D) | ((UINT64) (SIGNATURE_32 (E, F, G, H)) << 32))
+
+// The few boot services the minds, tsc.c and boot_arena.c call through gBS.
+typedef struct {
+    EFI_STATUS (EFIAPI *AllocatePages)(EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType, UINTN Pages,
+                                       EFI_PHYSICAL_ADDRESS *Memory);
+    EFI_STATUS (EFIAPI *FreePages)(EFI_PHYSICAL_ADDRESS Memory, UINTN Pages);
+    EFI_STATUS (EFIAPI *AllocatePool)(EFI_MEMORY_TYPE PoolType, UINTN Size, VOID **Buffer);
+    EFI_STATUS (EFIAPI *FreePool)(VOID *Buffer);
+    EFI_STATUS (EFIAPI *Stall)(UINTN Microseconds);
+    VOID       (EFIAPI *CopyMem)(VOID *Destination, VOID *Source, UINTN Length);
+    VOID       (EFIAPI *SetMem)(VOID *Buffer, UINTN Size, UINT8 Value);
+} EFI_BOOT_SERVICES;
+
+#endif // HOST_UEFI_H
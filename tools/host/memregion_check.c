@@ -0,0 +1,228 @@
+// memregion_check.c - The loader's memory region index against OVMF memory maps
+//
+//   memregion_check MAP...  index checks per map, exit status 1 on failure
+//
+// Each MAP is a memory map in the UEFI shell's `memmap` layout (see
+// memmaps/). It is packed into descriptors 48 bytes apart, the stride
+// OVMF reports, and indexed with MemoryRegions_Build. The index must
+// agree with a plain sort-and-merge of the same descriptors: the same
+// regions, per-type page totals that match the descriptors, every
+// descriptor found by MemoryRegions_Find at both ends, and the holes
+// between them not found. The same map shuffled and reversed must give
+// the same index. Two synthetic maps then check the MEMORY_REGION_MAX
+// limit, one whose regions all coalesce and one that cannot fit, and a
+// zero-page descriptor between two halves of one region.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kernel_shared.h"
+#include "memory_regions.h"
+
+#define CHECK_DESC_SIZE     48      // sizeof(EFI_MEMORY_DESCRIPTOR) plus OVMF's padding
+#define CHECK_MAX_DESC      (4 * MEMORY_REGION_MAX)
+
+static const char *const gTypeNames[] = {
+    "Reserved", "LoaderCode", "LoaderData", "BS_Code", "BS_Data", "RT_Code", "RT_Data",
+    "Available", "Unusable", "ACPI_Recl", "ACPI_NVS", "MMIO", "MMIO_Port", "PalCode", "Persistent",
+};
+
+#define TYPE_COUNT      (sizeof(gTypeNames) / sizeof(gTypeNames[0]))
+
+static UINT8 gMap[CHECK_MAX_DESC * CHECK_DESC_SIZE];
+static MEMORY_REGION_INDEX gIndex, gOther;
+
+static EFI_MEMORY_DESCRIPTOR *Desc(UINTN i) {
+    return (EFI_MEMORY_DESCRIPTOR *)(gMap + i * CHECK_DESC_SIZE);
+}
+
+static VOID SetDesc(UINTN i, UINT32 Type, UINT64 Base, UINT64 Pages, UINT64 Attribute) {
+    EFI_MEMORY_DESCRIPTOR *D = Desc(i);
+    memset(D, 0xCC, CHECK_DESC_SIZE);   // padding the index must not read
+    D->Type = Type;
+    D->PhysicalStart = Base;
+    D->VirtualStart = 0;
+    D->NumberOfPages = Pages;
+    D->Attribute = Attribute;
+}
+
+// Returns the descriptor count, or 0 when the file cannot be used.
+static UINTN LoadMap(const char *Path) {
+    FILE *F = fopen(Path, "r");
+    char Line[256], Name[32];
+    unsigned long long Start, End, Pages, Attribute;
+    UINTN Count = 0;
+
+    if (F == NULL) {
+        perror(Path);
+        return 0;
+    }
+    while (fgets(Line, sizeof(Line), F) != NULL) {
+        if (sscanf(Line, "%31s %llx-%llx %llx %llx", Name, &Start, &End, &Pages, &Attribute) != 5) continue;
+        UINTN Type = 0;
+        while (Type < TYPE_COUNT && strcmp(Name, gTypeNames[Type]) != 0) ++Type;
+        if (Type == TYPE_COUNT || End + 1 - Start != EFI_PAGES_TO_SIZE(Pages) || Count == CHECK_MAX_DESC) {
+            fprintf(stderr, "%s: bad line: %s", Path, Line);
+            fclose(F);
+            return 0;
+        }
+        SetDesc(Count++, (UINT32)Type, Start, Pages, Attribute);
+    }
+    fclose(F);
+    return Count;
+}
+
+static int CompareBase(const VOID *A, const VOID *B) {
+    const MEMORY_REGION *X = A, *Y = B;
+    return X->Base < Y->Base ? -1 : X->Base > Y->Base;
+}
+
+// The index the loader should hand over, built the obvious way.
+static UINTN Reference(UINTN Count, MEMORY_REGION *Out) {
+    UINTN n = 0;
+    for (UINTN i = 0; i < Count; ++i) {
+        EFI_MEMORY_DESCRIPTOR *D = Desc(i);
+        if (D->NumberOfPages == 0) continue;
+        MEMORY_REGION R = { D->PhysicalStart, D->NumberOfPages, D->Attribute, D->Type, 0 };
+        Out[n++] = R;
+    }
+    qsort(Out, n, sizeof(*Out), CompareBase);
+    UINTN m = 0;
+    for (UINTN i = 0; i < n; ++i) {
+        MEMORY_REGION *Prev = m ? &Out[m - 1] : NULL;
+        if (Prev && Prev->Type == Out[i].Type && Prev->Attribute == Out[i].Attribute &&
+            Prev->Base + EFI_PAGES_TO_SIZE(Prev->Pages) == Out[i].Base)
+            Prev->Pages += Out[i].Pages;
+        else
+            Out[m++] = Out[i];
+    }
+    return m;
+}
+
+// Region[] past Count is scratch, so only the live part is compared.
+static BOOLEAN SameIndex(const MEMORY_REGION_INDEX *A, const MEMORY_REGION_INDEX *B) {
+    return memcmp(A, B, OFFSET_OF(MEMORY_REGION_INDEX, Region)) == 0 &&
+           memcmp(A->Region, B->Region, A->Count * sizeof(A->Region[0])) == 0;
+}
+
+static int Report(const char *Map, const char *Name, BOOLEAN Ok, const char *Detail) {
+    char Label[96];
+    snprintf(Label, sizeof(Label), "%s: %s", Map, Name);
+    if (*Detail) printf("%-4s %-48s %s\n", Ok ? "ok" : "FAIL", Label, Detail);
+    else printf("%-4s %s\n", Ok ? "ok" : "FAIL", Label);
+    return Ok ? 0 : 1;
+}
+
+static int CheckMap(const char *Path) {
+    static MEMORY_REGION Ref[CHECK_MAX_DESC];
+    const char *Map = strrchr(Path, '/') ? strrchr(Path, '/') + 1 : Path;
+    char Detail[96];
+    int Failed = 0;
+
+    UINTN Count = LoadMap(Path);
+    if (Count == 0) return Report(Map, "load", FALSE, "no descriptors");
+
+    EFI_STATUS Status = MemoryRegions_Build(&gIndex, gMap, Count * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    UINTN RefCount = Reference(Count, Ref);
+    BOOLEAN Ok = !EFI_ERROR(Status) && gIndex.Count == RefCount && gIndex.DescriptorCount == Count &&
+                 memcmp(gIndex.Region, Ref, RefCount * sizeof(Ref[0])) == 0;
+    snprintf(Detail, sizeof(Detail), "%lu descriptors -> %u regions", (unsigned long)Count, gIndex.Count);
+    Failed += Report(Map, "regions match sort-and-merge", Ok, Detail);
+
+    UINT64 TypePages[MEMORY_REGION_TYPES] = { 0 }, Total = 0;
+    for (UINTN i = 0; i < Count; ++i) {
+        TypePages[Desc(i)->Type] += Desc(i)->NumberOfPages;
+        Total += Desc(i)->NumberOfPages;
+    }
+    Ok = gIndex.TotalPages == Total && gIndex.OtherPages == 0;
+    for (UINT32 t = 0; t < MEMORY_REGION_TYPES; ++t) Ok &= MemoryRegions_TypePages(&gIndex, t) == TypePages[t];
+    snprintf(Detail, sizeof(Detail), "%llu MiB available",
+             (unsigned long long)(EFI_PAGES_TO_SIZE(TypePages[EfiConventionalMemory]) >> 20));
+    Failed += Report(Map, "per-type page totals", Ok, Detail);
+
+    // Both ends of every descriptor, and the byte either side of each region.
+    UINTN Misses = 0, Holes = 0;
+    for (UINTN i = 0; i < Count; ++i) {
+        EFI_MEMORY_DESCRIPTOR *D = Desc(i);
+        UINT64 Ends[2] = { D->PhysicalStart, D->PhysicalStart + EFI_PAGES_TO_SIZE(D->NumberOfPages) - 1 };
+        for (UINTN e = 0; e < 2; ++e) {
+            const MEMORY_REGION *R = MemoryRegions_Find(&gIndex, Ends[e]);
+            Misses += R == NULL || R->Type != D->Type || R->Attribute != D->Attribute;
+        }
+    }
+    for (UINTN r = 0; r < gIndex.Count; ++r) {
+        const MEMORY_REGION *R = &gIndex.Region[r];
+        UINT64 End = R->Base + EFI_PAGES_TO_SIZE(R->Pages);
+        BOOLEAN GapBefore = r == 0 || gIndex.Region[r - 1].Base + EFI_PAGES_TO_SIZE(gIndex.Region[r - 1].Pages) < R->Base;
+        BOOLEAN GapAfter = r + 1 == gIndex.Count || End < gIndex.Region[r + 1].Base;
+        if (GapBefore && R->Base > 0 && MemoryRegions_Find(&gIndex, R->Base - 1) != NULL) Holes++;
+        if (GapAfter && MemoryRegions_Find(&gIndex, End) != NULL) Holes++;
+    }
+    snprintf(Detail, sizeof(Detail), "%lu misses, %lu holes found", (unsigned long)Misses, (unsigned long)Holes);
+    Failed += Report(Map, "find every descriptor, no hole", Misses == 0 && Holes == 0, Detail);
+
+    // Order must not matter: reversed, then a fixed shuffle.
+    memcpy(&gOther, &gIndex, sizeof(gIndex));
+    static UINT8 Copy[sizeof(gMap)];
+    memcpy(Copy, gMap, Count * CHECK_DESC_SIZE);
+    for (UINTN i = 0; i < Count; ++i) memcpy(Desc(i), Copy + (Count - 1 - i) * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    Status = MemoryRegions_Build(&gIndex, gMap, Count * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    Ok = !EFI_ERROR(Status) && SameIndex(&gIndex, &gOther);
+    srand(14);
+    for (UINTN i = Count - 1; i > 0; --i) {
+        UINTN j = (UINTN)rand() % (i + 1);
+        memcpy(Copy, Desc(i), CHECK_DESC_SIZE);
+        memcpy(Desc(i), Desc(j), CHECK_DESC_SIZE);
+        memcpy(Desc(j), Copy, CHECK_DESC_SIZE);
+    }
+    Status = MemoryRegions_Build(&gIndex, gMap, Count * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    Ok &= !EFI_ERROR(Status) && SameIndex(&gIndex, &gOther);
+    Failed += Report(Map, "same index reversed and shuffled", Ok, "");
+    return Failed;
+}
+
+// More descriptors than MEMORY_REGION_MAX must still fit when they merge,
+// and fail cleanly when they cannot.
+static int CheckLimits(VOID) {
+    const char *Map = "synthetic";
+    UINTN Count = MEMORY_REGION_MAX + 100;
+    int Failed = 0;
+
+    // Runs of 8 same-typed pages, one page each, in reverse: 1/8 of the regions.
+    for (UINTN i = 0; i < Count; ++i)
+        SetDesc(i, (i / 8) % 2 ? EfiBootServicesData : EfiConventionalMemory,
+                EFI_PAGES_TO_SIZE(Count - 1 - i), 1, EFI_MEMORY_WB);
+    EFI_STATUS Status = MemoryRegions_Build(&gIndex, gMap, Count * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    BOOLEAN Ok = !EFI_ERROR(Status) && gIndex.Count == (Count + 7) / 8 && gIndex.TotalPages == Count;
+    Failed += Report(Map, "over MEMORY_REGION_MAX descriptors, coalesced", Ok, "");
+
+    // Zero-page descriptors carry no memory and must not split a region.
+    SetDesc(0, EfiConventionalMemory, 0, 4, EFI_MEMORY_WB);
+    SetDesc(1, EfiACPIReclaimMemory, EFI_PAGES_TO_SIZE(4), 0, EFI_MEMORY_WB);
+    SetDesc(2, EfiConventionalMemory, EFI_PAGES_TO_SIZE(4), 4, EFI_MEMORY_WB);
+    Status = MemoryRegions_Build(&gIndex, gMap, 3 * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    Ok = !EFI_ERROR(Status) && gIndex.Count == 1 && gIndex.DescriptorCount == 2 &&
+         gIndex.Region[0].Pages == 8 && MemoryRegions_TypePages(&gIndex, EfiACPIReclaimMemory) == 0;
+    Failed += Report(Map, "zero-page descriptors skipped", Ok, "");
+
+    // Alternating types never merge.
+    for (UINTN i = 0; i < Count; ++i)
+        SetDesc(i, i % 2 ? EfiBootServicesData : EfiConventionalMemory, EFI_PAGES_TO_SIZE(i), 1, EFI_MEMORY_WB);
+    Status = MemoryRegions_Build(&gIndex, gMap, Count * CHECK_DESC_SIZE, CHECK_DESC_SIZE);
+    Failed += Report(Map, "over MEMORY_REGION_MAX regions", Status == EFI_BUFFER_TOO_SMALL &&
+                     gIndex.Count == MEMORY_REGION_MAX, "EFI_BUFFER_TOO_SMALL");
+    return Failed;
+}
+
+int main(int Argc, char **Argv) {
+    int Failed = 0;
+    if (Argc < 2) {
+        fprintf(stderr, "usage: %s MAP...\n", Argv[0]);
+        return 2;
+    }
+    for (int i = 1; i < Argc; ++i) Failed += CheckMap(Argv[i]);
+    Failed += CheckLimits();
+    return Failed ? 1 : 0;
+}
@@ -0,0 +1,307 @@
+// minds_bench.c - Runs each kernel mind on Linux and times its phases
+//
+//   make -C tools/host
+//   tools/host/minds_bench [-v] [-s] [-r N] [Mind...]
+//
+//   -v      let the minds' Print output through
+//   -s      one summary line per mind, no per-phase rows
+//   -r N    run each mind N times in its process, keep the best time per phase
+//
+// Every mind runs in its own forked process on a zeroed KERNEL_CONTEXT, so
+// one mind's state (or crash) does not leak into the next. A mind that
+// fails on the empty context (KernelMind wants fused trust from the others)
+// shows its status; only a crash makes the exit status non-zero. The kernel
+// objects are built with -finstrument-functions; a phase is any function the
+// mind's runner calls directly, or PhaseRegistry_Run calls for the minds on
+// the registry.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "kernel_shared.h"
+#include "phase_registry.h"
+#include "cpu_mind.h"
+#include "memory_mind.h"
+#include "kernel_mind.h"
+#include "entropy_mind.h"
+#include "network_mind.h"
+#include "power_mind.h"
+#include "thermal_mind.h"
+#include "host_shim.h"
+
+#define NO_TRACE __attribute__((no_instrument_function))
+
+EFI_STATUS GpuMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+EFI_STATUS SchedulerMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+EFI_STATUS IOMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+EFI_STATUS StorageMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+EFI_STATUS AICoreMind_RunAllPhases(KERNEL_CONTEXT *ctx);
+
+// Trust phases have no RunAllPhases of their own; TrustPhase_Execute
+// picks single ids. Running the whole table is the same work.
+static EFI_STATUS TrustMind_RunAllPhases(KERNEL_CONTEXT *ctx) {
+    PHASE_RUN Run = { .ErrorEvent = "TrustPhaseError", .CountPhases = TRUE };
+    return PhaseRegistry_Run(gTrustPhases, gTrustPhaseCount, ctx, &Run);
+}
+
+typedef struct {
+    const char  *Name;
+    EFI_STATUS (*Run)(KERNEL_CONTEXT *ctx);
+} BENCH_MIND;
+
+static const BENCH_MIND gBenchMinds[] = {
+    { "CpuMind",       CpuMind_RunAllPhases },
+    { "MemoryMind",    MemoryMind_RunAllPhases },
+    { "GpuMind",       GpuMind_RunAllPhases },
+    { "SchedulerMind", SchedulerMind_RunAllPhases },
+    { "IOMind",        IOMind_RunAllPhases },
+    { "StorageMind",   StorageMind_RunAllPhases },
+    { "TrustMind",     TrustMind_RunAllPhases },
+    { "AICore",        AICore_RunAllPhases },
+    { "AICoreMind",    AICoreMind_RunAllPhases },
+    { "KernelMind",    KernelMind_RunAllPhases },
+    { "EntropyMind",   EntropyMind_RunAllPhases },
+    { "ThermalMind",   ThermalMind_RunAllPhases },
+    { "NetworkMind",   NetworkMind_RunAllPhases },
+    { "PowerMind",     PowerMind_RunAllPhases },
+    { "TelemetryMind", TelemetryMind_RunAllPhases },
+};
+
+#define BENCH_MAX_PHASES    4096
+#define BENCH_MAX_FUNCTIONS 1024
+
+// Functions the runners call between phases, not phases themselves.
+static const char *const gHelperPrefixes[] = {
+    "Tsc_", "Telemetry_LogEvent", "Telemetry_SetPhase", "Trust_AdjustScore", "Trust_Get",
+    "AICore_Report", "AICore_Record", "AICore_Finalize", "AICore_Attach",
+};
+
+// One per function seen at phase depth. Minds that switch inside a single
+// Execute(ctx, id) call it once per phase, so a phase is a function and the
+// ordinal of the call within the run.
+typedef struct {
+    void   *Fn;
+    BOOLEAN Helper;
+    UINT32  RunCalls;       // calls so far in this run
+    UINT32  MaxCalls;       // most calls in any run
+} FUNCTION_INFO;
+
+typedef struct {
+    FUNCTION_INFO *Func;
+    UINT32  Ordinal;
+    UINT64  BestTicks;
+    UINT64  Allocations;    // from the best run
+} PHASE_STAT;
+
+static FUNCTION_INFO gFunctions[BENCH_MAX_FUNCTIONS];
+static UINTN gFunctionCount;
+static PHASE_STAT gPhases[BENCH_MAX_PHASES];
+static UINTN gPhaseCount;
+
+// Call tracing state. Only the thread running the mind traces; APs the
+// memory mind fans out to run untraced.
+static __thread BOOLEAN tTracing;
+static __thread UINTN tDepth;
+static UINTN gPhaseDepth;
+static PHASE_STAT *gInPhase;
+static UINT64 gPhaseStart, gPhaseAllocs;
+
+static const char *SymbolName(void *Fn);
+
+static NO_TRACE UINT64 AllocationCount(VOID) {
+    HOST_SHIM_COUNTERS C;
+    HostShim_Counters(&C);
+    return C.Allocations;
+}
+
+static NO_TRACE FUNCTION_INFO *FunctionInfo(void *Fn) {
+    for (UINTN i = 0; i < gFunctionCount; ++i)
+        if (gFunctions[i].Fn == Fn) return &gFunctions[i];
+    if (gFunctionCount == BENCH_MAX_FUNCTIONS) return NULL;
+    FUNCTION_INFO *F = &gFunctions[gFunctionCount++];
+    const char *Name = SymbolName(Fn);
+    F->Fn = Fn;
+    for (UINTN i = 0; i < sizeof(gHelperPrefixes) / sizeof(gHelperPrefixes[0]); ++i)
+        if (strncmp(Name, gHelperPrefixes[i], strlen(gHelperPrefixes[i])) == 0) F->Helper = TRUE;
+    return F;
+}
+
+static NO_TRACE PHASE_STAT *PhaseSlot(void *Fn) {
+    FUNCTION_INFO *F = FunctionInfo(Fn);
+    if (F == NULL || F->Helper) return NULL;
+    UINT32 Ordinal = ++F->RunCalls;
+    if (Ordinal > F->MaxCalls) F->MaxCalls = Ordinal;
+    for (UINTN i = 0; i < gPhaseCount; ++i)
+        if (gPhases[i].Func == F && gPhases[i].Ordinal == Ordinal) return &gPhases[i];
+    if (gPhaseCount == BENCH_MAX_PHASES) return NULL;
+    PHASE_STAT *S = &gPhases[gPhaseCount++];
+    S->Func = F;
+    S->Ordinal = Ordinal;
+    S->BestTicks = ~0ULL;
+    return S;
+}
+
+NO_TRACE void __cyg_profile_func_enter(void *Fn, void *Site) {
+    (void)Site;
+    if (!tTracing) return;
+    UINTN Depth = ++tDepth;
+    // The registry runner sits between a mind and its phases.
+    if (Fn == (void *)PhaseRegistry_Run && Depth < gPhaseDepth + 1) { gPhaseDepth = Depth + 1; return; }
+    if (Depth != gPhaseDepth) return;
+    gInPhase = PhaseSlot(Fn);
+    gPhaseAllocs = AllocationCount();
+    gPhaseStart = AsmReadTsc();
+}
+
+NO_TRACE void __cyg_profile_func_exit(void *Fn, void *Site) {
+    (void)Fn; (void)Site;
+    if (!tTracing) return;
+    if (tDepth-- != gPhaseDepth || gInPhase == NULL) return;
+    UINT64 Ticks = AsmReadTsc() - gPhaseStart;
+    PHASE_STAT *S = gInPhase;
+    if (Ticks < S->BestTicks) {
+        S->BestTicks = Ticks;
+        S->Allocations = AllocationCount() - gPhaseAllocs;
+    }
+    gInPhase = NULL;
+}
+
+// Names come from the executable's own symbol table; -no-pie keeps the
+// addresses nm prints the ones the hooks see.
+typedef struct {
+    UINT64 Addr;
+    char   Name[96];
+} SYMBOL;
+
+static SYMBOL *gSymbols;
+static UINTN gSymbolCount;
+
+static NO_TRACE void LoadSymbols(VOID) {
+    char Cmd[512], Line[256];
+    char Exe[256];
+    ssize_t n = readlink("/proc/self/exe", Exe, sizeof(Exe) - 1);
+    if (n <= 0) return;
+    Exe[n] = 0;
+    snprintf(Cmd, sizeof(Cmd), "nm --defined-only '%s' 2>/dev/null", Exe);
+    FILE *P = popen(Cmd, "r");
+    if (!P) return;
+    UINTN Cap = 0;
+    while (fgets(Line, sizeof(Line), P)) {
+        unsigned long long Addr;
+        char Type, Name[96];
+        if (sscanf(Line, "%llx %c %95s", &Addr, &Type, Name) != 3 || (Type != 'T' && Type != 't')) continue;
+        if (gSymbolCount == Cap) {
+            Cap = Cap ? Cap * 2 : 1024;
+            gSymbols = realloc(gSymbols, Cap * sizeof(*gSymbols));
+        }
+        gSymbols[gSymbolCount].Addr = Addr;
+        snprintf(gSymbols[gSymbolCount].Name, sizeof(gSymbols[0].Name), "%s", Name);
+        gSymbolCount++;
+    }
+    pclose(P);
+}
+
+static NO_TRACE const char *SymbolName(void *Fn) {
+    static char Hex[24];
+    for (UINTN i = 0; i < gSymbolCount; ++i)
+        if (gSymbols[i].Addr == (UINT64)(UINTN)Fn) return gSymbols[i].Name;
+    snprintf(Hex, sizeof(Hex), "%p", Fn);
+    return Hex;
+}
+
+static KERNEL_CONTEXT gCtx;
+static KERNEL_COLD gCold;
+
+static NO_TRACE int RunMind(const BENCH_MIND *M, UINTN Repeat, BOOLEAN Summary) {
+    EFI_STATUS Status = EFI_SUCCESS;
+    UINT64 BestTotal = ~0ULL;
+    HOST_SHIM_COUNTERS Before, After;
+
+    Tsc_Calibrate();
+    gCtx.cold = &gCold;
+    Trust_Reset();
+    LoadSymbols();
+
+    HostShim_Counters(&Before);
+    for (UINTN r = 0; r < Repeat; ++r) {
+        for (UINTN i = 0; i < gFunctionCount; ++i) gFunctions[i].RunCalls = 0;
+        gPhaseDepth = 2;
+        tDepth = 0;
+        gInPhase = NULL;
+        tTracing = TRUE;
+        UINT64 Start = AsmReadTsc();
+        Status = M->Run(&gCtx);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        tTracing = FALSE;
+        if (Ticks < BestTotal) BestTotal = Ticks;
+        if (EFI_ERROR(Status)) break;
+    }
+    HostShim_Counters(&After);
+
+    UINT64 PhaseAllocs = 0;
+    for (UINTN i = 0; i < gPhaseCount; ++i) PhaseAllocs += gPhases[i].Allocations;
+    printf("%-14s %5lu phases %12.1f us %6lu allocs %8lu bytes  %s\n", M->Name,
+           (unsigned long)gPhaseCount, (double)Tsc_ToNs(BestTotal) / 1000.0,
+           (unsigned long)PhaseAllocs, (unsigned long)((After.Bytes - Before.Bytes) / Repeat),
+           HostShim_StatusName(Status));
+    for (UINTN i = 0; !Summary && i < gPhaseCount; ++i) {
+        char Name[128];
+        const PHASE_STAT *S = &gPhases[i];
+        if (S->Func->MaxCalls > 1)
+            snprintf(Name, sizeof(Name), "%s[%u]", SymbolName(S->Func->Fn), S->Ordinal);
+        else
+            snprintf(Name, sizeof(Name), "%s", SymbolName(S->Func->Fn));
+        printf("    %-56s %10lu ns %4lu allocs\n", Name,
+               (unsigned long)Tsc_ToNs(S->BestTicks), (unsigned long)S->Allocations);
+    }
+    fflush(stdout);
+    return 0;
+}
+
+static NO_TRACE void Usage(const char *Argv0) {
+    fprintf(stderr, "usage: %s [-v] [-s] [-r N] [Mind...]\nminds:", Argv0);
+    for (UINTN i = 0; i < sizeof(gBenchMinds) / sizeof(gBenchMinds[0]); ++i)
+        fprintf(stderr, " %s", gBenchMinds[i].Name);
+    fprintf(stderr, "\n");
+    exit(2);
+}
+
+int NO_TRACE main(int Argc, char **Argv) {
+    BOOLEAN Summary = FALSE;
+    UINTN Repeat = 1;
+    int Opt, Failed = 0;
+    const UINTN Count = sizeof(gBenchMinds) / sizeof(gBenchMinds[0]);
+
+    while ((Opt = getopt(Argc, Argv, "vsr:")) != -1) {
+        switch (Opt) {
+        case 'v': HostShim_SetVerbose(TRUE); break;
+        case 's': Summary = TRUE; break;
+        case 'r': Repeat = (UINTN)strtoul(optarg, NULL, 0); if (!Repeat) Repeat = 1; break;
+        default: Usage(Argv[0]);
+        }
+    }
+
+    for (UINTN i = 0; i < Count; ++i) {
+        const BENCH_MIND *M = &gBenchMinds[i];
+        BOOLEAN Selected = optind == Argc;
+        for (int a = optind; a < Argc; ++a)
+            if (strcmp(Argv[a], M->Name) == 0) Selected = TRUE;
+        if (!Selected) continue;
+
+        fflush(stdout);
+        pid_t Pid = fork();
+        if (Pid < 0) { perror("fork"); return 1; }
+        if (Pid == 0) _exit(RunMind(M, Repeat, Summary));
+        int WaitStatus;
+        waitpid(Pid, &WaitStatus, 0);
+        if (WIFSIGNALED(WaitStatus)) {
+            printf("%-14s killed by signal %d\n", M->Name, WTERMSIG(WaitStatus));
+            Failed++;
+        }
+    }
+    return Failed ? 1 : 0;
+}
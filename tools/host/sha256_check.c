@@ -0,0 +1,270 @@
+// sha256_check.c - SHA-256 backends against the NIST vectors and each other
+//
+//   sha256_check            digest checks, exit status 1 on failure
+//   sha256_check -b [-r N]  MB/s per backend, 64 B to 64 MiB messages, best of N,
+//                           then sha256_mb's aggregate MB/s over 1, 4 and 8 lanes
+//
+// Every backend the CPU supports hashes the FIPS 180-2 example messages,
+// once in one update and once fed in uneven pieces that straddle the
+// 64-byte block buffer, and then random messages of every length up to a
+// few blocks, which must match the scalar digest. sha256_mb then hashes
+// random batches of messages of random length, which must match the
+// scalar digests too; with AVX2 selected they run side by side in its
+// lanes. A backend the CPU lacks is reported and skipped.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "sha256.h"
+#include "tsc.h"
+
+#define CHECK_RANDOM_MAX    300         // lengths 0..300 cover 1 to 6 blocks
+#define CHECK_MB_BATCHES    300
+#define CHECK_MB_MAX_COUNT  16          // two groups of SHA256_MB_LANES
+#define CHECK_MB_MAX_BYTES  70000
+#define BENCH_MIN_BYTES     (1ULL << 6)
+#define BENCH_MAX_BYTES     (1ULL << 26)
+#define BENCH_RUN_BYTES     (8ULL << 20) // hashed per timed run, at least one message
+
+static const char *const gImplNames[SHA256_IMPL_COUNT] = { "scalar", "AVX2", "SHA-NI" };
+
+typedef struct {
+    const char *Name;
+    const char *Message;
+    UINTN       Repeat;
+    const char *Digest;
+} NIST_VECTOR;
+
+static const NIST_VECTOR gVectors[] = {
+    { "empty", "", 1,
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { "abc", "abc", 1,
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { "448 bits", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+    { "896 bits", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+                  "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 1,
+      "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+    { "million a", "a", 1000000,
+      "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+#define VECTOR_COUNT    (sizeof(gVectors) / sizeof(gVectors[0]))
+
+static VOID ToHex(const UINT8 Digest[SHA256_DIGEST_LENGTH], char Hex[2 * SHA256_DIGEST_LENGTH + 1]) {
+    for (UINTN i = 0; i < SHA256_DIGEST_LENGTH; ++i) sprintf(Hex + 2 * i, "%02x", Digest[i]);
+}
+
+// Hashes Len bytes of Data in pieces of 1, 2, 3, ... bytes, or in one go.
+static VOID Digest(const UINT8 *Data, UINTN Len, BOOLEAN Pieces, UINT8 Out[SHA256_DIGEST_LENGTH]) {
+    SHA256_CTX Ctx;
+    sha256_init(&Ctx);
+    if (!Pieces) {
+        sha256_update(&Ctx, Data, Len);
+    } else {
+        for (UINTN Off = 0, Step = 1; Off < Len; Off += Step, Step = Step % 97 + 1)
+            sha256_update(&Ctx, Data + Off, Step < Len - Off ? Step : Len - Off);
+    }
+    sha256_final(&Ctx, Out);
+}
+
+static int CheckVectors(sha256_impl_t Impl) {
+    int Failed = 0;
+    for (UINTN v = 0; v < VECTOR_COUNT; ++v) {
+        const NIST_VECTOR *V = &gVectors[v];
+        UINTN Unit = strlen(V->Message), Len = Unit * V->Repeat;
+        UINT8 *Data = malloc(Len + 1);
+        for (UINTN r = 0; r < V->Repeat; ++r) memcpy(Data + r * Unit, V->Message, Unit);
+
+        for (int Pieces = 0; Pieces < 2; ++Pieces) {
+            UINT8 Out[SHA256_DIGEST_LENGTH];
+            char Hex[2 * SHA256_DIGEST_LENGTH + 1], Name[48];
+            Digest(Data, Len, (BOOLEAN)Pieces, Out);
+            ToHex(Out, Hex);
+            BOOLEAN Ok = strcmp(Hex, V->Digest) == 0;
+            snprintf(Name, sizeof(Name), "%s %s%s", gImplNames[Impl], V->Name, Pieces ? ", in pieces" : "");
+            printf("%-4s %-34s %s\n", Ok ? "ok" : "FAIL", Name, Hex);
+            Failed += !Ok;
+        }
+        free(Data);
+    }
+    return Failed;
+}
+
+// Every length up to CHECK_RANDOM_MAX against the scalar backend.
+static int CheckRandom(sha256_impl_t Impl) {
+    static UINT8 Data[CHECK_RANDOM_MAX];
+    UINTN Mismatch = 0, First = 0;
+    srand(1);
+    for (UINTN i = 0; i < CHECK_RANDOM_MAX; ++i) Data[i] = (UINT8)rand();
+
+    for (UINTN Len = 0; Len <= CHECK_RANDOM_MAX; ++Len) {
+        UINT8 Want[SHA256_DIGEST_LENGTH], Got[SHA256_DIGEST_LENGTH];
+        sha256_set_impl(SHA256_IMPL_SCALAR);
+        Digest(Data, Len, FALSE, Want);
+        sha256_set_impl(Impl);
+        Digest(Data, Len, Len & 1, Got);
+        if (memcmp(Want, Got, sizeof(Want)) != 0 && Mismatch++ == 0) First = Len;
+    }
+    char Name[48];
+    snprintf(Name, sizeof(Name), "%s against scalar, 0..%u bytes", gImplNames[Impl], CHECK_RANDOM_MAX);
+    if (Mismatch) printf("FAIL %-34s %lu mismatches, first at %lu bytes\n", Name, (unsigned long)Mismatch, (unsigned long)First);
+    else printf("ok   %s\n", Name);
+    return Mismatch ? 1 : 0;
+}
+
+// Batches of 1..CHECK_MB_MAX_COUNT messages through sha256_mb against the
+// scalar single-stream digests.
+static int CheckMultiBuffer(sha256_impl_t Impl) {
+    UINT8 *Pool = malloc(CHECK_MB_MAX_BYTES);
+    const UINT8 *Data[CHECK_MB_MAX_COUNT];
+    size_t Len[CHECK_MB_MAX_COUNT];
+    UINT8 Got[CHECK_MB_MAX_COUNT][SHA256_DIGEST_LENGTH], Want[SHA256_DIGEST_LENGTH];
+    UINTN Mismatch = 0;
+
+    srand(2);
+    for (UINTN i = 0; i < CHECK_MB_MAX_BYTES; ++i) Pool[i] = (UINT8)rand();
+    for (UINTN b = 0; b < CHECK_MB_BATCHES; ++b) {
+        UINTN Count = 1 + (UINTN)rand() % CHECK_MB_MAX_COUNT;
+        for (UINTN m = 0; m < Count; ++m) {
+            // Mostly short messages, so lanes finish at different blocks.
+            Len[m] = (size_t)rand() % (m & 1 ? CHECK_MB_MAX_BYTES : 300);
+            Data[m] = Pool + (size_t)rand() % (CHECK_MB_MAX_BYTES - Len[m] + 1);
+        }
+        sha256_set_impl(Impl);
+        sha256_mb(Count, Data, Len, Got);
+        sha256_set_impl(SHA256_IMPL_SCALAR);
+        for (UINTN m = 0; m < Count; ++m) {
+            Digest(Data[m], Len[m], FALSE, Want);
+            Mismatch += memcmp(Want, Got[m], sizeof(Want)) != 0;
+        }
+    }
+    free(Pool);
+    char Name[48];
+    snprintf(Name, sizeof(Name), "%s sha256_mb, %u batches", gImplNames[Impl], CHECK_MB_BATCHES);
+    if (Mismatch) printf("FAIL %-34s %lu digests differ from scalar\n", Name, (unsigned long)Mismatch);
+    else printf("ok   %s\n", Name);
+    return Mismatch ? 1 : 0;
+}
+
+static double BestMbPerSec(const UINT8 *Data, UINT64 Bytes, UINTN Rounds) {
+    UINT64 Count = BENCH_RUN_BYTES / Bytes ? BENCH_RUN_BYTES / Bytes : 1;
+    UINT64 Best = ~0ULL;
+    UINT8 Out[SHA256_DIGEST_LENGTH];
+    for (UINTN r = 0; r < Rounds; ++r) {
+        UINT64 Start = AsmReadTsc();
+        for (UINT64 i = 0; i < Count; ++i) Digest(Data, Bytes, FALSE, Out);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < Best) Best = Ticks;
+    }
+    return (double)(Count * Bytes) / ((double)Tsc_ToNs(Best) / 1e9) / 1e6;
+}
+
+static VOID Bench(UINTN Rounds) {
+    UINT8 *Data = malloc(BENCH_MAX_BYTES);
+    memset(Data, 0x5A, BENCH_MAX_BYTES);
+    Tsc_Calibrate();
+
+    printf("best of %lu, MB/s  ", (unsigned long)Rounds);
+    for (UINTN i = 0; i < SHA256_IMPL_COUNT; ++i) printf(" %10s", gImplNames[i]);
+    printf("\n");
+    for (UINT64 Bytes = BENCH_MIN_BYTES; Bytes <= BENCH_MAX_BYTES; Bytes <<= 2) {
+        if (Bytes >= (1ULL << 20)) printf("  %4llu MiB        ", (unsigned long long)(Bytes >> 20));
+        else if (Bytes >= (1ULL << 10)) printf("  %4llu KiB        ", (unsigned long long)(Bytes >> 10));
+        else printf("  %4llu B          ", (unsigned long long)Bytes);
+        for (sha256_impl_t Impl = 0; Impl < SHA256_IMPL_COUNT; ++Impl) {
+            if (sha256_set_impl(Impl) != 0) { printf(" %10s", "-"); continue; }
+            printf(" %10.1f", BestMbPerSec(Data, Bytes, Rounds));
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+    free(Data);
+}
+
+// Lanes messages of Bytes each in one sha256_mb call, repeated to fill
+// BENCH_RUN_BYTES. The rate is for all lanes together.
+static double LanesMbPerSec(const UINT8 *Data, UINT64 Bytes, UINTN Lanes, UINTN Rounds) {
+    const UINT8 *Ptr[SHA256_MB_LANES];
+    size_t Len[SHA256_MB_LANES];
+    UINT8 Out[SHA256_MB_LANES][SHA256_DIGEST_LENGTH];
+    UINT64 Count = BENCH_RUN_BYTES / (Bytes * Lanes) ? BENCH_RUN_BYTES / (Bytes * Lanes) : 1;
+    UINT64 Best = ~0ULL;
+
+    for (UINTN l = 0; l < Lanes; ++l) {
+        Ptr[l] = Data + l * Bytes;
+        Len[l] = Bytes;
+    }
+    for (UINTN r = 0; r < Rounds; ++r) {
+        UINT64 Start = AsmReadTsc();
+        for (UINT64 i = 0; i < Count; ++i) sha256_mb(Lanes, Ptr, Len, Out);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < Best) Best = Ticks;
+    }
+    return (double)(Count * Bytes * Lanes) / ((double)Tsc_ToNs(Best) / 1e9) / 1e6;
+}
+
+static VOID BenchMultiBuffer(UINTN Rounds) {
+    static const UINT64 Sizes[] = { 64, 512, 4096, 65536 };
+    static const UINTN Lanes[] = { 1, 4, SHA256_MB_LANES };
+    UINT8 *Data = malloc(SHA256_MB_LANES * 65536);
+    memset(Data, 0x5A, SHA256_MB_LANES * 65536);
+
+    if (!sha256_impl_supported(SHA256_IMPL_AVX2)) {
+        printf("sha256_mb: AVX2 not supported by this CPU\n");
+        free(Data);
+        return;
+    }
+    printf("sha256_mb, aggregate MB/s %10s %10s %10s %10s\n", "AVX2 x1", "AVX2 x4", "AVX2 x8", "SHA-NI x8");
+    for (UINTN s = 0; s < sizeof(Sizes) / sizeof(Sizes[0]); ++s) {
+        printf("  %5llu B messages       ", (unsigned long long)Sizes[s]);
+        sha256_set_impl(SHA256_IMPL_AVX2);
+        for (UINTN l = 0; l < sizeof(Lanes) / sizeof(Lanes[0]); ++l)
+            printf(" %10.1f", LanesMbPerSec(Data, Sizes[s], Lanes[l], Rounds));
+        if (sha256_set_impl(SHA256_IMPL_SHANI) == 0)
+            printf(" %10.1f", LanesMbPerSec(Data, Sizes[s], SHA256_MB_LANES, Rounds));
+        else
+            printf(" %10s", "-");
+        printf("\n");
+        fflush(stdout);
+    }
+    free(Data);
+}
+
+int main(int Argc, char **Argv) {
+    BOOLEAN Benchmark = FALSE;
+    UINTN Rounds = 3;
+    int Opt, Failed = 0;
+
+    while ((Opt = getopt(Argc, Argv, "br:")) != -1) {
+        switch (Opt) {
+        case 'b': Benchmark = TRUE; break;
+        case 'r': Rounds = (UINTN)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-b] [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (Rounds == 0) Rounds = 1;
+    if (Benchmark) {
+        Bench(Rounds);
+        BenchMultiBuffer(Rounds);
+        return 0;
+    }
+
+    for (sha256_impl_t Impl = 0; Impl < SHA256_IMPL_COUNT; ++Impl) {
+        if (!sha256_impl_supported(Impl)) {
+            printf("--   %-34s not supported by this CPU\n", gImplNames[Impl]);
+            continue;
+        }
+        sha256_set_impl(Impl);
+        Failed += CheckVectors(Impl);
+        if (Impl != SHA256_IMPL_SCALAR) Failed += CheckRandom(Impl);
+        Failed += CheckMultiBuffer(Impl);
+    }
+    return Failed ? 1 : 0;
+}
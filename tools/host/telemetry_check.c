@@ -0,0 +1,184 @@
+// telemetry_check.c - Concurrent producers against the telemetry ring
+//
+//   telemetry_check         no-loss / no-tear checks, exit status 1 on failure
+//   telemetry_check -b      events per second, one and several producers
+//
+// Producers run on host pool APs and log while the main thread drains, as
+// mind_dispatch does on the BSP. Every record carries its producer and
+// sequence number in A and the complement in B, so a torn record shows up
+// as B != ~A, a wrong name or a wrong phase. Nothing is lost when every
+// event was either drained or counted as dropped, and each producer's
+// events drain in the order it logged them.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kernel_shared.h"
+#include "telemetry_mind.h"
+#include "ap_pool.h"
+#include "tsc.h"
+
+#define CHECK_PRODUCERS     4
+#define CHECK_EVENTS        200000
+#define CHECK_PHASE_BASE    1000
+#define CHECK_PACE_BATCH    64
+#define CHECK_RING_SIZE     2048    // TELEMETRY_RING_SIZE
+
+static const CHAR8 *const gNames[CHECK_PRODUCERS] = {
+    "Producer0", "Producer1", "Producer2", "Producer3"
+};
+
+typedef struct {
+    UINTN   Index;
+    UINTN   Events;
+    BOOLEAN Paced;      // pause every CHECK_PACE_BATCH events so the drain keeps up
+} PRODUCER;
+
+typedef struct {
+    UINT64 Received;
+    UINT64 Torn;
+    UINT64 OutOfOrder;
+    INT64  Last[CHECK_PRODUCERS];
+} CHECK_SINK;
+
+static VOID EFIAPI Produce(VOID *Arg) {
+    PRODUCER *P = Arg;
+    Telemetry_SetPhase((UINT32)(CHECK_PHASE_BASE + P->Index));
+    for (UINTN k = 0; k < P->Events; ++k) {
+        UINT64 A = ((UINT64)P->Index << 32) | k;
+        Telemetry_LogEvent(gNames[P->Index], A, ~A);
+        if (P->Paced && k % CHECK_PACE_BATCH == CHECK_PACE_BATCH - 1) CpuPause();
+    }
+}
+
+static VOID CheckRecord(const TELEMETRY_RECORD *R, VOID *Context) {
+    CHECK_SINK *S = Context;
+    UINTN p = (UINTN)(R->A >> 32);
+    S->Received++;
+    if (p >= CHECK_PRODUCERS || R->B != ~R->A || R->Name != gNames[p] ||
+        R->Phase != CHECK_PHASE_BASE + p || R->Tsc == 0) {
+        S->Torn++;
+        return;
+    }
+    INT64 Seq = (INT64)(UINT32)R->A;
+    if (Seq <= S->Last[p]) S->OutOfOrder++;
+    S->Last[p] = Seq;
+}
+
+static VOID DiscardRecord(const TELEMETRY_RECORD *R, VOID *Context) {
+    (void)R;
+    (*(UINT64 *)Context)++;
+}
+
+static VOID ResetRing(VOID) {
+    KERNEL_CONTEXT *Ctx = calloc(1, sizeof(*Ctx));
+    Telemetry_InitPhase711_BootstrapTelemetryMind(Ctx);   // clears the ring and the drop count
+    free(Ctx);
+    UINT64 Discarded = 0;
+    Telemetry_DrainTo(DiscardRecord, &Discarded);          // its own bootstrap event
+}
+
+static BOOLEAN AnyBusy(UINTN Count) {
+    for (UINTN i = 0; i < Count; ++i)
+        if (ApPool_Busy(i)) return TRUE;
+    return FALSE;
+}
+
+// Runs Producers producers of Events each; the BSP drains into Sink until
+// they are done and the ring is empty. Returns elapsed ticks.
+static UINT64 RunProducers(UINTN Producers, UINTN Events, BOOLEAN Paced, BOOLEAN DrainWhileRunning,
+                           TELEMETRY_SINK Sink, VOID *Context) {
+    static PRODUCER P[CHECK_PRODUCERS];
+    UINT64 Start = AsmReadTsc();
+    for (UINTN i = 0; i < Producers; ++i) {
+        P[i].Index = i;
+        P[i].Events = Events;
+        P[i].Paced = Paced;
+        ApPool_Run(i, Produce, &P[i]);
+    }
+    while (AnyBusy(Producers)) {
+        if (!DrainWhileRunning || Telemetry_DrainTo(Sink, Context) == 0) CpuPause();
+    }
+    while (Telemetry_DrainTo(Sink, Context) != 0) {}
+    return AsmReadTsc() - Start;
+}
+
+static int Check(const char *Name, UINTN Producers, UINTN Events, BOOLEAN Paced, BOOLEAN DrainWhileRunning,
+                 BOOLEAN ExpectNoDrops) {
+    CHECK_SINK S;
+    memset(&S, 0, sizeof(S));
+    for (UINTN i = 0; i < CHECK_PRODUCERS; ++i) S.Last[i] = -1;
+
+    ResetRing();
+    RunProducers(Producers, Events, Paced, DrainWhileRunning, CheckRecord, &S);
+    UINT64 Dropped = Telemetry_GetDropped();
+    UINT64 Logged = (UINT64)Producers * Events;
+    BOOLEAN Ok = S.Torn == 0 && S.OutOfOrder == 0 && S.Received + Dropped == Logged &&
+                 (!ExpectNoDrops || Dropped == 0);
+    printf("%-4s %-34s logged %8lu received %8lu dropped %8lu torn %lu reordered %lu\n",
+           Ok ? "ok" : "FAIL", Name, (unsigned long)Logged, (unsigned long)S.Received,
+           (unsigned long)Dropped, (unsigned long)S.Torn, (unsigned long)S.OutOfOrder);
+    return Ok ? 0 : 1;
+}
+
+static VOID Bench(UINTN Producers) {
+    UINT64 Received = 0;
+    const UINTN Events = 1000000;
+
+    ResetRing();
+    UINT64 Ticks = RunProducers(Producers, Events, FALSE, TRUE, DiscardRecord, &Received);
+    double Seconds = (double)Tsc_ToNs(Ticks) / 1e9;
+    printf("%lu producer%s  %6.1f M events/s logged  %6.1f M events/s drained  %5.1f%% dropped\n",
+           (unsigned long)Producers, Producers == 1 ? " " : "s",
+           (double)(Producers * Events) / Seconds / 1e6, (double)Received / Seconds / 1e6,
+           100.0 * (double)Telemetry_GetDropped() / (double)(Producers * Events));
+}
+
+// Cost of Telemetry_LogEvent alone: fill the ring, drain it, repeat.
+static VOID BenchLogOnly(VOID) {
+    const UINTN Rounds = 2000, Batch = 1024;
+    UINT64 LogTicks = 0, DrainTicks = 0, Discarded = 0;
+
+    ResetRing();
+    for (UINTN r = 0; r < Rounds; ++r) {
+        UINT64 T0 = AsmReadTsc();
+        for (UINTN k = 0; k < Batch; ++k) Telemetry_LogEvent("Bench", k, ~(UINT64)k);
+        UINT64 T1 = AsmReadTsc();
+        Telemetry_DrainTo(DiscardRecord, &Discarded);
+        DrainTicks += AsmReadTsc() - T1;
+        LogTicks += T1 - T0;
+    }
+    printf("uncontended  %6.1f ns per LogEvent  %6.1f ns per drained record\n",
+           (double)Tsc_ToNs(LogTicks) / (double)(Rounds * Batch),
+           (double)Tsc_ToNs(DrainTicks) / (double)(Rounds * Batch));
+}
+
+int main(int Argc, char **Argv) {
+    BOOLEAN RunBench = Argc > 1 && strcmp(Argv[1], "-b") == 0;
+    int Failed = 0;
+
+    Tsc_Calibrate();
+    if (EFI_ERROR(ApPool_Start(0, CHECK_PRODUCERS))) {
+        fprintf(stderr, "telemetry_check: could not start %u producer threads\n", CHECK_PRODUCERS);
+        return 1;
+    }
+
+    if (RunBench) {
+        BenchLogOnly();
+        for (UINTN p = 1; p <= CHECK_PRODUCERS; p *= 2) Bench(p);
+        return 0;
+    }
+
+    // Fits the ring, drained only at the end: nothing may be dropped.
+    Failed += Check("burst within ring", CHECK_PRODUCERS, CHECK_RING_SIZE / CHECK_PRODUCERS, FALSE, FALSE, TRUE);
+    // Paced producers interleave with the drain even on a single host CPU.
+    Failed += Check("1 producer, paced", 1, CHECK_EVENTS, TRUE, TRUE, FALSE);
+    Failed += Check("4 producers, paced", CHECK_PRODUCERS, CHECK_EVENTS, TRUE, TRUE, FALSE);
+    // Flooding overruns the ring; every loss must show up as a drop.
+    Failed += Check("4 producers, flood", CHECK_PRODUCERS, CHECK_EVENTS, FALSE, TRUE, FALSE);
+    Failed += Check("4 producers, flood, drain after", CHECK_PRODUCERS, CHECK_EVENTS, FALSE, FALSE, FALSE);
+    return Failed ? 1 : 0;
+}
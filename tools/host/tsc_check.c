@@ -0,0 +1,174 @@
+// tsc_check.c - TSC calibration, against a fake clock and the host's TSC
+//
+//   tsc_check           exit status 1 when a check fails
+//
+// The checks that decide the exit status are deterministic. The Stall
+// fallback runs against a fake TSC and a fake gBS->Stall that stretches
+// some windows the way an interrupt would, so it must come out exact. The
+// tick/ns conversions run on an adopted rate. Sources read from CPUID are
+// held to the host's TSC frequency only when the kernel exports it in
+// tsc_freq_khz, since both are then fixed numbers.
+//
+// Everything measured on the real clock (the Stall fallback on this host,
+// and any source when the reference itself has to be measured across
+// CLOCK_MONOTONIC_RAW) is printed as "info" and never fails the run: a
+// busy host can stretch any timing window.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "kernel_shared.h"
+#include "tsc.h"
+#include "host_shim.h"
+
+#define CHECK_TOLERANCE_PPM         20000   // 2%
+#define CHECK_NOMINAL_TOLERANCE_PPM 50000   // 5%, CPUID leaf 0x16
+#define CHECK_REFERENCE_WINDOWS     5
+#define CHECK_REFERENCE_NS          40000000ULL
+#define CHECK_FAKE_HZ               2400000000ULL
+
+static const char *const gSourceNames[] = {
+    "default", "CPUID 0x15", "hypervisor leaf", "CPUID 0x16", "gBS->Stall"
+};
+
+// --- Fake clock ---
+
+static UINT64 gFakeTsc;
+static UINTN  gFakeWindow;
+static const UINT32 *gFakeJitterPpm;    // extra length of each Stall window
+
+static UINT64 FakeReadTsc(VOID) {
+    return gFakeTsc;
+}
+
+static EFI_STATUS EFIAPI FakeStall(UINTN Microseconds) {
+    UINT64 Ticks = CHECK_FAKE_HZ / 1000000 * Microseconds;
+    gFakeTsc += Ticks + Ticks * gFakeJitterPpm[gFakeWindow++ % TSC_STALL_WINDOWS] / 1000000;
+    return EFI_SUCCESS;
+}
+
+// Runs the Stall fallback with window i stretched by JitterPpm[i].
+static UINT64 FakeStallHz(const UINT32 JitterPpm[TSC_STALL_WINDOWS]) {
+    EFI_STATUS (EFIAPI *RealStall)(UINTN) = gBS->Stall;
+    gFakeTsc = 1000;
+    gFakeWindow = 0;
+    gFakeJitterPpm = JitterPpm;
+    gBS->Stall = FakeStall;
+    HostShim_SetTsc(FakeReadTsc);
+    UINT64 Hz = Tsc_FromSource(TSC_SOURCE_STALL);
+    HostShim_SetTsc(NULL);
+    gBS->Stall = RealStall;
+    return Hz;
+}
+
+static int CheckFakeStall(const char *Name, const UINT32 JitterPpm[TSC_STALL_WINDOWS], UINT64 Expected) {
+    UINT64 Hz = FakeStallHz(JitterPpm);
+    BOOLEAN Ok = Hz == Expected;
+    printf("%-4s %-36s %10.3f MHz  expected %.3f\n", Ok ? "ok" : "FAIL", Name,
+           (double)Hz / 1e6, (double)Expected / 1e6);
+    return Ok ? 0 : 1;
+}
+
+// --- Host TSC ---
+
+static UINT64 NowNs(VOID) {
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &Ts);
+    return (UINT64)Ts.tv_sec * 1000000000ULL + (UINT64)Ts.tv_nsec;
+}
+
+static int CompareU64(const void *A, const void *B) {
+    UINT64 X = *(const UINT64 *)A, Y = *(const UINT64 *)B;
+    return X < Y ? -1 : X > Y;
+}
+
+// Returns the host TSC rate; *Exact says it came from the kernel rather
+// than from a measurement.
+static UINT64 ReferenceHz(BOOLEAN *Exact) {
+    unsigned long long KHz = 0;
+    FILE *F = fopen("/sys/devices/system/cpu/cpu0/tsc_freq_khz", "r");
+    if (F != NULL) {
+        int Ok = fscanf(F, "%llu", &KHz) == 1;
+        fclose(F);
+        if (Ok && KHz != 0) {
+            *Exact = TRUE;
+            return KHz * 1000;
+        }
+    }
+
+    // Median of several windows, so one preempted window does not count.
+    UINT64 Hz[CHECK_REFERENCE_WINDOWS];
+    for (UINTN i = 0; i < CHECK_REFERENCE_WINDOWS; ++i) {
+        UINT64 T0 = NowNs(), C0 = AsmReadTsc();
+        UINT64 T1, C1;
+        do {
+            T1 = NowNs();
+            C1 = AsmReadTsc();
+        } while (T1 - T0 < CHECK_REFERENCE_NS);
+        Hz[i] = (UINT64)((unsigned __int128)(C1 - C0) * 1000000000ULL / (T1 - T0));
+    }
+    qsort(Hz, CHECK_REFERENCE_WINDOWS, sizeof(Hz[0]), CompareU64);
+    *Exact = FALSE;
+    return Hz[CHECK_REFERENCE_WINDOWS / 2];
+}
+
+// Gating compares fail the run; the others only report.
+static int Compare(const char *Name, UINT64 Hz, UINT64 Reference, UINT64 TolerancePpm, BOOLEAN Gating) {
+    INT64 Ppm = (INT64)(((__int128)Hz - (__int128)Reference) * 1000000 / (__int128)Reference);
+    BOOLEAN Ok = (UINT64)(Ppm < 0 ? -Ppm : Ppm) <= TolerancePpm;
+    printf("%-4s %-36s %10.3f MHz  %+8.3f%%  (limit %.1f%%)\n", !Gating ? "info" : Ok ? "ok" : "FAIL",
+           Name, (double)Hz / 1e6, (double)Ppm / 1e4, (double)TolerancePpm / 1e4);
+    return Gating && !Ok ? 1 : 0;
+}
+
+int main(VOID) {
+    static const UINT32 Clean[TSC_STALL_WINDOWS]       = { 0, 0, 0, 0, 0 };
+    static const UINT32 Interrupted[TSC_STALL_WINDOWS] = { 58430, 0, 300000, 10000, 2000 };
+    static const UINT32 CleanLast[TSC_STALL_WINDOWS]   = { 58430, 300000, 10000, 2000, 0 };
+    static const UINT32 AllLate[TSC_STALL_WINDOWS]     = { 58430, 300000, 10000, 2000, 500 };
+    int Failed = 0;
+
+    Failed += CheckFakeStall("Stall fallback, steady clock", Clean, CHECK_FAKE_HZ);
+    Failed += CheckFakeStall("Stall fallback, interrupted windows", Interrupted, CHECK_FAKE_HZ);
+    Failed += CheckFakeStall("Stall fallback, clean window last", CleanLast, CHECK_FAKE_HZ);
+    Failed += CheckFakeStall("Stall fallback, every window late", AllLate, CHECK_FAKE_HZ + CHECK_FAKE_HZ / 2000);
+
+    BOOLEAN Exact;
+    UINT64 Reference = ReferenceHz(&Exact);
+    printf("host TSC %.3f MHz from %s\n", (double)Reference / 1e6,
+           Exact ? "tsc_freq_khz" : "CLOCK_MONOTONIC_RAW");
+
+    const TSC_INFO *Tsc = Tsc_Calibrate();
+    char Name[48];
+    snprintf(Name, sizeof(Name), "Tsc_Calibrate (%s)", gSourceNames[Tsc->Source]);
+    if (Tsc->Source == TSC_SOURCE_DEFAULT) {
+        printf("FAIL %-36s no source available\n", Name);
+        Failed++;
+    } else {
+        Failed += Compare(Name, Tsc->Hz, Reference, Tsc->Source == TSC_SOURCE_CPUID_16 ?
+                          CHECK_NOMINAL_TOLERANCE_PPM : CHECK_TOLERANCE_PPM,
+                          Exact && Tsc->Source != TSC_SOURCE_STALL);
+    }
+
+    for (TSC_SOURCE S = TSC_SOURCE_CPUID_15; S <= TSC_SOURCE_STALL; ++S) {
+        UINT64 Hz = Tsc_FromSource(S);
+        if (Hz == 0) {
+            printf("--   %-36s not provided\n", gSourceNames[S]);
+            continue;
+        }
+        Failed += Compare(gSourceNames[S], Hz, Reference,
+                          S == TSC_SOURCE_CPUID_16 ? CHECK_NOMINAL_TOLERANCE_PPM : CHECK_TOLERANCE_PPM,
+                          Exact && S != TSC_SOURCE_STALL);
+    }
+
+    // One second's worth of ticks must convert back to one second.
+    Tsc_Adopt(CHECK_FAKE_HZ, TSC_SOURCE_STALL, TRUE);
+    UINT64 Ns = Tsc_ToNs(CHECK_FAKE_HZ);
+    BOOLEAN Ok = Ns + 1 >= 1000000000ULL && Ns <= 1000000000ULL && Tsc_FromNs(1000000000ULL) == CHECK_FAKE_HZ;
+    printf("%-4s %-36s %lu ns for one second of ticks\n", Ok ? "ok" : "FAIL", "Tsc_ToNs / Tsc_FromNs",
+           (unsigned long)Ns);
+    Failed += !Ok;
+    return Failed ? 1 : 0;
+}
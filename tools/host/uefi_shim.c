@@ -0,0 +1,269 @@
+// uefi_shim.c - EDK2 library calls the minds make, implemented for Linux
+
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sched.h>
+#include <time.h>
+#include <x86intrin.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SynchronizationLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include "host_shim.h"
+
+static HOST_SHIM_COUNTERS gCounters;
+static BOOLEAN gVerbose;
+static HOST_SHIM_TSC gTscHook;
+
+VOID HostShim_SetVerbose(BOOLEAN Verbose) { gVerbose = Verbose; }
+VOID HostShim_SetTsc(HOST_SHIM_TSC Read) { gTscHook = Read; }
+
+VOID HostShim_Counters(HOST_SHIM_COUNTERS *Out) {
+    Out->Allocations = __atomic_load_n(&gCounters.Allocations, __ATOMIC_RELAXED);
+    Out->Bytes       = __atomic_load_n(&gCounters.Bytes, __ATOMIC_RELAXED);
+    Out->Prints      = __atomic_load_n(&gCounters.Prints, __ATOMIC_RELAXED);
+}
+
+static VOID CountAllocation(UINTN Size) {
+    __atomic_add_fetch(&gCounters.Allocations, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&gCounters.Bytes, Size, __ATOMIC_RELAXED);
+}
+
+// --- BaseLib ---
+
+UINT64 EFIAPI AsmReadTsc(VOID) { return gTscHook ? gTscHook() : __rdtsc(); }
+// Spin loops give the CPU up too: the host may run more pool threads than
+// it has CPUs, and a spinner would otherwise hold on to its whole timeslice.
+VOID EFIAPI CpuPause(VOID) { _mm_pause(); sched_yield(); }
+VOID EFIAPI MemoryFence(VOID) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+// IA32_APERF/MPERF advance with the TSC; anything else reads as zero.
+UINT64 EFIAPI AsmReadMsr64(UINT32 Index) {
+    if (Index == 0xE7 || Index == 0xE8) return __rdtsc();
+    return 0;
+}
+UINT64 EFIAPI AsmWriteMsr64(UINT32 Index, UINT64 Value) { (void)Index; return Value; }
+
+// Long mode with paging, PAE, OSFXSR/OSXMMEXCPT and OSXSAVE, as the loader leaves it.
+UINTN EFIAPI AsmReadCr0(VOID) { return 0x80050033; }
+UINTN EFIAPI AsmReadCr3(VOID) { return 0x1000; }
+UINTN EFIAPI AsmReadCr4(VOID) { return 0x40668; }
+UINT64 EFIAPI AsmXGetBv(UINT32 Index) { return Index == 0 ? 0x7 : 0; }
+VOID EFIAPI AsmReadGdtr(IA32_DESCRIPTOR *Gdtr) { Gdtr->Limit = 0; Gdtr->Base = 0; }
+VOID EFIAPI AsmReadIdtr(IA32_DESCRIPTOR *Idtr) { Idtr->Limit = 0; Idtr->Base = 0; }
+UINT16 EFIAPI AsmReadCs(VOID) { return 0x38; }
+UINT16 EFIAPI AsmReadDs(VOID) { return 0x30; }
+INT64 EFIAPI AbsoluteValue64(INT64 Value) { return Value < 0 ? -Value : Value; }
+
+INTN EFIAPI AsciiStriCmp(CONST CHAR8 *FirstString, CONST CHAR8 *SecondString) {
+    return strcasecmp(FirstString, SecondString);
+}
+
+// Leaves Destination alone on failure, like the EDK2 version.
+RETURN_STATUS EFIAPI AsciiStrToUnicodeStrS(CONST CHAR8 *Source, CHAR16 *Destination, UINTN DestMax) {
+    if (Source == NULL || Destination == NULL || DestMax == 0) return RETURN_INVALID_PARAMETER;
+    UINTN Len = strnlen(Source, DestMax);
+    if (Len == DestMax) return RETURN_BUFFER_TOO_SMALL;
+    for (UINTN i = 0; i <= Len; ++i) Destination[i] = (UINT8)Source[i];
+    return RETURN_SUCCESS;
+}
+
+// --- SynchronizationLib ---
+
+UINT32 EFIAPI InterlockedIncrement(volatile UINT32 *Value) {
+    return __atomic_add_fetch(Value, 1, __ATOMIC_SEQ_CST);
+}
+UINT32 EFIAPI InterlockedDecrement(volatile UINT32 *Value) {
+    return __atomic_sub_fetch(Value, 1, __ATOMIC_SEQ_CST);
+}
+UINT32 EFIAPI InterlockedCompareExchange32(volatile UINT32 *Value, UINT32 CompareValue, UINT32 ExchangeValue) {
+    return __sync_val_compare_and_swap(Value, CompareValue, ExchangeValue);
+}
+UINT64 EFIAPI InterlockedCompareExchange64(volatile UINT64 *Value, UINT64 CompareValue, UINT64 ExchangeValue) {
+    return __sync_val_compare_and_swap(Value, CompareValue, ExchangeValue);
+}
+
+// --- BaseMemoryLib ---
+
+VOID * EFIAPI CopyMem(VOID *Destination, CONST VOID *Source, UINTN Length) {
+    return memmove(Destination, Source, Length);
+}
+VOID * EFIAPI SetMem(VOID *Buffer, UINTN Length, UINT8 Value) { return memset(Buffer, Value, Length); }
+VOID * EFIAPI ZeroMem(VOID *Buffer, UINTN Length) { return memset(Buffer, 0, Length); }
+INTN EFIAPI CompareMem(CONST VOID *DestinationBuffer, CONST VOID *SourceBuffer, UINTN Length) {
+    return memcmp(DestinationBuffer, SourceBuffer, Length);
+}
+
+// --- MemoryAllocationLib ---
+
+VOID * EFIAPI AllocatePool(UINTN AllocationSize) {
+    CountAllocation(AllocationSize);
+    return malloc(AllocationSize ? AllocationSize : 1);
+}
+VOID * EFIAPI AllocateZeroPool(UINTN AllocationSize) {
+    CountAllocation(AllocationSize);
+    return calloc(1, AllocationSize ? AllocationSize : 1);
+}
+VOID EFIAPI FreePool(VOID *Buffer) { free(Buffer); }
+
+// --- TimerLib ---
+
+UINTN EFIAPI MicroSecondDelay(UINTN MicroSeconds) {
+    struct timespec Ts = { (time_t)(MicroSeconds / 1000000), (long)(MicroSeconds % 1000000) * 1000 };
+    while (nanosleep(&Ts, &Ts) != 0) {}
+    return MicroSeconds;
+}
+
+// --- Boot services ---
+
+// Any address will do for AllocateAnyPages; the others would need a fixed
+// or bounded placement the host cannot promise.
+static EFI_STATUS EFIAPI ShimAllocatePages(EFI_ALLOCATE_TYPE Type, EFI_MEMORY_TYPE MemoryType, UINTN Pages,
+                                           EFI_PHYSICAL_ADDRESS *Memory) {
+    (void)MemoryType;
+    if (Type != AllocateAnyPages) return EFI_UNSUPPORTED;
+    VOID *P = aligned_alloc(EFI_PAGE_SIZE, EFI_PAGES_TO_SIZE(Pages));
+    if (P == NULL) return EFI_OUT_OF_RESOURCES;
+    *Memory = (EFI_PHYSICAL_ADDRESS)(UINTN)P;
+    return EFI_SUCCESS;
+}
+static EFI_STATUS EFIAPI ShimFreePages(EFI_PHYSICAL_ADDRESS Memory, UINTN Pages) {
+    (void)Pages;
+    free((VOID *)(UINTN)Memory);
+    return EFI_SUCCESS;
+}
+static EFI_STATUS EFIAPI ShimAllocatePool(EFI_MEMORY_TYPE PoolType, UINTN Size, VOID **Buffer) {
+    (void)PoolType;
+    *Buffer = AllocatePool(Size);
+    return *Buffer ? EFI_SUCCESS : EFI_OUT_OF_RESOURCES;
+}
+static EFI_STATUS EFIAPI ShimFreePool(VOID *Buffer) { FreePool(Buffer); return EFI_SUCCESS; }
+// Firmware Stall busy-waits, and Tsc_Calibrate's fallback times TSC ticks
+// across it, so it spins on the clock instead of sleeping: nanosleep's
+// wake-up latency alone would stretch every 2 ms calibration window.
+static EFI_STATUS EFIAPI ShimStall(UINTN Microseconds) {
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    UINT64 End = (UINT64)Ts.tv_sec * 1000000000ULL + (UINT64)Ts.tv_nsec + (UINT64)Microseconds * 1000;
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &Ts);
+    } while ((UINT64)Ts.tv_sec * 1000000000ULL + (UINT64)Ts.tv_nsec < End);
+    return EFI_SUCCESS;
+}
+static VOID EFIAPI ShimCopyMem(VOID *Destination, VOID *Source, UINTN Length) { CopyMem(Destination, Source, Length); }
+static VOID EFIAPI ShimSetMem(VOID *Buffer, UINTN Size, UINT8 Value) { SetMem(Buffer, Size, Value); }
+
+static EFI_BOOT_SERVICES gShimBootServices = {
+    ShimAllocatePages, ShimFreePages, ShimAllocatePool, ShimFreePool, ShimStall, ShimCopyMem, ShimSetMem
+};
+EFI_BOOT_SERVICES *gBS = &gShimBootServices;
+
+// --- UefiLib Print ---
+
+typedef struct {
+    char  *Buf;
+    size_t Len, Cap;
+} PRINT_OUT;
+
+static void Put(PRINT_OUT *O, char C) {
+    if (O->Len + 1 < O->Cap) O->Buf[O->Len++] = C;
+}
+
+static void PutStr(PRINT_OUT *O, const char *S) {
+    while (*S) Put(O, *S++);
+}
+
+const char *HostShim_StatusName(EFI_STATUS Status) {
+    static const char *Names[] = {
+        "Success", "Load Error", "Invalid Parameter", "Unsupported", "Bad Buffer Size",
+        "Buffer Too Small", "Not Ready", "Device Error", "Write Protected", "Out of Resources",
+        "Volume Corrupt", "Volume Full", "No Media", "Media changed", "Not Found",
+        "Access Denied", "No Response", "No mapping", "Time out", "Not started",
+        "Already started", "Aborted", "ICMP Error", "TFTP Error", "Protocol Error",
+        "Incompatible Version", "Security Violation", "CRC Error", "End of Media", "Reserved (29)",
+        "Reserved (30)", "End of File", "Invalid Language", "Compromised Data"
+    };
+    UINTN Code = Status & ~MAX_BIT;
+    if (Status != EFI_SUCCESS && !EFI_ERROR(Status)) return "Warning";
+    return Code < sizeof(Names) / sizeof(Names[0]) ? Names[Code] : "Unknown Error";
+}
+
+// Translates the UEFI conversions into printf ones: %a and %s carry CHAR8
+// and CHAR16 strings, %d/%u/%x are 32-bit unless l-prefixed, %r an EFI_STATUS.
+static void FormatUefi(PRINT_OUT *O, const CHAR16 *Format, va_list Args) {
+    for (const CHAR16 *F = Format; *F; ++F) {
+        if (*F != L'%') { Put(O, (char)*F); continue; }
+        char Spec[16] = "%";
+        size_t n = 1;
+        ++F;
+        while (*F && strchr("-+ 0#123456789.", (char)*F) && n < 8) Spec[n++] = (char)*F++;
+        BOOLEAN Long = FALSE;
+        while (*F == L'l' || *F == L'L') { Long = TRUE; ++F; }
+        char Tmp[128];
+        switch (*F) {
+        case L'a': {
+            const CHAR8 *S = va_arg(Args, const CHAR8 *);
+            PutStr(O, S ? S : "(null)");
+            break;
+        }
+        case L's': case L'S': {
+            const CHAR16 *S = va_arg(Args, const CHAR16 *);
+            while (S && *S) Put(O, (char)*S++);
+            break;
+        }
+        case L'c':
+            Put(O, (char)va_arg(Args, int));
+            break;
+        case L'r':
+            PutStr(O, HostShim_StatusName(va_arg(Args, EFI_STATUS)));
+            break;
+        case L'p':
+            snprintf(Tmp, sizeof(Tmp), "%p", va_arg(Args, VOID *));
+            PutStr(O, Tmp);
+            break;
+        case L'd': case L'i':
+            strcpy(Spec + n, "lld");
+            snprintf(Tmp, sizeof(Tmp), Spec, Long ? (long long)va_arg(Args, INT64) : (long long)va_arg(Args, INT32));
+            PutStr(O, Tmp);
+            break;
+        case L'u': case L'x': case L'X':
+            strcpy(Spec + n, *F == L'u' ? "llu" : *F == L'x' ? "llx" : "llX");
+            snprintf(Tmp, sizeof(Tmp), Spec,
+                     Long ? (unsigned long long)va_arg(Args, UINT64) : (unsigned long long)va_arg(Args, UINT32));
+            PutStr(O, Tmp);
+            break;
+        case L'%':
+            Put(O, '%');
+            break;
+        case 0:
+            return;
+        default:
+            Put(O, '%');
+            Put(O, (char)*F);
+            break;
+        }
+    }
+}
+
+UINTN EFIAPI Print(CONST CHAR16 *Format, ...) {
+    char Buf[1024];
+    PRINT_OUT O = { Buf, 0, sizeof(Buf) };
+    va_list Args;
+
+    va_start(Args, Format);
+    FormatUefi(&O, Format, Args);
+    va_end(Args);
+    Buf[O.Len] = 0;
+    __atomic_add_fetch(&gCounters.Prints, 1, __ATOMIC_RELAXED);
+    if (gVerbose) fputs(Buf, stdout);
+    return O.Len;
+}
@@ -0,0 +1,162 @@
+// zero_bench.c - Memory zeroing strategies on large anonymous buffers
+//
+//   zero_bench [-m MiB] [-j APs] [-r ROUNDS]
+//
+// First the store strategies alone, on one core: libc memset, phase 105's
+// ERMS `rep stosb` and its SSE2 non-temporal stores, both on a buffer the
+// size of phase 105's trial and on the whole buffer, so a trial that
+// picks the wrong winner for large ranges shows up. The trial-sized runs
+// start from a cache that was flushed by a larger fill, as the kernel's
+// trial does on memory nobody touched since the firmware. Then the memory mind
+// itself: the buffer is handed to MemoryMind_RunAllPhases as three
+// conventional regions, once on the BSP alone and once with -j host pool
+// APs, and checked to be all zero afterwards.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "kernel_shared.h"
+#include "memory_mind.h"
+#include "ap_pool.h"
+#include "tsc.h"
+
+#define ZERO_TRIAL_BYTES    (16ULL * 1024 * 1024)   // MEMORY_ZERO_TRIAL
+#define ZERO_EVICT_BYTES    (64ULL * 1024 * 1024)
+
+typedef struct {
+    const char *Name;
+    VOID      (*Zero)(VOID *Dst, UINT64 Bytes);
+} ZERO_STRATEGY;
+
+static VOID ZeroLibc(VOID *Dst, UINT64 Bytes) {
+    memset(Dst, 0, Bytes);
+}
+
+static const ZERO_STRATEGY gStrategies[] = {
+    { "memset",            ZeroLibc },
+    { "rep stosb (ERMS)",  MemZeroErms },
+    { "non-temporal SSE2", MemZeroNonTemporal },
+};
+
+#define STRATEGY_COUNT  (sizeof(gStrategies) / sizeof(gStrategies[0]))
+
+static double GbPerSec(UINT64 Bytes, UINT64 Ticks) {
+    return Ticks ? (double)Bytes / ((double)Tsc_ToNs(Ticks) / 1e9) / 1e9 : 0.0;
+}
+
+// Bytes at Buf are filled, then EvictBytes behind them so the fill has
+// left the cache before the timed run. Buf must hold Bytes + EvictBytes.
+static double BestGbPerSec(const ZERO_STRATEGY *S, UINT8 *Buf, UINT64 Bytes, UINT64 EvictBytes, UINTN Rounds) {
+    UINT64 Best = ~0ULL;
+    for (UINTN r = 0; r < Rounds; ++r) {
+        memset(Buf, 0xA5, Bytes);
+        if (EvictBytes) memset(Buf + Bytes, 0x5A, EvictBytes);
+        UINT64 Start = AsmReadTsc();
+        S->Zero(Buf, Bytes);
+        UINT64 Ticks = AsmReadTsc() - Start;
+        if (Ticks < Best) Best = Ticks;
+    }
+    return GbPerSec(Bytes, Best);
+}
+
+static BOOLEAN AllZero(const UINT8 *Buf, UINT64 Bytes) {
+    const UINT64 *P = (const UINT64 *)Buf;
+    UINT64 Acc = 0;
+    for (UINT64 i = 0; i < Bytes / 8; ++i) Acc |= P[i];
+    return Acc == 0;
+}
+
+static KERNEL_CONTEXT gCtx;
+static KERNEL_COLD gCold;
+static MEMORY_REGION_INDEX gRegions;
+
+// Three conventional regions of unequal size, so stripes cross range ends.
+static VOID BuildRegions(UINT8 *Buf, UINT64 Bytes) {
+    UINT64 Pages = Bytes / EFI_PAGE_SIZE;
+    UINT64 Split[3] = { Pages / 2, Pages / 4 + 1, 0 };
+    Split[2] = Pages - Split[0] - Split[1];
+
+    memset(&gRegions, 0, sizeof(gRegions));
+    UINT64 Base = (UINT64)(UINTN)Buf;
+    for (UINTN i = 0; i < 3; ++i) {
+        MEMORY_REGION *R = &gRegions.Region[gRegions.Count++];
+        R->Base = Base;
+        R->Pages = Split[i];
+        R->Type = EfiConventionalMemory;
+        Base += EFI_PAGES_TO_SIZE(Split[i]);
+    }
+    gRegions.TotalPages = Pages;
+    gRegions.TypePages[EfiConventionalMemory] = Pages;
+}
+
+static int RunMemoryMind(const char *Label, UINT8 *Buf, UINT64 Bytes) {
+    memset(Buf, 0xA5, Bytes);
+    memset(&gCtx, 0, sizeof(gCtx));
+    gCtx.cold = &gCold;
+    gCtx.Regions = &gRegions;
+    gCtx.DescriptorCount = gRegions.Count;
+
+    EFI_STATUS Status = MemoryMind_RunAllPhases(&gCtx);
+    BOOLEAN Zeroed = AllZero(Buf, Bytes);
+    printf("  %-22s %2u CPUs %7u MB/s total", Label, gCtx.zero_cpu_count, gCtx.zero_total_mbps);
+    for (UINT32 i = 0; i < gCtx.zero_cpu_count && i < 8; ++i) printf("%s%u", i ? " " : "  per CPU ", gCtx.zero_mbps[i]);
+    printf("%s\n", EFI_ERROR(Status) ? "  FAILED" : Zeroed ? "" : "  NOT ZERO");
+    return !EFI_ERROR(Status) && Zeroed ? 0 : 1;
+}
+
+int main(int Argc, char **Argv) {
+    UINT64 MiB = 1024;
+    long Aps = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+    UINTN Rounds = 3;
+    int Opt, Failed = 0;
+
+    while ((Opt = getopt(Argc, Argv, "m:j:r:")) != -1) {
+        switch (Opt) {
+        case 'm': MiB = strtoull(optarg, NULL, 0); break;
+        case 'j': Aps = strtol(optarg, NULL, 0); break;
+        case 'r': Rounds = (UINTN)strtoul(optarg, NULL, 0); break;
+        default:
+            fprintf(stderr, "usage: %s [-m MiB] [-j APs] [-r ROUNDS]\n", Argv[0]);
+            return 2;
+        }
+    }
+    if (MiB < 128) MiB = 128;
+    if (Rounds == 0) Rounds = 1;
+    if (Aps < 0) Aps = 0;
+
+    UINT64 Bytes = MiB << 20;
+    UINT8 *Buf = mmap(NULL, Bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (Buf == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    Tsc_Calibrate();
+
+    printf("one core, best of %lu, GB/s   %6llu MiB trial %6lu MiB\n", (unsigned long)Rounds,
+           ZERO_TRIAL_BYTES >> 20, (unsigned long)MiB);
+    double Trial[STRATEGY_COUNT], Large[STRATEGY_COUNT];
+    for (UINTN i = 0; i < STRATEGY_COUNT; ++i) {
+        Trial[i] = BestGbPerSec(&gStrategies[i], Buf, ZERO_TRIAL_BYTES, ZERO_EVICT_BYTES, Rounds * 4);
+        Large[i] = BestGbPerSec(&gStrategies[i], Buf, Bytes, 0, Rounds);
+        printf("  %-30s %10.2f %10.2f\n", gStrategies[i].Name, Trial[i], Large[i]);
+    }
+    // Phase 105 times ERMS against non-temporal stores on one trial-sized run each.
+    BOOLEAN TrialErms = Trial[1] > Trial[2], LargeErms = Large[1] > Large[2];
+    printf("  trial picks %s, whole buffer favours %s\n",
+           TrialErms ? "ERMS" : "non-temporal", LargeErms ? "ERMS" : "non-temporal");
+
+    printf("memory mind, phase 105 over %lu MiB in 3 regions\n", (unsigned long)MiB);
+    BuildRegions(Buf, Bytes);
+    Failed += RunMemoryMind("BSP only", Buf, Bytes);
+    if (Aps > 0 && !EFI_ERROR(ApPool_Start(0, (UINTN)Aps))) {
+        char Label[32];
+        snprintf(Label, sizeof(Label), "BSP + %lu APs", (unsigned long)ApPool_Count());
+        Failed += RunMemoryMind(Label, Buf, Bytes);
+    }
+    munmap(Buf, Bytes);
+    return Failed ? 1 : 0;
+}